@@ -0,0 +1,787 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/* Completion queues: the async calls deliver into a queue instead of calling
+   back, and the application reaps the queue from its own thread, woken
+   through a descriptor it can poll. */
+
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+
+#include "glfs-internal.h"
+#include "glfs-mem-types.h"
+#include "syncop.h"
+#include "glfs.h"
+#include "glfs-handles.h"
+
+#ifdef GF_LINUX_HOST_OS
+#include <sys/eventfd.h>
+#endif
+
+struct glfs_cq {
+        struct glfs       *fs;
+        pthread_mutex_t    lock;
+        pthread_cond_t     cond;
+        struct list_head   done;     /* completed ops, oldest first */
+        int                ndone;
+        int                pending;  /* submitted, not completed yet */
+        int                waiters;
+        int                signalled;
+        int                fd[2];    /* the eventfd twice, or a pipe */
+};
+
+struct glfs_cq_op {
+        struct list_head   list;
+        struct glfs_cq    *cq;
+        glusterfs_fop_t    op;
+        struct glfs_fd    *glfd;
+        char              *path;
+        int                flags;
+        mode_t             mode;
+        struct stat       *stat;
+        struct dirent     *entry;
+        struct glfs_cqe    cqe;
+};
+
+
+static int
+glfs_cq_notify_init (struct glfs_cq *cq)
+{
+#ifdef GF_LINUX_HOST_OS
+        cq->fd[0] = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (cq->fd[0] == -1)
+                return -1;
+        cq->fd[1] = cq->fd[0];
+#else
+        if (pipe (cq->fd))
+                return -1;
+        fcntl (cq->fd[0], F_SETFL, O_NONBLOCK);
+        fcntl (cq->fd[1], F_SETFL, O_NONBLOCK);
+        fcntl (cq->fd[0], F_SETFD, FD_CLOEXEC);
+        fcntl (cq->fd[1], F_SETFD, FD_CLOEXEC);
+#endif
+        return 0;
+}
+
+
+static void
+glfs_cq_notify_fini (struct glfs_cq *cq)
+{
+        close (cq->fd[0]);
+        if (cq->fd[1] != cq->fd[0])
+                close (cq->fd[1]);
+}
+
+
+/* The descriptor is written once when the done list turns non-empty, and
+   drained when a reap empties it. Both happen under cq->lock. */
+static void
+__glfs_cq_signal (struct glfs_cq *cq)
+{
+        uint64_t one = 1;
+        ssize_t  ret = 0;
+
+        if (cq->signalled)
+                return;
+
+#ifdef GF_LINUX_HOST_OS
+        ret = write (cq->fd[1], &one, sizeof (one));
+#else
+        ret = write (cq->fd[1], &one, 1);
+#endif
+        if (ret < 0 && errno != EAGAIN)
+                gf_log (THIS->name, GF_LOG_WARNING,
+                        "completion queue notify failed (%s)",
+                        strerror (errno));
+
+        cq->signalled = 1;
+}
+
+
+static void
+__glfs_cq_drain (struct glfs_cq *cq)
+{
+        char buf[64];
+
+        if (!cq->signalled)
+                return;
+
+        while (read (cq->fd[0], buf, sizeof (buf)) > 0)
+                ;
+
+        cq->signalled = 0;
+}
+
+
+glfs_cq_t *
+glfs_cq_new (struct glfs *fs)
+{
+        struct glfs_cq *cq = NULL;
+
+        if (!fs) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        __glfs_entry_fs (fs);
+
+        cq = GF_CALLOC (1, sizeof (*cq), glfs_mt_cq_t);
+        if (!cq) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        if (glfs_cq_notify_init (cq)) {
+                GF_FREE (cq);
+                return NULL;
+        }
+
+        cq->fs = fs;
+        pthread_mutex_init (&cq->lock, NULL);
+        pthread_cond_init (&cq->cond, NULL);
+        INIT_LIST_HEAD (&cq->done);
+
+        return cq;
+}
+
+
+int
+glfs_cq_fd (struct glfs_cq *cq)
+{
+        if (!cq) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        return cq->fd[0];
+}
+
+
+static struct glfs_cq_op *
+glfs_cq_op_new (struct glfs_cq *cq, glusterfs_fop_t fop, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        if (!cq) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        __glfs_entry_fs (cq->fs);
+
+        op = GF_CALLOC (1, sizeof (*op), glfs_mt_cq_op_t);
+        if (!op) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        INIT_LIST_HEAD (&op->list);
+        op->cq = cq;
+        op->op = fop;
+        op->cqe.data = data;
+
+        pthread_mutex_lock (&cq->lock);
+        {
+                cq->pending++;
+        }
+        pthread_mutex_unlock (&cq->lock);
+
+        return op;
+}
+
+
+static void
+glfs_cq_op_free (struct glfs_cq_op *op)
+{
+        GF_FREE (op->path);
+        GF_FREE (op);
+}
+
+
+/* For ops that could not be submitted, which complete nothing */
+static int
+glfs_cq_op_abort (struct glfs_cq_op *op)
+{
+        struct glfs_cq *cq = op->cq;
+        int             op_errno = errno;
+
+        pthread_mutex_lock (&cq->lock);
+        {
+                cq->pending--;
+                if (cq->waiters)
+                        pthread_cond_broadcast (&cq->cond);
+        }
+        pthread_mutex_unlock (&cq->lock);
+
+        glfs_cq_op_free (op);
+
+        errno = op_errno;
+
+        return -1;
+}
+
+
+static void
+glfs_cq_op_done (struct glfs_cq_op *op, ssize_t ret, int op_errno)
+{
+        struct glfs_cq *cq = op->cq;
+
+        op->cqe.ret = ret;
+        op->cqe.op_errno = (ret < 0) ? op_errno : 0;
+
+        pthread_mutex_lock (&cq->lock);
+        {
+                list_add_tail (&op->list, &cq->done);
+                cq->ndone++;
+                cq->pending--;
+
+                __glfs_cq_signal (cq);
+                if (cq->waiters)
+                        pthread_cond_broadcast (&cq->cond);
+        }
+        pthread_mutex_unlock (&cq->lock);
+}
+
+
+int
+glfs_cq_reap (struct glfs_cq *cq, struct glfs_cqe *cqe, int max, int min,
+              const struct timespec *timeout)
+{
+        struct glfs_cq_op *op = NULL;
+        struct glfs_cq_op *tmp = NULL;
+        struct timespec    deadline = {0, };
+        struct list_head   reaped;
+        int                count = 0;
+        int                ret = 0;
+
+        if (!cq || !cqe || max < 1 || min < 0 || min > max) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        if (timeout) {
+                clock_gettime (CLOCK_REALTIME, &deadline);
+                deadline.tv_sec += timeout->tv_sec;
+                deadline.tv_nsec += timeout->tv_nsec;
+                if (deadline.tv_nsec >= 1000000000) {
+                        deadline.tv_sec++;
+                        deadline.tv_nsec -= 1000000000;
+                }
+        }
+
+        INIT_LIST_HEAD (&reaped);
+
+        pthread_mutex_lock (&cq->lock);
+        {
+                while (cq->ndone < min && cq->pending) {
+                        cq->waiters++;
+                        if (timeout)
+                                ret = pthread_cond_timedwait (&cq->cond,
+                                                              &cq->lock,
+                                                              &deadline);
+                        else
+                                ret = pthread_cond_wait (&cq->cond,
+                                                         &cq->lock);
+                        cq->waiters--;
+                        if (ret == ETIMEDOUT)
+                                break;
+                }
+
+                list_for_each_entry_safe (op, tmp, &cq->done, list) {
+                        if (count == max)
+                                break;
+                        cqe[count++] = op->cqe;
+                        list_move_tail (&op->list, &reaped);
+                }
+                cq->ndone -= count;
+
+                if (list_empty (&cq->done))
+                        __glfs_cq_drain (cq);
+        }
+        pthread_mutex_unlock (&cq->lock);
+
+        list_for_each_entry_safe (op, tmp, &reaped, list) {
+                list_del_init (&op->list);
+                glfs_cq_op_free (op);
+        }
+
+        return count;
+}
+
+
+int
+glfs_cq_destroy (struct glfs_cq *cq)
+{
+        struct glfs_cq_op *op = NULL;
+        struct glfs_cq_op *tmp = NULL;
+        int                busy = 0;
+
+        if (!cq) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        pthread_mutex_lock (&cq->lock);
+        {
+                busy = cq->pending;
+        }
+        pthread_mutex_unlock (&cq->lock);
+
+        if (busy) {
+                errno = EBUSY;
+                return -1;
+        }
+
+        __glfs_entry_fs (cq->fs);
+
+        list_for_each_entry_safe (op, tmp, &cq->done, list) {
+                list_del_init (&op->list);
+                if (op->cqe.fd)
+                        glfs_close (op->cqe.fd);
+                if (op->cqe.object)
+                        glfs_h_close (op->cqe.object);
+                glfs_cq_op_free (op);
+        }
+
+        glfs_cq_notify_fini (cq);
+        pthread_cond_destroy (&cq->cond);
+        pthread_mutex_destroy (&cq->lock);
+        GF_FREE (cq);
+
+        return 0;
+}
+
+
+/* The I/O calls go through the existing _async calls */
+
+static void
+glfs_cq_io_cbk (struct glfs_fd *glfd, ssize_t ret, void *data)
+{
+        glfs_cq_op_done (data, ret, errno);
+}
+
+
+int
+glfs_cq_preadv (struct glfs_cq *cq, struct glfs_fd *glfd,
+                const struct iovec *iov, int iovcnt, off_t offset, int flags,
+                void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_READ, data);
+        if (!op)
+                return -1;
+
+        if (glfs_preadv_async (glfd, iov, iovcnt, offset, flags,
+                               glfs_cq_io_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_pwritev (struct glfs_cq *cq, struct glfs_fd *glfd,
+                 const struct iovec *iov, int iovcnt, off_t offset, int flags,
+                 void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_WRITE, data);
+        if (!op)
+                return -1;
+
+        if (glfs_pwritev_async (glfd, iov, iovcnt, offset, flags,
+                                glfs_cq_io_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_fsync (struct glfs_cq *cq, struct glfs_fd *glfd, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_FSYNC, data);
+        if (!op)
+                return -1;
+
+        if (glfs_fsync_async (glfd, glfs_cq_io_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_fdatasync (struct glfs_cq *cq, struct glfs_fd *glfd, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_FSYNC, data);
+        if (!op)
+                return -1;
+
+        if (glfs_fdatasync_async (glfd, glfs_cq_io_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_discard (struct glfs_cq *cq, struct glfs_fd *glfd, off_t offset,
+                 size_t len, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_DISCARD, data);
+        if (!op)
+                return -1;
+
+        if (glfs_discard_async (glfd, offset, len, glfs_cq_io_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_zerofill (struct glfs_cq *cq, struct glfs_fd *glfd, off_t offset,
+                  off_t len, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_ZEROFILL, data);
+        if (!op)
+                return -1;
+
+        if (glfs_zerofill_async (glfd, offset, len, glfs_cq_io_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+/* The metadata calls have no _async counterparts; they run the synchronous
+   call in a synctask, so that the caller does not block on the resolution
+   and the syncops underneath. */
+
+static int
+glfs_cq_task (void *data)
+{
+        struct glfs_cq_op *op = data;
+        struct dirent     *res = NULL;
+        ssize_t            ret = -1;
+
+        switch (op->op) {
+        case GF_FOP_STAT:
+                ret = glfs_stat (op->cq->fs, op->path, op->stat);
+                break;
+        case GF_FOP_FSTAT:
+                ret = glfs_fstat (op->glfd, op->stat);
+                break;
+        case GF_FOP_LOOKUP:
+                ret = glfs_lstat (op->cq->fs, op->path, op->stat);
+                break;
+        case GF_FOP_OPEN:
+                op->cqe.fd = glfs_open (op->cq->fs, op->path, op->flags);
+                ret = op->cqe.fd ? 0 : -1;
+                break;
+        case GF_FOP_CREATE:
+                op->cqe.fd = glfs_creat (op->cq->fs, op->path, op->flags,
+                                         op->mode);
+                ret = op->cqe.fd ? 0 : -1;
+                break;
+        case GF_FOP_READDIR:
+                ret = glfs_readdir_r (op->glfd, op->entry, &res);
+                if (ret == 0)
+                        ret = res ? 1 : 0;
+                break;
+        default:
+                errno = EINVAL;
+                break;
+        }
+
+        op->cqe.ret = ret;
+        op->cqe.op_errno = (ret < 0) ? errno : 0;
+
+        return 0;
+}
+
+
+static int
+glfs_cq_task_done (int ret, call_frame_t *frame, void *data)
+{
+        struct glfs_cq_op *op = data;
+
+        glfs_cq_op_done (op, op->cqe.ret, op->cqe.op_errno);
+
+        return 0;
+}
+
+
+static int
+glfs_cq_task_submit (struct glfs_cq_op *op)
+{
+        if (synctask_new (op->cq->fs->ctx->env, glfs_cq_task,
+                          glfs_cq_task_done, NULL, op)) {
+                errno = ENOMEM;
+                return glfs_cq_op_abort (op);
+        }
+
+        return 0;
+}
+
+
+static int
+glfs_cq_path_op (struct glfs_cq *cq, glusterfs_fop_t fop, const char *path,
+                 struct stat *buf, int flags, mode_t mode, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        if (!path) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        op = glfs_cq_op_new (cq, fop, data);
+        if (!op)
+                return -1;
+
+        op->path = gf_strdup (path);
+        if (!op->path) {
+                errno = ENOMEM;
+                return glfs_cq_op_abort (op);
+        }
+        op->stat = buf;
+        op->flags = flags;
+        op->mode = mode;
+
+        return glfs_cq_task_submit (op);
+}
+
+
+int
+glfs_cq_stat (struct glfs_cq *cq, const char *path, struct stat *buf,
+              void *data)
+{
+        return glfs_cq_path_op (cq, GF_FOP_STAT, path, buf, 0, 0, data);
+}
+
+
+int
+glfs_cq_lstat (struct glfs_cq *cq, const char *path, struct stat *buf,
+               void *data)
+{
+        return glfs_cq_path_op (cq, GF_FOP_LOOKUP, path, buf, 0, 0, data);
+}
+
+
+int
+glfs_cq_open (struct glfs_cq *cq, const char *path, int flags, void *data)
+{
+        return glfs_cq_path_op (cq, GF_FOP_OPEN, path, NULL, flags, 0, data);
+}
+
+
+int
+glfs_cq_creat (struct glfs_cq *cq, const char *path, int flags, mode_t mode,
+               void *data)
+{
+        return glfs_cq_path_op (cq, GF_FOP_CREATE, path, NULL, flags, mode,
+                                data);
+}
+
+
+int
+glfs_cq_fstat (struct glfs_cq *cq, struct glfs_fd *glfd, struct stat *buf,
+               void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        if (!glfd) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        op = glfs_cq_op_new (cq, GF_FOP_FSTAT, data);
+        if (!op)
+                return -1;
+
+        op->glfd = glfd;
+        op->stat = buf;
+
+        return glfs_cq_task_submit (op);
+}
+
+
+int
+glfs_cq_readdir (struct glfs_cq *cq, struct glfs_fd *glfd,
+                 struct dirent *entry, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        if (!glfd || !entry) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        op = glfs_cq_op_new (cq, GF_FOP_READDIR, data);
+        if (!op)
+                return -1;
+
+        op->glfd = glfd;
+        op->entry = entry;
+
+        return glfs_cq_task_submit (op);
+}
+
+
+/* The object calls go through the glfs_h_*_async calls */
+
+static void
+glfs_cq_h_cbk (struct glfs_object *object, ssize_t ret, void *data)
+{
+        struct glfs_cq_op *op = data;
+
+        if (op->op == GF_FOP_LOOKUP)
+                op->cqe.object = object;
+
+        glfs_cq_op_done (op, ret, errno);
+}
+
+
+int
+glfs_cq_h_lookupat (struct glfs_cq *cq, struct glfs_object *parent,
+                    const char *path, struct stat *stat, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_LOOKUP, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_lookupat_async (cq->fs, parent, path, stat, glfs_cq_h_cbk,
+                                   op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_h_stat (struct glfs_cq *cq, struct glfs_object *object,
+                struct stat *stat, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_STAT, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_stat_async (cq->fs, object, stat, glfs_cq_h_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_h_getattrs (struct glfs_cq *cq, struct glfs_object *object,
+                    struct stat *stat, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_STAT, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_getattrs_async (cq->fs, object, stat, glfs_cq_h_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_h_setattrs (struct glfs_cq *cq, struct glfs_object *object,
+                    struct stat *sb, int valid, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_SETATTR, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_setattrs_async (cq->fs, object, sb, valid, glfs_cq_h_cbk,
+                                   op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_h_getxattrs (struct glfs_cq *cq, struct glfs_object *object,
+                     const char *name, void *value, size_t size, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_GETXATTR, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_getxattrs_async (cq->fs, object, name, value, size,
+                                    glfs_cq_h_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_h_setxattrs (struct glfs_cq *cq, struct glfs_object *object,
+                     const char *name, const void *value, size_t size,
+                     int flags, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_SETXATTR, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_setxattrs_async (cq->fs, object, name, value, size, flags,
+                                    glfs_cq_h_cbk, op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
+
+
+int
+glfs_cq_h_removexattrs (struct glfs_cq *cq, struct glfs_object *object,
+                        const char *name, void *data)
+{
+        struct glfs_cq_op *op = NULL;
+
+        op = glfs_cq_op_new (cq, GF_FOP_REMOVEXATTR, data);
+        if (!op)
+                return -1;
+
+        if (glfs_h_removexattrs_async (cq->fs, object, name, glfs_cq_h_cbk,
+                                       op))
+                return glfs_cq_op_abort (op);
+
+        return 0;
+}
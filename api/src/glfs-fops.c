@@ -566,6 +566,7 @@ struct glfs_io {
 	int                  count;
 	int                  flags;
 	glfs_io_cbk          fn;
+	glfs_zc_cbk          zc_fn;
 	void                *data;
 };
 
@@ -779,6 +780,240 @@ glfs_readv_async (struct glfs_fd *glfd, const struct iovec *iov, int count,
 	return ret;
 }
 
+///// zero-copy readv /////
+
+/* Takes over @iov and a ref of @iobref. The regions are trimmed to the
+   @size bytes that were read. */
+static glfs_zcbuf_t *
+glfs_zcbuf_new (struct iovec *iov, int count, size_t size,
+		struct iobref *iobref)
+{
+	glfs_zcbuf_t *buf = NULL;
+	int           i = 0;
+
+	buf = GF_CALLOC (1, sizeof (*buf), glfs_mt_zcbuf_t);
+	if (!buf)
+		return NULL;
+
+	for (i = 0; i < count; i++) {
+		if (iov[i].iov_len > size)
+			iov[i].iov_len = size;
+		size -= iov[i].iov_len;
+	}
+
+	buf->iov = iov;
+	buf->count = count;
+	if (iobref)
+		buf->iobref = iobref_ref (iobref);
+
+	return buf;
+}
+
+
+int
+glfs_zcbuf_iovec (glfs_zcbuf_t *buf, const struct iovec **iov)
+{
+	if (!buf || !iov) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*iov = buf->iov;
+
+	return buf->count;
+}
+
+
+void
+glfs_zcbuf_release (glfs_zcbuf_t *buf)
+{
+	if (!buf)
+		return;
+
+	GF_FREE (buf->iov);
+	if (buf->iobref)
+		iobref_unref (buf->iobref);
+	GF_FREE (buf);
+}
+
+
+ssize_t
+glfs_preadv_zc (struct glfs_fd *glfd, size_t size, off_t offset, int flags,
+		glfs_zcbuf_t **buf)
+{
+	xlator_t       *subvol = NULL;
+	ssize_t         ret = -1;
+	struct iovec   *iov = NULL;
+	int             cnt = 0;
+	struct iobref  *iobref = NULL;
+	fd_t           *fd = NULL;
+
+	if (!buf) {
+		errno = EINVAL;
+		return -1;
+	}
+	*buf = NULL;
+
+	__glfs_entry_fd (glfd);
+
+	subvol = glfs_active_subvol (glfd->fs);
+	if (!subvol) {
+		ret = -1;
+		errno = EIO;
+		goto out;
+	}
+
+	fd = glfs_resolve_fd (glfd->fs, subvol, glfd);
+	if (!fd) {
+		ret = -1;
+		errno = EBADFD;
+		goto out;
+	}
+
+	ret = syncop_readv (subvol, fd, size, offset, 0, &iov, &cnt, &iobref);
+        DECODE_SYNCOP_ERR (ret);
+	if (ret <= 0)
+		goto out;
+
+	*buf = glfs_zcbuf_new (iov, cnt, ret, iobref);
+	if (!*buf) {
+		ret = -1;
+		errno = ENOMEM;
+		goto out;
+	}
+	iov = NULL;
+
+	glfd->offset = (offset + ret);
+out:
+        if (iov)
+                GF_FREE (iov);
+        if (iobref)
+                iobref_unref (iobref);
+
+	if (fd)
+		fd_unref (fd);
+
+	glfs_subvol_done (glfd->fs, subvol);
+
+	return ret;
+}
+
+
+int
+glfs_preadv_zc_async_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+			  int op_ret, int op_errno, struct iovec *iovec,
+			  int count, struct iatt *stbuf, struct iobref *iobref,
+			  dict_t *xdata)
+{
+	struct glfs_io *gio = NULL;
+	xlator_t       *subvol = NULL;
+	struct glfs    *fs = NULL;
+	struct glfs_fd *glfd = NULL;
+	struct iovec   *iov = NULL;
+	glfs_zcbuf_t   *buf = NULL;
+
+	gio = frame->local;
+	frame->local = NULL;
+	subvol = cookie;
+	glfd = gio->glfd;
+	fs = glfd->fs;
+
+	if (op_ret <= 0)
+		goto out;
+
+	iov = iov_dup (iovec, count);
+	if (iov)
+		buf = glfs_zcbuf_new (iov, count, op_ret, iobref);
+	if (!buf) {
+		GF_FREE (iov);
+		op_ret = -1;
+		op_errno = ENOMEM;
+		goto out;
+	}
+
+	glfd->offset = gio->offset + op_ret;
+out:
+	errno = op_errno;
+	gio->zc_fn (gio->glfd, op_ret, buf, gio->data);
+
+	GF_FREE (gio);
+	STACK_DESTROY (frame->root);
+	glfs_subvol_done (fs, subvol);
+
+	return 0;
+}
+
+
+int
+glfs_preadv_zc_async (struct glfs_fd *glfd, size_t size, off_t offset,
+		      int flags, glfs_zc_cbk fn, void *data)
+{
+	struct glfs_io *gio = NULL;
+	int             ret = 0;
+	call_frame_t   *frame = NULL;
+	xlator_t       *subvol = NULL;
+	glfs_t         *fs = NULL;
+	fd_t           *fd = NULL;
+
+	__glfs_entry_fd (glfd);
+
+	subvol = glfs_active_subvol (glfd->fs);
+	if (!subvol) {
+		ret = -1;
+		errno = EIO;
+		goto out;
+	}
+
+	fd = glfs_resolve_fd (glfd->fs, subvol, glfd);
+	if (!fd) {
+		ret = -1;
+		errno = EBADFD;
+		goto out;
+	}
+
+	fs = glfd->fs;
+
+	frame = syncop_create_frame (THIS);
+	if (!frame) {
+		ret = -1;
+		errno = ENOMEM;
+		goto out;
+	}
+
+	gio = GF_CALLOC (1, sizeof (*gio), glfs_mt_glfs_io_t);
+	if (!gio) {
+		ret = -1;
+		errno = ENOMEM;
+		goto out;
+	}
+
+	gio->op     = GF_FOP_READ;
+	gio->glfd   = glfd;
+	gio->offset = offset;
+	gio->flags  = flags;
+	gio->zc_fn  = fn;
+	gio->data   = data;
+
+	frame->local = gio;
+
+	STACK_WIND_COOKIE (frame, glfs_preadv_zc_async_cbk, subvol, subvol,
+			   subvol->fops->readv, fd, size, offset, flags, NULL);
+
+out:
+        if (ret) {
+                GF_FREE (gio);
+                if (frame) {
+                        STACK_DESTROY (frame->root);
+                }
+		glfs_subvol_done (fs, subvol);
+	}
+
+	if (fd)
+		fd_unref (fd);
+
+	return ret;
+}
+
 ///// writev /////
 
 ssize_t
@@ -989,6 +1224,130 @@ glfs_writev_async (struct glfs_fd *glfd, const struct iovec *iov, int count,
 	return ret;
 }
 
+///// zero-copy writev /////
+
+/* Caller's regions of a zero-copy write. The call holds one ref and every
+   iobuf wrapping a region holds one. */
+struct glfs_zcref {
+	int                ref;
+	glfs_zc_release_t  release;
+	void              *data;
+};
+
+
+static void
+glfs_zcref_unref (struct glfs_zcref *zc)
+{
+	if (__sync_sub_and_fetch (&zc->ref, 1))
+		return;
+
+	zc->release (zc->data);
+	GF_FREE (zc);
+}
+
+
+static void
+glfs_zcref_iobuf_free (void *ptr, void *data)
+{
+	glfs_zcref_unref (data);
+}
+
+
+ssize_t
+glfs_pwritev_zc (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
+		 off_t offset, int flags, glfs_zc_release_t release,
+		 void *data)
+{
+	xlator_t          *subvol = NULL;
+	int                ret = -1;
+	size_t             size = -1;
+	struct iobref     *iobref = NULL;
+	struct iobuf      *iobuf = NULL;
+	struct glfs_zcref *zc = NULL;
+	fd_t              *fd = NULL;
+	int                i = 0;
+
+	if (!release) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	__glfs_entry_fd (glfd);
+
+	zc = GF_CALLOC (1, sizeof (*zc), glfs_mt_zcref_t);
+	if (!zc) {
+		release (data);
+		errno = ENOMEM;
+		return -1;
+	}
+	zc->ref = 1;
+	zc->release = release;
+	zc->data = data;
+
+	subvol = glfs_active_subvol (glfd->fs);
+	if (!subvol) {
+		ret = -1;
+		errno = EIO;
+		goto out;
+	}
+
+	fd = glfs_resolve_fd (glfd->fs, subvol, glfd);
+	if (!fd) {
+		ret = -1;
+		errno = EBADFD;
+		goto out;
+	}
+
+	iobref = iobref_new ();
+	if (!iobref) {
+		ret = -1;
+		errno = ENOMEM;
+		goto out;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		iobuf = iobuf_wrap (subvol->ctx->iobuf_pool,
+				    iovec[i].iov_base, glfs_zcref_iobuf_free,
+				    zc);
+		if (!iobuf) {
+			ret = -1;
+			errno = ENOMEM;
+			goto out;
+		}
+		__sync_fetch_and_add (&zc->ref, 1);
+
+		ret = iobref_add (iobref, iobuf);
+		iobuf_unref (iobuf);
+		if (ret) {
+			ret = -1;
+			errno = ENOMEM;
+			goto out;
+		}
+	}
+
+	size = iov_length (iovec, iovcnt);
+
+	ret = syncop_writev (subvol, fd, iovec, iovcnt, offset, iobref, flags);
+        DECODE_SYNCOP_ERR (ret);
+
+	if (ret <= 0)
+		goto out;
+
+	glfd->offset = (offset + size);
+
+out:
+	if (iobref)
+		iobref_unref (iobref);
+	glfs_zcref_unref (zc);
+
+	if (fd)
+		fd_unref (fd);
+
+	glfs_subvol_done (glfd->fs, subvol);
+
+	return ret;
+}
+
 
 int
 glfs_fsync (struct glfs_fd *glfd)
@@ -1525,3 +1525,461 @@ out:
 
         return ret;
 }
+
+/* Asynchronous object operations: the fop is wound and @fn called from its
+   callback, so nothing waits in a syncop. The inode of @object only needs
+   a (synchronous) refresh after a graph switch. */
+
+struct glfs_h_async {
+        struct glfs             *fs;
+        xlator_t                *subvol;
+        struct glfs_object      *object;
+        loc_t                    loc;
+        struct stat             *stat;
+        void                    *value;
+        size_t                   size;
+        char                    *name;
+        glfs_h_cbk               fn;
+        void                    *data;
+};
+
+static struct glfs_h_async *
+glfs_h_async_new (struct glfs *fs, struct glfs_object *object,
+                  glfs_h_cbk fn, void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        inode_t                 *inode = NULL;
+        int                      ret = -1;
+
+        /* validate in args */
+        if ((fs == NULL) || (fn == NULL)) {
+                errno = EINVAL;
+                return NULL;
+        }
+
+        __glfs_entry_fs (fs);
+
+        ha = GF_CALLOC (1, sizeof (*ha), glfs_mt_h_async_t);
+        if (!ha) {
+                errno = ENOMEM;
+                return NULL;
+        }
+
+        ha->fs = fs;
+        ha->object = object;
+        ha->fn = fn;
+        ha->data = data;
+
+        /* get the active volume */
+        ha->subvol = glfs_active_subvol (fs);
+        if (!ha->subvol) {
+                errno = EIO;
+                goto out;
+        }
+
+        if (!object)
+                return ha;
+
+        /* get/refresh the in arg objects inode in correlation to the xlator */
+        inode = glfs_resolve_inode (fs, ha->subvol, object);
+        if (!inode) {
+                errno = ESTALE;
+                goto out;
+        }
+
+        /* populate loc */
+        GLFS_LOC_FILL_INODE (inode, ha->loc, out);
+
+        inode_unref (inode);
+
+        return ha;
+out:
+        if (inode)
+                inode_unref (inode);
+
+        glfs_subvol_done (fs, ha->subvol);
+        loc_wipe (&ha->loc);
+        GF_FREE (ha);
+
+        return NULL;
+}
+
+static void
+glfs_h_async_free (struct glfs_h_async *ha)
+{
+        loc_wipe (&ha->loc);
+
+        glfs_subvol_done (ha->fs, ha->subvol);
+
+        GF_FREE (ha->name);
+        GF_FREE (ha);
+}
+
+static void
+glfs_h_async_done (struct glfs_h_async *ha, struct glfs_object *object,
+                   ssize_t ret, int op_errno)
+{
+        errno = op_errno;
+        ha->fn (object, ret, ha->data);
+
+        glfs_h_async_free (ha);
+}
+
+static call_frame_t *
+glfs_h_async_frame (struct glfs_h_async *ha)
+{
+        call_frame_t            *frame = NULL;
+
+        frame = syncop_create_frame (THIS);
+        if (!frame) {
+                glfs_h_async_free (ha);
+                errno = ENOMEM;
+        }
+
+        return frame;
+}
+
+static void
+glfs_h_lookupat_resolved (loc_t *loc, struct iatt *iatt, int op_ret,
+                          int op_errno, void *data)
+{
+        struct glfs_h_async     *ha = data;
+        struct glfs_object      *object = NULL;
+
+        if (op_ret == 0) {
+                if (ha->stat)
+                        glfs_iatt_to_stat (ha->fs, iatt, ha->stat);
+
+                op_ret = glfs_create_object (loc, &object);
+                if (op_ret)
+                        op_errno = errno;
+        }
+
+        glfs_h_async_done (ha, object, op_ret, op_errno);
+}
+
+int
+glfs_h_lookupat_async (struct glfs *fs, struct glfs_object *parent,
+                       const char *path, struct stat *stat, glfs_h_cbk fn,
+                       void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        inode_t                 *inode = NULL;
+        int                      ret = -1;
+
+        if (path == NULL) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, NULL, fn, data);
+        if (!ha)
+                return -1;
+
+        ha->stat = stat;
+
+        if (parent) {
+                inode = glfs_resolve_inode (fs, ha->subvol, parent);
+                if (!inode) {
+                        glfs_h_async_free (ha);
+                        errno = ESTALE;
+                        return -1;
+                }
+        }
+
+        ret = glfs_resolve_at_async (fs, ha->subvol, inode, path,
+                                     glfs_h_lookupat_resolved, ha);
+        if (ret)
+                glfs_h_async_free (ha);
+
+        if (inode)
+                inode_unref (inode);
+
+        return ret;
+}
+
+static int
+glfs_h_async_stat_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                       int op_ret, int op_errno, struct iatt *buf,
+                       dict_t *xdata)
+{
+        struct glfs_h_async     *ha = cookie;
+
+        if (op_ret == 0 && ha->stat)
+                glfs_iatt_to_stat (ha->fs, buf, ha->stat);
+
+        STACK_DESTROY (frame->root);
+
+        glfs_h_async_done (ha, ha->object, op_ret, op_errno);
+
+        return 0;
+}
+
+int
+glfs_h_stat_async (struct glfs *fs, struct glfs_object *object,
+                   struct stat *stat, glfs_h_cbk fn, void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        call_frame_t            *frame = NULL;
+
+        if (object == NULL) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, object, fn, data);
+        if (!ha)
+                return -1;
+
+        ha->stat = stat;
+
+        frame = glfs_h_async_frame (ha);
+        if (!frame)
+                return -1;
+
+        STACK_WIND_COOKIE (frame, glfs_h_async_stat_cbk, ha, ha->subvol,
+                           ha->subvol->fops->stat, &ha->loc, NULL);
+
+        return 0;
+}
+
+static int
+glfs_h_async_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                         int op_ret, int op_errno, inode_t *inode,
+                         struct iatt *buf, dict_t *xdata,
+                         struct iatt *postparent)
+{
+        return glfs_h_async_stat_cbk (frame, cookie, this, op_ret, op_errno,
+                                      buf, xdata);
+}
+
+int
+glfs_h_getattrs_async (struct glfs *fs, struct glfs_object *object,
+                       struct stat *stat, glfs_h_cbk fn, void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        call_frame_t            *frame = NULL;
+
+        if (object == NULL) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, object, fn, data);
+        if (!ha)
+                return -1;
+
+        ha->stat = stat;
+
+        frame = glfs_h_async_frame (ha);
+        if (!frame)
+                return -1;
+
+        STACK_WIND_COOKIE (frame, glfs_h_async_lookup_cbk, ha, ha->subvol,
+                           ha->subvol->fops->lookup, &ha->loc, NULL);
+
+        return 0;
+}
+
+static int
+glfs_h_async_setattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                          int op_ret, int op_errno, struct iatt *preop,
+                          struct iatt *postop, dict_t *xdata)
+{
+        struct glfs_h_async     *ha = cookie;
+
+        STACK_DESTROY (frame->root);
+
+        glfs_h_async_done (ha, ha->object, op_ret, op_errno);
+
+        return 0;
+}
+
+int
+glfs_h_setattrs_async (struct glfs *fs, struct glfs_object *object,
+                       struct stat *stat, int valid, glfs_h_cbk fn,
+                       void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        call_frame_t            *frame = NULL;
+        struct iatt              iatt = {0, };
+        int                      glvalid = 0;
+
+        if ((object == NULL) || (stat == NULL)) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, object, fn, data);
+        if (!ha)
+                return -1;
+
+        /* map valid masks from in args */
+        glfs_iatt_from_stat (stat, valid, &iatt, &glvalid);
+
+        frame = glfs_h_async_frame (ha);
+        if (!frame)
+                return -1;
+
+        STACK_WIND_COOKIE (frame, glfs_h_async_setattr_cbk, ha, ha->subvol,
+                           ha->subvol->fops->setattr, &ha->loc, &iatt,
+                           glvalid, NULL);
+
+        return 0;
+}
+
+static int
+glfs_h_async_getxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                           int op_ret, int op_errno, dict_t *dict,
+                           dict_t *xdata)
+{
+        struct glfs_h_async     *ha = cookie;
+
+        STACK_DESTROY (frame->root);
+
+        if (op_ret < 0)
+                goto out;
+
+        /* the _process calls take a ref away */
+        if (dict)
+                dict_ref (dict);
+
+        /* If @name is NULL, means get all the xattrs (i.e listxattr). */
+        if (ha->name)
+                op_ret = glfs_getxattr_process (ha->value, ha->size, dict,
+                                                ha->name);
+        else
+                op_ret = glfs_listxattr_process (ha->value, ha->size, dict);
+
+        op_errno = (op_ret < 0) ? errno : 0;
+out:
+        glfs_h_async_done (ha, ha->object, op_ret, op_errno);
+
+        return 0;
+}
+
+int
+glfs_h_getxattrs_async (struct glfs *fs, struct glfs_object *object,
+                        const char *name, void *value, size_t size,
+                        glfs_h_cbk fn, void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        call_frame_t            *frame = NULL;
+
+        if (object == NULL) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, object, fn, data);
+        if (!ha)
+                return -1;
+
+        ha->value = value;
+        ha->size = size;
+        if (name) {
+                ha->name = gf_strdup (name);
+                if (!ha->name) {
+                        glfs_h_async_free (ha);
+                        errno = ENOMEM;
+                        return -1;
+                }
+        }
+
+        frame = glfs_h_async_frame (ha);
+        if (!frame)
+                return -1;
+
+        STACK_WIND_COOKIE (frame, glfs_h_async_getxattr_cbk, ha, ha->subvol,
+                           ha->subvol->fops->getxattr, &ha->loc, ha->name,
+                           NULL);
+
+        return 0;
+}
+
+static int
+glfs_h_async_xattrop_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                          int op_ret, int op_errno, dict_t *xdata)
+{
+        struct glfs_h_async     *ha = cookie;
+
+        STACK_DESTROY (frame->root);
+
+        glfs_h_async_done (ha, ha->object, op_ret, op_errno);
+
+        return 0;
+}
+
+int
+glfs_h_setxattrs_async (struct glfs *fs, struct glfs_object *object,
+                        const char *name, const void *value, size_t size,
+                        int flags, glfs_h_cbk fn, void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        call_frame_t            *frame = NULL;
+        dict_t                  *xattr = NULL;
+
+        if ((object == NULL) || (name == NULL) || (value == NULL)) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, object, fn, data);
+        if (!ha)
+                return -1;
+
+        xattr = dict_for_key_value (name, value, size);
+        if (!xattr) {
+                glfs_h_async_free (ha);
+                errno = ENOMEM;
+                return -1;
+        }
+
+        frame = glfs_h_async_frame (ha);
+        if (!frame) {
+                dict_unref (xattr);
+                return -1;
+        }
+
+        STACK_WIND_COOKIE (frame, glfs_h_async_xattrop_cbk, ha, ha->subvol,
+                           ha->subvol->fops->setxattr, &ha->loc, xattr,
+                           flags, NULL);
+
+        dict_unref (xattr);
+
+        return 0;
+}
+
+int
+glfs_h_removexattrs_async (struct glfs *fs, struct glfs_object *object,
+                           const char *name, glfs_h_cbk fn, void *data)
+{
+        struct glfs_h_async     *ha = NULL;
+        call_frame_t            *frame = NULL;
+
+        if ((object == NULL) || (name == NULL)) {
+                errno = EINVAL;
+                return -1;
+        }
+
+        ha = glfs_h_async_new (fs, object, fn, data);
+        if (!ha)
+                return -1;
+
+        ha->name = gf_strdup (name);
+        if (!ha->name) {
+                glfs_h_async_free (ha);
+                errno = ENOMEM;
+                return -1;
+        }
+
+        frame = glfs_h_async_frame (ha);
+        if (!frame)
+                return -1;
+
+        STACK_WIND_COOKIE (frame, glfs_h_async_xattrop_cbk, ha, ha->subvol,
+                           ha->subvol->fops->removexattr, &ha->loc, ha->name,
+                           NULL);
+
+        return 0;
+}
@@ -165,6 +165,80 @@ struct glfs_fd *glfs_h_open (struct glfs *fs, struct glfs_object *object,
 int
 glfs_h_access (struct glfs *fs, struct glfs_object *object, int mask) __THROW;
 
+/* Asynchronous operations on objects
+ *
+ * The glfs_h_*_async calls start the operation and return 0, or -1 with
+ * errno set when it could not be started, in which case @fn is not called.
+ * Otherwise @fn is called once, from a thread of the library and possibly
+ * before the call returned, with @ret (and errno on failure) as the
+ * synchronous call would have returned them. @object is the object looked
+ * up by glfs_h_lookupat_async (to be closed by the caller, NULL on failure),
+ * and the object operated on for the others. The buffers passed in (@stat,
+ * @value) are filled in before @fn is called.
+ *
+ * None of these block a thread while the operation is in flight: the path
+ * of glfs_h_lookupat_async is resolved by winding lookups and carrying on
+ * from their callbacks, so a single thread can keep any number of them
+ * outstanding. Only a path going through a symlink is still resolved in a
+ * synctask.
+ *
+ * The glfs_cq_h_* calls deliver the same results to a completion queue
+ * (see glfs.h), with the object of glfs_cq_h_lookupat in @object.
+ */
+typedef void (*glfs_h_cbk) (struct glfs_object *object, ssize_t ret,
+                            void *data);
+
+int glfs_h_lookupat_async (struct glfs *fs, struct glfs_object *parent,
+                           const char *path, struct stat *stat,
+                           glfs_h_cbk fn, void *data) __THROW;
+
+int glfs_h_stat_async (struct glfs *fs, struct glfs_object *object,
+                       struct stat *stat, glfs_h_cbk fn, void *data) __THROW;
+
+int glfs_h_getattrs_async (struct glfs *fs, struct glfs_object *object,
+                           struct stat *stat, glfs_h_cbk fn,
+                           void *data) __THROW;
+
+int glfs_h_setattrs_async (struct glfs *fs, struct glfs_object *object,
+                           struct stat *sb, int valid, glfs_h_cbk fn,
+                           void *data) __THROW;
+
+int glfs_h_getxattrs_async (struct glfs *fs, struct glfs_object *object,
+                            const char *name, void *value, size_t size,
+                            glfs_h_cbk fn, void *data) __THROW;
+
+int glfs_h_setxattrs_async (struct glfs *fs, struct glfs_object *object,
+                            const char *name, const void *value, size_t size,
+                            int flags, glfs_h_cbk fn, void *data) __THROW;
+
+int glfs_h_removexattrs_async (struct glfs *fs, struct glfs_object *object,
+                               const char *name, glfs_h_cbk fn,
+                               void *data) __THROW;
+
+int glfs_cq_h_lookupat (glfs_cq_t *cq, struct glfs_object *parent,
+                        const char *path, struct stat *stat,
+                        void *data) __THROW;
+
+int glfs_cq_h_stat (glfs_cq_t *cq, struct glfs_object *object,
+                    struct stat *stat, void *data) __THROW;
+
+int glfs_cq_h_getattrs (glfs_cq_t *cq, struct glfs_object *object,
+                        struct stat *stat, void *data) __THROW;
+
+int glfs_cq_h_setattrs (glfs_cq_t *cq, struct glfs_object *object,
+                        struct stat *sb, int valid, void *data) __THROW;
+
+int glfs_cq_h_getxattrs (glfs_cq_t *cq, struct glfs_object *object,
+                         const char *name, void *value, size_t size,
+                         void *data) __THROW;
+
+int glfs_cq_h_setxattrs (glfs_cq_t *cq, struct glfs_object *object,
+                         const char *name, const void *value, size_t size,
+                         int flags, void *data) __THROW;
+
+int glfs_cq_h_removexattrs (glfs_cq_t *cq, struct glfs_object *object,
+                            const char *name, void *data) __THROW;
+
 __END_DECLS
 
 /*pnfs implementation*/
@@ -119,6 +119,13 @@ struct glfs_fd {
 	struct dirent     *readdirbuf;
 };
 
+/* data of a zero-copy read, lent to the application */
+struct glfs_zcbuf {
+	struct iovec      *iov;
+	int                count;
+	struct iobref     *iobref;
+};
+
 /* glfs object handle introduced for the alternate gfapi implementation based
    on glfs handles/gfid/inode
 */
@@ -214,6 +221,15 @@ int glfs_resolve_base (struct glfs *fs, xlator_t *subvol, inode_t *inode,
 int glfs_resolve_at (struct glfs *fs, xlator_t *subvol, inode_t *at,
                      const char *origpath, loc_t *loc, struct iatt *iatt,
                      int follow, int reval);
+
+/* Called once an async resolution is over. On success @loc is that of the
+   resolved path, which the callee may take the inode out of. */
+typedef void (*glfs_resolve_cbk_t) (loc_t *loc, struct iatt *iatt,
+				    int op_ret, int op_errno, void *data);
+
+int glfs_resolve_at_async (struct glfs *fs, xlator_t *subvol, inode_t *at,
+			   const char *origpath, glfs_resolve_cbk_t fn,
+			   void *data);
 int glfs_loc_touchup (loc_t *loc);
 void glfs_iatt_to_stat (struct glfs *fs, struct iatt *iatt, struct stat *stat);
 int glfs_loc_link (loc_t *loc, struct iatt *iatt);
@@ -26,6 +26,12 @@ enum glfs_mem_types_ {
         glfs_mt_server_cmdline_t,
 	glfs_mt_glfs_object_t,
 	glfs_mt_readdirbuf_t,
+	glfs_mt_zcbuf_t,
+	glfs_mt_zcref_t,
+	glfs_mt_cq_t,
+	glfs_mt_cq_op_t,
+	glfs_mt_resolve_async_t,
+	glfs_mt_h_async_t,
 	glfs_mt_end
 
 };
@@ -532,6 +532,382 @@ glfs_lresolve (struct glfs *fs, xlator_t *subvol, const char *origpath,
 }
 
 
+/* Asynchronous counterpart of glfs_resolve_at (follow = 0, reval = 0, with
+   the iatt of the last component asked for). Components are walked from
+   the inode table as far as they are cached, and looked up otherwise, the
+   walk carrying on from the lookup callback. Only a symlink in the middle
+   of the path, which needs a readlink and a resolution of its own, has the
+   whole path resolved synchronously in a synctask instead. */
+
+struct glfs_resolve_async {
+	struct glfs         *fs;
+	xlator_t            *subvol;
+	char                *origpath;
+	char                *path;
+	char                *saveptr;
+	char                *component;
+	char                *next_component;
+	inode_t             *at;
+	inode_t             *parent;
+	inode_t             *inode;
+	struct iatt          iatt;
+	loc_t                loc;       /* of the lookup in flight */
+	dict_t              *xattr_req;
+	uuid_t               gfid_req;  /* xattr_req points at it */
+	int                  reval;
+	glfs_resolve_cbk_t   fn;
+	void                *data;
+};
+
+
+static void
+glfs_resolve_async_free (struct glfs_resolve_async *ra)
+{
+	loc_wipe (&ra->loc);
+
+	if (ra->xattr_req)
+		dict_unref (ra->xattr_req);
+	if (ra->at)
+		inode_unref (ra->at);
+	if (ra->parent)
+		inode_unref (ra->parent);
+	if (ra->inode)
+		inode_unref (ra->inode);
+
+	GF_FREE (ra->origpath);
+	GF_FREE (ra->path);
+	GF_FREE (ra);
+}
+
+
+static void
+glfs_resolve_async_done (struct glfs_resolve_async *ra, int op_ret,
+			 int op_errno)
+{
+	loc_t loc = {0, };
+
+	if (op_ret == 0) {
+		loc.inode = ra->inode;
+		ra->inode = NULL;
+		uuid_copy (loc.gfid, loc.inode->gfid);
+
+		if (ra->parent) {
+			loc.parent = ra->parent;
+			ra->parent = NULL;
+			uuid_copy (loc.pargfid, loc.parent->gfid);
+			loc.name = ra->component;
+		}
+
+		if (glfs_loc_touchup (&loc) < 0) {
+			op_ret = -1;
+			op_errno = ENOMEM;
+		}
+	}
+
+	ra->fn (&loc, &ra->iatt, op_ret, op_errno, ra->data);
+
+	loc_wipe (&loc);
+	glfs_resolve_async_free (ra);
+}
+
+
+static int
+glfs_resolve_async_sync (void *opaque)
+{
+	struct glfs_resolve_async *ra = opaque;
+	loc_t                      loc = {0, };
+	int                        ret = -1;
+
+	ret = glfs_resolve_at (ra->fs, ra->subvol, ra->at, ra->origpath, &loc,
+			       &ra->iatt, 0, 0);
+
+	ra->fn (&loc, &ra->iatt, ret, ret ? errno : 0, ra->data);
+
+	loc_wipe (&loc);
+
+	return 0;
+}
+
+
+static int
+glfs_resolve_async_sync_done (int ret, call_frame_t *frame, void *opaque)
+{
+	glfs_resolve_async_free (opaque);
+
+	return 0;
+}
+
+
+static int
+glfs_resolve_async_lookup_cbk (call_frame_t *frame, void *cookie,
+			       xlator_t *this, int op_ret, int op_errno,
+			       inode_t *inode, struct iatt *buf,
+			       dict_t *xdata, struct iatt *postparent);
+
+
+static void
+glfs_resolve_async_wind (struct glfs_resolve_async *ra)
+{
+	call_frame_t *frame = NULL;
+
+	frame = syncop_create_frame (THIS);
+	if (!frame) {
+		glfs_resolve_async_done (ra, -1, ENOMEM);
+		return;
+	}
+
+	STACK_WIND_COOKIE (frame, glfs_resolve_async_lookup_cbk, ra,
+			   ra->subvol, ra->subvol->fops->lookup, &ra->loc,
+			   ra->xattr_req);
+}
+
+
+static int
+glfs_resolve_async_fresh (struct glfs_resolve_async *ra)
+{
+	ra->loc.inode = inode_new (ra->parent->table);
+	if (!ra->loc.inode)
+		return -1;
+	uuid_clear (ra->loc.gfid);
+
+	if (!ra->xattr_req) {
+		ra->xattr_req = dict_new ();
+		if (!ra->xattr_req)
+			return -1;
+	}
+
+	/* the lookup is wound after we return, so the gfid must live as
+	   long as ra does */
+	uuid_generate (ra->gfid_req);
+
+	return dict_set_static_bin (ra->xattr_req, "gfid-req", ra->gfid_req,
+				    16);
+}
+
+
+/* Starts on ra->component in the directory ra->inode. Returns 1 when it was
+   found in the inode table, 0 when a lookup was wound for it, -1 on
+   error. */
+static int
+glfs_resolve_async_component (struct glfs_resolve_async *ra)
+{
+	const char *component = ra->component;
+	inode_t    *parent = NULL;
+
+	if (ra->parent)
+		inode_unref (ra->parent);
+	parent = ra->parent = ra->inode;
+	ra->inode = NULL;
+
+	loc_wipe (&ra->loc);
+	ra->loc.name = component;
+	ra->loc.parent = inode_ref (parent);
+	uuid_copy (ra->loc.pargfid, parent->gfid);
+	ra->reval = 0;
+
+	if (strcmp (component, ".") == 0) {
+		ra->loc.inode = inode_ref (parent);
+	} else if (strcmp (component, "..") == 0) {
+		if (__is_root_gfid (parent->gfid))
+			ra->loc.inode = inode_ref (parent);
+		else
+			ra->loc.inode = inode_parent (parent, 0, 0);
+	} else {
+		ra->loc.inode = inode_grep (parent->table, parent, component);
+	}
+
+	if (ra->loc.inode) {
+		uuid_copy (ra->loc.gfid, ra->loc.inode->gfid);
+		ra->reval = 1;
+
+		/* the last component is always looked up, for its iatt */
+		if (ra->next_component) {
+			ra->inode = inode_ref (ra->loc.inode);
+			inode_lookup (ra->inode);
+			ra->iatt.ia_type = ra->inode->ia_type;
+			return 1;
+		}
+	} else if (glfs_resolve_async_fresh (ra)) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	if (glfs_loc_touchup (&ra->loc) < 0)
+		return -1;
+
+	glfs_resolve_async_wind (ra);
+
+	return 0;
+}
+
+
+/* Moves on past a resolved component. Returns 1 once the resolution is
+   over (ra has been handed back or passed on), 0 to go on. */
+static int
+glfs_resolve_async_advance (struct glfs_resolve_async *ra)
+{
+	if (!ra->next_component) {
+		glfs_resolve_async_done (ra, 0, 0);
+		return 1;
+	}
+
+	if (IA_ISLNK (ra->iatt.ia_type)) {
+		if (synctask_new (ra->fs->ctx->env, glfs_resolve_async_sync,
+				  glfs_resolve_async_sync_done, NULL, ra))
+			glfs_resolve_async_done (ra, -1, ENOMEM);
+		return 1;
+	}
+
+	if (!IA_ISDIR (ra->iatt.ia_type)) {
+		glfs_resolve_async_done (ra, -1, ENOTDIR);
+		return 1;
+	}
+
+	ra->component = ra->next_component;
+	ra->next_component = strtok_r (NULL, "/", &ra->saveptr);
+
+	return 0;
+}
+
+
+static void
+glfs_resolve_async_run (struct glfs_resolve_async *ra)
+{
+	int ret = 0;
+
+	for (;;) {
+		ret = glfs_resolve_async_component (ra);
+		if (ret == 0)
+			return;
+		if (ret < 0) {
+			glfs_resolve_async_done (ra, -1, errno);
+			return;
+		}
+		if (glfs_resolve_async_advance (ra))
+			return;
+	}
+}
+
+
+static int
+glfs_resolve_async_lookup_cbk (call_frame_t *frame, void *cookie,
+			       xlator_t *this, int op_ret, int op_errno,
+			       inode_t *inode, struct iatt *buf,
+			       dict_t *xdata, struct iatt *postparent)
+{
+	struct glfs_resolve_async *ra = cookie;
+	inode_t                   *linked = NULL;
+
+	STACK_DESTROY (frame->root);
+
+	/* the path was a bare directory, looked up for its iatt */
+	if (!ra->component) {
+		if (op_ret == 0)
+			ra->iatt = *buf;
+		glfs_resolve_async_done (ra, op_ret, op_errno);
+		return 0;
+	}
+
+	if (op_ret < 0 && ra->reval) {
+		/* A stale mapping might exist for a dentry/inode that has
+		   been removed from another client. */
+		if (op_errno == ENOENT)
+			inode_unlink (ra->loc.inode, ra->loc.parent,
+				      ra->component);
+		inode_unref (ra->loc.inode);
+		ra->loc.inode = NULL;
+		ra->reval = 0;
+
+		if (glfs_resolve_async_fresh (ra)) {
+			glfs_resolve_async_done (ra, -1, ENOMEM);
+			return 0;
+		}
+
+		glfs_resolve_async_wind (ra);
+		return 0;
+	}
+
+	if (op_ret < 0) {
+		glfs_resolve_async_done (ra, -1, op_errno);
+		return 0;
+	}
+
+	linked = inode_link (ra->loc.inode, ra->loc.parent, ra->component,
+			     buf);
+	if (!linked) {
+		glfs_resolve_async_done (ra, -1, ENOMEM);
+		return 0;
+	}
+	inode_lookup (linked);
+
+	ra->inode = linked;
+	ra->iatt = *buf;
+
+	if (!glfs_resolve_async_advance (ra))
+		glfs_resolve_async_run (ra);
+
+	return 0;
+}
+
+
+int
+glfs_resolve_at_async (struct glfs *fs, xlator_t *subvol, inode_t *at,
+		       const char *origpath, glfs_resolve_cbk_t fn,
+		       void *data)
+{
+	struct glfs_resolve_async *ra = NULL;
+	char                      *path = NULL;
+
+	ra = GF_CALLOC (1, sizeof (*ra), glfs_mt_resolve_async_t);
+	if (!ra) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ra->fs = fs;
+	ra->subvol = subvol;
+	ra->fn = fn;
+	ra->data = data;
+	if (at)
+		ra->at = inode_ref (at);
+
+	ra->origpath = gf_strdup (origpath);
+	ra->path = gf_strdup (origpath);
+	if (!ra->origpath || !ra->path) {
+		glfs_resolve_async_free (ra);
+		errno = ENOMEM;
+		return -1;
+	}
+	path = ra->path;
+
+	/* A relative resolution of a path which starts with '/' is equal to
+	   an absolute path resolution. */
+	if (at && path[0] != '/')
+		ra->inode = inode_ref (at);
+	else
+		ra->inode = inode_ref (subvol->itable->root);
+
+	ra->component = strtok_r (path, "/", &ra->saveptr);
+	if (ra->component) {
+		ra->next_component = strtok_r (NULL, "/", &ra->saveptr);
+		glfs_resolve_async_run (ra);
+		return 0;
+	}
+
+	ra->loc.inode = inode_ref (ra->inode);
+	uuid_copy (ra->loc.gfid, ra->inode->gfid);
+	if (inode_path (ra->loc.inode, NULL, &path) < 0) {
+		glfs_resolve_async_free (ra);
+		errno = ENOMEM;
+		return -1;
+	}
+	ra->loc.path = path;
+
+	glfs_resolve_async_wind (ra);
+
+	return 0;
+}
+
 int
 glfs_migrate_fd_locks_safe (struct glfs *fs, xlator_t *oldsubvol, fd_t *oldfd,
 			    xlator_t *newsubvol, fd_t *newfd)
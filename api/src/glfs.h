@@ -507,6 +507,50 @@ int glfs_pwritev_async (glfs_fd_t *fd, const struct iovec *iov,
                         int count, off_t offset, int flags,
                         glfs_io_cbk fn, void *data) __THROW;
 
+/*
+  Zero-copy I/O
+
+  The calls above copy: reads copy the data out of the buffers the volume
+  returned it in, writes copy the caller's buffers into buffers of the
+  library. The _zc calls below hand the buffers across instead, with
+  these rules of ownership:
+
+  glfs_preadv_zc: on success (@ret > 0) *@buf is a glfs_zcbuf_t holding
+  the data, which glfs_zcbuf_iovec() describes as one or more regions.
+  The regions belong to the library and may be shared with its caches;
+  they must be treated as read-only, and stay valid until the caller
+  hands *@buf back with glfs_zcbuf_release(), from any thread. On end of
+  file or error *@buf is NULL.
+
+  glfs_preadv_zc_async: the same, with the glfs_zcbuf_t passed to @fn.
+  @fn owns it and must release it (it is NULL when @ret <= 0).
+
+  glfs_pwritev_zc: the regions of @iov are passed to the volume as they
+  are. The volume may still hold them after the call returned (e.g. when
+  write-behind acknowledged the write early). @release is called with
+  @data exactly once, from any thread and possibly before the call
+  returns, once nothing refers to the regions anymore, also when the
+  write failed. Until then they must not be modified or freed.
+*/
+
+typedef struct glfs_zcbuf glfs_zcbuf_t;
+
+typedef void (*glfs_zc_release_t) (void *data);
+
+typedef void (*glfs_zc_cbk) (glfs_fd_t *fd, ssize_t ret, glfs_zcbuf_t *buf,
+                             void *data);
+
+ssize_t glfs_preadv_zc (glfs_fd_t *fd, size_t size, off_t offset, int flags,
+                        glfs_zcbuf_t **buf) __THROW;
+int glfs_preadv_zc_async (glfs_fd_t *fd, size_t size, off_t offset,
+                          int flags, glfs_zc_cbk fn, void *data) __THROW;
+ssize_t glfs_pwritev_zc (glfs_fd_t *fd, const struct iovec *iov, int iovcnt,
+                         off_t offset, int flags, glfs_zc_release_t release,
+                         void *data) __THROW;
+
+int glfs_zcbuf_iovec (glfs_zcbuf_t *buf, const struct iovec **iov) __THROW;
+void glfs_zcbuf_release (glfs_zcbuf_t *buf) __THROW;
+
 
 off_t glfs_lseek (glfs_fd_t *fd, off_t offset, int whence) __THROW;
 
@@ -659,6 +703,81 @@ int glfs_posix_lock (glfs_fd_t *fd, int cmd, struct flock *flock) __THROW;
 
 glfs_fd_t *glfs_dup (glfs_fd_t *fd) __THROW;
 
+/*
+  Completion queues
+
+  The _async calls above run @fn on a thread of the library. The calls
+  below put their results on a completion queue instead, which the
+  application reaps in batches from its own thread:
+
+  glfs_cq_new: creates a queue on @fs. glfs_cq_fd() returns a descriptor
+  that polls readable while completions are waiting, for the event loop
+  of the application. It must not be read, written or closed.
+
+  glfs_cq_<call>: submits the call and returns 0, or -1 with @errno set
+  when it could not be submitted, in which case nothing will complete.
+  The buffers passed (the regions of @iov, @buf, @entry) must stay valid
+  until the completion has been reaped.
+
+  glfs_cq_reap: moves up to @max completions to @cqe, oldest first, and
+  returns their number. It waits until at least @min are there, nothing
+  submitted is outstanding anymore, or @timeout (relative; NULL waits
+  without limit) has passed. With @min 0 it never waits.
+
+  A completion carries the @data given on submission, in @ret the return
+  value of the matching synchronous call, and in @op_errno the error when
+  @ret is -1. For glfs_cq_open and glfs_cq_creat @ret is 0 with the new
+  fd in @fd. glfs_cq_readdir returns 1 with the next entry in @entry, or
+  0 at the end of the directory. The object based calls are declared in
+  glfs-handles.h.
+
+  glfs_cq_destroy: frees the queue, and fails with EBUSY while submitted
+  calls are outstanding. Completions not reaped are dropped, closing the
+  fds opened by them.
+*/
+
+typedef struct glfs_cq glfs_cq_t;
+
+struct glfs_object;
+
+struct glfs_cqe {
+	void               *data;
+	ssize_t             ret;
+	int                 op_errno;
+	glfs_fd_t          *fd;
+	struct glfs_object *object;
+};
+
+glfs_cq_t *glfs_cq_new (glfs_t *fs) __THROW;
+int glfs_cq_fd (glfs_cq_t *cq) __THROW;
+int glfs_cq_reap (glfs_cq_t *cq, struct glfs_cqe *cqe, int max, int min,
+                  const struct timespec *timeout) __THROW;
+int glfs_cq_destroy (glfs_cq_t *cq) __THROW;
+
+int glfs_cq_preadv (glfs_cq_t *cq, glfs_fd_t *fd, const struct iovec *iov,
+                    int iovcnt, off_t offset, int flags, void *data) __THROW;
+int glfs_cq_pwritev (glfs_cq_t *cq, glfs_fd_t *fd, const struct iovec *iov,
+                     int iovcnt, off_t offset, int flags, void *data) __THROW;
+int glfs_cq_fsync (glfs_cq_t *cq, glfs_fd_t *fd, void *data) __THROW;
+int glfs_cq_fdatasync (glfs_cq_t *cq, glfs_fd_t *fd, void *data) __THROW;
+int glfs_cq_discard (glfs_cq_t *cq, glfs_fd_t *fd, off_t offset, size_t len,
+                     void *data) __THROW;
+int glfs_cq_zerofill (glfs_cq_t *cq, glfs_fd_t *fd, off_t offset, off_t len,
+                      void *data) __THROW;
+
+int glfs_cq_stat (glfs_cq_t *cq, const char *path, struct stat *buf,
+                  void *data) __THROW;
+int glfs_cq_lstat (glfs_cq_t *cq, const char *path, struct stat *buf,
+                   void *data) __THROW;
+int glfs_cq_fstat (glfs_cq_t *cq, glfs_fd_t *fd, struct stat *buf,
+                   void *data) __THROW;
+int glfs_cq_open (glfs_cq_t *cq, const char *path, int flags,
+                  void *data) __THROW;
+int glfs_cq_creat (glfs_cq_t *cq, const char *path, int flags, mode_t mode,
+                   void *data) __THROW;
+int glfs_cq_readdir (glfs_cq_t *cq, glfs_fd_t *fd, struct dirent *entry,
+                     void *data) __THROW;
+
 
 __END_DECLS
 
@@ -0,0 +1,194 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Read and write throughput of one file through gfapi, with the copying
+ * calls (glfs_pwritev, glfs_preadv) and the zero-copy ones
+ * (glfs_pwritev_zc, glfs_preadv_zc). The file is written once with each
+ * and then read a few times with each, so with a cache in the volume most
+ * reads never leave the client and the copies are most of the cost.
+ *
+ * usage: glfs_zc_bench <volfile> [file-mb] [io-kb] [read-passes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "glfs.h"
+
+#define BENCH_FILE "/glfs_zc_bench"
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+bench_release (void *data)
+{
+        (*(long *)data)++;
+}
+
+static double
+bench_write (glfs_fd_t *fd, char *buf, size_t io, size_t total, int zc,
+             long *released)
+{
+        struct iovec iov = {0, };
+        double       start = 0;
+        size_t       off = 0;
+        ssize_t      ret = 0;
+
+        start = bench_now ();
+        for (off = 0; off < total; off += io) {
+                iov.iov_base = buf;
+                iov.iov_len = io;
+
+                if (zc)
+                        ret = glfs_pwritev_zc (fd, &iov, 1, off, 0,
+                                               bench_release, released);
+                else
+                        ret = glfs_pwritev (fd, &iov, 1, off, 0);
+                if (ret != io)
+                        return -1;
+        }
+        if (glfs_fsync (fd))
+                return -1;
+
+        return total / (bench_now () - start) / (1024 * 1024);
+}
+
+static double
+bench_read (glfs_fd_t *fd, char *buf, size_t io, size_t total, int zc,
+            int passes)
+{
+        glfs_zcbuf_t       *zcbuf = NULL;
+        const struct iovec *iov = NULL;
+        struct iovec        one = {0, };
+        double              start = 0;
+        size_t              off = 0;
+        ssize_t             ret = 0;
+        long                sum = 0;
+        int                 cnt = 0;
+        int                 i = 0;
+
+        start = bench_now ();
+        for (i = 0; i < passes; i++) {
+                for (off = 0; off < total; off += io) {
+                        if (!zc) {
+                                one.iov_base = buf;
+                                one.iov_len = io;
+                                ret = glfs_preadv (fd, &one, 1, off, 0);
+                                if (ret != io)
+                                        return -1;
+                                sum += buf[0];
+                                continue;
+                        }
+
+                        ret = glfs_preadv_zc (fd, io, off, 0, &zcbuf);
+                        if (ret != io)
+                                return -1;
+                        cnt = glfs_zcbuf_iovec (zcbuf, &iov);
+                        if (cnt < 1)
+                                return -1;
+                        sum += ((char *)iov[0].iov_base)[0];
+                        glfs_zcbuf_release (zcbuf);
+                }
+        }
+
+        if (sum != (long)passes * (total / io) * 'z')
+                return -1;
+
+        return (double)total * passes / (bench_now () - start) /
+                (1024 * 1024);
+}
+
+int
+main (int argc, char *argv[])
+{
+        glfs_t    *fs = NULL;
+        glfs_fd_t *fd = NULL;
+        char      *buf = NULL;
+        size_t     total = 64;
+        size_t     io = 128;
+        int        passes = 4;
+        long       released = 0;
+        long       writes = 0;
+        double     copy = 0;
+        double     zc = 0;
+        int        errors = 0;
+
+        if (argc < 2) {
+                fprintf (stderr, "usage: %s <volfile> [file-mb] [io-kb] "
+                         "[read-passes]\n", argv[0]);
+                return 1;
+        }
+        if (argc > 2)
+                total = atol (argv[2]);
+        if (argc > 3)
+                io = atol (argv[3]);
+        if (argc > 4)
+                passes = atoi (argv[4]);
+
+        total *= 1024 * 1024;
+        io *= 1024;
+        if (!io || total < io || passes < 1)
+                return 1;
+        total -= total % io;
+        writes = total / io;
+
+        buf = malloc (io);
+        if (!buf)
+                return 1;
+        memset (buf, 'z', io);
+
+        fs = glfs_new ("bench");
+        if (!fs || glfs_set_volfile (fs, argv[1]) ||
+            glfs_set_logging (fs, "/dev/null", 0) || glfs_init (fs)) {
+                fprintf (stderr, "cannot start %s: %s\n", argv[1],
+                         strerror (errno));
+                return 1;
+        }
+
+        fd = glfs_creat (fs, BENCH_FILE, O_RDWR, 0644);
+        if (!fd) {
+                fprintf (stderr, "%s: %s\n", BENCH_FILE, strerror (errno));
+                return 1;
+        }
+
+        printf ("%-8s %14s %14s\n", "", "copy MB/s", "zero-copy MB/s");
+
+        copy = bench_write (fd, buf, io, total, 0, &released);
+        zc = bench_write (fd, buf, io, total, 1, &released);
+        errors += (copy < 0 || zc < 0 || released != writes);
+        printf ("%-8s %14.1f %14.1f %s\n", "write", copy, zc,
+                errors ? "ERRORS" : "");
+
+        copy = bench_read (fd, buf, io, total, 0, passes);
+        zc = bench_read (fd, buf, io, total, 1, passes);
+        errors += (copy < 0 || zc < 0);
+        printf ("%-8s %14.1f %14.1f %s\n", "read", copy, zc,
+                errors ? "ERRORS" : "");
+
+        glfs_close (fd);
+        glfs_unlink (fs, BENCH_FILE);
+        glfs_fini (fs);
+        free (buf);
+
+        return errors ? 1 : 0;
+}
@@ -72,6 +72,10 @@ typedef struct cli_profile_info_ {
         double avg_latency;
         char   *fop_name;
         double percentage_avg_latency;
+        double p50_latency;
+        double p90_latency;
+        double p99_latency;
+        double p999_latency;
 } cli_profile_info_t;
 
 typedef struct addrinfo_list {
@@ -4802,6 +4802,21 @@ cmd_profile_volume_brick_out (dict_t *dict, int count, int interval)
                 ret = dict_get_double (dict, key, &profile_info[i].max_latency);
                 profile_info[i].fop_name = (char *)gf_fop_list[i];
 
+                /* not sent by bricks before percentiles were measured */
+                snprintf (key, sizeof (key), "%d-%d-%d-p50latency", count,
+                          interval, i);
+                ret = dict_get_double (dict, key, &profile_info[i].p50_latency);
+                snprintf (key, sizeof (key), "%d-%d-%d-p90latency", count,
+                          interval, i);
+                ret = dict_get_double (dict, key, &profile_info[i].p90_latency);
+                snprintf (key, sizeof (key), "%d-%d-%d-p99latency", count,
+                          interval, i);
+                ret = dict_get_double (dict, key, &profile_info[i].p99_latency);
+                snprintf (key, sizeof (key), "%d-%d-%d-p999latency", count,
+                          interval, i);
+                ret = dict_get_double (dict, key,
+                                       &profile_info[i].p999_latency);
+
                 total_percentage_latency +=
                        (profile_info[i].fop_hits * profile_info[i].avg_latency);
         }
@@ -4904,6 +4919,28 @@ cmd_profile_volume_brick_out (dict_t *dict, int count, int interval)
                                  profile_info[i].fop_name);
                 }
         }
+        is_header_printed = 0;
+        for (i = 0; i < GF_FOP_MAXVALUE; i++) {
+                if (profile_info[i].fop_hits == 0 ||
+                    profile_info[i].p50_latency == 0)
+                        continue;
+                if (is_header_printed == 0) {
+                        cli_out (" ");
+                        cli_out ("%13s %13s %13s %14s %11s", "P50-latency",
+                                 "P90-latency", "P99-latency", "P99.9-latency",
+                                 "Fop");
+                        cli_out ("%13s %13s %13s %14s %11s", "-----------",
+                                 "-----------", "-----------", "-------------",
+                                 "----");
+                        is_header_printed = 1;
+                }
+                cli_out ("%10.0lf us %10.0lf us %10.0lf us %11.0lf us %11s",
+                         profile_info[i].p50_latency,
+                         profile_info[i].p90_latency,
+                         profile_info[i].p99_latency,
+                         profile_info[i].p999_latency,
+                         profile_info[i].fop_name);
+        }
         cli_out (" ");
         cli_out ("%12s: %"PRId64" seconds", "Duration", sec);
         cli_out ("%12s: %"PRId64" bytes", "Data Read", r_count);
@@ -7073,6 +7110,11 @@ cmd_heal_volume_statistics_out (dict_t *dict, int  brick)
         char            *end_time_str = NULL;
         char            *crawl_type = NULL;
         int             progress = -1;
+        uint64_t        index_count = 0;
+        uint64_t        pending_count = 0;
+        uint64_t        skipped_count = 0;
+        uint64_t        heal_rate = 0;
+        gf_boolean_t    has_backlog = _gf_false;
 
         snprintf (key, sizeof key, "%d-hostname", brick);
         ret = dict_get_str (dict, key, &hostname);
@@ -7127,6 +7169,25 @@ cmd_heal_volume_statistics_out (dict_t *dict, int  brick)
                 if (ret)
                         goto out;
 
+                /* not sent by older self-heal daemons */
+                has_backlog = _gf_true;
+                snprintf (key, sizeof key, "statistics_index_cnt-%d-%"PRIu64,
+                          brick, i);
+                if (dict_get_uint64 (dict, key, &index_count))
+                        has_backlog = _gf_false;
+                snprintf (key, sizeof key, "statistics_pending_cnt-%d-%"PRIu64,
+                          brick, i);
+                if (dict_get_uint64 (dict, key, &pending_count))
+                        has_backlog = _gf_false;
+                snprintf (key, sizeof key, "statistics_skipped_cnt-%d-%"PRIu64,
+                          brick, i);
+                if (dict_get_uint64 (dict, key, &skipped_count))
+                        has_backlog = _gf_false;
+                snprintf (key, sizeof key, "statistics_heal_rate-%d-%"PRIu64,
+                          brick, i);
+                if (dict_get_uint64 (dict, key, &heal_rate))
+                        has_backlog = _gf_false;
+
                 cli_out ("\nStarting time of crawl: %s", start_time_str);
                 if (progress == 1)
                         cli_out ("Crawl is in progress");
@@ -7140,6 +7201,16 @@ cmd_heal_volume_statistics_out (dict_t *dict, int  brick)
                         split_brain_count);
                 cli_out ("No. of heal failed entries: %"PRIu64,
                          heal_failed_count);
+                if (has_backlog) {
+                        cli_out ("No. of index entries crawled: %"PRIu64,
+                                 index_count);
+                        cli_out ("No. of entries waiting for heal: %"PRIu64,
+                                 pending_count);
+                        cli_out ("No. of entries already being healed: "
+                                 "%"PRIu64, skipped_count);
+                        cli_out ("Heal rate (entries/sec): %"PRIu64,
+                                 heal_rate);
+                }
 
         }
 
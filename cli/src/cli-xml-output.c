@@ -2058,6 +2058,11 @@ cli_xml_output_vol_profile_stats (xmlTextWriterPtr writer, dict_t *dict,
         uint64_t                total_write = 0;
         char                    key[1024] = {0};
         int                     i = 0;
+        int                     p = 0;
+        double                  pct_latency = 0.0;
+        const char             *pct_names[] = {"p50", "p90", "p99", "p999"};
+        const char             *pct_elems[] = {"p50Latency", "p90Latency",
+                                               "p99Latency", "p999Latency"};
 
         /* <cumulativeStats> || <intervalStats> */
         if (interval == -1)
@@ -2167,6 +2172,17 @@ cli_xml_output_vol_profile_stats (xmlTextWriterPtr writer, dict_t *dict,
                         (writer, (xmlChar *)"maxLatency", "%f", max_latency);
                 XML_RET_CHECK_AND_GOTO (ret, out);
 
+                for (p = 0; p < 4; p++) {
+                        snprintf (key, sizeof (key), "%d-%d-%d-%slatency",
+                                  brick_index, interval, i, pct_names[p]);
+                        if (dict_get_double (dict, key, &pct_latency))
+                                continue;
+                        ret = xmlTextWriterWriteFormatElement
+                                (writer, (xmlChar *)pct_elems[p], "%f",
+                                 pct_latency);
+                        XML_RET_CHECK_AND_GOTO (ret, out);
+                }
+
                 /* </fop> */
                 ret = xmlTextWriterEndElement (writer);
                 XML_RET_CHECK_AND_GOTO (ret, out);
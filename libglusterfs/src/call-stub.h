@@ -26,6 +26,7 @@ typedef struct {
 	call_frame_t *frame;
 	glusterfs_fop_t fop;
         struct mem_pool *stub_mem_pool; /* pointer to stub mempool in ctx_t */
+        struct timeval   queued;        /* set by io-threads */
 
 	union {
 		fop_lookup_t lookup;
@@ -10,8 +10,11 @@
 
 #include <openssl/md5.h>
 #include <stdint.h>
+#include <string.h>
+#include <endian.h>
 
 #include "glusterfs.h"
+#include "checksum.h"
 
 /*
  * The "weak" checksum required for the rsync algorithm,
@@ -63,3 +66,105 @@ gf_rsync_strong_checksum (unsigned char *data, size_t len, unsigned char *md5)
 {
         MD5(data, len, md5);
 }
+
+
+/*
+ * A fast 128 bit checksum of a data block (MurmurHash3, x64 128 bit
+ * variant). It is not a cryptographic hash, but like MD5 above it only has
+ * to tell apart copies of a block which went out of sync, and it runs
+ * several times faster. The result does not depend on the host byte order.
+ */
+
+#define GF_ROTL64(x, r) (((x) << (r)) | ((x) >> (64 - (r))))
+
+static inline uint64_t
+__fast_load64 (const unsigned char *p)
+{
+        uint64_t v = 0;
+
+        memcpy (&v, p, sizeof (v));
+#if __BYTE_ORDER == __BIG_ENDIAN
+        v = __builtin_bswap64 (v);
+#endif
+        return v;
+}
+
+
+static inline uint64_t
+__fast_fmix64 (uint64_t k)
+{
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+
+        return k;
+}
+
+
+void
+gf_fast_checksum (unsigned char *buf, size_t len, unsigned char *sum)
+{
+        const uint64_t  c1 = 0x87c37b91114253d5ULL;
+        const uint64_t  c2 = 0x4cf5ad432745937fULL;
+        uint64_t        h1 = 0;
+        uint64_t        h2 = 0;
+        uint64_t        k1 = 0;
+        uint64_t        k2 = 0;
+        size_t          nblocks = len / 16;
+        size_t          i = 0;
+        unsigned char  *tail = NULL;
+
+        for (i = 0; i < nblocks; i++) {
+                k1 = __fast_load64 (buf + i * 16);
+                k2 = __fast_load64 (buf + i * 16 + 8);
+
+                k1 *= c1; k1 = GF_ROTL64 (k1, 31); k1 *= c2; h1 ^= k1;
+                h1 = GF_ROTL64 (h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+                k2 *= c2; k2 = GF_ROTL64 (k2, 33); k2 *= c1; h2 ^= k2;
+                h2 = GF_ROTL64 (h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+        }
+
+        tail = buf + nblocks * 16;
+        k1 = 0;
+        k2 = 0;
+
+        switch (len & 15) {
+        case 15: k2 ^= ((uint64_t)tail[14]) << 48;
+        case 14: k2 ^= ((uint64_t)tail[13]) << 40;
+        case 13: k2 ^= ((uint64_t)tail[12]) << 32;
+        case 12: k2 ^= ((uint64_t)tail[11]) << 24;
+        case 11: k2 ^= ((uint64_t)tail[10]) << 16;
+        case 10: k2 ^= ((uint64_t)tail[9]) << 8;
+        case  9: k2 ^= ((uint64_t)tail[8]);
+                 k2 *= c2; k2 = GF_ROTL64 (k2, 33); k2 *= c1; h2 ^= k2;
+        case  8: k1 ^= ((uint64_t)tail[7]) << 56;
+        case  7: k1 ^= ((uint64_t)tail[6]) << 48;
+        case  6: k1 ^= ((uint64_t)tail[5]) << 40;
+        case  5: k1 ^= ((uint64_t)tail[4]) << 32;
+        case  4: k1 ^= ((uint64_t)tail[3]) << 24;
+        case  3: k1 ^= ((uint64_t)tail[2]) << 16;
+        case  2: k1 ^= ((uint64_t)tail[1]) << 8;
+        case  1: k1 ^= ((uint64_t)tail[0]);
+                 k1 *= c1; k1 = GF_ROTL64 (k1, 31); k1 *= c2; h1 ^= k1;
+        }
+
+        h1 ^= len;
+        h2 ^= len;
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = __fast_fmix64 (h1);
+        h2 = __fast_fmix64 (h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        for (i = 0; i < 8; i++) {
+                sum[i] = (h1 >> (i * 8)) & 0xff;
+                sum[i + 8] = (h2 >> (i * 8)) & 0xff;
+        }
+}
@@ -11,10 +11,15 @@
 #ifndef __CHECKSUM_H__
 #define __CHECKSUM_H__
 
+#define GF_FAST_CHECKSUM_LENGTH 16
+
 uint32_t
 gf_rsync_weak_checksum (unsigned char *buf, size_t len);
 
 void
 gf_rsync_strong_checksum (unsigned char *buf, size_t len, unsigned char *sum);
 
+void
+gf_fast_checksum (unsigned char *buf, size_t len, unsigned char *sum);
+
 #endif /* __CHECKSUM_H__ */
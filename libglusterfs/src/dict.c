@@ -15,6 +15,7 @@
 #include <inttypes.h>
 #include <limits.h>
 #include <fnmatch.h>
+#include <stdarg.h>
 
 #ifndef _CONFIG_H
 #define _CONFIG_H
@@ -30,6 +31,10 @@
 #include "byte-order.h"
 #include "globals.h"
 
+/* Marks a slot whose pair was deleted, so that probing goes on past it. */
+static data_pair_t dict_deleted_pair;
+#define DICT_SLOT_DELETED (&dict_deleted_pair)
+
 data_t *
 get_new_data ()
 {
@@ -40,42 +45,69 @@ get_new_data ()
                 return NULL;
         }
 
-        LOCK_INIT (&data->lock);
         return data;
 }
 
+/* Copy @len bytes of @value into the data_t when they fit. */
+static int
+data_set_inline (data_t *data, const void *value, int32_t len)
+{
+        if (len < 0 || len > GF_DATA_INLINE_LEN)
+                return -1;
+
+        memcpy (data->inline_data, value, len);
+        data->data = data->inline_data;
+        data->len = len;
+        data->is_inline = 1;
+
+        return 0;
+}
+
+static int
+data_printf (data_t *data, const char *fmt, ...)
+{
+        va_list ap;
+        int     ret = 0;
+
+        va_start (ap, fmt);
+        ret = vsnprintf (data->inline_data, GF_DATA_INLINE_LEN, fmt, ap);
+        va_end (ap);
+
+        if (ret >= 0 && ret < GF_DATA_INLINE_LEN) {
+                data->data = data->inline_data;
+                data->is_inline = 1;
+        } else {
+                va_start (ap, fmt);
+                ret = gf_vasprintf (&data->data, fmt, ap);
+                va_end (ap);
+                if (ret == -1)
+                        return -1;
+        }
+
+        data->len = ret + 1;
+
+        return 0;
+}
+
 dict_t *
 get_new_dict_full (int size_hint)
 {
         dict_t *dict = mem_get0 (THIS->ctx->dict_pool);
+        int     size = GF_DICT_INLINE_SLOTS;
 
         if (!dict) {
                 return NULL;
         }
 
-        dict->hash_size = size_hint;
-        if (size_hint == 1) {
-                /*
-                 * This is the only case we ever see currently.  If we ever
-                 * need to support resizing the hash table, the resize function
-                 * will have to take into account the possibility that
-                 * "members" is not separately allocated (i.e. don't just call
-                 * realloc() blindly.
-                 */
-                dict->members = &dict->members_internal;
-        }
-        else {
-                /*
-                 * We actually need to allocate space for size_hint *pointers*
-                 * but we actually allocate space for one *structure*.  Since
-                 * a data_pair_t consists of five pointers, we're wasting four
-                 * pointers' worth for N=1, and will overrun what we allocated
-                 * for N>5.  If anybody ever starts using size_hint, we'll need
-                 * to fix this.
-                 */
-                GF_ASSERT (size_hint <=
-                           (sizeof(data_pair_t) / sizeof(data_pair_t *)));
-                dict->members = mem_get0 (THIS->ctx->dict_pair_pool);
+        while (size < size_hint)
+                size <<= 1;
+
+        dict->hash_size = size;
+        if (size == GF_DICT_INLINE_SLOTS) {
+                dict->members = dict->members_internal;
+        } else {
+                dict->members = GF_CALLOC (size, sizeof (data_pair_t *),
+                                           gf_common_mt_dict_members);
                 if (!dict->members) {
                         mem_put (dict);
                         return NULL;
@@ -137,9 +169,10 @@ void
 data_destroy (data_t *data)
 {
         if (data) {
-                LOCK_DESTROY (&data->lock);
+                if (data->backing)
+                        data_unref (data->backing);
 
-                if (!data->is_static) {
+                if (!data->is_static && !data->is_inline) {
                         if (data->data) {
                                 if (data->is_stdalloc)
                                         free (data->data);
@@ -170,14 +203,14 @@ data_copy (data_t *old)
 
         if (old) {
                 newdata->len = old->len;
-                if (old->data) {
+                if (old->data &&
+                    data_set_inline (newdata, old->data, old->len) != 0) {
                         newdata->data = memdup (old->data, old->len);
                         if (!newdata->data)
                                 goto err_out;
                 }
         }
 
-        LOCK_INIT (&newdata->lock);
         return newdata;
 
 err_out:
@@ -188,24 +221,46 @@ err_out:
         return NULL;
 }
 
+static inline uint32_t
+dict_hash (char *key, int keylen)
+{
+        return SuperFastHash (key, keylen);
+}
+
+/* Index of the slot holding @key, or -1. */
+static int
+__dict_find_slot (dict_t *this, char *key, uint32_t hash)
+{
+        data_pair_t *pair = NULL;
+        uint32_t     mask = this->hash_size - 1;
+        uint32_t     i    = 0;
+
+        for (i = hash & mask; (pair = this->members[i]) != NULL;
+             i = (i + 1) & mask) {
+                if (pair != DICT_SLOT_DELETED && pair->hash == hash &&
+                    !strcmp (pair->key, key))
+                        return i;
+        }
+
+        return -1;
+}
+
 static data_pair_t *
 _dict_lookup (dict_t *this, char *key)
 {
+        int slot = 0;
+
         if (!this || !key) {
                 gf_log_callingfn ("dict", GF_LOG_WARNING,
                                   "!this || !key (%s)", key);
                 return NULL;
         }
 
-        int hashval = SuperFastHash (key, strlen (key)) % this->hash_size;
-        data_pair_t *pair;
-
-        for (pair = this->members[hashval]; pair != NULL; pair = pair->hash_next) {
-                if (pair->key && !strcmp (pair->key, key))
-                        return pair;
-        }
+        slot = __dict_find_slot (this, key, dict_hash (key, strlen (key)));
+        if (slot < 0)
+                return NULL;
 
-        return NULL;
+        return this->members[slot];
 }
 
 int32_t
@@ -231,13 +286,92 @@ dict_lookup (dict_t *this, char *key, data_t **data)
         return 0;
 }
 
+static void
+__dict_insert_slot (data_pair_t **members, int32_t size, data_pair_t *pair)
+{
+        uint32_t mask = size - 1;
+        uint32_t i    = 0;
+
+        for (i = pair->hash & mask; members[i] != NULL; i = (i + 1) & mask)
+                ;
+
+        members[i] = pair;
+}
+
+/* Make room for one more slot: grow when the live pairs would take more
+ * than half of the table, otherwise just sweep the deleted slots. */
+static int
+__dict_reserve_slot (dict_t *this)
+{
+        data_pair_t **members = NULL;
+        data_pair_t  *pair    = NULL;
+        int32_t       size    = this->hash_size;
+
+        if ((this->used + 1) * 4 <= size * 3)
+                return 0;
+
+        while ((this->count + 1) * 2 > size)
+                size <<= 1;
+
+        if (size == this->hash_size) {
+                members = this->members;
+                memset (members, 0, size * sizeof (data_pair_t *));
+        } else {
+                members = GF_CALLOC (size, sizeof (data_pair_t *),
+                                     gf_common_mt_dict_members);
+                if (!members)
+                        return -1;
+        }
+
+        for (pair = this->members_list; pair; pair = pair->next)
+                __dict_insert_slot (members, size, pair);
+
+        if (this->members != this->members_internal &&
+            this->members != members)
+                GF_FREE (this->members);
+
+        this->members = members;
+        this->hash_size = size;
+        this->used = this->count;
+
+        return 0;
+}
+
+static data_pair_t *
+__dict_pair_get (dict_t *this)
+{
+        int i = 0;
+
+        for (i = 0; i < GF_DICT_INLINE_PAIRS; i++) {
+                if (!(this->pairs_in_use & (1 << i))) {
+                        this->pairs_in_use |= (1 << i);
+                        return &this->pairs[i];
+                }
+        }
+
+        return mem_get (THIS->ctx->dict_pair_pool);
+}
+
+static void
+__dict_pair_put (dict_t *this, data_pair_t *pair)
+{
+        if (pair->key != pair->key_inline)
+                GF_FREE (pair->key);
+
+        if (pair >= this->pairs && pair < this->pairs + GF_DICT_INLINE_PAIRS)
+                this->pairs_in_use &= ~(1 << (pair - this->pairs));
+        else
+                mem_put (pair);
+}
+
 static int32_t
 _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
 {
-        int hashval;
         data_pair_t *pair;
         char key_free = 0;
-        int tmp = 0;
+        int keylen = 0;
+        uint32_t hash = 0;
+        int slot = 0;
         int ret = 0;
 
         if (!key) {
@@ -249,14 +383,15 @@ _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
                 key_free = 1;
         }
 
-        tmp = SuperFastHash (key, strlen (key));
-        hashval = (tmp % this->hash_size);
+        keylen = strlen (key);
+        hash = dict_hash (key, keylen);
 
         /* Search for a existing key if 'replace' is asked for */
         if (replace) {
-                pair = _dict_lookup (this, key);
+                slot = __dict_find_slot (this, key, hash);
 
-                if (pair) {
+                if (slot >= 0) {
+                        pair = this->members[slot];
                         data_t *unref_data = pair->value;
                         pair->value = data_ref (value);
                         data_unref (unref_data);
@@ -267,42 +402,41 @@ _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
                 }
         }
 
-        if (this->free_pair_in_use) {
-                pair = mem_get0 (THIS->ctx->dict_pair_pool);
-                if (!pair) {
-                        if (key_free)
-                                GF_FREE (key);
-                        return -1;
-                }
+        if (__dict_reserve_slot (this) != 0) {
+                if (key_free)
+                        GF_FREE (key);
+                return -1;
         }
-        else {
-                pair = &this->free_pair;
-                this->free_pair_in_use = _gf_true;
+
+        pair = __dict_pair_get (this);
+        if (!pair) {
+                if (key_free)
+                        GF_FREE (key);
+                return -1;
         }
 
-        if (key_free) {
+        if (keylen < GF_DICT_INLINE_KEY) {
+                memcpy (pair->key_inline, key, keylen + 1);
+                pair->key = pair->key_inline;
+        } else if (key_free) {
                 /* It's ours.  Use it. */
                 pair->key = key;
                 key_free = 0;
-        }
-        else {
-                pair->key = (char *) GF_CALLOC (1, strlen (key) + 1,
+        } else {
+                pair->key = (char *) GF_CALLOC (1, keylen + 1,
                                                 gf_common_mt_char);
                 if (!pair->key) {
-                        if (pair == &this->free_pair) {
-                                this->free_pair_in_use = _gf_false;
-                        }
-                        else {
-                                mem_put (pair);
-                        }
+                        pair->key = pair->key_inline;
+                        __dict_pair_put (this, pair);
                         return -1;
                 }
-                strcpy (pair->key, key);
+                memcpy (pair->key, key, keylen + 1);
         }
+        pair->hash = hash;
         pair->value = data_ref (value);
 
-        pair->hash_next = this->members[hashval];
-        this->members[hashval] = pair;
+        __dict_insert_slot (this->members, this->hash_size, pair);
+        this->used++;
 
         pair->next = this->members_list;
         pair->prev = NULL;
@@ -386,6 +520,9 @@ dict_get (dict_t *this, char *key)
 void
 dict_del (dict_t *this, char *key)
 {
+        data_pair_t *pair = NULL;
+        int          slot = 0;
+
         if (!this || !key) {
                 gf_log_callingfn ("dict", GF_LOG_WARNING,
                                   "!this || key=%s", key);
@@ -394,42 +531,32 @@ dict_del (dict_t *this, char *key)
 
         LOCK (&this->lock);
 
-        int hashval = SuperFastHash (key, strlen (key)) % this->hash_size;
-        data_pair_t *pair = this->members[hashval];
-        data_pair_t *prev = NULL;
+        slot = __dict_find_slot (this, key, dict_hash (key, strlen (key)));
+        if (slot < 0)
+                goto unlock;
 
-        while (pair) {
-                if (strcmp (pair->key, key) == 0) {
-                        if (prev)
-                                prev->hash_next = pair->hash_next;
-                        else
-                                this->members[hashval] = pair->hash_next;
+        pair = this->members[slot];
+        this->members[slot] = DICT_SLOT_DELETED;
 
-                        data_unref (pair->value);
+        data_unref (pair->value);
 
-                        if (pair->prev)
-                                pair->prev->next = pair->next;
-                        else
-                                this->members_list = pair->next;
+        if (pair->prev)
+                pair->prev->next = pair->next;
+        else
+                this->members_list = pair->next;
 
-                        if (pair->next)
-                                pair->next->prev = pair->prev;
+        if (pair->next)
+                pair->next->prev = pair->prev;
 
-                        GF_FREE (pair->key);
-                        if (pair == &this->free_pair) {
-                                this->free_pair_in_use = _gf_false;
-                        }
-                        else {
-                                mem_put (pair);
-                        }
-                        this->count--;
-                        break;
-                }
+        __dict_pair_put (this, pair);
+        this->count--;
 
-                prev = pair;
-                pair = pair->hash_next;
+        if (!this->count) {
+                memset (this->members, 0,
+                        this->hash_size * sizeof (data_pair_t *));
+                this->used = 0;
         }
-
+unlock:
         UNLOCK (&this->lock);
 
         return;
@@ -451,15 +578,12 @@ dict_destroy (dict_t *this)
         while (prev) {
                 pair = pair->next;
                 data_unref (prev->value);
-                GF_FREE (prev->key);
-                if (prev != &this->free_pair) {
-                        mem_put (prev);
-                }
+                __dict_pair_put (this, prev);
                 prev = pair;
         }
 
-        if (this->members != &this->members_internal) {
-                mem_put (this->members);
+        if (this->members != this->members_internal) {
+                GF_FREE (this->members);
         }
 
         GF_FREE (this->extra_free);
@@ -519,12 +643,7 @@ data_unref (data_t *this)
                 return;
         }
 
-        LOCK (&this->lock);
-
-        this->refcount--;
-        ref = this->refcount;
-
-        UNLOCK (&this->lock);
+        ref = __sync_sub_and_fetch (&this->refcount, 1);
 
         if (!ref)
                 data_destroy (this);
@@ -538,11 +657,7 @@ data_ref (data_t *this)
                 return NULL;
         }
 
-        LOCK (&this->lock);
-
-        this->refcount++;
-
-        UNLOCK (&this->lock);
+        __sync_add_and_fetch (&this->refcount, 1);
 
         return this;
 }
@@ -557,12 +672,11 @@ int_to_data (int64_t value)
                 return NULL;
         }
 
-        ret = gf_asprintf (&data->data, "%"PRId64, value);
+        ret = data_printf (data, "%"PRId64, value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
-        data->len = strlen (data->data) + 1;
 
         return data;
 }
@@ -576,12 +690,11 @@ data_from_int64 (int64_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%"PRId64, value);
+        ret = data_printf (data, "%"PRId64, value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
-        data->len = strlen (data->data) + 1;
 
         return data;
 }
@@ -595,14 +708,12 @@ data_from_int32 (int32_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%"PRId32, value);
+        ret = data_printf (data, "%"PRId32, value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
 
-        data->len = strlen (data->data) + 1;
-
         return data;
 }
 
@@ -615,14 +726,12 @@ data_from_int16 (int16_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%"PRId16, value);
+        ret = data_printf (data, "%"PRId16, value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
 
-        data->len = strlen (data->data) + 1;
-
         return data;
 }
 
@@ -635,14 +744,12 @@ data_from_int8 (int8_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%d", value);
+        ret = data_printf (data, "%d", value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
 
-        data->len = strlen (data->data) + 1;
-
         return data;
 }
 
@@ -655,14 +762,12 @@ data_from_uint64 (uint64_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%"PRIu64, value);
+        ret = data_printf (data, "%"PRIu64, value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
 
-        data->len = strlen (data->data) + 1;
-
         return data;
 }
 
@@ -678,11 +783,10 @@ data_from_double (double value)
                 return NULL;
         }
 
-        ret = gf_asprintf (&data->data, "%f", value);
+        ret = data_printf (data, "%f", value);
         if (ret == -1) {
                 return NULL;
         }
-        data->len = strlen (data->data) + 1;
 
         return data;
 }
@@ -697,14 +801,12 @@ data_from_uint32 (uint32_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%"PRIu32, value);
+        ret = data_printf (data, "%"PRIu32, value);
         if (-1 == ret) {
                 gf_log ("dict", GF_LOG_DEBUG, "asprintf failed");
                 return NULL;
         }
 
-        data->len = strlen (data->data) + 1;
-
         return data;
 }
 
@@ -718,13 +820,11 @@ data_from_uint16 (uint16_t value)
         if (!data) {
                 return NULL;
         }
-        ret = gf_asprintf (&data->data, "%"PRIu16, value);
+        ret = data_printf (data, "%"PRIu16, value);
         if (-1 == ret) {
                 return NULL;
         }
 
-        data->len = strlen (data->data) + 1;
-
         return data;
 }
 
@@ -2529,6 +2629,49 @@ out:
 }
 
 
+/**
+ * dict_serialize_iov - serialize a dictionary straight into a buffer owned
+ *                      by the caller, typically the iobuf of an RPC record
+ *
+ * @this: dict to serialize
+ * @iov:  buffer to serialize into. iov_len is the room available, and is set
+ *        to the serialized length on success
+ *
+ * @return: success: 0
+ *          failure: -errno, -ENOSPC if the dict does not fit
+ */
+
+int
+dict_serialize_iov (dict_t *this, struct iovec *iov)
+{
+        int ret = -EINVAL;
+
+        if (!this || !iov || !iov->iov_base) {
+                gf_log_callingfn ("dict", GF_LOG_WARNING, "dict is null!");
+                goto out;
+        }
+
+        LOCK (&this->lock);
+        {
+                ret = _dict_serialized_length (this);
+                if (ret < 0)
+                        goto unlock;
+
+                if (ret > iov->iov_len) {
+                        ret = -ENOSPC;
+                        goto unlock;
+                }
+
+                iov->iov_len = ret;
+                ret = _dict_serialize (this, iov->iov_base);
+        }
+unlock:
+        UNLOCK (&this->lock);
+out:
+        return ret;
+}
+
+
 /**
  * dict_unserialize - unserialize a buffer into a dict
  *
@@ -2540,8 +2683,9 @@ out:
  *          failure: -errno
  */
 
-int32_t
-dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
+static int32_t
+_dict_unserialize (char *orig_buf, int32_t size, dict_t **fill,
+                   data_t *backing)
 {
         char   *buf = NULL;
         int     ret   = -1;
@@ -2598,9 +2742,6 @@ dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
                 goto out;
         }
 
-        /* count will be set by the dict_set's below */
-        (*fill)->count = 0;
-
         for (i = 0; i < count; i++) {
                 if ((buf + DICT_DATA_HDR_KEY_LEN) > (orig_buf + size)) {
                         gf_log_callingfn ("dict", GF_LOG_ERROR,
@@ -2646,9 +2787,20 @@ dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
                         goto out;
                 }
                 value = get_new_data ();
-                value->len  = vallen;
-                value->data = memdup (buf, vallen);
-                value->is_static = 0;
+                if (!value)
+                        goto out;
+                if (data_set_inline (value, buf, vallen) == 0) {
+                        /* copied */
+                } else if (backing) {
+                        value->len  = vallen;
+                        value->data = buf;
+                        value->is_static = 1;
+                        value->backing = data_ref (backing);
+                } else {
+                        value->len  = vallen;
+                        value->data = memdup (buf, vallen);
+                        value->is_static = 0;
+                }
                 buf += vallen;
 
                 dict_add (*fill, key, value);
@@ -2660,6 +2812,59 @@ out:
 }
 
 
+int32_t
+dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
+{
+        return _dict_unserialize (orig_buf, size, fill, NULL);
+}
+
+
+/**
+ * dict_unserialize_ref - unserialize a buffer into a dict without copying
+ *                        the values out of it
+ *
+ * @buf:  buf containing serialized dict, allocated with malloc () as XDR
+ *        decoding does. The dict takes it over in all cases.
+ * @size: size of the @buf
+ * @fill: dict to fill in
+ *
+ * Values too big to be stored inline point into @buf, and each holds a
+ * reference on it, so they stay valid when shared with other dicts. @buf is
+ * freed along with the last of them.
+ *
+ * @return: success: 0
+ *          failure: -errno
+ */
+
+int32_t
+dict_unserialize_ref (char *buf, int32_t size, dict_t **fill)
+{
+        data_t  *backing = NULL;
+        int32_t  ret     = -1;
+
+        if (!buf)
+                return dict_unserialize (buf, size, fill);
+
+        backing = get_new_data ();
+        if (!backing) {
+                ret = dict_unserialize (buf, size, fill);
+                free (buf);
+                return ret;
+        }
+
+        backing->data = buf;
+        backing->len = size;
+        backing->is_stdalloc = 1;
+        data_ref (backing);
+
+        ret = _dict_unserialize (buf, size, fill, backing);
+
+        data_unref (backing);
+
+        return ret;
+}
+
+
 /**
  * dict_allocate_and_serialize - serialize a dictionary into an allocated buffer
  *
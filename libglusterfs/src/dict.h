@@ -44,6 +44,28 @@ typedef struct _data_pair data_pair_t;
         } while (0)
 
 
+/* Like GF_PROTOCOL_DICT_UNSERIALIZE, for a buffer XDR allocated with
+ * malloc (): the dict takes it over and @buff is set to NULL. */
+#define GF_PROTOCOL_DICT_UNSERIALIZE_REF(xl,to,buff,len,ret,ope,labl) do { \
+                if (!len)                                               \
+                        break;                                          \
+                to = dict_new();                                        \
+                GF_VALIDATE_OR_GOTO (xl->name, to, labl);               \
+                                                                        \
+                ret = dict_unserialize_ref (buff, len, &to);            \
+                buff = NULL;                                            \
+                if (ret < 0) {                                          \
+                        gf_log (xl->name, GF_LOG_WARNING,               \
+                                "failed to unserialize dictionary (%s)", \
+                                (#to));                                 \
+                                                                        \
+                        ope = EINVAL;                                   \
+                        goto labl;                                      \
+                }                                                       \
+                                                                        \
+        } while (0)
+
+
 #define GF_PROTOCOL_DICT_UNSERIALIZE(xl,to,buff,len,ret,ope,labl) do {  \
                 if (!len)                                               \
                         break;                                          \
@@ -62,24 +84,41 @@ typedef struct _data_pair data_pair_t;
                                                                         \
         } while (0)
 
+/* Values of up to GF_DATA_INLINE_LEN bytes (any integer in its string form)
+ * live in the data_t itself, keys of up to GF_DICT_INLINE_KEY bytes in the
+ * pair. The first GF_DICT_INLINE_PAIRS pairs and the first
+ * GF_DICT_INLINE_SLOTS hash slots are part of the dict_t, so the common
+ * fop-path dict with a handful of keys costs a single allocation.
+ */
+#define GF_DATA_INLINE_LEN      24
+#define GF_DICT_INLINE_KEY      48
+#define GF_DICT_INLINE_PAIRS    4
+#define GF_DICT_INLINE_SLOTS    8       /* power of 2 */
+
 struct _data {
         unsigned char  is_static:1;
         unsigned char  is_const:1;
         unsigned char  is_stdalloc:1;
+        unsigned char  is_inline:1;
         int32_t        len;
         char          *data;
-        int32_t        refcount;
-        gf_lock_t      lock;
+        int32_t        refcount;        /* updated atomically */
+        struct _data  *backing;         /* owner of data, see
+                                           dict_unserialize_ref() */
+        char           inline_data[GF_DATA_INLINE_LEN];
 };
 
 struct _data_pair {
-        struct _data_pair *hash_next;
         struct _data_pair *prev;
         struct _data_pair *next;
         data_t            *value;
         char              *key;
+        uint32_t           hash;
+        char               key_inline[GF_DICT_INLINE_KEY];
 };
 
+/* members is an open addressed table of hash_size slots (a power of 2),
+ * probed linearly; members_list links the pairs, newest first. */
 struct _dict {
         unsigned char   is_static:1;
         int32_t         hash_size;
@@ -90,9 +129,10 @@ struct _dict {
         char           *extra_free;
         char           *extra_stdfree;
         gf_lock_t       lock;
-        data_pair_t    *members_internal;
-        data_pair_t     free_pair;
-        gf_boolean_t    free_pair_in_use;
+        int32_t         used;           /* live and deleted slots */
+        uint32_t        pairs_in_use;   /* bitmap of pairs[] */
+        data_pair_t    *members_internal[GF_DICT_INLINE_SLOTS];
+        data_pair_t     pairs[GF_DICT_INLINE_PAIRS];
 };
 
 
@@ -111,6 +151,8 @@ int dict_reset (dict_t *dict);
 int32_t dict_serialized_length (dict_t *dict);
 int32_t dict_serialize (dict_t *dict, char *buf);
 int32_t dict_unserialize (char *buf, int32_t size, dict_t **fill);
+int32_t dict_unserialize_ref (char *buf, int32_t size, dict_t **fill);
+int dict_serialize_iov (dict_t *dict, struct iovec *iov);
 
 int32_t dict_allocate_and_serialize (dict_t *this, char **buf, u_int *length);
 
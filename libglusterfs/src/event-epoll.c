@@ -31,28 +31,190 @@
 #include <sys/epoll.h>
 
 
-static int
-__event_getindex (struct event_pool *event_pool, int fd, int idx)
+struct event_slot_epoll {
+	int fd;
+	int events;
+	int gen;
+	int ref;
+	int in_handler;
+	void *data;
+	event_handler_t handler;
+	gf_lock_t lock;
+};
+
+
+struct event_thread_data {
+        struct event_pool *event_pool;
+        int                event_index;
+};
+
+
+static struct event_slot_epoll *
+__event_newtable (struct event_pool *event_pool, int table_idx)
 {
-        int  ret = -1;
-        int  i = 0;
+        struct event_slot_epoll *table = NULL;
+        int                      i = 0;
 
-        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+        table = GF_CALLOC (EVENT_EPOLL_SLOTS, sizeof (*table),
+                           gf_common_mt_ereg);
+        if (!table)
+                return NULL;
 
-        if (idx > -1 && idx < event_pool->used) {
-                if (event_pool->reg[idx].fd == fd)
-                        ret = idx;
+        for (i = 0; i < EVENT_EPOLL_SLOTS; i++) {
+                table[i].fd = -1;
+                LOCK_INIT (&table[i].lock);
         }
 
-        for (i=0; ret == -1 && i<event_pool->used; i++) {
-                if (event_pool->reg[i].fd == fd) {
-                        ret = i;
-                        break;
+        event_pool->ereg[table_idx] = table;
+        event_pool->slots_used[table_idx] = 0;
+
+        return table;
+}
+
+
+/* A slot can be reused only once its fd is unregistered and no
+ * dispatcher holds a reference on it any more.
+ */
+static int
+__event_slot_alloc (struct event_pool *event_pool, int fd)
+{
+        struct event_slot_epoll *table = NULL;
+        int                      i = 0;
+        int                      j = 0;
+        int                      idx = -1;
+
+        for (i = 0; i < EVENT_EPOLL_TABLES && idx == -1; i++) {
+                if (event_pool->slots_used[i] == EVENT_EPOLL_SLOTS)
+                        continue;
+
+                table = event_pool->ereg[i];
+                if (!table) {
+                        table = __event_newtable (event_pool, i);
+                        if (!table)
+                                break;
+                }
+
+                for (j = 0; j < EVENT_EPOLL_SLOTS; j++) {
+                        LOCK (&table[j].lock);
+                        {
+                                if (table[j].fd == -1 && table[j].ref == 0) {
+                                        table[j].fd = fd;
+                                        table[j].ref = 1;
+                                        table[j].in_handler = 0;
+                                        idx = i * EVENT_EPOLL_SLOTS + j;
+                                }
+                        }
+                        UNLOCK (&table[j].lock);
+
+                        if (idx != -1) {
+                                event_pool->slots_used[i]++;
+                                break;
+                        }
                 }
         }
 
-out:
-        return ret;
+        return idx;
+}
+
+
+static struct event_slot_epoll *
+event_slot_get (struct event_pool *event_pool, int idx)
+{
+        struct event_slot_epoll *slot = NULL;
+        struct event_slot_epoll *table = NULL;
+
+        if (idx < 0 || idx >= EVENT_EPOLL_TABLES * EVENT_EPOLL_SLOTS)
+                return NULL;
+
+        table = event_pool->ereg[idx / EVENT_EPOLL_SLOTS];
+        if (!table)
+                return NULL;
+
+        slot = &table[idx % EVENT_EPOLL_SLOTS];
+
+        LOCK (&slot->lock);
+        {
+                slot->ref++;
+        }
+        UNLOCK (&slot->lock);
+
+        return slot;
+}
+
+
+static void
+event_slot_unref (struct event_pool *event_pool, struct event_slot_epoll *slot,
+                  int idx)
+{
+        int ref = -1;
+
+        LOCK (&slot->lock);
+        {
+                ref = --slot->ref;
+        }
+        UNLOCK (&slot->lock);
+
+        if (ref)
+                return;
+
+        pthread_mutex_lock (&event_pool->mutex);
+        {
+                event_pool->slots_used[idx / EVENT_EPOLL_SLOTS]--;
+        }
+        pthread_mutex_unlock (&event_pool->mutex);
+}
+
+
+static void
+__event_slot_set_events (struct event_slot_epoll *slot, int poll_in,
+                         int poll_out)
+{
+        switch (poll_in) {
+        case 1:
+                slot->events |= EPOLLIN;
+                break;
+        case 0:
+                slot->events &= ~EPOLLIN;
+                break;
+        case -1:
+                /* do nothing */
+                break;
+        default:
+                gf_log ("epoll", GF_LOG_ERROR,
+                        "invalid poll_in value %d", poll_in);
+                break;
+        }
+
+        switch (poll_out) {
+        case 1:
+                slot->events |= EPOLLOUT;
+                break;
+        case 0:
+                slot->events &= ~EPOLLOUT;
+                break;
+        case -1:
+                /* do nothing */
+                break;
+        default:
+                gf_log ("epoll", GF_LOG_ERROR,
+                        "invalid poll_out value %d", poll_out);
+                break;
+        }
+}
+
+
+static int
+__event_slot_arm (struct event_pool *event_pool, struct event_slot_epoll *slot,
+                  int idx, int op)
+{
+        struct epoll_event  epoll_event = {0, };
+        struct event_data  *ev_data = (void *)&epoll_event.data;
+
+        epoll_event.events = slot->events | EPOLLONESHOT;
+        ev_data->idx = idx;
+        ev_data->gen = slot->gen;
+
+        return epoll_ctl (event_pool->fd, op, slot->fd, &epoll_event);
 }
 
 
@@ -68,23 +230,11 @@ event_pool_new_epoll (int count)
         if (!event_pool)
                 goto out;
 
-        event_pool->count = count;
-        event_pool->reg = GF_CALLOC (event_pool->count,
-                                     sizeof (*event_pool->reg),
-                                     gf_common_mt_reg);
-
-        if (!event_pool->reg) {
-                GF_FREE (event_pool);
-                event_pool = NULL;
-                goto out;
-        }
-
         epfd = epoll_create (count);
 
         if (epfd == -1) {
                 gf_log ("epoll", GF_LOG_ERROR, "epoll fd creation failed (%s)",
                         strerror (errno));
-                GF_FREE (event_pool->reg);
                 GF_FREE (event_pool);
                 event_pool = NULL;
                 goto out;
@@ -94,6 +244,8 @@ event_pool_new_epoll (int count)
 
         event_pool->count = count;
 
+        event_pool->eventthreadcount = 1;
+
         pthread_mutex_init (&event_pool->mutex, NULL);
         pthread_cond_init (&event_pool->cond, NULL);
 
@@ -107,90 +259,49 @@ event_register_epoll (struct event_pool *event_pool, int fd,
                       event_handler_t handler,
                       void *data, int poll_in, int poll_out)
 {
-        int                 idx = -1;
-        int                 ret = -1;
-        struct epoll_event  epoll_event = {0, };
-        struct event_data  *ev_data = (void *)&epoll_event.data;
-
+        int                      idx = -1;
+        int                      ret = -1;
+        struct event_slot_epoll *slot = NULL;
 
         GF_VALIDATE_OR_GOTO ("event", event_pool, out);
 
         pthread_mutex_lock (&event_pool->mutex);
         {
-                if (event_pool->count == event_pool->used) {
-                        event_pool->count *= 2;
-
-                        event_pool->reg = GF_REALLOC (event_pool->reg,
-                                                      event_pool->count *
-                                                      sizeof (*event_pool->reg));
-
-                        if (!event_pool->reg) {
-                                gf_log ("epoll", GF_LOG_ERROR,
-                                        "event registry re-allocation failed");
-                                goto unlock;
-                        }
-                }
-
-                idx = event_pool->used;
-                event_pool->used++;
-
-                event_pool->reg[idx].fd = fd;
-                event_pool->reg[idx].events = EPOLLPRI;
-                event_pool->reg[idx].handler = handler;
-                event_pool->reg[idx].data = data;
-
-                switch (poll_in) {
-                case 1:
-                        event_pool->reg[idx].events |= EPOLLIN;
-                        break;
-                case 0:
-                        event_pool->reg[idx].events &= ~EPOLLIN;
-                        break;
-                case -1:
-                        /* do nothing */
-                        break;
-                default:
-                        gf_log ("epoll", GF_LOG_ERROR,
-                                "invalid poll_in value %d", poll_in);
-                        break;
-                }
+                idx = __event_slot_alloc (event_pool, fd);
+        }
+        pthread_mutex_unlock (&event_pool->mutex);
 
-                switch (poll_out) {
-                case 1:
-                        event_pool->reg[idx].events |= EPOLLOUT;
-                        break;
-                case 0:
-                        event_pool->reg[idx].events &= ~EPOLLOUT;
-                        break;
-                case -1:
-                        /* do nothing */
-                        break;
-                default:
-                        gf_log ("epoll", GF_LOG_ERROR,
-                                "invalid poll_out value %d", poll_out);
-                        break;
-                }
+        if (idx == -1) {
+                gf_log ("epoll", GF_LOG_ERROR,
+                        "could not find slot for fd=%d", fd);
+                goto out;
+        }
 
-                event_pool->changed = 1;
+        slot = event_slot_get (event_pool, idx);
 
-                epoll_event.events = event_pool->reg[idx].events;
-                ev_data->fd = fd;
-                ev_data->idx = idx;
+        LOCK (&slot->lock);
+        {
+                slot->events = EPOLLPRI;
+                slot->handler = handler;
+                slot->data = data;
 
-                ret = epoll_ctl (event_pool->fd, EPOLL_CTL_ADD, fd,
-                                 &epoll_event);
+                __event_slot_set_events (slot, poll_in, poll_out);
 
+                ret = __event_slot_arm (event_pool, slot, idx, EPOLL_CTL_ADD);
                 if (ret == -1) {
                         gf_log ("epoll", GF_LOG_ERROR,
                                 "failed to add fd(=%d) to epoll fd(=%d) (%s)",
                                 fd, event_pool->fd, strerror (errno));
-                        goto unlock;
+                        slot->fd = -1;
+                        slot->ref--;
                 }
-
-                pthread_cond_broadcast (&event_pool->cond);
         }
-unlock:
-        pthread_mutex_unlock (&event_pool->mutex);
+        UNLOCK (&slot->lock);
+
+        event_slot_unref (event_pool, slot, idx);
+
+        if (ret == 0)
+                ret = idx;
 
 out:
         return ret;
@@ -198,72 +309,54 @@ out:
 
 
 static int
-event_unregister_epoll (struct event_pool *event_pool, int fd, int idx_hint)
+event_unregister_epoll (struct event_pool *event_pool, int fd, int idx)
 {
-        int  idx = -1;
-        int  ret = -1;
-
-        struct epoll_event epoll_event = {0, };
-        struct event_data *ev_data = (void *)&epoll_event.data;
-        int                lastidx = -1;
+        int                      ret = -1;
+        int                      found = 0;
+        struct event_slot_epoll *slot = NULL;
 
         GF_VALIDATE_OR_GOTO ("event", event_pool, out);
 
-        pthread_mutex_lock (&event_pool->mutex);
-        {
-                idx = __event_getindex (event_pool, fd, idx_hint);
+        slot = event_slot_get (event_pool, idx);
+        if (!slot) {
+                gf_log ("epoll", GF_LOG_ERROR,
+                        "index not found for fd=%d (idx=%d)", fd, idx);
+                errno = ENOENT;
+                goto out;
+        }
 
-                if (idx == -1) {
+        LOCK (&slot->lock);
+        {
+                if (slot->fd != fd) {
                         gf_log ("epoll", GF_LOG_ERROR,
-                                "index not found for fd=%d (idx_hint=%d)",
-                                fd, idx_hint);
+                                "fd=%d is not registered at idx=%d", fd, idx);
                         errno = ENOENT;
                         goto unlock;
                 }
 
-                ret = epoll_ctl (event_pool->fd, EPOLL_CTL_DEL, fd, NULL);
-
-                /* if ret is -1, this array member should never be accessed */
-                /* if it is 0, the array member might be used by idx_cache
-                 * in which case the member should not be accessed till
-                 * it is reallocated
-                 */
-
-                event_pool->reg[idx].fd = -1;
+                found = 1;
 
+                ret = epoll_ctl (event_pool->fd, EPOLL_CTL_DEL, fd, NULL);
                 if (ret == -1) {
                         gf_log ("epoll", GF_LOG_ERROR,
                                 "fail to del fd(=%d) from epoll fd(=%d) (%s)",
                                 fd, event_pool->fd, strerror (errno));
-                        goto unlock;
                 }
 
-                lastidx = event_pool->used - 1;
-                if (lastidx == idx) {
-                        event_pool->used--;
-                        goto unlock;
-                }
-
-                epoll_event.events = event_pool->reg[lastidx].events;
-                ev_data->fd = event_pool->reg[lastidx].fd;
-                ev_data->idx = idx;
-
-                ret = epoll_ctl (event_pool->fd, EPOLL_CTL_MOD, ev_data->fd,
-                                 &epoll_event);
-                if (ret == -1) {
-                        gf_log ("epoll", GF_LOG_ERROR,
-                                "fail to modify fd(=%d) index %d to %d (%s)",
-                                ev_data->fd, event_pool->used, idx,
-                                strerror (errno));
-                        goto unlock;
-                }
-
-                /* just replace the unregistered idx by last one */
-                event_pool->reg[idx] = event_pool->reg[lastidx];
-                event_pool->used--;
+                /* events already fetched by other dispatchers and a late
+                 * event_handled() for this fd now see a stale gen */
+                slot->fd = -1;
+                slot->gen++;
+                slot->in_handler = 0;
+                slot->handler = NULL;
+                slot->data = NULL;
         }
 unlock:
-        pthread_mutex_unlock (&event_pool->mutex);
+        UNLOCK (&slot->lock);
+
+        if (found)
+                event_slot_unref (event_pool, slot, idx);
+        event_slot_unref (event_pool, slot, idx);
 
 out:
         return ret;
@@ -271,193 +364,323 @@ out:
 
 
 static int
-event_select_on_epoll (struct event_pool *event_pool, int fd, int idx_hint,
+event_select_on_epoll (struct event_pool *event_pool, int fd, int idx,
                        int poll_in, int poll_out)
 {
-        int idx = -1;
-        int ret = -1;
-
-        struct epoll_event epoll_event = {0, };
-        struct event_data *ev_data = (void *)&epoll_event.data;
-
+        int                      ret = -1;
+        struct event_slot_epoll *slot = NULL;
 
         GF_VALIDATE_OR_GOTO ("event", event_pool, out);
 
-        pthread_mutex_lock (&event_pool->mutex);
-        {
-                idx = __event_getindex (event_pool, fd, idx_hint);
+        slot = event_slot_get (event_pool, idx);
+        if (!slot) {
+                gf_log ("epoll", GF_LOG_ERROR,
+                        "index not found for fd=%d (idx=%d)", fd, idx);
+                errno = ENOENT;
+                goto out;
+        }
 
-                if (idx == -1) {
+        LOCK (&slot->lock);
+        {
+                if (slot->fd != fd) {
                         gf_log ("epoll", GF_LOG_ERROR,
-                                "index not found for fd=%d (idx_hint=%d)",
-                                fd, idx_hint);
+                                "fd=%d is not registered at idx=%d", fd, idx);
                         errno = ENOENT;
                         goto unlock;
                 }
 
-                switch (poll_in) {
-                case 1:
-                        event_pool->reg[idx].events |= EPOLLIN;
-                        break;
-                case 0:
-                        event_pool->reg[idx].events &= ~EPOLLIN;
-                        break;
-                case -1:
-                        /* do nothing */
-                        break;
-                default:
-                        gf_log ("epoll", GF_LOG_ERROR,
-                                "invalid poll_in value %d", poll_in);
-                        break;
-                }
+                __event_slot_set_events (slot, poll_in, poll_out);
 
-                switch (poll_out) {
-                case 1:
-                        event_pool->reg[idx].events |= EPOLLOUT;
-                        break;
-                case 0:
-                        event_pool->reg[idx].events &= ~EPOLLOUT;
-                        break;
-                case -1:
-                        /* do nothing */
-                        break;
-                default:
-                        gf_log ("epoll", GF_LOG_ERROR,
-                                "invalid poll_out value %d", poll_out);
-                        break;
+                /* re-arming now would let another dispatcher run the
+                 * handler concurrently, event_handled() picks up the new
+                 * events instead */
+                if (slot->in_handler) {
+                        ret = 0;
+                        goto unlock;
                 }
 
-                epoll_event.events = event_pool->reg[idx].events;
-                ev_data->fd = fd;
-                ev_data->idx = idx;
-
-                ret = epoll_ctl (event_pool->fd, EPOLL_CTL_MOD, fd,
-                                 &epoll_event);
+                ret = __event_slot_arm (event_pool, slot, idx, EPOLL_CTL_MOD);
                 if (ret == -1) {
                         gf_log ("epoll", GF_LOG_ERROR,
                                 "failed to modify fd(=%d) events to %d",
-                                fd, epoll_event.events);
+                                fd, slot->events);
                 }
         }
 unlock:
-        pthread_mutex_unlock (&event_pool->mutex);
+        UNLOCK (&slot->lock);
 
+        event_slot_unref (event_pool, slot, idx);
+
+        if (ret == 0)
+                ret = idx;
 out:
         return ret;
 }
 
 
 static int
-event_dispatch_epoll_handler (struct event_pool *event_pool,
-                              struct epoll_event *events, int i)
+event_handled_epoll (struct event_pool *event_pool, int fd, int idx, int gen)
 {
-        struct event_data  *event_data = NULL;
-        event_handler_t     handler = NULL;
-        void               *data = NULL;
-        int                 idx = -1;
-        int                 ret = -1;
-
+        int                      ret = 0;
+        struct event_slot_epoll *slot = NULL;
 
-        event_data = (void *)&events[i].data;
-        handler = NULL;
-        data = NULL;
+        slot = event_slot_get (event_pool, idx);
+        if (!slot)
+                return -1;
 
-        pthread_mutex_lock (&event_pool->mutex);
+        LOCK (&slot->lock);
         {
-                idx = __event_getindex (event_pool, event_data->fd,
-                                        event_data->idx);
+                /* unregistered (and maybe reused) while being handled */
+                if (slot->fd != fd || slot->gen != gen)
+                        goto unlock;
 
-                if (idx == -1) {
-                        gf_log ("epoll", GF_LOG_ERROR,
-                                "index not found for fd(=%d) (idx_hint=%d)",
-                                event_data->fd, event_data->idx);
+                if (slot->in_handler > 0)
+                        slot->in_handler--;
+                if (slot->in_handler)
                         goto unlock;
-                }
 
-                handler = event_pool->reg[idx].handler;
-                data = event_pool->reg[idx].data;
+                ret = __event_slot_arm (event_pool, slot, idx, EPOLL_CTL_MOD);
+                if (ret == -1) {
+                        gf_log ("epoll", GF_LOG_ERROR,
+                                "failed to re-arm fd(=%d) at idx=%d (%s)",
+                                fd, idx, strerror (errno));
+                }
         }
 unlock:
-        pthread_mutex_unlock (&event_pool->mutex);
+        UNLOCK (&slot->lock);
+
+        event_slot_unref (event_pool, slot, idx);
 
-        if (handler)
-                ret = handler (event_data->fd, event_data->idx, data,
-                               (events[i].events & (EPOLLIN|EPOLLPRI)),
-                               (events[i].events & (EPOLLOUT)),
-                               (events[i].events & (EPOLLERR|EPOLLHUP)));
         return ret;
 }
 
 
 static int
-event_dispatch_epoll (struct event_pool *event_pool)
+event_dispatch_epoll_handler (struct event_pool *event_pool,
+                              struct epoll_event *event)
 {
-        struct epoll_event *events = NULL;
-        int                 size = 0;
-        int                 i = 0;
-        int                 ret = -1;
+        struct event_data       *ev_data = NULL;
+        struct event_slot_epoll *slot = NULL;
+        event_handler_t          handler = NULL;
+        void                    *data = NULL;
+        int                      idx = -1;
+        int                      gen = -1;
+        int                      fd = -1;
+        int                      ret = -1;
+
+        ev_data = (void *)&event->data;
+        idx = ev_data->idx;
+        gen = ev_data->gen;
+
+        slot = event_slot_get (event_pool, idx);
+        if (!slot) {
+                gf_log ("epoll", GF_LOG_ERROR,
+                        "index not found for idx=%d (gen=%d)", idx, gen);
+                return -1;
+        }
 
-        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+        LOCK (&slot->lock);
+        {
+                if (slot->fd == -1 || slot->gen != gen)
+                        goto unlock;
 
-        while (1) {
-                pthread_mutex_lock (&event_pool->mutex);
-                {
-                        while (event_pool->used == 0)
-                                pthread_cond_wait (&event_pool->cond,
-                                                   &event_pool->mutex);
+                fd = slot->fd;
+                handler = slot->handler;
+                data = slot->data;
+                slot->in_handler++;
+        }
+unlock:
+        UNLOCK (&slot->lock);
 
-                        if (event_pool->used > event_pool->evcache_size) {
-                                GF_FREE (event_pool->evcache);
+        if (handler)
+                ret = handler (fd, idx, gen, data,
+                               (event->events & (EPOLLIN|EPOLLPRI)),
+                               (event->events & (EPOLLOUT)),
+                               (event->events & (EPOLLERR|EPOLLHUP)));
 
-                                event_pool->evcache = events = NULL;
+        event_slot_unref (event_pool, slot, idx);
+
+        return ret;
+}
 
-                                event_pool->evcache_size =
-                                        event_pool->used + 256;
 
-                                events = GF_CALLOC (event_pool->evcache_size,
-                                                    sizeof (struct epoll_event),
-                                                    gf_common_mt_epoll_event);
-                                if (!events)
-                                        break;
+static void *
+event_dispatch_epoll_worker (void *data)
+{
+        struct event_thread_data *ev_data = data;
+        struct event_pool        *event_pool = NULL;
+        struct epoll_event        event = {0, };
+        int                       myindex = -1;
+        int                       ret = -1;
+        int                       leave = 0;
+
+        event_pool = ev_data->event_pool;
+        myindex = ev_data->event_index;
+        GF_FREE (ev_data);
+
+        gf_log ("epoll", GF_LOG_INFO, "Started thread with index %d", myindex);
+
+        for (;;) {
+                /* the first dispatcher never goes away */
+                if (myindex > 1 && event_pool->eventthreadcount < myindex) {
+                        pthread_mutex_lock (&event_pool->mutex);
+                        {
+                                if (event_pool->eventthreadcount < myindex) {
+                                        event_pool->pollers[myindex - 1] = 0;
+                                        leave = 1;
+                                }
+                        }
+                        pthread_mutex_unlock (&event_pool->mutex);
 
-                                event_pool->evcache = events;
+                        if (leave) {
+                                gf_log ("epoll", GF_LOG_INFO,
+                                        "Exited thread with index %d",
+                                        myindex);
+                                break;
                         }
                 }
-                pthread_mutex_unlock (&event_pool->mutex);
 
-                ret = epoll_wait (event_pool->fd, event_pool->evcache,
-                                  event_pool->evcache_size, -1);
+                ret = epoll_wait (event_pool->fd, &event, 1, -1);
 
                 if (ret == 0)
                         /* timeout */
                         continue;
 
-                if (ret == -1 && errno == EINTR)
+                if (ret == -1)
                         /* sys call */
                         continue;
 
-                size = ret;
+                event_dispatch_epoll_handler (event_pool, &event);
+        }
+
+        return NULL;
+}
+
+
+static int
+__event_dispatch_epoll_spawn (struct event_pool *event_pool, int index)
+{
+        struct event_thread_data *ev_data = NULL;
+        pthread_t                 t_id;
+        int                       ret = -1;
+
+        ev_data = GF_CALLOC (1, sizeof (*ev_data), gf_common_mt_event_pool);
+        if (!ev_data)
+                goto out;
 
-                for (i = 0; i < size; i++) {
-                        if (!events || !events[i].events)
+        ev_data->event_pool = event_pool;
+        ev_data->event_index = index;
+
+        ret = gf_thread_create (&t_id, NULL, event_dispatch_epoll_worker,
+                                ev_data);
+        if (ret) {
+                gf_log ("epoll", GF_LOG_WARNING,
+                        "Failed to start thread for index %d", index);
+                GF_FREE (ev_data);
+                goto out;
+        }
+
+        /* only the first dispatcher is joined by event_dispatch() */
+        if (index > 1)
+                pthread_detach (t_id);
+
+        event_pool->pollers[index - 1] = t_id;
+out:
+        return ret;
+}
+
+
+static int
+event_dispatch_epoll (struct event_pool *event_pool)
+{
+        pthread_t  t_id;
+        int        pollercount = 0;
+        int        i = 0;
+        int        ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+
+        pthread_mutex_lock (&event_pool->mutex);
+        {
+                pollercount = event_pool->eventthreadcount;
+                for (i = 0; i < pollercount; i++) {
+                        ret = __event_dispatch_epoll_spawn (event_pool, i + 1);
+                        if (ret) {
+                                event_pool->eventthreadcount = i;
+                                break;
+                        }
+                }
+
+                t_id = event_pool->pollers[0];
+        }
+        pthread_mutex_unlock (&event_pool->mutex);
+
+        if (i == 0)
+                goto out;
+
+        ret = pthread_join (t_id, NULL);
+
+out:
+        return ret;
+}
+
+
+static int
+event_reconfigure_threads_epoll (struct event_pool *event_pool, int value)
+{
+        int i = 0;
+        int ret = 0;
+        int oldthreadcount = 0;
+
+        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+
+        if (value < 1)
+                value = 1;
+        if (value > EVENT_MAX_THREADS)
+                value = EVENT_MAX_THREADS;
+
+        pthread_mutex_lock (&event_pool->mutex);
+        {
+                oldthreadcount = event_pool->eventthreadcount;
+                event_pool->eventthreadcount = value;
+
+                /* not dispatching yet, event_dispatch() starts them all */
+                if (!event_pool->pollers[0])
+                        goto unlock;
+
+                /* surplus dispatchers exit on their next wake up; one that
+                 * has not noticed yet simply keeps running */
+                for (i = oldthreadcount; i < value; i++) {
+                        if (event_pool->pollers[i])
                                 continue;
 
-                        ret = event_dispatch_epoll_handler (event_pool,
-                                                            events, i);
+                        ret = __event_dispatch_epoll_spawn (event_pool, i + 1);
+                        if (ret) {
+                                event_pool->eventthreadcount = i;
+                                break;
+                        }
                 }
         }
+unlock:
+        pthread_mutex_unlock (&event_pool->mutex);
 
+        if (oldthreadcount != value)
+                gf_log ("epoll", GF_LOG_INFO, "event threads reconfigured "
+                        "from %d to %d", oldthreadcount,
+                        event_pool->eventthreadcount);
 out:
         return ret;
 }
 
 
 struct event_ops event_ops_epoll = {
-        .new              = event_pool_new_epoll,
-        .event_register   = event_register_epoll,
-        .event_select_on  = event_select_on_epoll,
-        .event_unregister = event_unregister_epoll,
-        .event_dispatch   = event_dispatch_epoll
+        .new                       = event_pool_new_epoll,
+        .event_register            = event_register_epoll,
+        .event_select_on           = event_select_on_epoll,
+        .event_unregister          = event_unregister_epoll,
+        .event_dispatch            = event_dispatch_epoll,
+        .event_reconfigure_threads = event_reconfigure_threads_epoll,
+        .event_handled             = event_handled_epoll
 };
 
 #endif
@@ -33,7 +33,7 @@ event_register_poll (struct event_pool *event_pool, int fd,
 
 
 static int
-__flush_fd (int fd, int idx, void *data,
+__flush_fd (int fd, int idx, int gen, void *data,
             int poll_in, int poll_out, int poll_err)
 {
         char buf[64];
@@ -354,7 +354,7 @@ unlock:
         pthread_mutex_unlock (&event_pool->mutex);
 
         if (handler)
-                ret = handler (ufds[i].fd, idx, data,
+                ret = handler (ufds[i].fd, idx, 0, data,
                                (ufds[i].revents & (POLLIN|POLLPRI)),
                                (ufds[i].revents & (POLLOUT)),
                                (ufds[i].revents & (POLLERR|POLLHUP|POLLNVAL)));
@@ -442,10 +442,28 @@ out:
 }
 
 
+static int
+event_reconfigure_threads_poll (struct event_pool *event_pool, int value)
+{
+        /* poll based dispatch is single threaded */
+        return 0;
+}
+
+
+static int
+event_handled_poll (struct event_pool *event_pool, int fd, int idx, int gen)
+{
+        /* poll is level triggered, nothing to re-arm */
+        return 0;
+}
+
+
 struct event_ops event_ops_poll = {
-        .new              = event_pool_new_poll,
-        .event_register   = event_register_poll,
-        .event_select_on  = event_select_on_poll,
-        .event_unregister = event_unregister_poll,
-        .event_dispatch   = event_dispatch_poll
+        .new                       = event_pool_new_poll,
+        .event_register            = event_register_poll,
+        .event_select_on           = event_select_on_poll,
+        .event_unregister          = event_unregister_poll,
+        .event_dispatch            = event_dispatch_poll,
+        .event_reconfigure_threads = event_reconfigure_threads_poll,
+        .event_handled             = event_handled_poll
 };
@@ -115,3 +115,66 @@ event_dispatch (struct event_pool *event_pool)
 out:
         return ret;
 }
+
+
+int
+event_reconfigure_threads (struct event_pool *event_pool, int value)
+{
+        int ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+
+        ret = event_pool->ops->event_reconfigure_threads (event_pool, value);
+
+out:
+        return ret;
+}
+
+
+/* Serializes the requests, so that the count applied last is the one
+   computed from all of them. event_pool->mutex cannot be held across
+   event_reconfigure_threads(), which takes it. */
+static pthread_mutex_t event_threads_lock = PTHREAD_MUTEX_INITIALIZER;
+
+int
+event_request_threads (struct event_pool *event_pool, int owner, int value)
+{
+        int ret = -1;
+        int max = 0;
+        int i = 0;
+
+        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+
+        if ((owner < 0) || (owner >= EVENT_THREADS_OWNERS)) {
+                gf_log ("event", GF_LOG_ERROR, "invalid owner %d", owner);
+                goto out;
+        }
+
+        pthread_mutex_lock (&event_threads_lock);
+        {
+                event_pool->threads_wanted[owner] = value;
+                for (i = 0; i < EVENT_THREADS_OWNERS; i++)
+                        if (event_pool->threads_wanted[i] > max)
+                                max = event_pool->threads_wanted[i];
+
+                ret = event_reconfigure_threads (event_pool, max);
+        }
+        pthread_mutex_unlock (&event_threads_lock);
+
+out:
+        return ret;
+}
+
+
+int
+event_handled (struct event_pool *event_pool, int fd, int idx, int gen)
+{
+        int ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+
+        ret = event_pool->ops->event_handled (event_pool, fd, idx, gen);
+
+out:
+        return ret;
+}
@@ -18,17 +18,37 @@
 
 #include <pthread.h>
 
+#define EVENT_EPOLL_TABLES 1024
+#define EVENT_EPOLL_SLOTS 1024
+#define EVENT_MAX_THREADS  32
+
 struct event_pool;
 struct event_ops;
+struct event_slot_epoll;
 struct event_data {
-	int fd;
 	int idx;
+	int gen;
 } __attribute__ ((__packed__, __may_alias__));
 
 
-typedef int (*event_handler_t) (int fd, int idx, void *data,
+/* With the epoll backend a registered fd is armed one-shot: once its
+ * handler has been called, no other dispatcher thread will see an event
+ * on it until the handler (or whoever it hands the work to) calls
+ * event_handled() with the fd, idx and gen it was given.
+ */
+typedef int (*event_handler_t) (int fd, int idx, int gen, void *data,
 				int poll_in, int poll_out, int poll_err);
 
+/* The protocol client and server of a process share its event pool, and
+ * each asks for the number of dispatcher threads it wants with
+ * event_request_threads(): the pool runs as many as the larger of them.
+ */
+enum event_threads_owner {
+	EVENT_THREADS_CLIENT,
+	EVENT_THREADS_SERVER,
+	EVENT_THREADS_OWNERS,
+};
+
 struct event_pool {
 	struct event_ops *ops;
 
@@ -51,6 +71,15 @@ struct event_pool {
 
 	void *evcache;
 	int evcache_size;
+
+	/* epoll: slots never move once allocated, so an in-flight event
+	 * can always find its registration by index */
+	struct event_slot_epoll *ereg[EVENT_EPOLL_TABLES];
+	int slots_used[EVENT_EPOLL_TABLES];
+
+	int eventthreadcount; /* number of dispatcher threads wanted */
+	int threads_wanted[EVENT_THREADS_OWNERS]; /* by owner, 0 if none */
+	pthread_t pollers[EVENT_MAX_THREADS]; /* started dispatchers */
 };
 
 struct event_ops {
@@ -66,6 +95,12 @@ struct event_ops {
         int (*event_unregister) (struct event_pool *event_pool, int fd, int idx);
 
         int (*event_dispatch) (struct event_pool *event_pool);
+
+        int (*event_reconfigure_threads) (struct event_pool *event_pool,
+                                          int newcount);
+
+        int (*event_handled) (struct event_pool *event_pool, int fd, int idx,
+                              int gen);
 };
 
 struct event_pool * event_pool_new (int count);
@@ -76,5 +111,9 @@ int event_register (struct event_pool *event_pool, int fd,
 		    void *data, int poll_in, int poll_out);
 int event_unregister (struct event_pool *event_pool, int fd, int idx);
 int event_dispatch (struct event_pool *event_pool);
+int event_reconfigure_threads (struct event_pool *event_pool, int value);
+int event_request_threads (struct event_pool *event_pool, int owner,
+			   int value);
+int event_handled (struct event_pool *event_pool, int fd, int idx, int gen);
 
 #endif /* _EVENT_H_ */
@@ -49,11 +49,10 @@ inode_table_prune (inode_table_t *table);
 void
 fd_dump (struct list_head *head, char *prefix);
 
-static int
-hash_dentry (inode_t *parent, const char *name, int mod)
+static uint32_t
+hash_dentry (inode_t *parent, const char *name)
 {
-        int hash = 0;
-        int ret = 0;
+        uint32_t hash = 0;
 
         hash = *name;
         if (hash) {
@@ -61,28 +60,313 @@ hash_dentry (inode_t *parent, const char *name, int mod)
                         hash = (hash << 5) - hash + *name;
                 }
         }
-        ret = (hash + (unsigned long)parent) % mod;
+        hash += (unsigned long)parent;
 
-        return ret;
+        /* buckets and stripes are picked by the low bits */
+        hash *= 0x9e3779b1;
+        hash ^= hash >> 16;
+
+        return hash;
+}
+
+
+static uint32_t
+hash_gfid (uuid_t uuid)
+{
+        return ((uint32_t)uuid[12] << 24) | (uuid[13] << 16) |
+                (uuid[14] << 8) | uuid[15];
+}
+
+
+static pthread_mutex_t *
+inode_hash_lock (inode_table_t *table, uuid_t gfid)
+{
+        uint32_t hash = hash_gfid (gfid);
+
+        return &table->hash_lock[hash & (GF_INODE_LOCK_STRIPES - 1)];
+}
+
+
+static pthread_mutex_t *
+dentry_hash_lock (inode_table_t *table, uint32_t hash)
+{
+        return &table->name_lock[hash & (GF_INODE_LOCK_STRIPES - 1)];
+}
+
+
+/* old buckets moved along with every insert or removal during a resize,
+   and the number of (mostly empty) buckets looked at to find them */
+#define INODE_HASH_STEP 8
+#define INODE_HASH_SCAN 256
+
+/* number of chain length classes in the statedump histogram */
+#define INODE_HASH_HIST 8
+
+typedef uint32_t (*inode_hash_fn_t) (struct list_head *entry);
+
+
+static uint32_t
+inode_hash_of (struct list_head *entry)
+{
+        return hash_gfid (list_entry (entry, inode_t, hash)->gfid);
+}
+
+
+static uint32_t
+dentry_hash_of (struct list_head *entry)
+{
+        return list_entry (entry, dentry_t, hash)->hashval;
+}
+
+
+static uint32_t
+inode_hash_size (uint32_t entries)
+{
+        uint32_t size = GF_INODE_HASH_MIN_SIZE;
+
+        while (size < entries && size < GF_INODE_HASH_MAX_SIZE)
+                size <<= 1;
+
+        return size;
+}
+
+
+static struct list_head *
+inode_hash_buckets_new (uint32_t size)
+{
+        struct list_head *buckets = NULL;
+        uint32_t          i = 0;
+
+        buckets = GF_CALLOC (size, sizeof (*buckets), gf_common_mt_list_head);
+        if (!buckets)
+                return NULL;
+
+        for (i = 0; i < size; i++)
+                INIT_LIST_HEAD (&buckets[i]);
+
+        return buckets;
+}
+
+
+/* The bucket an entry with this hash value is in, or has to be added to.
+   The stripe lock of the hash value or table->lock held. */
+static struct list_head *
+inode_hash_bucket (struct _inode_hash *ht, uint32_t hash)
+{
+        uint32_t idx = 0;
+
+        if (ht->old) {
+                idx = hash & (ht->old_size - 1);
+                if (idx >= ht->moved)
+                        return &ht->old[idx];
+        }
+
+        return &ht->buckets[hash & (ht->size - 1)];
+}
+
+
+static void
+inode_hash_lock_all (pthread_mutex_t *locks)
+{
+        int i = 0;
+
+        for (i = 0; i < GF_INODE_LOCK_STRIPES; i++)
+                pthread_mutex_lock (&locks[i]);
+}
+
+
+static void
+inode_hash_unlock_all (pthread_mutex_t *locks)
+{
+        int i = 0;
+
+        for (i = GF_INODE_LOCK_STRIPES - 1; i >= 0; i--)
+                pthread_mutex_unlock (&locks[i]);
+}
+
+
+/* Swapping the arrays is the only step which has to keep lookups out. */
+static void
+__inode_hash_resize (struct _inode_hash *ht, pthread_mutex_t *locks,
+                     uint32_t size)
+{
+        struct list_head *buckets = NULL;
+
+        buckets = inode_hash_buckets_new (size);
+        if (!buckets)
+                return; /* try again on the next insert */
+
+        inode_hash_lock_all (locks);
+        {
+                ht->old = ht->buckets;
+                ht->old_size = ht->size;
+                ht->moved = 0;
+                ht->buckets = buckets;
+                ht->size = size;
+        }
+        inode_hash_unlock_all (locks);
+}
+
+
+/* Moves a few more buckets of a running resize, or starts one if the
+   chains got too long or the table too sparse. table->lock held, no
+   stripe lock. */
+static void
+__inode_hash_step (struct _inode_hash *ht, pthread_mutex_t *locks,
+                   inode_hash_fn_t hashfn)
+{
+        struct list_head *pos = NULL;
+        struct list_head *old = NULL;
+        pthread_mutex_t  *lock = NULL;
+        uint32_t          idx = 0;
+        int               busy = 0;
+        int               i = 0;
+
+        if (!ht->old) {
+                if (ht->count > ht->size && ht->size < GF_INODE_HASH_MAX_SIZE)
+                        __inode_hash_resize (ht, locks, ht->size << 1);
+                else if (ht->count < ht->size / 8 &&
+                         ht->size > GF_INODE_HASH_MIN_SIZE)
+                        __inode_hash_resize (ht, locks,
+                                             inode_hash_size (ht->count * 2));
+                return;
+        }
+
+        /* empty buckets are cheap, they only count towards the scan limit */
+        for (i = 0; i < INODE_HASH_SCAN && busy < INODE_HASH_STEP &&
+                     ht->moved < ht->old_size; i++) {
+                idx = ht->moved;
+                if (list_empty (&ht->old[idx])) {
+                        ht->moved = idx + 1;
+                        continue;
+                }
+                busy++;
+
+                /* both sizes are multiples of the number of stripes, so
+                   the entries stay under the same lock */
+                lock = &locks[idx & (GF_INODE_LOCK_STRIPES - 1)];
+
+                pthread_mutex_lock (lock);
+                {
+                        while (!list_empty (&ht->old[idx])) {
+                                pos = ht->old[idx].next;
+                                list_move (pos, &ht->buckets[hashfn (pos) &
+                                                             (ht->size - 1)]);
+                        }
+                        ht->moved = idx + 1;
+                }
+                pthread_mutex_unlock (lock);
+        }
+
+        if (ht->moved < ht->old_size)
+                return;
+
+        inode_hash_lock_all (locks);
+        {
+                old = ht->old;
+                ht->old = NULL;
+                ht->old_size = 0;
+                ht->moved = 0;
+        }
+        inode_hash_unlock_all (locks);
+
+        GF_FREE (old);
 }
 
 
 static int
-hash_gfid (uuid_t uuid, int mod)
+inode_hash_init (struct _inode_hash *ht, uint32_t size)
 {
-        int ret = 0;
+        ht->buckets = inode_hash_buckets_new (size);
+        if (!ht->buckets)
+                return -1;
 
-        ret = uuid[15] + (uuid[14] << 8);
+        ht->size = size;
 
-        return ret;
+        return 0;
+}
+
+
+static void
+inode_hash_chains (struct list_head *buckets, uint32_t from, uint32_t to,
+                   uint32_t *hist, uint32_t *max)
+{
+        struct list_head *pos = NULL;
+        uint32_t          len = 0;
+        uint32_t          idx = 0;
+        int               class = 0;
+
+        for (idx = from; idx < to; idx++) {
+                len = 0;
+                list_for_each (pos, &buckets[idx])
+                        len++;
+
+                if (len > *max)
+                        *max = len;
+
+                /* 0, 1, 2-3, 4-7, ... */
+                for (class = 0; len && class < INODE_HASH_HIST - 1; class++)
+                        len >>= 1;
+                hist[class]++;
+        }
+}
+
+
+/* table->lock held */
+static void
+inode_hash_dump (struct _inode_hash *ht, char *prefix, const char *name)
+{
+        char      key[GF_DUMP_MAX_BUF_LEN];
+        char      range[32];
+        uint32_t  hist[INODE_HASH_HIST] = {0, };
+        uint32_t  max = 0;
+        uint32_t  lo = 0;
+        int       i = 0;
+
+        inode_hash_chains (ht->buckets, 0, ht->size, hist, &max);
+        if (ht->old)
+                inode_hash_chains (ht->old, ht->moved, ht->old_size, hist,
+                                   &max);
+
+        gf_proc_dump_build_key (key, prefix, "%s.size", name);
+        gf_proc_dump_write (key, "%u", ht->size);
+        gf_proc_dump_build_key (key, prefix, "%s.count", name);
+        gf_proc_dump_write (key, "%u", ht->count);
+        if (ht->old) {
+                gf_proc_dump_build_key (key, prefix, "%s.resizing_from",
+                                        name);
+                gf_proc_dump_write (key, "%u (%u moved)", ht->old_size,
+                                    ht->moved);
+        }
+        gf_proc_dump_build_key (key, prefix, "%s.max_chain", name);
+        gf_proc_dump_write (key, "%u", max);
+
+        for (i = 0; i < INODE_HASH_HIST; i++) {
+                lo = i ? 1 << (i - 1) : 0;
+                if (i == INODE_HASH_HIST - 1)
+                        snprintf (range, sizeof (range), "%u+", lo);
+                else if (i < 2)
+                        snprintf (range, sizeof (range), "%u", lo);
+                else
+                        snprintf (range, sizeof (range), "%u-%u", lo,
+                                  2 * lo - 1);
+
+                gf_proc_dump_build_key (key, prefix, "%s.chains[%s]", name,
+                                        range);
+                gf_proc_dump_write (key, "%u", hist[i]);
+        }
 }
 
 
+static void
+__dentry_unhash (dentry_t *dentry);
+
+
 static void
 __dentry_hash (dentry_t *dentry)
 {
         inode_table_t   *table = NULL;
-        int              hash = 0;
+        pthread_mutex_t *lock = NULL;
 
         if (!dentry) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "dentry not found");
@@ -90,11 +374,21 @@ __dentry_hash (dentry_t *dentry)
         }
 
         table = dentry->inode->table;
-        hash = hash_dentry (dentry->parent, dentry->name,
-                            table->hashsize);
 
-        list_del_init (&dentry->hash);
-        list_add (&dentry->hash, &table->name_hash[hash]);
+        __dentry_unhash (dentry);
+
+        lock = dentry_hash_lock (table, dentry->hashval);
+        pthread_mutex_lock (lock);
+        {
+                list_add (&dentry->hash,
+                          inode_hash_bucket (&table->name_hash,
+                                             dentry->hashval));
+        }
+        pthread_mutex_unlock (lock);
+
+        table->name_hash.count++;
+        __inode_hash_step (&table->name_hash, table->name_lock,
+                           dentry_hash_of);
 }
 
 
@@ -113,12 +407,29 @@ __is_dentry_hashed (dentry_t *dentry)
 static void
 __dentry_unhash (dentry_t *dentry)
 {
+        inode_table_t   *table = NULL;
+        pthread_mutex_t *lock = NULL;
+
         if (!dentry) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "dentry not found");
                 return;
         }
 
-        list_del_init (&dentry->hash);
+        if (list_empty (&dentry->hash))
+                return;
+
+        table = dentry->inode->table;
+
+        lock = dentry_hash_lock (table, dentry->hashval);
+        pthread_mutex_lock (lock);
+        {
+                list_del_init (&dentry->hash);
+        }
+        pthread_mutex_unlock (lock);
+
+        table->name_hash.count--;
+        __inode_hash_step (&table->name_hash, table->name_lock,
+                           dentry_hash_of);
 }
 
 
@@ -221,18 +532,6 @@ __is_dentry_cyclic (dentry_t *dentry)
 }
 
 
-static void
-__inode_unhash (inode_t *inode)
-{
-        if (!inode) {
-                gf_log_callingfn (THIS->name, GF_LOG_WARNING, "inode not found");
-                return;
-        }
-
-        list_del_init (&inode->hash);
-}
-
-
 static int
 __is_inode_hashed (inode_t *inode)
 {
@@ -245,11 +544,14 @@ __is_inode_hashed (inode_t *inode)
 }
 
 
+/* Called right after the gfid is set. The caller holds a reference, so
+   nobody can be taking the first one under the hash_lock of the old gfid. */
 static void
 __inode_hash (inode_t *inode)
 {
-        inode_table_t *table = NULL;
-        int            hash = 0;
+        inode_table_t   *table = NULL;
+        pthread_mutex_t *lock = NULL;
+        uint32_t         hash = 0;
 
         if (!inode) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "inode not found");
@@ -257,10 +559,22 @@ __inode_hash (inode_t *inode)
         }
 
         table = inode->table;
-        hash = hash_gfid (inode->gfid, 65536);
+        hash = hash_gfid (inode->gfid);
+
+        lock = inode_hash_lock (table, inode->gfid);
+        pthread_mutex_lock (lock);
+        {
+                if (list_empty (&inode->hash))
+                        table->inode_hash.count++;
+                else
+                        list_del_init (&inode->hash);
+                list_add (&inode->hash,
+                          inode_hash_bucket (&table->inode_hash, hash));
+        }
+        pthread_mutex_unlock (lock);
 
-        list_del_init (&inode->hash);
-        list_add (&inode->hash, &table->inode_hash[hash]);
+        __inode_hash_step (&table->inode_hash, table->hash_lock,
+                           inode_hash_of);
 }
 
 
@@ -329,14 +643,24 @@ noctx:
 }
 
 
+/* Moves the inode to the active list; table->lock and its hash_lock held. */
 static void
 __inode_activate (inode_t *inode)
 {
+        inode_table_t *table = NULL;
+
         if (!inode)
                 return;
 
-        list_move (&inode->list, &inode->table->active);
-        inode->table->active_size++;
+        table = inode->table;
+
+        if (inode->in_lru) {
+                table->lru_size--;
+                inode->in_lru = 0;
+        }
+
+        list_move (&inode->list, &table->active);
+        table->active_size++;
 }
 
 
@@ -351,9 +675,6 @@ __inode_passivate (inode_t *inode)
                 return;
         }
 
-        list_move_tail (&inode->list, &inode->table->lru);
-        inode->table->lru_size++;
-
         list_for_each_entry_safe (dentry, t, &inode->dentry_list, inode_list) {
                 if (!__is_dentry_hashed (dentry))
                         __dentry_unset (dentry);
@@ -361,6 +682,7 @@ __inode_passivate (inode_t *inode)
 }
 
 
+/* The inode has already been unhashed and moved to the purge list. */
 static void
 __inode_retire (inode_t *inode)
 {
@@ -372,17 +694,209 @@ __inode_retire (inode_t *inode)
                 return;
         }
 
-        list_move_tail (&inode->list, &inode->table->purge);
-        inode->table->purge_size++;
-
-        __inode_unhash (inode);
-
         list_for_each_entry_safe (dentry, t, &inode->dentry_list, inode_list) {
                 __dentry_unset (dentry);
         }
 }
 
 
+/* table->lock and the hash_lock of the inode held, no refs left */
+static void
+__inode_move_to_purge (inode_t *inode)
+{
+        inode_table_t *table = inode->table;
+
+        if (inode->in_lru)
+                table->lru_size--;
+        else
+                table->active_size--;
+        inode->in_lru = 0;
+
+        if (!list_empty (&inode->hash)) {
+                list_del_init (&inode->hash);
+                table->inode_hash.count--;
+        }
+
+        list_move_tail (&inode->list, &table->purge);
+        table->purge_size++;
+}
+
+
+/* Takes a reference on an inode which already has one, without locks.
+   Returns 0 if there was none to begin with. */
+static int
+__inode_ref_shared (inode_t *inode)
+{
+        uint32_t old = 0;
+        uint32_t cur = 0;
+
+        old = inode->ref;
+        while (old) {
+                cur = __sync_val_compare_and_swap (&inode->ref, old, old + 1);
+                if (cur == old)
+                        return 1;
+                old = cur;
+        }
+
+        return 0;
+}
+
+
+/* Takes a reference, hash_lock of the inode held. Returns 1 if that
+   revived an inode from the lru list, which the caller then passes to
+   inode_activate_revived () once it has dropped its locks. */
+static int
+__inode_get (inode_t *inode)
+{
+        return (__sync_fetch_and_add (&inode->ref, 1) == 0 && inode->in_lru);
+}
+
+
+/* Moves an inode revived from the lru list to the active list, with the
+   reference taken on it still held. Lookups revive inodes under their
+   hash_lock alone, which ranks below table->lock, so this happens right
+   after instead of being left to the next prune, which does not run at
+   all without an lru_limit. */
+static void
+inode_activate_revived (inode_t *inode)
+{
+        inode_table_t   *table = inode->table;
+        pthread_mutex_t *lock = NULL;
+
+        lock = inode_hash_lock (table, inode->gfid);
+
+        pthread_mutex_lock (&table->lock);
+        {
+                pthread_mutex_lock (lock);
+                {
+                        if (inode->ref && inode->in_lru)
+                                __inode_activate (inode);
+                }
+                pthread_mutex_unlock (lock);
+        }
+        pthread_mutex_unlock (&table->lock);
+}
+
+
+/* Lookups only find inodes through a hash chain or a dentry; an inode that
+   has been unhashed is on its way to the purge list and must not be
+   revived. */
+static inode_t *
+__inode_get_hashed (inode_t *inode, int *revived)
+{
+        pthread_mutex_t *lock = NULL;
+
+        if (__is_root_gfid (inode->gfid) && inode->ref)
+                return inode;
+
+        if (__inode_ref_shared (inode))
+                return inode;
+
+        lock = inode_hash_lock (inode->table, inode->gfid);
+        pthread_mutex_lock (lock);
+        {
+                if (list_empty (&inode->hash))
+                        inode = NULL;
+                else
+                        *revived = __inode_get (inode);
+        }
+        pthread_mutex_unlock (lock);
+
+        return inode;
+}
+
+
+/*
+ * Drops a reference. Returns 1 if it is the last one and the inode has to
+ * be passivated or retired: the reference is then kept for
+ * __inode_release () to drop under table->lock. An inode which is already
+ * on the lru list and still looked up just stays where it is.
+ */
+static int
+__inode_put (inode_t *inode)
+{
+        pthread_mutex_t *lock = NULL;
+        uint32_t         old = 0;
+        uint32_t         cur = 0;
+        int              last = 0;
+
+        old = inode->ref;
+        while (old > 1) {
+                cur = __sync_val_compare_and_swap (&inode->ref, old, old - 1);
+                if (cur == old)
+                        return 0;
+                old = cur;
+        }
+
+        lock = inode_hash_lock (inode->table, inode->gfid);
+        pthread_mutex_lock (lock);
+        {
+                if (inode->ref > 1) {
+                        __sync_sub_and_fetch (&inode->ref, 1);
+                } else if (inode->in_lru && inode->nlookup) {
+                        __sync_sub_and_fetch (&inode->ref, 1);
+                        inode->accessed = 1;
+                } else {
+                        last = 1;
+                }
+        }
+        pthread_mutex_unlock (lock);
+
+        return last;
+}
+
+
+/* Drops the reference __inode_put () kept, table->lock held. */
+static void
+__inode_release (inode_t *inode)
+{
+        inode_table_t   *table = NULL;
+        pthread_mutex_t *lock = NULL;
+        int              retire = 0;
+        int              revived = 0;
+
+        table = inode->table;
+
+        lock = inode_hash_lock (table, inode->gfid);
+        pthread_mutex_lock (lock);
+        {
+                if (__sync_sub_and_fetch (&inode->ref, 1)) {
+                        revived = 1;
+                        goto unlock;
+                }
+
+                if (inode->nlookup) {
+                        if (!inode->in_lru) {
+                                table->active_size--;
+                                list_move_tail (&inode->list, &table->lru);
+                                table->lru_size++;
+                                inode->in_lru = 1;
+                        }
+                        inode->accessed = 0;
+                } else {
+                        __inode_move_to_purge (inode);
+                        retire = 1;
+                }
+        }
+unlock:
+        pthread_mutex_unlock (lock);
+
+        if (revived)
+                return;
+
+        if (retire)
+                __inode_hash_step (&table->inode_hash, table->hash_lock,
+                                   inode_hash_of);
+
+        /* unhashed dentries cannot be found, even if a lookup has taken
+           the inode off the lru list again by now */
+        if (retire)
+                __inode_retire (inode);
+        else
+                __inode_passivate (inode);
+}
+
+
 static inode_t *
 __inode_unref (inode_t *inode)
 {
@@ -398,16 +912,8 @@ __inode_unref (inode_t *inode)
 
         GF_ASSERT (inode->ref);
 
-        --inode->ref;
-
-        if (!inode->ref) {
-                inode->table->active_size--;
-
-                if (inode->nlookup)
-                        __inode_passivate (inode);
-                else
-                        __inode_retire (inode);
-        }
+        if (__inode_put (inode))
+                __inode_release (inode);
 
         return inode;
 }
@@ -416,14 +922,11 @@ __inode_unref (inode_t *inode)
 static inode_t *
 __inode_ref (inode_t *inode)
 {
+        pthread_mutex_t *lock = NULL;
+
         if (!inode)
                 return NULL;
 
-        if (!inode->ref) {
-                inode->table->lru_size--;
-                __inode_activate (inode);
-        }
-
         /*
          * Root inode should always be in active list of inode table. So unrefs
          * on root inode are no-ops. If we do not allow unrefs but allow refs,
@@ -435,7 +938,17 @@ __inode_ref (inode_t *inode)
         if (__is_root_gfid(inode->gfid) && inode->ref)
                 return inode;
 
-        inode->ref++;
+        if (__inode_ref_shared (inode))
+                return inode;
+
+        /* table->lock is held anyway, so activate it right away */
+        lock = inode_hash_lock (inode->table, inode->gfid);
+        pthread_mutex_lock (lock);
+        {
+                if (!__sync_fetch_and_add (&inode->ref, 1) && inode->in_lru)
+                        __inode_activate (inode);
+        }
+        pthread_mutex_unlock (lock);
 
         return inode;
 }
@@ -449,11 +962,19 @@ inode_unref (inode_t *inode)
         if (!inode)
                 return NULL;
 
+        if (__is_root_gfid (inode->gfid))
+                return inode;
+
+        GF_ASSERT (inode->ref);
+
+        if (!__inode_put (inode))
+                return inode;
+
         table = inode->table;
 
         pthread_mutex_lock (&table->lock);
         {
-                inode = __inode_unref (inode);
+                __inode_release (inode);
         }
         pthread_mutex_unlock (&table->lock);
 
@@ -466,18 +987,27 @@ inode_unref (inode_t *inode)
 inode_t *
 inode_ref (inode_t *inode)
 {
-        inode_table_t *table = NULL;
+        pthread_mutex_t *lock = NULL;
+        int              revived = 0;
 
         if (!inode)
                 return NULL;
 
-        table = inode->table;
+        if (__is_root_gfid (inode->gfid) && inode->ref)
+                return inode;
 
-        pthread_mutex_lock (&table->lock);
+        if (__inode_ref_shared (inode))
+                return inode;
+
+        lock = inode_hash_lock (inode->table, inode->gfid);
+        pthread_mutex_lock (lock);
         {
-                inode = __inode_ref (inode);
+                revived = __inode_get (inode);
         }
-        pthread_mutex_unlock (&table->lock);
+        pthread_mutex_unlock (lock);
+
+        if (revived)
+                inode_activate_revived (inode);
 
         return inode;
 }
@@ -511,6 +1041,7 @@ __dentry_create (inode_t *inode, inode_t *parent, const char *name)
 
         if (parent)
                 newd->parent = __inode_ref (parent);
+        newd->hashval = hash_dentry (parent, name);
 
         list_add (&newd->inode_list, &inode->dentry_list);
         newd->inode = inode;
@@ -556,6 +1087,7 @@ __inode_create (inode_table_t *table)
 
         list_add (&newi->list, &table->lru);
         table->lru_size++;
+        newi->in_lru = 1;
 
 out:
 
@@ -586,13 +1118,15 @@ inode_new (inode_table_t *table)
 }
 
 
+/* nlookup only changes while the caller holds a reference, see
+   __inode_put () for the one reader outside table->lock */
 static inode_t *
 __inode_lookup (inode_t *inode)
 {
         if (!inode)
                 return NULL;
 
-        inode->nlookup++;
+        __sync_add_and_fetch (&inode->nlookup, 1);
 
         return inode;
 }
@@ -606,29 +1140,26 @@ __inode_forget (inode_t *inode, uint64_t nlookup)
 
         GF_ASSERT (inode->nlookup >= nlookup);
 
-        inode->nlookup -= nlookup;
-
         if (!nlookup)
-                inode->nlookup = 0;
+                nlookup = inode->nlookup;
+
+        __sync_sub_and_fetch (&inode->nlookup, nlookup);
 
         return inode;
 }
 
 
-dentry_t *
-__dentry_grep (inode_table_t *table, inode_t *parent, const char *name)
+static dentry_t *
+__dentry_grep_bucket (inode_table_t *table, uint32_t hash, inode_t *parent,
+                      const char *name)
 {
-        int       hash = 0;
         dentry_t *dentry = NULL;
         dentry_t *tmp = NULL;
 
-        if (!table || !name || !parent)
-                return NULL;
-
-        hash = hash_dentry (parent, name, table->hashsize);
-
-        list_for_each_entry (tmp, &table->name_hash[hash], hash) {
-                if (tmp->parent == parent && !strcmp (tmp->name, name)) {
+        list_for_each_entry (tmp, inode_hash_bucket (&table->name_hash, hash),
+                             hash) {
+                if (tmp->hashval == hash && tmp->parent == parent &&
+                    !strcmp (tmp->name, name)) {
                         dentry = tmp;
                         break;
                 }
@@ -638,11 +1169,29 @@ __dentry_grep (inode_table_t *table, inode_t *parent, const char *name)
 }
 
 
+/* table->lock or the name_lock of the bucket held */
+dentry_t *
+__dentry_grep (inode_table_t *table, inode_t *parent, const char *name)
+{
+        uint32_t  hash = 0;
+
+        if (!table || !name || !parent)
+                return NULL;
+
+        hash = hash_dentry (parent, name);
+
+        return __dentry_grep_bucket (table, hash, parent, name);
+}
+
+
 inode_t *
 inode_grep (inode_table_t *table, inode_t *parent, const char *name)
 {
-        inode_t   *inode = NULL;
-        dentry_t  *dentry = NULL;
+        inode_t         *inode = NULL;
+        dentry_t        *dentry = NULL;
+        pthread_mutex_t *lock = NULL;
+        uint32_t         hash = 0;
+        int              revived = 0;
 
         if (!table || !parent || !name) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING,
@@ -650,17 +1199,23 @@ inode_grep (inode_table_t *table, inode_t *parent, const char *name)
                 return NULL;
         }
 
-        pthread_mutex_lock (&table->lock);
+        hash = hash_dentry (parent, name);
+        lock = dentry_hash_lock (table, hash);
+
+        pthread_mutex_lock (lock);
         {
-                dentry = __dentry_grep (table, parent, name);
+                dentry = __dentry_grep_bucket (table, hash, parent, name);
 
                 if (dentry)
                         inode = dentry->inode;
 
                 if (inode)
-                        __inode_ref (inode);
+                        inode = __inode_get_hashed (inode, &revived);
         }
-        pthread_mutex_unlock (&table->lock);
+        pthread_mutex_unlock (lock);
+
+        if (revived)
+                inode_activate_revived (inode);
 
         return inode;
 }
@@ -713,9 +1268,11 @@ int
 inode_grep_for_gfid (inode_table_t *table, inode_t *parent, const char *name,
                      uuid_t gfid, ia_type_t *type)
 {
-        inode_t   *inode = NULL;
-        dentry_t  *dentry = NULL;
-        int        ret = -1;
+        inode_t         *inode = NULL;
+        dentry_t        *dentry = NULL;
+        pthread_mutex_t *lock = NULL;
+        uint32_t         hash = 0;
+        int              ret = -1;
 
         if (!table || !parent || !name) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING,
@@ -723,9 +1280,12 @@ inode_grep_for_gfid (inode_table_t *table, inode_t *parent, const char *name,
                 return ret;
         }
 
-        pthread_mutex_lock (&table->lock);
+        hash = hash_dentry (parent, name);
+        lock = dentry_hash_lock (table, hash);
+
+        pthread_mutex_lock (lock);
         {
-                dentry = __dentry_grep (table, parent, name);
+                dentry = __dentry_grep_bucket (table, hash, parent, name);
 
                 if (dentry)
                         inode = dentry->inode;
@@ -736,7 +1296,7 @@ inode_grep_for_gfid (inode_table_t *table, inode_t *parent, const char *name,
                         ret = 0;
                 }
         }
-        pthread_mutex_unlock (&table->lock);
+        pthread_mutex_unlock (lock);
 
         return ret;
 }
@@ -758,12 +1318,13 @@ __is_root_gfid (uuid_t gfid)
 }
 
 
+/* table->lock or the hash_lock of the gfid held */
 inode_t *
 __inode_find (inode_table_t *table, uuid_t gfid)
 {
         inode_t   *inode = NULL;
         inode_t   *tmp = NULL;
-        int        hash = 0;
+        uint32_t   hash = 0;
 
         if (!table) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "table not found");
@@ -773,9 +1334,10 @@ __inode_find (inode_table_t *table, uuid_t gfid)
         if (__is_root_gfid (gfid))
                 return table->root;
 
-        hash = hash_gfid (gfid, 65536);
+        hash = hash_gfid (gfid);
 
-        list_for_each_entry (tmp, &table->inode_hash[hash], hash) {
+        list_for_each_entry (tmp, inode_hash_bucket (&table->inode_hash, hash),
+                             hash) {
                 if (uuid_compare (tmp->gfid, gfid) == 0) {
                         inode = tmp;
                         break;
@@ -790,20 +1352,29 @@ out:
 inode_t *
 inode_find (inode_table_t *table, uuid_t gfid)
 {
-        inode_t   *inode = NULL;
+        inode_t         *inode = NULL;
+        pthread_mutex_t *lock = NULL;
+        int              revived = 0;
 
         if (!table) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "table not found");
                 return NULL;
         }
 
-        pthread_mutex_lock (&table->lock);
+        if (__is_root_gfid (gfid))
+                return inode_ref (table->root);
+
+        lock = inode_hash_lock (table, gfid);
+        pthread_mutex_lock (lock);
         {
                 inode = __inode_find (table, gfid);
-                if (inode)
-                        __inode_ref (inode);
+                if (inode && !__inode_ref_shared (inode))
+                        revived = __inode_get (inode);
         }
-        pthread_mutex_unlock (&table->lock);
+        pthread_mutex_unlock (lock);
+
+        if (revived)
+                inode_activate_revived (inode);
 
         return inode;
 }
@@ -921,20 +1492,12 @@ inode_link (inode_t *inode, inode_t *parent, const char *name,
 int
 inode_lookup (inode_t *inode)
 {
-        inode_table_t *table = NULL;
-
         if (!inode) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "inode not found");
                 return -1;
         }
 
-        table = inode->table;
-
-        pthread_mutex_lock (&table->lock);
-        {
-                __inode_lookup (inode);
-        }
-        pthread_mutex_unlock (&table->lock);
+        __inode_lookup (inode);
 
         return 0;
 }
@@ -1276,6 +1839,38 @@ inode_table_set_lru_limit (inode_table_t *table, uint32_t lru_limit)
         return;
 }
 
+/* One step of the lru scan, table->lock held. Inodes a lookup has revived
+   but not moved to the active list yet are moved there now, and ones used
+   since the last scan get a second chance. Returns 1 if the
+   inode was moved to the purge list. */
+static int
+__inode_table_prune_one (inode_table_t *table, inode_t *entry)
+{
+        pthread_mutex_t *lock = NULL;
+        int              retire = 0;
+
+        lock = inode_hash_lock (table, entry->gfid);
+        pthread_mutex_lock (lock);
+        {
+                if (entry->ref) {
+                        __inode_activate (entry);
+                } else if (entry->accessed) {
+                        entry->accessed = 0;
+                        list_move_tail (&entry->list, &table->lru);
+                } else {
+                        __inode_move_to_purge (entry);
+                        retire = 1;
+                }
+        }
+        pthread_mutex_unlock (lock);
+
+        if (retire)
+                __inode_retire (entry);
+
+        return retire;
+}
+
+
 static int
 inode_table_prune (inode_table_t *table)
 {
@@ -1284,23 +1879,30 @@ inode_table_prune (inode_table_t *table)
         inode_t          *del = NULL;
         inode_t          *tmp = NULL;
         inode_t          *entry = NULL;
+        uint32_t          scan = 0;
 
         if (!table)
                 return -1;
 
+        /* Unlocked peek; sizes only change under table->lock, and whoever
+           changes them calls us again. */
+        if (!table->purge_size &&
+            !(table->lru_limit && table->lru_size > table->lru_limit))
+                return 0;
+
         INIT_LIST_HEAD (&purge);
 
         pthread_mutex_lock (&table->lock);
         {
+                /* every inode is passed over at most twice */
+                scan = 2 * table->lru_size;
+
                 while (table->lru_limit
-                       && table->lru_size > (table->lru_limit)) {
+                       && table->lru_size > (table->lru_limit) && scan--) {
 
                         entry = list_entry (table->lru.next, inode_t, list);
 
-                        table->lru_size--;
-                        __inode_retire (entry);
-
-                        ret++;
+                        ret += __inode_table_prune_one (table, entry);
                 }
 
                 list_splice_init (&table->purge, &purge);
@@ -1344,6 +1946,7 @@ inode_table_t *
 inode_table_new (size_t lru_limit, xlator_t *xl)
 {
         inode_table_t *new = NULL;
+        uint32_t       hashsize = 0;
         int            ret = -1;
         int            i = 0;
 
@@ -1356,7 +1959,17 @@ inode_table_new (size_t lru_limit, xlator_t *xl)
 
         new->lru_limit = lru_limit;
 
-        new->hashsize = 14057; /* TODO: Random Number?? */
+        /* both tables grow and shrink with their population later on */
+        if (lru_limit)
+                hashsize = inode_hash_size (lru_limit);
+        else
+                hashsize = GF_INODE_HASH_DEFAULT_SIZE;
+
+        if (inode_hash_init (&new->inode_hash, hashsize))
+                goto out;
+
+        if (inode_hash_init (&new->name_hash, hashsize))
+                goto out;
 
         /* In case FUSE is initing the inode table. */
         if (lru_limit == 0)
@@ -1372,18 +1985,6 @@ inode_table_new (size_t lru_limit, xlator_t *xl)
         if (!new->dentry_pool)
                 goto out;
 
-        new->inode_hash = (void *)GF_CALLOC (65536,
-                                             sizeof (struct list_head),
-                                             gf_common_mt_list_head);
-        if (!new->inode_hash)
-                goto out;
-
-        new->name_hash = (void *)GF_CALLOC (new->hashsize,
-                                            sizeof (struct list_head),
-                                            gf_common_mt_list_head);
-        if (!new->name_hash)
-                goto out;
-
         /* if number of fd open in one process is more than this,
            we may hit perf issues */
         new->fd_mem_pool = mem_pool_new (fd_t, 1024);
@@ -1391,15 +1992,6 @@ inode_table_new (size_t lru_limit, xlator_t *xl)
         if (!new->fd_mem_pool)
                 goto out;
 
-        for (i = 0; i < 65536; i++) {
-                INIT_LIST_HEAD (&new->inode_hash[i]);
-        }
-
-
-        for (i = 0; i < new->hashsize; i++) {
-                INIT_LIST_HEAD (&new->name_hash[i]);
-        }
-
         INIT_LIST_HEAD (&new->active);
         INIT_LIST_HEAD (&new->lru);
         INIT_LIST_HEAD (&new->purge);
@@ -1410,6 +2002,11 @@ inode_table_new (size_t lru_limit, xlator_t *xl)
                 ;
         }
 
+        for (i = 0; i < GF_INODE_LOCK_STRIPES; i++) {
+                pthread_mutex_init (&new->hash_lock[i], NULL);
+                pthread_mutex_init (&new->name_lock[i], NULL);
+        }
+
         __inode_table_init_root (new);
 
         pthread_mutex_init (&new->lock, NULL);
@@ -1418,8 +2015,8 @@ inode_table_new (size_t lru_limit, xlator_t *xl)
 out:
         if (ret) {
                 if (new) {
-                        GF_FREE (new->inode_hash);
-                        GF_FREE (new->name_hash);
+                        GF_FREE (new->inode_hash.buckets);
+                        GF_FREE (new->name_hash.buckets);
                         if (new->dentry_pool)
                                 mem_pool_destroy (new->dentry_pool);
                         if (new->inode_pool)
@@ -1922,8 +2519,6 @@ inode_table_dump (inode_table_t *itable, char *prefix)
                 return;
         }
 
-        gf_proc_dump_build_key(key, prefix, "hashsize");
-        gf_proc_dump_write(key, "%d", itable->hashsize);
         gf_proc_dump_build_key(key, prefix, "name");
         gf_proc_dump_write(key, "%s", itable->name);
 
@@ -1936,6 +2531,9 @@ inode_table_dump (inode_table_t *itable, char *prefix)
         gf_proc_dump_build_key(key, prefix, "purge_size");
         gf_proc_dump_write(key, "%d", itable->purge_size);
 
+        inode_hash_dump (&itable->inode_hash, prefix, "inode_hash");
+        inode_hash_dump (&itable->name_hash, prefix, "dentry_hash");
+
         INODE_DUMP_LIST(&itable->active, key, prefix, "active");
         INODE_DUMP_LIST(&itable->lru, key, prefix, "lru");
         INODE_DUMP_LIST(&itable->purge, key, prefix, "purge");
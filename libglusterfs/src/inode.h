@@ -20,6 +20,10 @@
 #include <sys/types.h>
 
 #define DEFAULT_INODE_MEMPOOL_ENTRIES   32 * 1024
+#define GF_INODE_LOCK_STRIPES           64 /* power of 2 */
+#define GF_INODE_HASH_MIN_SIZE          256 /* power of 2, >= lock stripes */
+#define GF_INODE_HASH_MAX_SIZE          (1 << 26)
+#define GF_INODE_HASH_DEFAULT_SIZE      65536 /* no lru-limit */
 #define INODE_PATH_FMT "<gfid:%s>"
 struct _inode_table;
 typedef struct _inode_table inode_table_t;
@@ -36,15 +40,47 @@ typedef struct _dentry dentry_t;
 #include "uuid.h"
 
 
+/*
+ * Locking: table->lock serializes changes to the dentry tree and moves
+ * between the active, lru and purge lists. Hash chains are additionally
+ * covered by striped locks, so inode_find() and inode_grep() only take
+ * the stripe of the bucket they search. Refcounts are atomic; an inode
+ * picked up from the lru list by a lookup stays there and is moved to the
+ * active list in batches by inode_table_prune(), which also gives
+ * recently used inodes a second chance before retiring them.
+ *
+ * Lock order: table->lock, name_lock[], hash_lock[].
+ */
+
+/*
+ * A chained hash table that grows and shrinks with the number of entries
+ * in it. On a resize the old buckets are kept and moved into the new array
+ * a few at a time by every insert, so no caller pays for the whole rehash.
+ * Bucket counts are powers of 2 and never below GF_INODE_LOCK_STRIPES, so
+ * an entry keeps its stripe lock in the old and the new array; the stripe
+ * of a bucket is enough to look it up or to move it.
+ */
+struct _inode_hash {
+        struct list_head  *buckets;
+        uint32_t           size;        /* number of buckets, power of 2 */
+        struct list_head  *old;         /* buckets being moved, or NULL */
+        uint32_t           old_size;
+        uint32_t           moved;       /* old[] below this is empty */
+        uint32_t           count;       /* entries in the table */
+};
+
 struct _inode_table {
         pthread_mutex_t    lock;
-        size_t             hashsize;    /* bucket size of inode hash and dentry hash */
+        pthread_mutex_t    hash_lock[GF_INODE_LOCK_STRIPES]; /* inode_hash
+                                           chains, ref 0 -> 1 transitions */
+        pthread_mutex_t    name_lock[GF_INODE_LOCK_STRIPES]; /* name_hash
+                                           chains */
         char              *name;        /* name of the inode table, just for gf_log() */
         inode_t           *root;        /* root directory inode, with number 1 */
         xlator_t          *xl;          /* xlator to be called to do purge */
         uint32_t           lru_limit;   /* maximum LRU cache size */
-        struct list_head  *inode_hash;  /* buckets for inode hash table */
-        struct list_head  *name_hash;   /* buckets for dentry hash table */
+        struct _inode_hash inode_hash;  /* inodes by gfid */
+        struct _inode_hash name_hash;   /* dentries by parent and name */
         struct list_head   active;      /* list of inodes currently active (in an fop) */
         uint32_t           active_size; /* count of inodes in active list */
         struct list_head   lru;         /* list of inodes recently used.
@@ -63,6 +99,7 @@ struct _inode_table {
 struct _dentry {
         struct list_head   inode_list;   /* list of dentries of inode */
         struct list_head   hash;         /* hash table pointers */
+        uint32_t           hashval;      /* hash of parent and name */
         inode_t           *inode;        /* inode of this directory entry */
         char              *name;         /* name of the directory entry */
         inode_t           *parent;       /* directory of the entry */
@@ -91,12 +128,15 @@ struct _inode {
         gf_lock_t            lock;
         uint64_t             nlookup;
         uint32_t             fd_count;      /* Open fd count */
-        uint32_t             ref;           /* reference count on this inode */
+        uint32_t             ref;           /* reference count on this inode,
+                                               updated atomically */
         ia_type_t            ia_type;       /* what kind of file */
         struct list_head     fd_list;       /* list of open files on this inode */
         struct list_head     dentry_list;   /* list of directory entries for this inode */
         struct list_head     hash;          /* hash table pointers */
         struct list_head     list;          /* active/lru/purge */
+        char                 in_lru;        /* on table->lru, even if ref */
+        char                 accessed;      /* used since the last prune */
 
 	struct _inode_ctx   *_ctx;    /* replacement for dict_t *(inode->ctx) */
 };
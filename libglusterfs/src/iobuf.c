@@ -571,6 +571,42 @@ out:
 }
 
 
+/* Makes an iobuf of memory owned by the caller, so that it can be passed
+   down in an iobref without a copy. @fn is called with @ptr and @data when
+   the last ref of the iobuf is dropped, and not before: until then the
+   memory must not be modified or freed. */
+struct iobuf *
+iobuf_wrap (struct iobuf_pool *iobuf_pool, void *ptr, iobuf_free_fn_t fn,
+            void *data)
+{
+        struct iobuf       *iobuf       = NULL;
+        struct iobuf_arena *trav        = NULL;
+
+        GF_VALIDATE_OR_GOTO ("iobuf", iobuf_pool, out);
+        GF_VALIDATE_OR_GOTO ("iobuf", fn, out);
+
+        iobuf = GF_CALLOC (1, sizeof (*iobuf), gf_common_mt_iobuf);
+        if (!iobuf)
+                goto out;
+
+        /* accounted like the iobufs allocated with calloc() */
+        list_for_each_entry (trav, &iobuf_pool->arenas[IOBUF_ARENA_MAX_INDEX],
+                             list) {
+                iobuf->iobuf_arena = trav;
+                break;
+        }
+
+        INIT_LIST_HEAD (&iobuf->list);
+        LOCK_INIT (&iobuf->lock);
+        iobuf->ptr = ptr;
+        iobuf->free_fn = fn;
+        iobuf->free_data = data;
+        iobuf->ref = 1;
+out:
+        return iobuf;
+}
+
+
 struct iobuf *
 iobuf_get2 (struct iobuf_pool *iobuf_pool, size_t page_size)
 {
@@ -702,6 +738,13 @@ iobuf_put (struct iobuf *iobuf)
 
         GF_VALIDATE_OR_GOTO ("iobuf", iobuf, out);
 
+        if (iobuf->free_fn) {
+                iobuf->free_fn (iobuf->ptr, iobuf->free_data);
+                LOCK_DESTROY (&iobuf->lock);
+                GF_FREE (iobuf);
+                return;
+        }
+
         iobuf_arena = iobuf->iobuf_arena;
         if (!iobuf_arena) {
                 gf_log (THIS->name, GF_LOG_WARNING, "arena not found");
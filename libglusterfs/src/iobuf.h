@@ -47,6 +47,9 @@ struct iobuf_arena;
 /* expandable and contractable pool of memory, internally broken into arenas */
 struct iobuf_pool;
 
+/* Releases memory wrapped by iobuf_wrap() once the last ref is gone */
+typedef void (*iobuf_free_fn_t) (void *ptr, void *data);
+
 struct iobuf_init_config {
         size_t   pagesize;
         int32_t  num_pages;
@@ -69,6 +72,9 @@ struct iobuf {
 
         void                *free_ptr; /* in case of stdalloc, this is the
                                           one to be freed */
+
+        iobuf_free_fn_t      free_fn;  /* memory not owned by the pool */
+        void                *free_data;
 };
 
 
@@ -159,4 +165,8 @@ void   iobuf_stats_dump (struct iobuf_pool *iobuf_pool);
 
 struct iobuf *
 iobuf_get2 (struct iobuf_pool *iobuf_pool, size_t page_size);
+
+struct iobuf *
+iobuf_wrap (struct iobuf_pool *iobuf_pool, void *ptr, iobuf_free_fn_t fn,
+            void *data);
 #endif /* !_IOBUF_H_ */
@@ -13,6 +13,7 @@
 #include "xlator.h"
 #include <stdlib.h>
 #include <stdarg.h>
+#include <pthread.h>
 
 #define GF_MEM_POOL_LIST_BOUNDARY        (sizeof(struct list_head))
 #define GF_MEM_POOL_PTR                  (sizeof(struct mem_pool*))
@@ -21,6 +22,20 @@
 #define mem_pool_ptr2chunkhead(ptr)      ((ptr) - GF_MEM_POOL_PAD_BOUNDARY)
 #define is_mem_chunk_in_use(ptr)         (*ptr == 1)
 #define mem_pool_from_ptr(ptr)           ((ptr) + GF_MEM_POOL_LIST_BOUNDARY)
+#define mem_pool_chunk_in_use(head)      ((int *)((head) +                   \
+                                          GF_MEM_POOL_LIST_BOUNDARY +        \
+                                          GF_MEM_POOL_PTR))
+
+/* Per-thread magazines: every thread keeps a small stack of free chunks
+ * for each pool it allocates from. mem_get()/mem_put() are served from
+ * that stack without taking pool->lock, and only go to the shared cold
+ * list in batches of half a magazine (refill on empty, spill on full).
+ */
+#define GF_MEM_POOL_MAG_MAX              64
+#define GF_MEM_POOL_MAG_MIN              4
+#define GF_MEM_POOL_MAG_RATIO            8
+#define GF_MEM_POOL_MAG_MAX_POOLS        4096
+#define GF_MEM_POOL_MAG_TABLE_STEP       32
 
 #define GLUSTERFS_ENV_MEM_ACCT_STR  "GLUSTERFS_DISABLE_MEM_ACCT"
 
@@ -287,6 +302,293 @@ free:
 
 
 
+struct mem_magazine {
+        struct mem_pool   *pool;
+        struct list_head   pool_list;
+        int                size;
+        int                count;
+        uint64_t           hits;
+        uint64_t           misses;
+        uint64_t           refills;
+        uint64_t           spills;
+        void              *objs[GF_MEM_POOL_MAG_MAX];
+};
+
+struct mem_magazine_table {
+        int                   size;
+        struct mem_magazine **mags;
+};
+
+static pthread_key_t   mem_magazine_key;
+static pthread_once_t  mem_magazine_once = PTHREAD_ONCE_INIT;
+static int             mem_magazine_enabled;
+/* protects binding of magazines to pools and the index slots below; lock
+ * ordering is mem_magazine_lock -> pool->lock */
+static pthread_mutex_t mem_magazine_lock = PTHREAD_MUTEX_INITIALIZER;
+static char            mem_magazine_slots[GF_MEM_POOL_MAG_MAX_POOLS];
+
+
+static int
+__mem_magazine_refill (struct mem_pool *pool, struct mem_magazine *mag,
+                       int want)
+{
+        struct list_head *list = NULL;
+        int               got  = 0;
+
+        while (pool->cold_count && mag->count < want) {
+                list = pool->list.next;
+                list_del (list);
+
+                pool->cold_count--;
+                pool->hot_count++;
+
+                mag->objs[mag->count++] = list;
+                got++;
+        }
+
+        if (pool->max_alloc < pool->hot_count)
+                pool->max_alloc = pool->hot_count;
+
+        return got;
+}
+
+
+static void
+__mem_magazine_spill (struct mem_pool *pool, struct mem_magazine *mag,
+                      int count)
+{
+        struct list_head *list = NULL;
+
+        while (count-- > 0 && mag->count) {
+                list = mag->objs[--mag->count];
+                INIT_LIST_HEAD (list);
+                list_add (list, &pool->list);
+
+                pool->hot_count--;
+                pool->cold_count++;
+        }
+}
+
+
+static void
+mem_magazine_table_destroy (void *data)
+{
+        struct mem_magazine_table *table = data;
+        struct mem_magazine       *mag   = NULL;
+        struct mem_pool           *pool  = NULL;
+        int                        i     = 0;
+
+        if (!table)
+                return;
+
+        for (i = 0; i < table->size; i++) {
+                mag = table->mags[i];
+                if (!mag)
+                        continue;
+
+                pthread_mutex_lock (&mem_magazine_lock);
+                {
+                        pool = mag->pool;
+                        if (pool) {
+                                LOCK (&pool->lock);
+                                {
+                                        __mem_magazine_spill (pool, mag,
+                                                              mag->count);
+                                        list_del_init (&mag->pool_list);
+                                }
+                                UNLOCK (&pool->lock);
+                        }
+                }
+                pthread_mutex_unlock (&mem_magazine_lock);
+
+                FREE (mag);
+        }
+
+        FREE (table->mags);
+        FREE (table);
+}
+
+
+static void
+mem_magazine_key_init (void)
+{
+        if (pthread_key_create (&mem_magazine_key,
+                                mem_magazine_table_destroy) == 0)
+                mem_magazine_enabled = 1;
+}
+
+
+static void
+mem_magazine_pool_init (struct mem_pool *pool, unsigned long count)
+{
+        int i = 0;
+
+        INIT_LIST_HEAD (&pool->magazines);
+        pool->mag_index = -1;
+        pool->mag_size = min (count / GF_MEM_POOL_MAG_RATIO,
+                              GF_MEM_POOL_MAG_MAX);
+
+        /* a pool too small to keep a few chunks per thread is better
+         * served by the shared list alone */
+        if (pool->mag_size < GF_MEM_POOL_MAG_MIN || !pool->pool)
+                return;
+
+        pthread_once (&mem_magazine_once, mem_magazine_key_init);
+        if (!mem_magazine_enabled)
+                return;
+
+        pthread_mutex_lock (&mem_magazine_lock);
+        {
+                for (i = 0; i < GF_MEM_POOL_MAG_MAX_POOLS; i++) {
+                        if (!mem_magazine_slots[i]) {
+                                mem_magazine_slots[i] = 1;
+                                pool->mag_index = i;
+                                break;
+                        }
+                }
+        }
+        pthread_mutex_unlock (&mem_magazine_lock);
+}
+
+
+/* The pool must not be in use by any other thread at this point, exactly
+ * as for the chunks handed out from it. Chunks cached in magazines belong
+ * to the pool's slab and go away with it.
+ */
+static void
+mem_magazine_pool_fini (struct mem_pool *pool)
+{
+        struct mem_magazine *mag = NULL;
+        struct mem_magazine *tmp = NULL;
+
+        pthread_mutex_lock (&mem_magazine_lock);
+        {
+                list_for_each_entry_safe (mag, tmp, &pool->magazines,
+                                          pool_list) {
+                        list_del_init (&mag->pool_list);
+                        mag->count = 0;
+                        mag->pool = NULL;
+                }
+
+                if (pool->mag_index >= 0)
+                        mem_magazine_slots[pool->mag_index] = 0;
+                pool->mag_index = -1;
+        }
+        pthread_mutex_unlock (&mem_magazine_lock);
+}
+
+
+static struct mem_magazine *
+mem_magazine_bind (struct mem_pool *pool)
+{
+        struct mem_magazine_table  *table = NULL;
+        struct mem_magazine       **mags  = NULL;
+        struct mem_magazine        *mag   = NULL;
+        int                         size  = 0;
+
+        table = pthread_getspecific (mem_magazine_key);
+        if (!table) {
+                table = CALLOC (1, sizeof (*table));
+                if (!table)
+                        return NULL;
+
+                if (pthread_setspecific (mem_magazine_key, table) != 0) {
+                        FREE (table);
+                        return NULL;
+                }
+        }
+
+        if (table->size <= pool->mag_index) {
+                size = pool->mag_index + GF_MEM_POOL_MAG_TABLE_STEP;
+                mags = REALLOC (table->mags, size * sizeof (*mags));
+                if (!mags)
+                        return NULL;
+
+                memset (mags + table->size, 0,
+                        (size - table->size) * sizeof (*mags));
+                table->mags = mags;
+                table->size = size;
+        }
+
+        mag = table->mags[pool->mag_index];
+        if (!mag) {
+                mag = CALLOC (1, sizeof (*mag));
+                if (!mag)
+                        return NULL;
+                table->mags[pool->mag_index] = mag;
+        } else if (mag->pool) {
+                /* slot still owned by a live pool, should never happen */
+                return NULL;
+        }
+
+        /* a slot left over from a destroyed pool is simply recycled */
+        memset (mag, 0, sizeof (*mag));
+        INIT_LIST_HEAD (&mag->pool_list);
+        mag->size = pool->mag_size;
+
+        pthread_mutex_lock (&mem_magazine_lock);
+        {
+                mag->pool = pool;
+                LOCK (&pool->lock);
+                {
+                        list_add (&mag->pool_list, &pool->magazines);
+                }
+                UNLOCK (&pool->lock);
+        }
+        pthread_mutex_unlock (&mem_magazine_lock);
+
+        return mag;
+}
+
+
+static inline struct mem_magazine *
+mem_magazine_get (struct mem_pool *pool)
+{
+        struct mem_magazine_table *table = NULL;
+        struct mem_magazine       *mag   = NULL;
+
+        if (pool->mag_index < 0)
+                return NULL;
+
+        table = pthread_getspecific (mem_magazine_key);
+        if (table && pool->mag_index < table->size) {
+                mag = table->mags[pool->mag_index];
+                if (mag && mag->pool == pool)
+                        return mag;
+        }
+
+        return mem_magazine_bind (pool);
+}
+
+
+void
+mem_pool_magazine_stats (struct mem_pool *pool,
+                         struct mem_pool_mag_stats *stats)
+{
+        struct mem_magazine *mag = NULL;
+
+        if (!pool || !stats)
+                return;
+
+        memset (stats, 0, sizeof (*stats));
+
+        /* counters are owned by their threads, so the sums are only a
+         * snapshot */
+        pthread_mutex_lock (&mem_magazine_lock);
+        {
+                list_for_each_entry (mag, &pool->magazines, pool_list) {
+                        stats->threads++;
+                        stats->cached  += mag->count;
+                        stats->hits    += mag->hits;
+                        stats->misses  += mag->misses;
+                        stats->refills += mag->refills;
+                        stats->spills  += mag->spills;
+                }
+        }
+        pthread_mutex_unlock (&mem_magazine_lock);
+}
+
+
 struct mem_pool *
 mem_pool_new_fn (unsigned long sizeof_type,
                  unsigned long count, char *name)
@@ -344,6 +646,8 @@ mem_pool_new_fn (unsigned long sizeof_type,
         mem_pool->pool_end = pool + (count * (padded_sizeof_type));
 #endif
 
+        mem_magazine_pool_init (mem_pool, count);
+
         /* add this pool to the global list */
         ctx = THIS->ctx;
         if (!ctx)
@@ -380,12 +684,39 @@ mem_get (struct mem_pool *mem_pool)
         void             *ptr = NULL;
         int             *in_use = NULL;
         struct mem_pool **pool_ptr = NULL;
+        struct mem_magazine *mag = NULL;
 
         if (!mem_pool) {
                 gf_log_callingfn ("mem-pool", GF_LOG_ERROR, "invalid argument");
                 return NULL;
         }
 
+        mag = mem_magazine_get (mem_pool);
+        if (mag) {
+                if (!mag->count) {
+                        mag->misses++;
+                        LOCK (&mem_pool->lock);
+                        {
+                                if (__mem_magazine_refill (mem_pool, mag,
+                                                           mag->size / 2))
+                                        mag->refills++;
+                        }
+                        UNLOCK (&mem_pool->lock);
+                }
+
+                if (mag->count) {
+                        mag->hits++;
+                        ptr = mag->objs[--mag->count];
+                        in_use = mem_pool_chunk_in_use (ptr);
+                        *in_use = 1;
+
+                        pool_ptr = mem_pool_from_ptr (ptr);
+                        *pool_ptr = mem_pool;
+                        return mem_pool_chunkhead2ptr (ptr);
+                }
+                /* slab exhausted, fall back to the heap below */
+        }
+
         LOCK (&mem_pool->lock);
         {
                 mem_pool->alloc_count++;
@@ -476,6 +807,7 @@ mem_put (void *ptr)
         void   *head = NULL;
         struct mem_pool **tmp = NULL;
         struct mem_pool *pool = NULL;
+        struct mem_magazine *mag = NULL;
 
         if (!ptr) {
                 gf_log_callingfn ("mem-pool", GF_LOG_ERROR, "invalid argument");
@@ -496,6 +828,35 @@ mem_put (void *ptr)
                                   "mem-pool ptr is NULL");
                 return;
         }
+
+        /* only chunks of the slab are cached, heap fallbacks are freed
+         * below */
+        if (__is_member (pool, ptr) == 1)
+                mag = mem_magazine_get (pool);
+        if (mag) {
+                in_use = mem_pool_chunk_in_use (head);
+                if (!is_mem_chunk_in_use (in_use)) {
+                        gf_log_callingfn ("mem-pool", GF_LOG_CRITICAL,
+                                          "mem_put called on freed ptr %p of "
+                                          "mem pool %p", ptr, pool);
+                        return;
+                }
+                *in_use = 0;
+
+                if (mag->count == mag->size) {
+                        mag->spills++;
+                        LOCK (&pool->lock);
+                        {
+                                __mem_magazine_spill (pool, mag,
+                                                      mag->size / 2);
+                        }
+                        UNLOCK (&pool->lock);
+                }
+
+                mag->objs[mag->count++] = head;
+                return;
+        }
+
         LOCK (&pool->lock);
         {
 
@@ -555,6 +916,8 @@ mem_pool_destroy (struct mem_pool *pool)
 
         list_del (&pool->global_list);
 
+        mem_magazine_pool_fini (pool);
+
         LOCK_DESTROY (&pool->lock);
         GF_FREE (pool->name);
         GF_FREE (pool->pool);
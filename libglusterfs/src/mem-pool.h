@@ -192,6 +192,23 @@ struct mem_pool {
         int               max_stdalloc;
         char             *name;
         struct list_head  global_list;
+        int               mag_index;  /* slot in the per-thread magazine
+                                         table, -1 if magazines are off */
+        int               mag_size;
+        struct list_head  magazines;  /* per-thread magazines bound to
+                                         this pool */
+};
+
+/* Aggregated counters of all the per-thread magazines of a pool. Objects
+ * sitting in a magazine are accounted as hot in the pool itself.
+ */
+struct mem_pool_mag_stats {
+        int               threads;
+        int               cached;
+        uint64_t          hits;
+        uint64_t          misses;
+        uint64_t          refills;
+        uint64_t          spills;
 };
 
 struct mem_pool *
@@ -205,6 +222,9 @@ void *mem_get0 (struct mem_pool *pool);
 
 void mem_pool_destroy (struct mem_pool *pool);
 
+void mem_pool_magazine_stats (struct mem_pool *pool,
+                              struct mem_pool_mag_stats *stats);
+
 void gf_mem_acct_enable_set (void *ctx);
 
 #endif /* _MEM_POOL_H */
@@ -15,6 +15,8 @@
 #include "statedump.h"
 #include "stack.h"
 #include "common-utils.h"
+#include "timer.h"
+#include "syncop.h"
 
 
 #ifdef HAVE_MALLOC_H
@@ -375,23 +377,41 @@ gf_proc_dump_mem_info_to_dict (dict_t *dict)
 void
 gf_proc_dump_mempool_info (glusterfs_ctx_t *ctx)
 {
-        struct mem_pool *pool = NULL;
+        struct mem_pool           *pool = NULL;
+        struct mem_pool_mag_stats  mag  = {0,};
 
         gf_proc_dump_add_section ("mempool");
 
         list_for_each_entry (pool, &ctx->mempool_list, global_list) {
+                mem_pool_magazine_stats (pool, &mag);
+
                 gf_proc_dump_write ("-----", "-----");
                 gf_proc_dump_write ("pool-name", "%s", pool->name);
                 gf_proc_dump_write ("hot-count", "%d", pool->hot_count);
                 gf_proc_dump_write ("cold-count", "%d", pool->cold_count);
                 gf_proc_dump_write ("padded_sizeof", "%lu",
                                     pool->padded_sizeof_type);
-                gf_proc_dump_write ("alloc-count", "%"PRIu64, pool->alloc_count);
+                gf_proc_dump_write ("alloc-count", "%"PRIu64,
+                                    pool->alloc_count + mag.hits);
                 gf_proc_dump_write ("max-alloc", "%d", pool->max_alloc);
 
                 gf_proc_dump_write ("pool-misses", "%"PRIu64, pool->pool_misses);
                 gf_proc_dump_write ("cur-stdalloc", "%d", pool->curr_stdalloc);
                 gf_proc_dump_write ("max-stdalloc", "%d", pool->max_stdalloc);
+
+                if (pool->mag_index < 0)
+                        continue;
+
+                gf_proc_dump_write ("magazine-size", "%d", pool->mag_size);
+                gf_proc_dump_write ("magazine-threads", "%d", mag.threads);
+                gf_proc_dump_write ("magazine-cached", "%d", mag.cached);
+                gf_proc_dump_write ("magazine-hits", "%"PRIu64, mag.hits);
+                gf_proc_dump_write ("magazine-misses", "%"PRIu64,
+                                    mag.misses);
+                gf_proc_dump_write ("magazine-refills", "%"PRIu64,
+                                    mag.refills);
+                gf_proc_dump_write ("magazine-spills", "%"PRIu64,
+                                    mag.spills);
         }
 }
 
@@ -399,6 +419,7 @@ void
 gf_proc_dump_mempool_info_to_dict (glusterfs_ctx_t *ctx, dict_t *dict)
 {
         struct mem_pool *pool = NULL;
+        struct mem_pool_mag_stats mag = {0,};
         char            key[GF_DUMP_MAX_BUF_LEN] = {0,};
         int             count = 0;
         int             ret = -1;
@@ -407,6 +428,8 @@ gf_proc_dump_mempool_info_to_dict (glusterfs_ctx_t *ctx, dict_t *dict)
                 return;
 
         list_for_each_entry (pool, &ctx->mempool_list, global_list) {
+                mem_pool_magazine_stats (pool, &mag);
+
                 memset (key, 0, sizeof (key));
                 snprintf (key, sizeof (key), "pool%d.name", count);
                 ret = dict_set_str (dict, key, pool->name);
@@ -433,7 +456,8 @@ gf_proc_dump_mempool_info_to_dict (glusterfs_ctx_t *ctx, dict_t *dict)
 
                 memset (key, 0, sizeof (key));
                 snprintf (key, sizeof (key), "pool%d.alloccount", count);
-                ret = dict_set_uint64 (dict, key, pool->alloc_count);
+                ret = dict_set_uint64 (dict, key,
+                                       pool->alloc_count + mag.hits);
                 if (ret)
                         return;
 
@@ -821,8 +845,11 @@ gf_proc_dump_info (int signum, glusterfs_ctx_t *ctx)
 
         if (GF_PROC_DUMP_IS_OPTION_ENABLED (iobuf))
                 iobuf_stats_dump (ctx->iobuf_pool);
-        if (GF_PROC_DUMP_IS_OPTION_ENABLED (callpool))
+        if (GF_PROC_DUMP_IS_OPTION_ENABLED (callpool)) {
                 gf_proc_dump_pending_frames (ctx->pool);
+                gf_timer_registry_dump (ctx);
+                syncenv_dump (ctx->env);
+        }
 
         if (ctx->master) {
                 gf_proc_dump_add_section ("fuse");
@@ -14,6 +14,13 @@
 #endif
 
 #include "syncop.h"
+#include "statedump.h"
+
+#include <sys/mman.h>
+
+#ifndef MAP_STACK
+#define MAP_STACK 0
+#endif
 
 int
 syncopctx_setfsuid (void *uid)
@@ -209,6 +216,153 @@ out:
 	return ret;
 }
 
+#ifdef SYNCTASK_SWITCH_FAST
+/*
+ * synctask_switch_stack (&from_sp, to_sp) pushes the callee-saved registers
+ * and the SSE/x87 control words, stores the stack pointer in *from_sp and
+ * pops the same from to_sp. synctask_switch_start is where a new task's
+ * stack first returns to: it calls r12 (synctask_wrap) with rbx (the task).
+ */
+void synctask_switch_stack (void **from, void *to);
+void synctask_switch_start (void);
+void synctask_wrap (struct synctask *old_task);
+
+__asm__ (
+        ".text\n"
+        ".p2align 4\n"
+        ".globl synctask_switch_stack\n"
+        ".hidden synctask_switch_stack\n"
+        ".type synctask_switch_stack, @function\n"
+        "synctask_switch_stack:\n"
+        "        pushq %rbp\n"
+        "        pushq %rbx\n"
+        "        pushq %r12\n"
+        "        pushq %r13\n"
+        "        pushq %r14\n"
+        "        pushq %r15\n"
+        "        subq $8, %rsp\n"
+        "        stmxcsr (%rsp)\n"
+        "        fnstcw 4(%rsp)\n"
+        "        movq %rsp, (%rdi)\n"
+        "        movq %rsi, %rsp\n"
+        "        ldmxcsr (%rsp)\n"
+        "        fldcw 4(%rsp)\n"
+        "        addq $8, %rsp\n"
+        "        popq %r15\n"
+        "        popq %r14\n"
+        "        popq %r13\n"
+        "        popq %r12\n"
+        "        popq %rbx\n"
+        "        popq %rbp\n"
+        "        ret\n"
+        ".size synctask_switch_stack, .-synctask_switch_stack\n"
+        ".p2align 4\n"
+        ".globl synctask_switch_start\n"
+        ".hidden synctask_switch_start\n"
+        ".type synctask_switch_start, @function\n"
+        "synctask_switch_start:\n"
+        "        movq %rbx, %rdi\n"
+        "        callq *%r12\n"
+        "        ud2\n"
+        ".size synctask_switch_start, .-synctask_switch_start\n"
+        );
+
+
+static void
+synctask_stack_init (struct synctask *task, size_t size)
+{
+        uint64_t *sp = NULL;
+
+        sp = (uint64_t *)(((uintptr_t)task->stack + size) & ~(uintptr_t)15);
+
+        /* popped by synctask_switch_stack, last one first. The padding
+           leaves the stack 16 byte aligned for the call in
+           synctask_switch_start. */
+        *--sp = 0;
+        *--sp = 0;
+        *--sp = (uintptr_t)synctask_switch_start;
+        *--sp = 0;                              /* rbp */
+        *--sp = (uintptr_t)task;                /* rbx */
+        *--sp = (uintptr_t)synctask_wrap;       /* r12 */
+        *--sp = 0;                              /* r13 */
+        *--sp = 0;                              /* r14 */
+        *--sp = 0;                              /* r15 */
+        *--sp = 0x037f00001f80ULL;              /* x87 cw, mxcsr defaults */
+
+        task->sp = sp;
+}
+#endif /* SYNCTASK_SWITCH_FAST */
+
+
+/* Stacks are mapped with an inaccessible guard page below them, so that an
+   overflow faults instead of silently corrupting the neighbouring memory.
+   Freed stacks are kept on the env and handed to the next task; an unused
+   stack holds its list link in its lowest bytes. */
+static void *
+syncenv_stack_get (struct syncenv *env)
+{
+        struct list_head *link = NULL;
+        char             *base = NULL;
+
+        LOCK (&env->stack_lock);
+        {
+                if (!list_empty (&env->stacks)) {
+                        link = env->stacks.next;
+                        list_del (link);
+                        env->stackcount--;
+                        env->stacks_reused++;
+                }
+        }
+        UNLOCK (&env->stack_lock);
+
+        if (link)
+                return link;
+
+        base = mmap (NULL, env->stacksize + env->guardsize,
+                     PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+        if (base == MAP_FAILED)
+                return NULL;
+
+        if (mprotect (base, env->guardsize, PROT_NONE) < 0) {
+                munmap (base, env->stacksize + env->guardsize);
+                return NULL;
+        }
+
+        LOCK (&env->stack_lock);
+        {
+                env->stacks_new++;
+        }
+        UNLOCK (&env->stack_lock);
+
+        return base + env->guardsize;
+}
+
+
+static void
+syncenv_stack_put (struct syncenv *env, void *stack)
+{
+        struct list_head *link = stack;
+
+        if (!stack)
+                return;
+
+        LOCK (&env->stack_lock);
+        {
+                if (env->stackcount < SYNCENV_STACK_CACHE) {
+                        list_add (link, &env->stacks);
+                        env->stackcount++;
+                        link = NULL;
+                }
+        }
+        UNLOCK (&env->stack_lock);
+
+        if (link)
+                munmap ((char *)stack - env->guardsize,
+                        env->stacksize + env->guardsize);
+}
+
+
 static void
 __run (struct synctask *task)
 {
@@ -293,10 +447,14 @@ synctask_yield (struct synctask *task)
 
         if (task->state != SYNCTASK_DONE)
                 task->state = SYNCTASK_SUSPEND;
+#ifdef SYNCTASK_SWITCH_FAST
+        synctask_switch_stack (&task->sp, task->proc->sched_sp);
+#else
         if (swapcontext (&task->ctx, &task->proc->sched) < 0) {
                 gf_log ("syncop", GF_LOG_ERROR,
                         "swapcontext failed (%s)", strerror (errno));
         }
+#endif
 
         THIS = oldTHIS;
 }
@@ -346,7 +504,7 @@ synctask_destroy (struct synctask *task)
         if (!task)
                 return;
 
-        FREE (task->stack);
+        syncenv_stack_put (task->env, task->stack);
 
         if (task->opframe)
                 STACK_DESTROY (task->opframe->root);
@@ -429,17 +587,20 @@ synctask_create (struct syncenv *env, synctask_fn_t fn, synctask_cbk_t cbk,
         INIT_LIST_HEAD (&newtask->all_tasks);
         INIT_LIST_HEAD (&newtask->waitq);
 
-        if (getcontext (&newtask->ctx) < 0) {
+        newtask->stack = syncenv_stack_get (env);
+        if (!newtask->stack) {
                 gf_log ("syncop", GF_LOG_ERROR,
-                        "getcontext failed (%s)",
-                        strerror (errno));
+                        "out of memory for stack (%s)", strerror (errno));
                 goto err;
         }
 
-        newtask->stack = CALLOC (1, env->stacksize);
-        if (!newtask->stack) {
+#ifdef SYNCTASK_SWITCH_FAST
+        synctask_stack_init (newtask, env->stacksize);
+#else
+        if (getcontext (&newtask->ctx) < 0) {
                 gf_log ("syncop", GF_LOG_ERROR,
-                        "out of memory for stack");
+                        "getcontext failed (%s)",
+                        strerror (errno));
                 goto err;
         }
 
@@ -447,6 +608,7 @@ synctask_create (struct syncenv *env, synctask_fn_t fn, synctask_cbk_t cbk,
         newtask->ctx.uc_stack.ss_size = env->stacksize;
 
         makecontext (&newtask->ctx, (void (*)(void)) synctask_wrap, 2, newtask);
+#endif
 
         newtask->state = SYNCTASK_INIT;
 
@@ -468,7 +630,7 @@ synctask_create (struct syncenv *env, synctask_fn_t fn, synctask_cbk_t cbk,
 	return newtask;
 err:
         if (newtask) {
-                FREE (newtask->stack);
+                syncenv_stack_put (env, newtask->stack);
                 if (newtask->opframe)
                         STACK_DESTROY (newtask->opframe->root);
                 FREE (newtask);
@@ -529,12 +691,18 @@ syncenv_task (struct syncproc *proc)
         pthread_mutex_lock (&env->mutex);
         {
                 while (list_empty (&env->runq)) {
+                        /* syncenv_destroy() joins the thread, so @proc is
+                           left as it is */
+                        if (env->destroy) {
+                                task = NULL;
+                                goto unlock;
+                        }
                         sleep_till.tv_sec = time (NULL) + SYNCPROC_IDLE_TIME;
                         ret = pthread_cond_timedwait (&env->cond, &env->mutex,
                                                       &sleep_till);
                         if (!list_empty (&env->runq))
                                 break;
-                        if ((ret == ETIMEDOUT) &&
+                        if ((ret == ETIMEDOUT) && !env->destroy &&
                             (env->procs > env->procmin)) {
                                 task = NULL;
                                 env->procs--;
@@ -570,6 +738,11 @@ synctask_switchto (struct synctask *task)
         synctask_set (task);
         THIS = task->xl;
 
+        __sync_fetch_and_add (&env->switches, 1);
+
+#ifdef SYNCTASK_SWITCH_FAST
+        synctask_switch_stack (&task->proc->sched_sp, task->sp);
+#else
 #if defined(__NetBSD__) && defined(_UC_TLSBASE)
         /* Preserve pthread private pointer through swapcontex() */
         task->ctx.uc_flags &= ~_UC_TLSBASE;
@@ -579,6 +752,7 @@ synctask_switchto (struct synctask *task)
                 gf_log ("syncop", GF_LOG_ERROR,
                         "swapcontext failed (%s)", strerror (errno));
         }
+#endif
 
         if (task->state == SYNCTASK_DONE) {
                 synctask_done (task);
@@ -660,10 +834,81 @@ unlock:
 }
 
 
+/* Stops the processors once they run out of tasks, unmaps the cached
+   stacks and frees @env. No task may be left waiting on it. */
 void
 syncenv_destroy (struct syncenv *env)
 {
+        pthread_t         processors[SYNCENV_PROC_MAX];
+        struct list_head *link = NULL;
+        int               count = 0;
+        int               i = 0;
+
+        if (!env)
+                return;
+
+        pthread_mutex_lock (&env->mutex);
+        {
+                env->destroy = 1;
+                pthread_cond_broadcast (&env->cond);
+
+                for (i = 0; i < env->procmax; i++)
+                        if (env->proc[i].processor)
+                                processors[count++] = env->proc[i].processor;
+        }
+        pthread_mutex_unlock (&env->mutex);
+
+        for (i = 0; i < count; i++)
+                pthread_join (processors[i], NULL);
+
+        while (!list_empty (&env->stacks)) {
+                link = env->stacks.next;
+                list_del (link);
+                munmap ((char *)link - env->guardsize,
+                        env->stacksize + env->guardsize);
+        }
+        env->stackcount = 0;
+
+        LOCK_DESTROY (&env->stack_lock);
+        pthread_cond_destroy (&env->cond);
+        pthread_mutex_destroy (&env->mutex);
+
+        FREE (env);
+}
+
+
+void
+syncenv_dump (struct syncenv *env)
+{
+        int      stackcount = 0;
+        uint64_t stacks_new = 0;
+        uint64_t stacks_reused = 0;
+
+        if (!env)
+                return;
 
+        LOCK (&env->stack_lock);
+        {
+                stackcount = env->stackcount;
+                stacks_new = env->stacks_new;
+                stacks_reused = env->stacks_reused;
+        }
+        UNLOCK (&env->stack_lock);
+
+        gf_proc_dump_add_section ("syncenv");
+        gf_proc_dump_write ("procs", "%d", env->procs);
+        gf_proc_dump_write ("runcount", "%d", env->runcount);
+        gf_proc_dump_write ("waitcount", "%d", env->waitcount);
+#ifdef SYNCTASK_SWITCH_FAST
+        gf_proc_dump_write ("switch", "registers");
+#else
+        gf_proc_dump_write ("switch", "ucontext");
+#endif
+        gf_proc_dump_write ("switches", "%"PRIu64, env->switches);
+        gf_proc_dump_write ("stacksize", "%zu", env->stacksize);
+        gf_proc_dump_write ("stacks_cached", "%d", stackcount);
+        gf_proc_dump_write ("stacks_new", "%"PRIu64, stacks_new);
+        gf_proc_dump_write ("stacks_reused", "%"PRIu64, stacks_reused);
 }
 
 
@@ -693,9 +938,16 @@ syncenv_new (size_t stacksize, int procmin, int procmax)
         INIT_LIST_HEAD (&newenv->runq);
         INIT_LIST_HEAD (&newenv->waitq);
 
+        LOCK_INIT (&newenv->stack_lock);
+        INIT_LIST_HEAD (&newenv->stacks);
+
+        newenv->guardsize    = sysconf (_SC_PAGESIZE);
         newenv->stacksize    = SYNCENV_DEFAULT_STACKSIZE;
         if (stacksize)
                 newenv->stacksize = stacksize;
+        /* whole pages, so that the guard of each stack is page aligned */
+        newenv->stacksize = ((newenv->stacksize + newenv->guardsize - 1) /
+                             newenv->guardsize) * newenv->guardsize;
 	newenv->procmin = procmin;
 	newenv->procmax = procmax;
 
@@ -708,8 +960,10 @@ syncenv_new (size_t stacksize, int procmin, int procmax)
                 newenv->procs++;
         }
 
-        if (ret != 0)
+        if (ret != 0) {
                 syncenv_destroy (newenv);
+                newenv = NULL;
+        }
 
         return newenv;
 }
@@ -24,6 +24,17 @@
 #define SYNCENV_PROC_MAX 16
 #define SYNCENV_PROC_MIN 2
 #define SYNCPROC_IDLE_TIME 600
+#define SYNCENV_STACK_CACHE 64  /* unused stacks kept for reuse */
+
+/*
+ * On x86_64 tasks are switched by saving and restoring the callee-saved
+ * registers only. swapcontext() also saves and restores the signal mask,
+ * which is a system call every time a task is switched in or out. Define
+ * GF_SYNCTASK_UCONTEXT to always use ucontext.
+ */
+#if defined(__x86_64__) && defined(__ELF__) && !defined(GF_SYNCTASK_UCONTEXT)
+#define SYNCTASK_SWITCH_FAST 1
+#endif
 
 /*
  * Flags for syncopctx valid elements
@@ -72,6 +83,7 @@ struct synctask {
         gid_t               gid;
 
         ucontext_t          ctx;
+        void               *sp;  /* saved stack pointer, fast switch */
         struct syncproc    *proc;
 
         pthread_mutex_t     mutex; /* for synchronous spawning of synctask */
@@ -85,6 +97,7 @@ struct synctask {
 struct syncproc {
         pthread_t           processor;
         ucontext_t          sched;
+        void               *sched_sp;
         struct syncenv     *env;
         struct synctask    *current;
 };
@@ -101,11 +114,21 @@ struct syncenv {
 
 	int                 procmin;
 	int                 procmax;
+        int                 destroy;     /* processors exit once idle */
 
         pthread_mutex_t     mutex;
         pthread_cond_t      cond;
 
         size_t              stacksize;
+        size_t              guardsize;
+
+        gf_lock_t           stack_lock;
+        struct list_head    stacks;      /* unused stacks */
+        int                 stackcount;
+
+        uint64_t            switches;
+        uint64_t            stacks_new;
+        uint64_t            stacks_reused;
 };
 
 
@@ -243,6 +266,7 @@ struct syncopctx {
 struct syncenv * syncenv_new (size_t stacksize, int procmin, int procmax);
 void syncenv_destroy (struct syncenv *);
 void syncenv_scale (struct syncenv *env);
+void syncenv_dump (struct syncenv *env);
 
 int synctask_new (struct syncenv *, synctask_fn_t, synctask_cbk_t, call_frame_t* frame, void *);
 struct synctask *synctask_create (struct syncenv *, synctask_fn_t,
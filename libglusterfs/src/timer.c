@@ -18,6 +18,87 @@
 #include "common-utils.h"
 #include "globals.h"
 #include "timespec.h"
+#include "statedump.h"
+
+#ifdef HAVE_SYS_TIMERFD_H
+#include <sys/timerfd.h>
+#endif
+
+static uint64_t
+gf_timer_now (gf_timer_registry_t *reg)
+{
+        struct timespec now = {0, };
+
+        timespec_now (&now);
+
+        return (TS (now) - reg->base) / GF_TIMER_TICK_NS;
+}
+
+
+static void
+__gf_timer_insert (gf_timer_registry_t *reg, gf_timer_t *event)
+{
+        struct list_head *slot = NULL;
+        uint64_t          expires = 0;
+        uint64_t          delta = 0;
+        int               level = 0;
+        int               shift = 0;
+
+        expires = event->expires;
+        if (expires < reg->tick)
+                expires = reg->tick;
+
+        delta = expires - reg->tick;
+        if (delta > GF_TIMER_MAX_TICKS) {
+                delta = GF_TIMER_MAX_TICKS;
+                expires = reg->tick + delta;
+        }
+
+        if (delta < GF_TIMER_ROOT_SIZE) {
+                slot = &reg->root[expires & GF_TIMER_ROOT_MASK];
+        } else {
+                for (level = 0; level < GF_TIMER_LEVELS - 1; level++) {
+                        shift = GF_TIMER_ROOT_BITS +
+                                (level + 1) * GF_TIMER_LVL_BITS;
+                        if (delta < (1ULL << shift))
+                                break;
+                }
+                shift = GF_TIMER_ROOT_BITS + level * GF_TIMER_LVL_BITS;
+                slot = &reg->wheel[level][(expires >> shift) &
+                                          GF_TIMER_LVL_MASK];
+        }
+
+        list_add_tail (&event->list, slot);
+}
+
+
+/* Program the wake up of gf_timer_proc for @tick, 0 meaning never. */
+static void
+__gf_timer_arm (gf_timer_registry_t *reg, uint64_t tick)
+{
+        reg->armed = tick;
+
+#ifdef HAVE_SYS_TIMERFD_H
+        if (reg->tfd != -1) {
+                struct itimerspec its = {{0, }, {0, }};
+                uint64_t          at = 0;
+
+                if (tick) {
+                        at = reg->base + tick * GF_TIMER_TICK_NS;
+                        its.it_value.tv_sec = at / 1000000000;
+                        its.it_value.tv_nsec = at % 1000000000;
+                        /* an all zero it_value would disarm the timer */
+                        if (!its.it_value.tv_sec && !its.it_value.tv_nsec)
+                                its.it_value.tv_nsec = 1;
+                }
+
+                timerfd_settime (reg->tfd, TFD_TIMER_ABSTIME, &its, NULL);
+                return;
+        }
+#endif
+        pthread_cond_signal (&reg->cond);
+}
+
 
 gf_timer_t *
 gf_timer_call_after (glusterfs_ctx_t *ctx,
@@ -27,8 +108,6 @@ gf_timer_call_after (glusterfs_ctx_t *ctx,
 {
         gf_timer_registry_t *reg = NULL;
         gf_timer_t *event = NULL;
-        gf_timer_t *trav = NULL;
-        uint64_t at = 0;
 
         if (ctx == NULL)
         {
@@ -49,47 +128,25 @@ gf_timer_call_after (glusterfs_ctx_t *ctx,
         }
         timespec_now (&event->at);
         timespec_adjust_delta (&event->at, delta);
-        at = TS (event->at);
+        /* never fire early, round up to the next tick */
+        event->expires = (TS (event->at) - reg->base + GF_TIMER_TICK_NS - 1)
+                         / GF_TIMER_TICK_NS;
         event->callbk = callbk;
         event->data = data;
         event->xl = THIS;
+        INIT_LIST_HEAD (&event->list);
         pthread_mutex_lock (&reg->lock);
         {
-                trav = reg->active.prev;
-                while (trav != &reg->active) {
-                        if (TS (trav->at) < at)
-                                break;
-                        trav = trav->prev;
-                }
-                event->prev = trav;
-                event->next = event->prev->next;
-                event->prev->next = event;
-                event->next->prev = event;
+                __gf_timer_insert (reg, event);
+                reg->count++;
+
+                if (!reg->armed || event->expires < reg->armed)
+                        __gf_timer_arm (reg, max (event->expires, reg->tick));
         }
         pthread_mutex_unlock (&reg->lock);
         return event;
 }
 
-int32_t
-gf_timer_call_stale (gf_timer_registry_t *reg,
-                     gf_timer_t *event)
-{
-        if (reg == NULL || event == NULL)
-        {
-                gf_log_callingfn ("timer", GF_LOG_ERROR, "invalid argument");
-                return 0;
-        }
-
-        event->next->prev = event->prev;
-        event->prev->next = event->next;
-        event->next = &reg->stale;
-        event->prev = event->next->prev;
-        event->next->prev = event;
-        event->prev->next = event;
-
-        return 0;
-}
-
 int32_t
 gf_timer_call_cancel (glusterfs_ctx_t *ctx,
                       gf_timer_t *event)
@@ -111,8 +168,10 @@ gf_timer_call_cancel (glusterfs_ctx_t *ctx,
 
         pthread_mutex_lock (&reg->lock);
         {
-                event->next->prev = event->prev;
-                event->prev->next = event->next;
+                /* wherever it is: wheel, expired or stale list */
+                list_del_init (&event->list);
+                if (!event->fired)
+                        reg->count--;
         }
         pthread_mutex_unlock (&reg->lock);
 
@@ -120,11 +179,162 @@ gf_timer_call_cancel (glusterfs_ctx_t *ctx,
         return 0;
 }
 
+
+static void
+__gf_timer_cascade (gf_timer_registry_t *reg, int level, int idx)
+{
+        struct list_head  pending;
+        gf_timer_t       *event = NULL;
+        gf_timer_t       *tmp = NULL;
+
+        INIT_LIST_HEAD (&pending);
+        list_splice_init (&reg->wheel[level][idx], &pending);
+
+        list_for_each_entry_safe (event, tmp, &pending, list) {
+                list_del_init (&event->list);
+                __gf_timer_insert (reg, event);
+        }
+}
+
+
+/* Move everything due up to @now to the expired list. */
+static void
+__gf_timer_advance (gf_timer_registry_t *reg, uint64_t now)
+{
+        int idx = 0;
+        int level = 0;
+
+        if (!reg->count) {
+                reg->tick = now + 1;
+                return;
+        }
+
+        while (reg->tick <= now) {
+                idx = reg->tick & GF_TIMER_ROOT_MASK;
+                if (!idx) {
+                        for (level = 0; level < GF_TIMER_LEVELS; level++) {
+                                idx = (reg->tick >>
+                                       (GF_TIMER_ROOT_BITS +
+                                        level * GF_TIMER_LVL_BITS)) &
+                                      GF_TIMER_LVL_MASK;
+                                __gf_timer_cascade (reg, level, idx);
+                                if (idx)
+                                        break;
+                        }
+                        idx = 0;
+                }
+
+                list_append_init (&reg->root[idx], &reg->expired);
+                reg->tick++;
+        }
+}
+
+
+/* Next tick worth waking up for: the first non-empty root slot, or the
+ * next cascade when the root wheel is empty. */
+static uint64_t
+__gf_timer_next (gf_timer_registry_t *reg)
+{
+        uint64_t tick = 0;
+        int      i = 0;
+
+        if (!reg->count)
+                return 0;
+
+        if (!list_empty (&reg->expired))
+                return reg->tick;
+
+        for (i = 0; i < GF_TIMER_ROOT_SIZE; i++) {
+                tick = reg->tick + i;
+                if (!(tick & GF_TIMER_ROOT_MASK))
+                        break;
+                if (!list_empty (&reg->root[tick & GF_TIMER_ROOT_MASK]))
+                        break;
+        }
+
+        return tick;
+}
+
+
+static void
+gf_timer_wait (gf_timer_registry_t *reg)
+{
+#ifdef HAVE_SYS_TIMERFD_H
+        uint64_t expirations = 0;
+
+        if (reg->tfd != -1) {
+                if (read (reg->tfd, &expirations, sizeof (expirations)) < 0 &&
+                    errno != EINTR && errno != EAGAIN)
+                        gf_log ("timer", GF_LOG_ERROR,
+                                "read on timerfd failed (%s)",
+                                strerror (errno));
+                return;
+        }
+#endif
+        pthread_mutex_lock (&reg->lock);
+        {
+                struct timespec  abs = {0, };
+                struct timeval   tv = {0, };
+                uint64_t         now = 0;
+                uint64_t         wait = 0;
+
+                if (reg->fin)
+                        goto unlock;
+
+                if (!reg->armed) {
+                        pthread_cond_wait (&reg->cond, &reg->lock);
+                        goto unlock;
+                }
+
+                now = gf_timer_now (reg);
+                if (reg->armed <= now)
+                        goto unlock;
+
+                wait = (reg->armed - now) * GF_TIMER_TICK_NS;
+                gettimeofday (&tv, NULL);
+                wait += tv.tv_usec * 1000ULL;
+                abs.tv_sec = tv.tv_sec + wait / 1000000000;
+                abs.tv_nsec = wait % 1000000000;
+
+                pthread_cond_timedwait (&reg->cond, &reg->lock, &abs);
+        }
+unlock:
+        pthread_mutex_unlock (&reg->lock);
+}
+
+
+static void
+gf_timer_registry_destroy (gf_timer_registry_t *reg)
+{
+        gf_timer_t *event = NULL;
+        gf_timer_t *tmp = NULL;
+        int         i = 0;
+        int         j = 0;
+
+        for (i = 0; i < GF_TIMER_ROOT_SIZE; i++)
+                list_append_init (&reg->root[i], &reg->stale);
+        for (i = 0; i < GF_TIMER_LEVELS; i++)
+                for (j = 0; j < GF_TIMER_LVL_SIZE; j++)
+                        list_append_init (&reg->wheel[i][j], &reg->stale);
+        list_append_init (&reg->expired, &reg->stale);
+
+        list_for_each_entry_safe (event, tmp, &reg->stale, list) {
+                list_del (&event->list);
+                GF_FREE (event);
+        }
+
+        if (reg->tfd != -1)
+                close (reg->tfd);
+        pthread_cond_destroy (&reg->cond);
+        pthread_mutex_destroy (&reg->lock);
+        GF_FREE (reg);
+}
+
+
 void *
 gf_timer_proc (void *ctx)
 {
         gf_timer_registry_t *reg = NULL;
-        const struct timespec sleepts = {.tv_sec = 1, .tv_nsec = 0, };
 
         if (ctx == NULL)
         {
@@ -139,50 +349,48 @@ gf_timer_proc (void *ctx)
         }
 
         while (!reg->fin) {
-                uint64_t now;
-                struct timespec now_ts;
                 gf_timer_t *event = NULL;
 
-                timespec_now (&now_ts);
-                now = TS (now_ts);
-                while (1) {
-                        uint64_t at;
-                        char need_cbk = 0;
+                pthread_mutex_lock (&reg->lock);
+                {
+                        __gf_timer_advance (reg, gf_timer_now (reg));
+                }
+                pthread_mutex_unlock (&reg->lock);
 
+                while (1) {
                         pthread_mutex_lock (&reg->lock);
                         {
-                                event = reg->active.next;
-                                at = TS (event->at);
-                                if (event != &reg->active && now >= at) {
-                                        need_cbk = 1;
-                                        gf_timer_call_stale (reg, event);
+                                event = NULL;
+                                if (!list_empty (&reg->expired)) {
+                                        event = list_entry (reg->expired.next,
+                                                            gf_timer_t, list);
+                                        list_move_tail (&event->list,
+                                                        &reg->stale);
+                                        event->fired = 1;
+                                        reg->count--;
                                 }
                         }
                         pthread_mutex_unlock (&reg->lock);
-                        if (event->xl)
-                                THIS = event->xl;
-                        if (need_cbk)
-                                event->callbk  (event->data);
 
-                        else
+                        if (!event)
                                 break;
-                }
-                nanosleep (&sleepts, NULL);
-        }
 
-        pthread_mutex_lock (&reg->lock);
-        {
-                while (reg->active.next != &reg->active) {
-                        gf_timer_call_cancel (ctx, reg->active.next);
+                        if (event->xl)
+                                THIS = event->xl;
+                        event->callbk (event->data);
                 }
 
-                while (reg->stale.next != &reg->stale) {
-                        gf_timer_call_cancel (ctx, reg->stale.next);
+                pthread_mutex_lock (&reg->lock);
+                {
+                        __gf_timer_arm (reg, __gf_timer_next (reg));
                 }
+                pthread_mutex_unlock (&reg->lock);
+
+                gf_timer_wait (reg);
         }
-        pthread_mutex_unlock (&reg->lock);
-        pthread_mutex_destroy (&reg->lock);
-        GF_FREE (((glusterfs_ctx_t *)ctx)->timer);
+
+        ((glusterfs_ctx_t *)ctx)->timer = NULL;
+        gf_timer_registry_destroy (reg);
 
         return NULL;
 }
@@ -197,6 +405,9 @@ gf_timer_registry_init (glusterfs_ctx_t *ctx)
 
         if (!ctx->timer) {
                 gf_timer_registry_t *reg = NULL;
+                struct timespec      now = {0, };
+                int                  i = 0;
+                int                  j = 0;
 
                 reg = GF_CALLOC (1, sizeof (*reg),
                                  gf_common_mt_gf_timer_registry_t);
@@ -204,10 +415,27 @@ gf_timer_registry_init (glusterfs_ctx_t *ctx)
                         goto out;
 
                 pthread_mutex_init (&reg->lock, NULL);
-                reg->active.next = &reg->active;
-                reg->active.prev = &reg->active;
-                reg->stale.next = &reg->stale;
-                reg->stale.prev = &reg->stale;
+                pthread_cond_init (&reg->cond, NULL);
+
+                for (i = 0; i < GF_TIMER_ROOT_SIZE; i++)
+                        INIT_LIST_HEAD (&reg->root[i]);
+                for (i = 0; i < GF_TIMER_LEVELS; i++)
+                        for (j = 0; j < GF_TIMER_LVL_SIZE; j++)
+                                INIT_LIST_HEAD (&reg->wheel[i][j]);
+                INIT_LIST_HEAD (&reg->expired);
+                INIT_LIST_HEAD (&reg->stale);
+
+                timespec_now (&now);
+                reg->base = TS (now);
+
+                reg->tfd = -1;
+#ifdef HAVE_SYS_TIMERFD_H
+                reg->tfd = timerfd_create (CLOCK_MONOTONIC, TFD_CLOEXEC);
+                if (reg->tfd == -1)
+                        gf_log ("timer", GF_LOG_WARNING,
+                                "timerfd_create failed (%s), falling back to "
+                                "condition wait", strerror (errno));
+#endif
 
                 ctx->timer = reg;
                 gf_thread_create (&reg->th, NULL, gf_timer_proc, ctx);
@@ -215,3 +443,82 @@ gf_timer_registry_init (glusterfs_ctx_t *ctx)
 out:
         return ctx->timer;
 }
+
+
+void
+gf_timer_registry_dump (glusterfs_ctx_t *ctx)
+{
+        gf_timer_registry_t *reg = NULL;
+        gf_timer_t          *event = NULL;
+        struct list_head    *lists[GF_TIMER_ROOT_SIZE +
+                                   GF_TIMER_LEVELS * GF_TIMER_LVL_SIZE + 1];
+        struct {
+                xlator_t *xl;
+                int       count;
+        }                    per_xl[64];
+        int                  nxl = 0;
+        int                  maxxl = sizeof (per_xl) / sizeof (per_xl[0]);
+        int                  others = 0;
+        int                  stale = 0;
+        uint64_t             pending = 0;
+        uint64_t             tick = 0;
+        int                  nlists = 0;
+        int                  i = 0;
+        int                  j = 0;
+        char                 key[GF_DUMP_MAX_BUF_LEN];
+
+        if (!ctx || !ctx->timer)
+                return;
+
+        reg = ctx->timer;
+
+        for (i = 0; i < GF_TIMER_ROOT_SIZE; i++)
+                lists[nlists++] = &reg->root[i];
+        for (i = 0; i < GF_TIMER_LEVELS; i++)
+                for (j = 0; j < GF_TIMER_LVL_SIZE; j++)
+                        lists[nlists++] = &reg->wheel[i][j];
+        lists[nlists++] = &reg->expired;
+
+        pthread_mutex_lock (&reg->lock);
+        {
+                pending = reg->count;
+                tick = reg->tick;
+
+                for (i = 0; i < nlists; i++) {
+                        list_for_each_entry (event, lists[i], list) {
+                                for (j = 0; j < nxl; j++)
+                                        if (per_xl[j].xl == event->xl)
+                                                break;
+                                if (j == nxl) {
+                                        if (nxl == maxxl) {
+                                                others++;
+                                                continue;
+                                        }
+                                        per_xl[nxl].xl = event->xl;
+                                        per_xl[nxl].count = 0;
+                                        nxl++;
+                                }
+                                per_xl[j].count++;
+                        }
+                }
+
+                list_for_each_entry (event, &reg->stale, list)
+                        stale++;
+        }
+        pthread_mutex_unlock (&reg->lock);
+
+        gf_proc_dump_add_section ("timer");
+        gf_proc_dump_write ("resolution-ms", "%d",
+                            GF_TIMER_TICK_NS / 1000000);
+        gf_proc_dump_write ("current-tick", "%"PRIu64, tick);
+        gf_proc_dump_write ("pending", "%"PRIu64, pending);
+        gf_proc_dump_write ("fired-not-cancelled", "%d", stale);
+
+        for (i = 0; i < nxl; i++) {
+                snprintf (key, sizeof (key), "xlator.%s.pending",
+                          per_xl[i].xl ? per_xl[i].xl->name : "(null)");
+                gf_proc_dump_write (key, "%d", per_xl[i].count);
+        }
+        if (others)
+                gf_proc_dump_write ("xlator.others.pending", "%d", others);
+}
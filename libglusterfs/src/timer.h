@@ -23,20 +23,48 @@
 
 typedef void (*gf_timer_cbk_t) (void *);
 
+/* Timers are kept in a hierarchical timing wheel with a resolution of
+ * one tick: a root wheel of 256 slots covering the next 256 ticks and four
+ * coarser wheels of 64 slots each, which are cascaded down to the root as
+ * time goes by. Insertion and cancellation are O(1).
+ */
+#define GF_TIMER_TICK_NS        1000000 /* 1ms */
+#define GF_TIMER_ROOT_BITS      8
+#define GF_TIMER_LVL_BITS       6
+#define GF_TIMER_ROOT_SIZE      (1 << GF_TIMER_ROOT_BITS)
+#define GF_TIMER_LVL_SIZE       (1 << GF_TIMER_LVL_BITS)
+#define GF_TIMER_ROOT_MASK      (GF_TIMER_ROOT_SIZE - 1)
+#define GF_TIMER_LVL_MASK       (GF_TIMER_LVL_SIZE - 1)
+#define GF_TIMER_LEVELS         4
+#define GF_TIMER_MAX_TICKS      ((1ULL << (GF_TIMER_ROOT_BITS +        \
+                                           GF_TIMER_LEVELS *           \
+                                           GF_TIMER_LVL_BITS)) - 1)
+
 struct _gf_timer {
-        struct _gf_timer *next, *prev;
-        struct timespec    at;
+        struct list_head  list;
+        struct timespec   at;
+        uint64_t          expires; /* in ticks of the registry */
         gf_timer_cbk_t    callbk;
         void             *data;
         xlator_t         *xl;
+        char              fired;
 };
 
 struct _gf_timer_registry {
         pthread_t        th;
         char             fin;
-        struct _gf_timer stale;
-        struct _gf_timer active;
+        int              tfd;      /* timerfd driving gf_timer_proc */
+        uint64_t         base;     /* monotonic time of tick 0, in ns */
+        uint64_t         tick;     /* next tick to be processed */
+        uint64_t         armed;    /* tick gf_timer_proc wakes up at,
+                                      0 when there is nothing to wait for */
+        uint64_t         count;    /* timers not yet fired */
+        struct list_head root[GF_TIMER_ROOT_SIZE];
+        struct list_head wheel[GF_TIMER_LEVELS][GF_TIMER_LVL_SIZE];
+        struct list_head expired;  /* due, callback not called yet */
+        struct list_head stale;    /* fired, waiting for cancel */
         pthread_mutex_t  lock;
+        pthread_cond_t   cond;     /* used when there is no timerfd */
 };
 
 typedef struct _gf_timer gf_timer_t;
@@ -58,4 +86,7 @@ gf_timer_proc (void *data);
 gf_timer_registry_t *
 gf_timer_registry_init (glusterfs_ctx_t *ctx);
 
+void
+gf_timer_registry_dump (glusterfs_ctx_t *ctx);
+
 #endif /* _TIMER_H */
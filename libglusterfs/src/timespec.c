@@ -59,7 +59,9 @@ void timespec_now (struct timespec *ts)
 
 void timespec_adjust_delta (struct timespec *ts, struct timespec delta)
 {
-        ts->tv_nsec = ((ts->tv_nsec + delta.tv_nsec) % 1000000000);
-        ts->tv_sec += ((ts->tv_nsec + delta.tv_nsec) / 1000000000);
+        long nsec = ts->tv_nsec + delta.tv_nsec;
+
+        ts->tv_nsec = nsec % 1000000000;
+        ts->tv_sec += nsec / 1000000000;
         ts->tv_sec += delta.tv_sec;
 }
@@ -0,0 +1,85 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Throughput of the block checksums used by data self-heal: the MD5 strong
+ * checksum of plain rchecksum requests against the fast checksum which
+ * bricks use for tree rchecksum requests, on 128KB blocks.
+ *
+ * usage: checksum_bench [megabytes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <openssl/md5.h>
+
+#include "glusterfs.h"
+#include "checksum.h"
+
+#define BENCH_BLOCK (128 * 1024)
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main (int argc, char *argv[])
+{
+        unsigned char  *buf = NULL;
+        unsigned char   sum[MD5_DIGEST_LENGTH];
+        unsigned char   acc = 0;
+        long            megabytes = 1024;
+        long            blocks = 0;
+        long            i = 0;
+        double          start = 0;
+        double          md5 = 0;
+        double          fast = 0;
+
+        if (argc > 1)
+                megabytes = atol (argv[1]);
+        blocks = megabytes * 1024 * 1024 / BENCH_BLOCK;
+
+        buf = malloc (BENCH_BLOCK);
+        if (!buf)
+                return 1;
+        for (i = 0; i < BENCH_BLOCK; i++)
+                buf[i] = rand ();
+
+        start = bench_now ();
+        for (i = 0; i < blocks; i++) {
+                buf[0] = i;
+                gf_rsync_strong_checksum (buf, BENCH_BLOCK, sum);
+                acc ^= sum[0];
+        }
+        md5 = megabytes / (bench_now () - start);
+
+        start = bench_now ();
+        for (i = 0; i < blocks; i++) {
+                buf[0] = i;
+                gf_fast_checksum (buf, BENCH_BLOCK, sum);
+                acc ^= sum[0];
+        }
+        fast = megabytes / (bench_now () - start);
+
+        printf ("%-10s %10.0f MB/s\n", "md5", md5);
+        printf ("%-10s %10.0f MB/s\n", "fast", fast);
+        printf ("(%d)\n", acc);
+
+        free (buf);
+
+        return 0;
+}
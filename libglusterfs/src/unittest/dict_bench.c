@@ -0,0 +1,192 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Cost of the dict operations found on the fop path: building a small
+ * xdata dict, looking keys up, serializing it for the wire and decoding
+ * it again, plus a larger getxattr-style reply. Run it against two builds
+ * to compare dict implementations.
+ *
+ * usage: dict_bench [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "dict.h"
+
+#define BENCH_XATTR_KEYS   32
+
+static char *bench_keys[] = {
+        "trusted.afr.patchy-client-0",
+        "trusted.afr.patchy-client-1",
+        "glusterfs.open-fd-count",
+        "trusted.glusterfs.dht",
+        "link-count",
+        "glusterfs.inodelk-count",
+};
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* dict_new, a few typed sets, a few gets, unref: an xdata round trip
+ * inside one process. */
+static int
+bench_xdata (long iterations)
+{
+        dict_t   *dict = NULL;
+        char      afr[12] = {0, };
+        int32_t   i32 = 0;
+        uint32_t  u32 = 0;
+        void     *ptr = NULL;
+        long      i = 0;
+        int       ret = 0;
+
+        for (i = 0; i < iterations; i++) {
+                dict = dict_new ();
+                ret |= dict_set_static_bin (dict, bench_keys[0], afr,
+                                            sizeof (afr));
+                ret |= dict_set_static_bin (dict, bench_keys[1], afr,
+                                            sizeof (afr));
+                ret |= dict_set_uint32 (dict, bench_keys[2], 1);
+                ret |= dict_set_int32 (dict, bench_keys[5], 0);
+
+                ret |= dict_get_int32 (dict, bench_keys[5], &i32);
+                ret |= dict_get_uint32 (dict, bench_keys[2], &u32);
+                ret |= dict_get_ptr (dict, bench_keys[0], &ptr);
+                dict_get (dict, bench_keys[3]);
+
+                dict_unref (dict);
+        }
+
+        return ret;
+}
+
+/* What protocol/client and protocol/server do with every xdata. */
+static int
+bench_wire (long iterations)
+{
+        dict_t   *dict = NULL;
+        dict_t   *out  = NULL;
+        char     *buf  = NULL;
+        u_int     len  = 0;
+        char      afr[12] = {0, };
+        int32_t   i32 = 0;
+        long      i = 0;
+        int       ret = 0;
+
+        dict = dict_new ();
+        ret |= dict_set_static_bin (dict, bench_keys[0], afr, sizeof (afr));
+        ret |= dict_set_static_bin (dict, bench_keys[1], afr, sizeof (afr));
+        ret |= dict_set_uint32 (dict, bench_keys[2], 1);
+        ret |= dict_set_int32 (dict, bench_keys[5], 0);
+
+        for (i = 0; i < iterations; i++) {
+                dict_allocate_and_serialize (dict, &buf, &len);
+
+                out = dict_new ();
+                dict_unserialize (buf, len, &out);
+                ret |= dict_get_int32 (out, bench_keys[5], &i32);
+                dict_unref (out);
+
+                GF_FREE (buf);
+        }
+
+        dict_unref (dict);
+
+        return ret;
+}
+
+/* A getxattr reply with many keys, looked up one by one. */
+static int
+bench_xattrs (long iterations)
+{
+        dict_t   *dict = NULL;
+        char      key[64];
+        int       j = 0;
+        long      i = 0;
+        int       ret = 0;
+
+        for (i = 0; i < iterations; i++) {
+                dict = dict_new ();
+                for (j = 0; j < BENCH_XATTR_KEYS; j++) {
+                        snprintf (key, sizeof (key), "user.attribute.%d", j);
+                        ret |= dict_set_uint64 (dict, key, j);
+                }
+                for (j = 0; j < BENCH_XATTR_KEYS; j++) {
+                        snprintf (key, sizeof (key), "user.attribute.%d", j);
+                        dict_get (dict, key);
+                }
+                dict_unref (dict);
+        }
+
+        return ret;
+}
+
+static int
+bench_report (const char *name, int (*fn) (long), long iterations)
+{
+        double start = 0;
+        double secs  = 0;
+        int    ret   = 0;
+
+        start = bench_now ();
+        ret = fn (iterations);
+        secs = bench_now () - start;
+
+        if (ret) {
+                printf ("%-10s failed\n", name);
+                return -1;
+        }
+
+        printf ("%-10s %12.0f ns/op %14.0f ops/sec\n", name,
+                secs * 1e9 / iterations, iterations / secs);
+
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t *ctx        = NULL;
+        long             iterations = 1000000;
+        int              ret        = 0;
+
+        if (argc > 1)
+                iterations = atol (argv[1]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        ctx->dict_pool = mem_pool_new (dict_t, 1024);
+        ctx->dict_pair_pool = mem_pool_new (data_pair_t, 4096);
+        ctx->dict_data_pool = mem_pool_new (data_t, 4096);
+        if (!ctx->dict_pool || !ctx->dict_pair_pool || !ctx->dict_data_pool)
+                return 1;
+
+        ret |= bench_report ("xdata", bench_xdata, iterations);
+        ret |= bench_report ("wire", bench_wire, iterations);
+        ret |= bench_report ("xattrs", bench_xattrs, iterations / 10);
+
+        return ret ? 1 : 0;
+}
@@ -0,0 +1,207 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Lookup throughput of one inode table as the number of threads grows.
+ * Each thread resolves random entries by gfid (inode_find) and by name
+ * (inode_grep) and drops the reference again, which is what the server
+ * resolver and the fuse and nfs lookup paths do for every fop. With an
+ * lru-limit below the number of entries, the table is pruned while the
+ * threads run.
+ *
+ * usage: inode_bench [max-threads] [iterations-per-thread] [entries]
+ *                    [lru-limit]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "inode.h"
+
+struct bench_arg {
+        inode_table_t   *table;
+        xlator_t        *xl;
+        long             iterations;
+        int              entries;
+        unsigned int     seed;
+};
+
+static void
+bench_gfid (uuid_t gfid, int i)
+{
+        memset (gfid, 0, sizeof (uuid_t));
+        gfid[0] = 0xbe;
+        gfid[12] = (i >> 24) & 0xff;
+        gfid[13] = (i >> 16) & 0xff;
+        gfid[14] = (i >> 8) & 0xff;
+        gfid[15] = i & 0xff;
+}
+
+static void *
+bench_worker (void *data)
+{
+        struct bench_arg *arg = data;
+        unsigned int      seed = arg->seed;
+        char              name[32];
+        uuid_t            gfid;
+        inode_t          *inode = NULL;
+        long              i = 0;
+        int               k = 0;
+
+        THIS = arg->xl;
+
+        for (i = 0; i < arg->iterations; i++) {
+                k = rand_r (&seed) % arg->entries;
+
+                bench_gfid (gfid, k + 2);
+                inode = inode_find (arg->table, gfid);
+                if (inode)
+                        inode_unref (inode);
+
+                snprintf (name, sizeof (name), "entry.%d", k);
+                inode = inode_grep (arg->table, arg->table->root, name);
+                if (inode)
+                        inode_unref (inode);
+        }
+
+        return NULL;
+}
+
+static double
+bench_run (inode_table_t *table, int threads, long iterations, int entries)
+{
+        pthread_t        *tids = NULL;
+        struct bench_arg *args = NULL;
+        struct timespec   start;
+        struct timespec   end;
+        int               i    = 0;
+
+        tids = calloc (threads, sizeof (*tids));
+        args = calloc (threads, sizeof (*args));
+        if (!tids || !args) {
+                free (tids);
+                free (args);
+                return 0;
+        }
+
+        for (i = 0; i < threads; i++) {
+                args[i].table = table;
+                args[i].xl = THIS;
+                args[i].iterations = iterations;
+                args[i].entries = entries;
+                args[i].seed = i + 1;
+        }
+
+        clock_gettime (CLOCK_MONOTONIC, &start);
+        for (i = 0; i < threads; i++)
+                pthread_create (&tids[i], NULL, bench_worker, &args[i]);
+        for (i = 0; i < threads; i++)
+                pthread_join (tids[i], NULL);
+        clock_gettime (CLOCK_MONOTONIC, &end);
+
+        free (tids);
+        free (args);
+
+        return (end.tv_sec - start.tv_sec) +
+               (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+static int
+bench_populate (inode_table_t *table, int entries)
+{
+        struct iatt  iatt = {0, };
+        char         name[32];
+        inode_t     *inode = NULL;
+        inode_t     *linked = NULL;
+        int          i = 0;
+
+        for (i = 0; i < entries; i++) {
+                inode = inode_new (table);
+                if (!inode)
+                        return -1;
+
+                bench_gfid (iatt.ia_gfid, i + 2);
+                iatt.ia_type = IA_IFREG;
+                snprintf (name, sizeof (name), "entry.%d", i);
+
+                linked = inode_link (inode, table->root, name, &iatt);
+                if (!linked)
+                        return -1;
+                inode_lookup (linked);
+                inode_unref (linked);
+                inode_unref (inode);
+        }
+
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t           *ctx        = NULL;
+        glusterfs_graph_t          graph      = {{0, }, };
+        xlator_t                   xl         = {0, };
+        inode_table_t             *table      = NULL;
+        int                        max        = 32;
+        long                       iterations = 200000;
+        int                        entries    = 100000;
+        uint32_t                   lru_limit  = 0;
+        int                        threads    = 0;
+        double                     secs       = 0;
+        double                     ops        = 0;
+
+        if (argc > 1)
+                max = atoi (argv[1]);
+        if (argc > 2)
+                iterations = atol (argv[2]);
+        if (argc > 3)
+                entries = atoi (argv[3]);
+        if (argc > 4)
+                lru_limit = atoi (argv[4]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        graph.xl_count = 1;
+        xl.name = "bench";
+        xl.graph = &graph;
+        xl.ctx = ctx;
+
+        table = inode_table_new (lru_limit ? lru_limit : entries * 2, &xl);
+        if (!table)
+                return 1;
+        inode_ref (table->root);
+
+        if (bench_populate (table, entries))
+                return 1;
+
+        printf ("%8s %14s %14s\n", "threads", "lookups/sec",
+                "lookups/sec/thr");
+
+        for (threads = 1; threads <= max; threads *= 2) {
+                secs = bench_run (table, threads, iterations, entries);
+                ops = (double)threads * iterations * 2;
+
+                printf ("%8d %14.0f %14.0f\n", threads, ops / secs,
+                        ops / secs / threads);
+        }
+
+        printf ("active %u lru %u purge %u\n", table->active_size,
+                table->lru_size, table->purge_size);
+
+        return 0;
+}
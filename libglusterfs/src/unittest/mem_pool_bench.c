@@ -0,0 +1,143 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Allocation throughput of mem_get()/mem_put() as the number of threads
+ * sharing one pool grows. Each thread repeatedly takes a burst of chunks
+ * and gives them back, which is the pattern of frames and dicts on the
+ * fop path. The baseline is the same pool with its per-thread magazines
+ * switched off, so that every call goes to the shared list under
+ * pool->lock.
+ *
+ * usage: mem_pool_bench [max-threads] [iterations-per-thread]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "mem-pool.h"
+
+#define BENCH_OBJ_SIZE     256
+#define BENCH_POOL_COUNT   4096
+#define BENCH_BURST        16
+
+struct bench_arg {
+        struct mem_pool *pool;
+        xlator_t        *xl;
+        long             iterations;
+};
+
+static void *
+bench_worker (void *data)
+{
+        struct bench_arg *arg = data;
+        void             *objs[BENCH_BURST];
+        long              i = 0;
+        int               j = 0;
+
+        THIS = arg->xl;
+
+        for (i = 0; i < arg->iterations; i++) {
+                for (j = 0; j < BENCH_BURST; j++)
+                        objs[j] = mem_get (arg->pool);
+                for (j = 0; j < BENCH_BURST; j++)
+                        mem_put (objs[j]);
+        }
+
+        return NULL;
+}
+
+static double
+bench_run (struct mem_pool *pool, int threads, long iterations)
+{
+        pthread_t        *tids = NULL;
+        struct bench_arg  arg  = {0,};
+        struct timespec   start;
+        struct timespec   end;
+        int               i    = 0;
+
+        tids = calloc (threads, sizeof (*tids));
+        if (!tids)
+                return 0;
+
+        arg.pool = pool;
+        arg.xl = THIS;
+        arg.iterations = iterations;
+
+        clock_gettime (CLOCK_MONOTONIC, &start);
+        for (i = 0; i < threads; i++)
+                pthread_create (&tids[i], NULL, bench_worker, &arg);
+        for (i = 0; i < threads; i++)
+                pthread_join (tids[i], NULL);
+        clock_gettime (CLOCK_MONOTONIC, &end);
+
+        free (tids);
+
+        return (end.tv_sec - start.tv_sec) +
+               (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t           *ctx        = NULL;
+        struct mem_pool           *pool       = NULL;
+        struct mem_pool           *base       = NULL;
+        int                        mag_index  = -1;
+        int                        max        = 32;
+        long                       iterations = 200000;
+        int                        threads    = 0;
+        double                     ops        = 0;
+        double                     shared     = 0;
+        double                     cached     = 0;
+
+        if (argc > 1)
+                max = atoi (argv[1]);
+        if (argc > 2)
+                iterations = atol (argv[2]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        pool = mem_pool_new_fn (BENCH_OBJ_SIZE, BENCH_POOL_COUNT, "bench");
+        base = mem_pool_new_fn (BENCH_OBJ_SIZE, BENCH_POOL_COUNT,
+                                "bench-shared");
+        if (!pool || !base)
+                return 1;
+
+        /* given back before destroying the pool, which frees the slot */
+        mag_index = base->mag_index;
+        base->mag_index = -1;
+
+        printf ("%8s %14s %14s %8s\n", "threads", "shared ops/s",
+                "magazine ops/s", "speedup");
+
+        for (threads = 1; threads <= max; threads *= 2) {
+                ops = (double)threads * iterations * BENCH_BURST * 2;
+                shared = ops / bench_run (base, threads, iterations);
+                cached = ops / bench_run (pool, threads, iterations);
+
+                printf ("%8d %14.0f %14.0f %7.2fx\n", threads, shared,
+                        cached, cached / shared);
+        }
+
+        base->mag_index = mag_index;
+        mem_pool_destroy (base);
+        mem_pool_destroy (pool);
+
+        return 0;
+}
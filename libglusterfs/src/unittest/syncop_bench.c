@@ -0,0 +1,154 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Cost of the synctask machinery under a syncop. A syncop winds a fop,
+ * yields, and is woken by the callback; the round trip goes through the
+ * syncenv run queue and switches the task out and back in. Here the tasks
+ * wake themselves before yielding, which leaves only that round trip.
+ * The second test spawns empty tasks one at a time and waits for each,
+ * so every task needs a stack.
+ *
+ * usage: syncop_bench [tasks] [round-trips-per-task] [spawns]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "stack.h"
+#include "syncop.h"
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int
+bench_roundtrips (void *opaque)
+{
+        struct synctask *task = NULL;
+        long             rounds = *(long *)opaque;
+        long             i = 0;
+
+        task = synctask_get ();
+
+        for (i = 0; i < rounds; i++) {
+                synctask_wake (task);
+                synctask_yield (task);
+        }
+
+        return 0;
+}
+
+static int
+bench_nothing (void *opaque)
+{
+        return 0;
+}
+
+static call_pool_t *
+bench_call_pool (void)
+{
+        call_pool_t *pool = NULL;
+
+        pool = calloc (1, sizeof (*pool));
+        if (!pool)
+                return NULL;
+
+        INIT_LIST_HEAD (&pool->all_frames);
+        LOCK_INIT (&pool->lock);
+        pool->frame_mem_pool = mem_pool_new (call_frame_t, 4096);
+        pool->stack_mem_pool = mem_pool_new (call_stack_t, 1024);
+        if (!pool->frame_mem_pool || !pool->stack_mem_pool)
+                return NULL;
+
+        return pool;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t  *ctx = NULL;
+        struct syncenv   *env = NULL;
+        struct synctask **tasks = NULL;
+        int               ntasks = 4;
+        long              rounds = 200000;
+        long              spawns = 100000;
+        long              i = 0;
+        int               errors = 0;
+        double            start = 0;
+        double            elapsed = 0;
+        uint64_t          switches = 0;
+
+        if (argc > 1)
+                ntasks = atoi (argv[1]);
+        if (argc > 2)
+                rounds = atol (argv[2]);
+        if (argc > 3)
+                spawns = atol (argv[3]);
+        if (ntasks < 1 || rounds < 1 || spawns < 1)
+                return 1;
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        ctx->pool = bench_call_pool ();
+        if (!ctx->pool)
+                return 1;
+
+        env = syncenv_new (0, 1, 1);
+        tasks = calloc (ntasks, sizeof (*tasks));
+        if (!env || !tasks)
+                return 1;
+
+#ifdef SYNCTASK_SWITCH_FAST
+        printf ("context switch: registers\n");
+#else
+        printf ("context switch: ucontext\n");
+#endif
+
+        start = bench_now ();
+        for (i = 0; i < ntasks; i++) {
+                tasks[i] = synctask_create (env, bench_roundtrips, NULL, NULL,
+                                            &rounds);
+                if (!tasks[i])
+                        return 1;
+        }
+        for (i = 0; i < ntasks; i++)
+                errors += (synctask_join (tasks[i]) != 0);
+        elapsed = bench_now () - start;
+        switches = env->switches;
+
+        printf ("%-24s %12.1f ns  (%"PRIu64" switches)\n",
+                "round trip", elapsed * 1e9 / (ntasks * rounds), switches);
+
+        start = bench_now ();
+        for (i = 0; i < spawns; i++)
+                errors += (synctask_new (env, bench_nothing, NULL, NULL,
+                                         NULL) != 0);
+        elapsed = bench_now () - start;
+
+        printf ("%-24s %12.1f ns  (stacks new %"PRIu64", reused %"PRIu64")\n",
+                "spawn", elapsed * 1e9 / spawns, env->stacks_new,
+                env->stacks_reused);
+
+        return errors ? 1 : 0;
+}
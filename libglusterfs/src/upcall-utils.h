@@ -0,0 +1,51 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef _UPCALL_UTILS_H
+#define _UPCALL_UTILS_H
+
+#include "uuid.h"
+
+/* What changed on the inode, in gf_upcall_cache_invalidation.flags */
+#define UP_NLINK          0x00000001   /* link count */
+#define UP_MODE           0x00000002   /* type and permission bits */
+#define UP_OWN            0x00000004   /* uid and gid */
+#define UP_SIZE           0x00000008
+#define UP_TIMES          0x00000010   /* mtime and ctime */
+#define UP_ATIME          0x00000020
+#define UP_XATTR          0x00000040   /* extended attributes */
+#define UP_RENAME         0x00000080   /* an entry of it was renamed */
+#define UP_FORGET         0x00000100   /* it was removed */
+#define UP_PARENT_DENTRY  0x00000200   /* entries were added or removed */
+
+#define UP_WRITE_FLAGS    (UP_SIZE | UP_TIMES)
+#define UP_ATTR_FLAGS     (UP_SIZE | UP_TIMES | UP_OWN | UP_MODE | UP_ATIME)
+#define UP_PARENT_DENTRY_FLAGS (UP_PARENT_DENTRY | UP_TIMES)
+
+typedef enum {
+        GF_UPCALL_EVENT_NULL,
+        GF_UPCALL_CACHE_INVALIDATION,
+} gf_upcall_event_t;
+
+/* The data of GF_EVENT_UPCALL. On the brick side client_uid names the
+   client it is meant for; on the client side it is not set. */
+struct gf_upcall {
+        char      *client_uid;
+        uuid_t     gfid;
+        uint32_t   event_type;
+        void      *data;
+};
+
+struct gf_upcall_cache_invalidation {
+        uint32_t   flags;
+        uint32_t   expire_time_attr;
+};
+
+#endif /* _UPCALL_UTILS_H */
@@ -15,6 +15,7 @@
 #endif
 
 #define RPC_CLNT_DEFAULT_REQUEST_COUNT 512
+#define RPC_CLNT_XID_BUCKETS           256
 
 #include "rpc-clnt.h"
 #include "rpc-clnt-ping.h"
@@ -44,6 +45,8 @@ rpc_clnt_new_callid (struct rpc_clnt *clnt)
 }
 
 
+/* sf is in the order the calls were sent, so only its head can have timed
+   out before the others. Lock fops on lk_sf never bail out. */
 struct saved_frame *
 __saved_frames_get_timedout (struct saved_frames *frames, uint32_t timeout,
                              struct timeval *current)
@@ -55,6 +58,7 @@ __saved_frames_get_timedout (struct saved_frames *frames, uint32_t timeout,
 		if ((tmp->saved_at.tv_sec + timeout) < current->tv_sec) {
 			bailout_frame = tmp;
 			list_del_init (&bailout_frame->list);
+                        list_del_init (&bailout_frame->xid_hash);
 			frames->count--;
 		}
 	}
@@ -78,6 +82,69 @@ _is_lock_fop (struct saved_frame *sframe)
                 (fop == GFS3_OP_FENTRYLK));
 }
 
+static struct list_head *
+__saved_frames_bucket (struct saved_frames *frames, int64_t callid)
+{
+        return &frames->xid_table[(uint32_t)callid & frames->xid_mask];
+}
+
+
+/* Doubles the xid table once there are more calls than buckets. If memory
+   is short the table stays as it is, with longer chains. */
+static void
+__saved_frames_grow (struct saved_frames *frames)
+{
+        struct list_head   *table = NULL;
+        struct list_head   *old = NULL;
+        struct saved_frame *trav = NULL;
+        struct saved_frame *tmp = NULL;
+        uint32_t            size = 0;
+        uint32_t            i = 0;
+
+        size = (frames->xid_mask + 1) * 2;
+        if (frames->count <= frames->xid_mask + 1 || !size)
+                return;
+
+        table = GF_CALLOC (size, sizeof (*table),
+                           gf_common_mt_rpcclnt_xid_table_t);
+        if (!table)
+                return;
+
+        for (i = 0; i < size; i++)
+                INIT_LIST_HEAD (&table[i]);
+
+        old = frames->xid_table;
+        for (i = 0; i <= frames->xid_mask; i++) {
+                list_for_each_entry_safe (trav, tmp, &old[i], xid_hash) {
+                        list_move_tail (&trav->xid_hash,
+                                        &table[trav->rpcreq->xid & (size - 1)]);
+                }
+        }
+
+        frames->xid_table = table;
+        frames->xid_mask = size - 1;
+
+        GF_FREE (old);
+}
+
+
+static struct saved_frame *
+__saved_frames_find (struct saved_frames *frames, int64_t callid)
+{
+        struct list_head   *bucket = NULL;
+        struct saved_frame *tmp = NULL;
+
+        bucket = __saved_frames_bucket (frames, callid);
+
+        list_for_each_entry (tmp, bucket, xid_hash) {
+                if (tmp->rpcreq->xid == callid)
+                        return tmp;
+        }
+
+        return NULL;
+}
+
+
 struct saved_frame *
 __saved_frames_put (struct saved_frames *frames, void *frame,
                     struct rpc_req *rpcreq)
@@ -92,6 +159,7 @@ __saved_frames_put (struct saved_frames *frames, void *frame,
 
         memset (saved_frame, 0, sizeof (*saved_frame));
 	INIT_LIST_HEAD (&saved_frame->list);
+        INIT_LIST_HEAD (&saved_frame->xid_hash);
 
 	saved_frame->capital_this = THIS;
 	saved_frame->frame        = frame;
@@ -103,7 +171,11 @@ __saved_frames_put (struct saved_frames *frames, void *frame,
         else
                 list_add_tail (&saved_frame->list, &frames->sf.list);
 
+        list_add_tail (&saved_frame->xid_hash,
+                       __saved_frames_bucket (frames, rpcreq->xid));
+
 	frames->count++;
+        __saved_frames_grow (frames);
 
 out:
 	return saved_frame;
@@ -250,6 +322,7 @@ struct saved_frames *
 saved_frames_new (void)
 {
 	struct saved_frames *saved_frames = NULL;
+        int                  i = 0;
 
 	saved_frames = GF_CALLOC (1, sizeof (*saved_frames),
                                   gf_common_mt_rpcclnt_savedframe_t);
@@ -260,6 +333,18 @@ saved_frames_new (void)
 	INIT_LIST_HEAD (&saved_frames->sf.list);
 	INIT_LIST_HEAD (&saved_frames->lk_sf.list);
 
+        saved_frames->xid_table = GF_CALLOC (RPC_CLNT_XID_BUCKETS,
+                                             sizeof (struct list_head),
+                                             gf_common_mt_rpcclnt_xid_table_t);
+        if (!saved_frames->xid_table) {
+                GF_FREE (saved_frames);
+                return NULL;
+        }
+
+        for (i = 0; i < RPC_CLNT_XID_BUCKETS; i++)
+                INIT_LIST_HEAD (&saved_frames->xid_table[i]);
+        saved_frames->xid_mask = RPC_CLNT_XID_BUCKETS - 1;
+
 	return saved_frames;
 }
 
@@ -276,21 +361,11 @@ __saved_frame_copy (struct saved_frames *frames, int64_t callid,
                 goto out;
         }
 
-	list_for_each_entry (tmp, &frames->sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			*saved_frame = *tmp;
-                        ret = 0;
-			goto out;
-		}
-	}
-
-	list_for_each_entry (tmp, &frames->lk_sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			*saved_frame = *tmp;
-                        ret = 0;
-			goto out;
-		}
-	}
+        tmp = __saved_frames_find (frames, callid);
+        if (tmp) {
+                *saved_frame = *tmp;
+                ret = 0;
+        }
 
 out:
 	return ret;
@@ -301,28 +376,12 @@ struct saved_frame *
 __saved_frame_get (struct saved_frames *frames, int64_t callid)
 {
 	struct saved_frame *saved_frame = NULL;
-	struct saved_frame *tmp = NULL;
-
-	list_for_each_entry (tmp, &frames->sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			list_del_init (&tmp->list);
-			frames->count--;
-			saved_frame = tmp;
-			goto out;
-		}
-	}
 
-	list_for_each_entry (tmp, &frames->lk_sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			list_del_init (&tmp->list);
-			frames->count--;
-			saved_frame = tmp;
-			goto out;
-		}
-	}
-
-out:
+        saved_frame = __saved_frames_find (frames, callid);
 	if (saved_frame) {
+                list_del_init (&saved_frame->list);
+                list_del_init (&saved_frame->xid_hash);
+                frames->count--;
                 THIS  = saved_frame->capital_this;
         }
 
@@ -341,6 +400,8 @@ saved_frames_unwind (struct saved_frames *saved_frames)
         list_splice_init (&saved_frames->lk_sf.list, &saved_frames->sf.list);
 
 	list_for_each_entry_safe (trav, tmp, &saved_frames->sf.list, list) {
+                list_del_init (&trav->xid_hash);
+
                 gf_time_fmt (timestr, sizeof timestr,
                              trav->saved_at.tv_sec, gf_timefmt_FT);
                 snprintf (timestr + strlen (timestr),
@@ -382,6 +443,7 @@ saved_frames_destroy (struct saved_frames *frames)
 
 	saved_frames_unwind (frames);
 
+        GF_FREE (frames->xid_table);
 	GF_FREE (frames);
 }
 
@@ -55,12 +55,21 @@ struct saved_frame {
 	struct timeval           saved_at;
         struct rpc_req          *rpcreq;
         rpc_transport_rsp_t      rsp;
+        struct list_head         xid_hash;
 };
 
+/* Outstanding calls are kept on sf (or lk_sf for lock fops) in the order
+ * they were sent, which is also the order in which they time out, and in a
+ * hash table keyed by xid for matching replies. Xids are handed out in
+ * sequence, so with at least as many buckets as calls most buckets hold
+ * one call.
+ */
 struct saved_frames {
 	int64_t            count;
 	struct saved_frame sf;
 	struct saved_frame lk_sf;
+        struct list_head  *xid_table;
+        uint32_t           xid_mask;
 };
 
 
@@ -983,6 +983,7 @@ rpcsvc_callback_submit (rpcsvc_t *rpc, rpc_transport_t *trans,
                         struct iovec *proghdr, int proghdrcount)
 {
         struct iobuf          *request_iob = NULL;
+        struct iobref         *iobref      = NULL;
         struct iovec           rpchdr      = {0,};
         rpc_transport_req_t    req;
         int                    ret         = -1;
@@ -1009,10 +1010,24 @@ rpcsvc_callback_submit (rpcsvc_t *rpc, rpc_transport_t *trans,
                 goto out;
         }
 
+        iobref = iobref_new ();
+        if (!iobref)
+                goto out;
+        iobref_add (iobref, request_iob);
+
+        /* The transport may queue the message and only keeps the iovecs,
+         * so the program header is copied behind the rpc header, into the
+         * iobuf which was sized for both and is held by the iobref.
+         */
+        if (proglen) {
+                iov_unload ((char *)rpchdr.iov_base + rpchdr.iov_len,
+                            proghdr, proghdrcount);
+                rpchdr.iov_len += proglen;
+        }
+
         req.msg.rpchdr = &rpchdr;
         req.msg.rpchdrcount = 1;
-        req.msg.proghdr = proghdr;
-        req.msg.proghdrcount = proghdrcount;
+        req.msg.iobref = iobref;
 
         ret = rpc_transport_submit_request (trans, &req);
         if (ret == -1) {
@@ -1024,7 +1039,10 @@ rpcsvc_callback_submit (rpcsvc_t *rpc, rpc_transport_t *trans,
         ret = 0;
 
 out:
-        iobuf_unref (request_iob);
+        if (iobref)
+                iobref_unref (iobref);
+        if (request_iob)
+                iobuf_unref (request_iob);
 
         return ret;
 }
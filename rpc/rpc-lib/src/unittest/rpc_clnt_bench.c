@@ -0,0 +1,169 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Reply matching in rpc-clnt, as the number of outstanding calls on one
+ * connection grows. Each round a reply comes in for a random outstanding
+ * call, its saved frame is looked up by xid and taken out, and a new call
+ * is saved in its place, so the number of calls in flight stays the same.
+ * Lookups used to walk every outstanding call.
+ *
+ * usage: rpc_clnt_bench [max-outstanding] [rounds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "mem-pool.h"
+#include "rpc-clnt.h"
+
+struct saved_frame *
+__saved_frames_put (struct saved_frames *frames, void *frame,
+                    struct rpc_req *rpcreq);
+
+struct saved_frame *
+__saved_frame_get (struct saved_frames *frames, int64_t callid);
+
+struct saved_frames *
+saved_frames_new (void);
+
+void
+saved_frames_destroy (struct saved_frames *frames);
+
+static rpc_clnt_prog_t bench_prog = {
+        .progname = "bench",
+        .prognum  = 1,
+        .progver  = 1,
+};
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int
+bench_save (struct saved_frames *frames, struct rpc_req *req, uint32_t xid)
+{
+        req->xid = xid;
+
+        return __saved_frames_put (frames, NULL, req) ? 0 : -1;
+}
+
+static double
+bench_replies (struct rpc_clnt *clnt, struct rpc_req *reqs, int outstanding,
+               long rounds, long *errors)
+{
+        struct saved_frames *frames = NULL;
+        struct saved_frame  *sframe = NULL;
+        unsigned int         seed = 1;
+        uint32_t             xid = 0;
+        double               start = 0;
+        double               elapsed = 0;
+        long                 i = 0;
+        int                  slot = 0;
+
+        frames = saved_frames_new ();
+        if (!frames)
+                return -1;
+
+        for (slot = 0; slot < outstanding; slot++) {
+                reqs[slot].conn = &clnt->conn;
+                reqs[slot].prog = &bench_prog;
+                if (bench_save (frames, &reqs[slot], ++xid))
+                        (*errors)++;
+        }
+
+        start = bench_now ();
+        for (i = 0; i < rounds; i++) {
+                slot = rand_r (&seed) % outstanding;
+
+                sframe = __saved_frame_get (frames, reqs[slot].xid);
+                if (!sframe || sframe->rpcreq != &reqs[slot]) {
+                        (*errors)++;
+                        continue;
+                }
+                mem_put (sframe);
+
+                if (bench_save (frames, &reqs[slot], ++xid))
+                        (*errors)++;
+        }
+        elapsed = bench_now () - start;
+
+        if (frames->count != outstanding)
+                (*errors)++;
+
+        /* nothing to unwind: the calls have no callbacks */
+        for (slot = 0; slot < outstanding; slot++) {
+                sframe = __saved_frame_get (frames, reqs[slot].xid);
+                if (sframe)
+                        mem_put (sframe);
+        }
+        saved_frames_destroy (frames);
+
+        return elapsed * 1e9 / rounds;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t *ctx = NULL;
+        struct rpc_clnt  clnt = {0, };
+        struct rpc_req  *reqs = NULL;
+        int              max = 65536;
+        long             rounds = 1000000;
+        int              outstanding = 0;
+        long             errors = 0;
+        double           ns = 0;
+
+        if (argc > 1)
+                max = atoi (argv[1]);
+        if (argc > 2)
+                rounds = atol (argv[2]);
+        if (max < 1 || rounds < 1)
+                return 1;
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        clnt.conn.rpc_clnt = &clnt;
+        clnt.conn.name = "bench";
+        clnt.saved_frames_pool = mem_pool_new (struct saved_frame, max);
+        if (!clnt.saved_frames_pool)
+                return 1;
+
+        reqs = calloc (max, sizeof (*reqs));
+        if (!reqs)
+                return 1;
+
+        printf ("%12s %14s\n", "outstanding", "ns/reply");
+
+        for (outstanding = 1; outstanding <= max; outstanding *= 4) {
+                ns = bench_replies (&clnt, reqs, outstanding, rounds, &errors);
+
+                printf ("%12d %14.1f %s\n", outstanding, ns,
+                        errors ? "ERRORS" : "");
+        }
+
+        free (reqs);
+        mem_pool_destroy (clnt.saved_frames_pool);
+
+        return errors ? 1 : 0;
+}
@@ -2140,14 +2140,23 @@ out:
 
 
 static int
-socket_event_poll_in (rpc_transport_t *this)
+socket_event_poll_in (rpc_transport_t *this, gf_boolean_t notify_handled)
 {
         int                     ret    = -1;
         rpc_transport_pollin_t *pollin = NULL;
         socket_private_t       *priv = this->private;
+        glusterfs_ctx_t        *ctx = NULL;
+
+        ctx = this->ctx;
 
         ret = socket_proto_state_machine (this, &pollin);
 
+        /* the message is off the wire, let another dispatcher read the
+         * next one while this one is being processed */
+        if (notify_handled && (ret != -1))
+                event_handled (ctx->event_pool, priv->sock, priv->idx,
+                               priv->gen);
+
         if (pollin != NULL) {
                 priv->ot_state = OT_CALLBACK;
                 ret = rpc_transport_notify (this, RPC_TRANSPORT_MSG_RECEIVED,
@@ -2235,12 +2244,13 @@ out:
 
 /* reads rpc_requests during pollin */
 static int
-socket_event_handler (int fd, int idx, void *data,
+socket_event_handler (int fd, int idx, int gen, void *data,
                       int poll_in, int poll_out, int poll_err)
 {
         rpc_transport_t  *this = NULL;
         socket_private_t *priv = NULL;
 	int               ret = -1;
+        gf_boolean_t      handled = _gf_false;
 
         this = data;
         GF_VALIDATE_OR_GOTO ("socket", this, out);
@@ -2253,6 +2263,7 @@ socket_event_handler (int fd, int idx, void *data,
         pthread_mutex_lock (&priv->lock);
         {
                 priv->idx = idx;
+                priv->gen = gen;
         }
         pthread_mutex_unlock (&priv->lock);
 
@@ -2263,7 +2274,9 @@ socket_event_handler (int fd, int idx, void *data,
         }
 
         if (!ret && poll_in) {
-                ret = socket_event_poll_in (this);
+                /* re-arms the socket itself once the message is read */
+                ret = socket_event_poll_in (this, _gf_true);
+                handled = _gf_true;
         }
 
         if ((ret < 0) || poll_err) {
@@ -2272,7 +2285,9 @@ socket_event_handler (int fd, int idx, void *data,
                         "disconnecting now");
                 socket_event_poll_err (this);
                 rpc_transport_unref (this);
-	}
+	} else if (!handled) {
+                event_handled (this->ctx->event_pool, fd, idx, gen);
+        }
 
 out:
 	return ret;
@@ -2362,7 +2377,7 @@ socket_poller (void *ctx)
 		/* Only glusterd actually seems to need this. */
 		THIS = this->xl;
 		if (pfd[1].revents & POLL_MASK_INPUT) {
-			ret = socket_event_poll_in(this);
+			ret = socket_event_poll_in(this, _gf_false);
 			if (ret >= 0) {
 				/* Suppress errors while making progress. */
 				pfd[1].revents &= ~POLL_MASK_ERROR;
@@ -2472,7 +2487,7 @@ socket_spawn (rpc_transport_t *this)
 }
 
 static int
-socket_server_event_handler (int fd, int idx, void *data,
+socket_server_event_handler (int fd, int idx, int gen, void *data,
                              int poll_in, int poll_out, int poll_err)
 {
         rpc_transport_t             *this = NULL;
@@ -2498,6 +2513,7 @@ socket_server_event_handler (int fd, int idx, void *data,
         pthread_mutex_lock (&priv->lock);
         {
                 priv->idx = idx;
+                priv->gen = gen;
 
                 if (poll_in) {
                         new_sock = accept (priv->sock, SA (&new_sockaddr),
@@ -2658,12 +2674,17 @@ socket_server_event_handler (int fd, int idx, void *data,
                                         socket_spawn(new_trans);
 				}
 				else {
+					/* reads are enabled once the
+					 * listener has accepted the
+					 * transport, so that no other
+					 * dispatcher thread delivers a
+					 * request for it before that */
 					new_priv->idx =
 						event_register (ctx->event_pool,
 								new_sock,
 								socket_event_handler,
 								new_trans,
-								1, 0);
+								0, 0);
 					if (new_priv->idx == -1)
 						ret = -1;
 				}
@@ -2681,12 +2702,29 @@ socket_server_event_handler (int fd, int idx, void *data,
                         if (!priv->own_thread) {
                                 ret = rpc_transport_notify (this,
                                         RPC_TRANSPORT_ACCEPT, new_trans);
+
+                                /* do not keep a connection nobody would
+                                 * ever read from */
+                                if (event_select_on (ctx->event_pool,
+                                                     new_sock, new_priv->idx,
+                                                     1, -1) == -1) {
+                                        gf_log (this->name, GF_LOG_WARNING,
+                                                "failed to enable reads on "
+                                                "socket %d", new_sock);
+                                        pthread_mutex_lock (&new_priv->lock);
+                                        {
+                                                __socket_shutdown (new_trans);
+                                        }
+                                        pthread_mutex_unlock (&new_priv->lock);
+                                }
                         }
                 }
         }
 unlock:
         pthread_mutex_unlock (&priv->lock);
 
+        event_handled (ctx->event_pool, fd, idx, gen);
+
 out:
         if (cname && (cname != this->ssl_name)) {
                 GF_FREE(cname);
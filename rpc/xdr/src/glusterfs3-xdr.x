@@ -770,3 +770,10 @@ struct gf_getsnap_name_uuid_rsp {
         string op_errstr<>;
         opaque dict<>;
 };
+
+struct gfs3_cbk_cache_invalidation_req {
+        opaque       gfid[16];
+        unsigned int event_type;
+        unsigned int flags;
+        unsigned int expire_time_attr;
+};
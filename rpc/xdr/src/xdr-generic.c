@@ -10,6 +10,8 @@
 
 
 #include "xdr-generic.h"
+#include "dict.h"
+#include "byte-order.h"
 
 
 ssize_t
@@ -36,6 +38,69 @@ ret:
 }
 
 
+/* Room needed to encode @res followed by @xdata as its trailing opaque. */
+ssize_t
+xdr_sizeof_xdata (xdrproc_t proc, void *res, dict_t *xdata)
+{
+        ssize_t size = 0;
+        int     len  = 0;
+
+        size = xdr_sizeof (proc, res);
+
+        if (xdata) {
+                len = dict_serialized_length (xdata);
+                if (len < 0)
+                        return -1;
+                size += xdr_length_round_up (len, ~0U);
+        }
+
+        return size;
+}
+
+
+/* Encode @res, whose last member is an empty "opaque xdata<>", and then
+ * serialize @xdata in place as the content of that member. This is the
+ * layout every gfs3 message has, and it saves the intermediate buffer and
+ * copy of GF_PROTOCOL_DICT_SERIALIZE. */
+ssize_t
+xdr_serialize_generic_xdata (struct iovec outmsg, void *res, xdrproc_t proc,
+                             dict_t *xdata)
+{
+        ssize_t       ret     = -1;
+        struct iovec  tail    = {0, };
+        uint32_t      netlen  = 0;
+        size_t        pad     = 0;
+
+        ret = xdr_serialize_generic (outmsg, res, proc);
+        if (ret == -1 || !xdata)
+                return ret;
+
+        /* the length of the empty opaque is the last word encoded */
+        if (ret < XDR_BYTES_PER_UNIT)
+                return -1;
+        memcpy (&netlen, (char *)outmsg.iov_base + ret - XDR_BYTES_PER_UNIT,
+                sizeof (netlen));
+        if (netlen != 0)
+                return -1;
+
+        tail.iov_base = (char *)outmsg.iov_base + ret;
+        tail.iov_len = outmsg.iov_len - ret;
+        if (dict_serialize_iov (xdata, &tail) < 0)
+                return -1;
+
+        pad = xdr_length_round_up (tail.iov_len, ~0U) - tail.iov_len;
+        if (ret + tail.iov_len + pad > outmsg.iov_len)
+                return -1;
+        memset ((char *)tail.iov_base + tail.iov_len, 0, pad);
+
+        netlen = hton32 (tail.iov_len);
+        memcpy ((char *)outmsg.iov_base + ret - XDR_BYTES_PER_UNIT, &netlen,
+                sizeof (netlen));
+
+        return ret + tail.iov_len + pad;
+}
+
+
 ssize_t
 xdr_to_generic (struct iovec inmsg, void *args, xdrproc_t proc)
 {
@@ -17,6 +17,8 @@
 
 #include "compat.h"
 
+struct _dict;
+
 #define xdr_decoded_remaining_addr(xdr)        ((&xdr)->x_private)
 #define xdr_decoded_remaining_len(xdr)         ((&xdr)->x_handy)
 #define xdr_encoded_length(xdr) (((size_t)(&xdr)->x_private) - ((size_t)(&xdr)->x_base))
@@ -55,6 +57,13 @@
 ssize_t
 xdr_serialize_generic (struct iovec outmsg, void *res, xdrproc_t proc);
 
+ssize_t
+xdr_serialize_generic_xdata (struct iovec outmsg, void *res, xdrproc_t proc,
+                             struct _dict *xdata);
+
+ssize_t
+xdr_sizeof_xdata (xdrproc_t proc, void *res, struct _dict *xdata);
+
 ssize_t
 xdr_to_generic (struct iovec inmsg, void *args, xdrproc_t proc);
 
@@ -0,0 +1,55 @@
+#!/bin/bash
+
+#This file checks that a write through an O_APPEND fd, which lands at the end
+#of file whatever offset it is sent with, drops the cached leaf checksums of
+#the tail it changes, so that a later diff self-heal copies that tail.
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+function heal_brick0 {
+        TEST $CLI volume start $V0 force
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 0
+        EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" glustershd_up_status
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 0
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 1
+        TEST $CLI volume heal $V0
+        EXPECT_WITHIN $HEAL_TIMEOUT "0" afr_get_pending_heal_count $V0
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 2 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 data-self-heal-algorithm diff
+TEST $CLI volume set $V0 cluster.data-self-heal off
+TEST $CLI volume set $V0 cluster.metadata-self-heal off
+TEST $CLI volume set $V0 cluster.entry-self-heal off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=/$V0 --volfile-server=$H0 $M0;
+#a file which ends in the middle of a block, so that appending to it
+#changes the last leaf instead of only adding new ones
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=64
+TEST dd if=/dev/urandom of=$M0/file bs=1000 count=1 oflag=append conv=notrunc
+
+#a first heal fills the leaf checksum cache of both bricks
+TEST kill_brick $V0 $H0 $B0/${V0}0
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=1 seek=26 conv=notrunc
+heal_brick0
+EXPECT $(md5sum $M0/file | awk '{print $1}') echo $(md5sum $B0/${V0}0/file | awk '{print $1}')
+
+TEST kill_brick $V0 $H0 $B0/${V0}0
+TEST dd if=/dev/urandom of=$M0/file bs=1000 count=1 oflag=append conv=notrunc
+md5sum=$(md5sum $M0/file | awk '{print $1}')
+heal_brick0
+
+EXPECT $md5sum echo $(md5sum $B0/${V0}0/file | awk '{print $1}')
+EXPECT $md5sum echo $(md5sum $B0/${V0}1/file | awk '{print $1}')
+
+TEST rm -f $M0/file
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
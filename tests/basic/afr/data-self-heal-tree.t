@@ -0,0 +1,65 @@
+#!/bin/bash
+
+#This file checks that diff self-heal of a file which differs in one block
+#compares the copies a range at a time and descends only into the range
+#which differs, and copies only the block which differs.
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+function brick_fop_count {
+        local brick=$1
+        local fop=$2
+        $CLI volume profile $V0 info | awk -v b="Brick: $H0:$brick" -v f=$fop '
+                /^Brick: / { on = ($0 == b) }
+                on && $NF == f && $(NF-1) ~ /^[0-9]+$/ { print $(NF-1); exit }'
+}
+
+function brick_data_written {
+        local brick=$1
+        $CLI volume profile $V0 info | awk -v b="Brick: $H0:$brick" '
+                /^Brick: / { on = ($0 == b) }
+                on && /Data Written:/ { print $3; exit }'
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 2 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 data-self-heal-algorithm diff
+TEST $CLI volume set $V0 cluster.data-self-heal off
+TEST $CLI volume set $V0 cluster.metadata-self-heal off
+TEST $CLI volume set $V0 cluster.entry-self-heal off
+TEST $CLI volume start $V0
+TEST $CLI volume profile $V0 start
+
+TEST $GFS --volfile-id=/$V0 --volfile-server=$H0 $M0;
+#64 blocks of 128k, i.e. a single range of the tree
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=64
+
+TEST kill_brick $V0 $H0 $B0/${V0}0
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=1 seek=26 conv=notrunc
+md5sum=$(md5sum $M0/file | awk '{print $1}')
+
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 0
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" glustershd_up_status
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 1
+TEST $CLI volume heal $V0
+EXPECT_WITHIN $HEAL_TIMEOUT "0" afr_get_pending_heal_count $V0
+
+EXPECT $md5sum echo $(md5sum $B0/${V0}0/file | awk '{print $1}')
+
+#the 8M range, its 8 1M parts, and the 8 blocks of the part which differs,
+#instead of all the 64 blocks one after the other
+EXPECT "17" brick_fop_count $B0/${V0}1 RCHECKSUM
+EXPECT "17" brick_fop_count $B0/${V0}0 RCHECKSUM
+EXPECT "131072" brick_data_written $B0/${V0}0
+
+TEST rm -f $M0/file
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <poll.h>
+#include <glusterfs/api/glfs.h>
+
+/*
+ * Drives a file through a completion queue: creates it, writes it a block
+ * at a time with all the writes in flight at once, syncs, stats and reads
+ * it back, looks for it in its directory, and checks that failures and
+ * the descriptor of the queue are reported as documented.
+ */
+
+#define BLOCK   4096
+#define BLOCKS  8
+
+#define FAIL(fmt, args...) do {                                 \
+                fprintf (stderr, "line %d: " fmt "\n", __LINE__, \
+                         ##args);                               \
+                goto out;                                       \
+        } while (0)
+
+static int
+cq_readable (glfs_cq_t *cq, int timeout)
+{
+        struct pollfd pfd = {0, };
+
+        pfd.fd = glfs_cq_fd (cq);
+        pfd.events = POLLIN;
+
+        return poll (&pfd, 1, timeout);
+}
+
+int
+main (int argc, char *argv[])
+{
+        glfs_t          *fs    = NULL;
+        glfs_cq_t       *cq    = NULL;
+        glfs_fd_t       *fd    = NULL;
+        glfs_fd_t       *dir   = NULL;
+        struct glfs_cqe  cqe[BLOCKS];
+        struct iovec     iov[BLOCKS];
+        static char      wbuf[BLOCKS][BLOCK];
+        static char      rbuf[BLOCKS][BLOCK];
+        struct stat      st;
+        struct dirent    entry;
+        int              seen  = 0;
+        int              found = 0;
+        int              ret   = 1;
+        int              n     = 0;
+        int              i     = 0;
+
+        if (argc != 4) {
+                fprintf (stderr, "usage: %s <host> <volname> <logfile>\n",
+                         argv[0]);
+                return 1;
+        }
+
+        fs = glfs_new (argv[2]);
+        if (!fs) {
+                fprintf (stderr, "glfs_new: %s\n", strerror (errno));
+                return 1;
+        }
+
+        glfs_set_volfile_server (fs, "tcp", argv[1], 24007);
+        glfs_set_logging (fs, argv[3], 7);
+
+        if (glfs_init (fs)) {
+                fprintf (stderr, "glfs_init: %s\n", strerror (errno));
+                return 1;
+        }
+
+        cq = glfs_cq_new (fs);
+        if (!cq)
+                FAIL ("glfs_cq_new: %s", strerror (errno));
+
+        /* nothing submitted: nothing to reap, nothing to wake up for */
+        if (glfs_cq_reap (cq, cqe, BLOCKS, 1, NULL) != 0)
+                FAIL ("reap of an idle queue did not return 0");
+        if (cq_readable (cq, 0) != 0)
+                FAIL ("idle queue polls readable");
+
+        if (glfs_cq_creat (cq, "cq-file", O_RDWR, 0644, cq))
+                FAIL ("glfs_cq_creat: %s", strerror (errno));
+        if (cq_readable (cq, 10000) != 1)
+                FAIL ("queue did not poll readable");
+        n = glfs_cq_reap (cq, cqe, BLOCKS, 1, NULL);
+        if (n != 1 || cqe[0].data != cq || cqe[0].ret != 0 || !cqe[0].fd)
+                FAIL ("creat completed with %d, %zd", n, cqe[0].ret);
+        fd = cqe[0].fd;
+        if (cq_readable (cq, 0) != 0)
+                FAIL ("reaped queue polls readable");
+
+        for (i = 0; i < BLOCKS; i++) {
+                memset (wbuf[i], 'a' + i, BLOCK);
+                iov[i].iov_base = wbuf[i];
+                iov[i].iov_len = BLOCK;
+                if (glfs_cq_pwritev (cq, fd, &iov[i], 1, i * BLOCK, 0,
+                                     &wbuf[i]))
+                        FAIL ("glfs_cq_pwritev: %s", strerror (errno));
+        }
+
+        for (n = 0; n < BLOCKS; ) {
+                ret = glfs_cq_reap (cq, cqe, BLOCKS, 1, NULL);
+                if (ret < 1)
+                        FAIL ("reap of the writes returned %d", ret);
+                for (i = 0; i < ret; i++) {
+                        if (cqe[i].ret != BLOCK)
+                                FAIL ("write returned %zd", cqe[i].ret);
+                        seen |= 1 << (((char *) cqe[i].data - wbuf[0]) /
+                                      BLOCK);
+                }
+                n += ret;
+        }
+        ret = 1;
+        if (seen != (1 << BLOCKS) - 1)
+                FAIL ("writes completed as %x", seen);
+
+        if (glfs_cq_fsync (cq, fd, NULL) || glfs_cq_fstat (cq, fd, &st, &st))
+                FAIL ("submitting fsync and fstat: %s", strerror (errno));
+        if (glfs_cq_reap (cq, cqe, BLOCKS, 2, NULL) != 2)
+                FAIL ("fsync and fstat did not complete");
+        for (i = 0; i < 2; i++)
+                if (cqe[i].ret != 0)
+                        FAIL ("fsync or fstat returned %zd", cqe[i].ret);
+        if (st.st_size != BLOCKS * BLOCK)
+                FAIL ("size is %lld", (long long) st.st_size);
+
+        for (i = 0; i < BLOCKS; i++) {
+                iov[i].iov_base = rbuf[i];
+                if (glfs_cq_preadv (cq, fd, &iov[i], 1, i * BLOCK, 0, NULL))
+                        FAIL ("glfs_cq_preadv: %s", strerror (errno));
+        }
+        if (glfs_cq_reap (cq, cqe, BLOCKS, BLOCKS, NULL) != BLOCKS)
+                FAIL ("reads did not complete");
+        for (i = 0; i < BLOCKS; i++)
+                if (cqe[i].ret != BLOCK)
+                        FAIL ("read returned %zd", cqe[i].ret);
+        if (memcmp (rbuf, wbuf, sizeof (wbuf)))
+                FAIL ("data read back differs");
+
+        /* failures complete with -1 and the errno */
+        if (glfs_cq_stat (cq, "cq-missing", &st, NULL))
+                FAIL ("glfs_cq_stat: %s", strerror (errno));
+        if (glfs_cq_reap (cq, cqe, 1, 1, NULL) != 1 || cqe[0].ret != -1 ||
+            cqe[0].op_errno != ENOENT)
+                FAIL ("stat of a missing file returned %zd, %d",
+                      cqe[0].ret, cqe[0].op_errno);
+
+        dir = glfs_opendir (fs, "/");
+        if (!dir)
+                FAIL ("glfs_opendir: %s", strerror (errno));
+        do {
+                if (glfs_cq_readdir (cq, dir, &entry, NULL))
+                        FAIL ("glfs_cq_readdir: %s", strerror (errno));
+                if (glfs_cq_reap (cq, cqe, 1, 1, NULL) != 1 ||
+                    cqe[0].ret < 0)
+                        FAIL ("readdir failed");
+                if (cqe[0].ret == 1 && !strcmp (entry.d_name, "cq-file"))
+                        found = 1;
+        } while (cqe[0].ret == 1);
+        if (!found)
+                FAIL ("cq-file not found in its directory");
+
+        /* an fd opened by a completion never reaped is closed with the
+           queue */
+        if (glfs_cq_open (cq, "cq-file", O_RDONLY, NULL))
+                FAIL ("glfs_cq_open: %s", strerror (errno));
+        if (cq_readable (cq, 10000) != 1)
+                FAIL ("queue did not poll readable");
+
+        if (glfs_cq_destroy (cq))
+                FAIL ("glfs_cq_destroy: %s", strerror (errno));
+        cq = NULL;
+
+        ret = 0;
+out:
+        if (dir)
+                glfs_closedir (dir);
+        if (fd)
+                glfs_close (fd);
+        if (cq)
+                glfs_cq_destroy (cq);
+        glfs_fini (fs);
+        return ret;
+}
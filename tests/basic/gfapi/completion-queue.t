@@ -0,0 +1,32 @@
+#!/bin/bash
+#
+# Test the completion queues of gfapi: calls submitted to a queue have to
+# complete there with the results of their synchronous counterparts, and
+# the descriptor of the queue has to poll readable exactly while there are
+# completions to reap.
+#
+###
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume start $V0
+
+logdir=`gluster --print-logdir`
+
+TEST build_tester $(dirname $0)/completion-queue.c -lgfapi
+TEST $(dirname $0)/completion-queue $H0 $V0 $logdir/completion-queue.log
+
+EXPECT "32768" stat -c %s $B0/$V0/cq-file
+
+TEST cleanup_tester $(dirname $0)/completion-queue
+
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
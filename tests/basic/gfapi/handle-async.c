@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <glusterfs/api/glfs.h>
+#include <glusterfs/api/glfs-handles.h>
+
+/*
+ * Looks up paths with glfs_h_lookupat_async, directly and through a
+ * completion queue: one that exists, one through a symlink, one missing
+ * and one through a regular file, and works on the xattrs and attributes
+ * of the object found with the other glfs_h_*_async calls.
+ */
+
+#define LOOKUPS 16
+
+#define FAIL(fmt, args...) do {                                 \
+                fprintf (stderr, "line %d: " fmt "\n", __LINE__, \
+                         ##args);                               \
+                goto out;                                       \
+        } while (0)
+
+struct result {
+        struct glfs_object *object;
+        ssize_t             ret;
+        int                 op_errno;
+        struct stat         st;
+};
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  cond = PTHREAD_COND_INITIALIZER;
+static int             completed;
+
+static void
+h_cbk (struct glfs_object *object, ssize_t ret, void *data)
+{
+        struct result *res = data;
+
+        res->object = object;
+        res->ret = ret;
+        res->op_errno = (ret < 0) ? errno : 0;
+
+        pthread_mutex_lock (&lock);
+        {
+                completed++;
+                pthread_cond_broadcast (&cond);
+        }
+        pthread_mutex_unlock (&lock);
+}
+
+static void
+wait_for (int count)
+{
+        pthread_mutex_lock (&lock);
+        {
+                while (completed < count)
+                        pthread_cond_wait (&cond, &lock);
+                completed -= count;
+        }
+        pthread_mutex_unlock (&lock);
+}
+
+static int
+lookup (glfs_t *fs, struct glfs_object *parent, const char *path,
+        struct result *res)
+{
+        memset (res, 0, sizeof (*res));
+
+        if (glfs_h_lookupat_async (fs, parent, path, &res->st, h_cbk, res))
+                return -1;
+
+        wait_for (1);
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glfs_t             *fs     = NULL;
+        glfs_cq_t          *cq     = NULL;
+        struct glfs_object *root   = NULL;
+        struct glfs_object *dir    = NULL;
+        struct glfs_object *file   = NULL;
+        glfs_fd_t          *fd     = NULL;
+        struct glfs_cqe     cqe[2];
+        struct result       res[LOOKUPS];
+        struct stat         fst;
+        struct stat         st;
+        char                value[8];
+        int                 ret    = 1;
+        int                 i      = 0;
+
+        if (argc != 4) {
+                fprintf (stderr, "usage: %s <host> <volname> <logfile>\n",
+                         argv[0]);
+                return 1;
+        }
+
+        fs = glfs_new (argv[2]);
+        if (!fs) {
+                fprintf (stderr, "glfs_new: %s\n", strerror (errno));
+                return 1;
+        }
+
+        glfs_set_volfile_server (fs, "tcp", argv[1], 24007);
+        glfs_set_logging (fs, argv[3], 7);
+
+        if (glfs_init (fs)) {
+                fprintf (stderr, "glfs_init: %s\n", strerror (errno));
+                return 1;
+        }
+
+        if (glfs_mkdir (fs, "dir", 0755))
+                FAIL ("glfs_mkdir: %s", strerror (errno));
+        fd = glfs_creat (fs, "dir/file", O_RDWR, 0644);
+        if (!fd)
+                FAIL ("glfs_creat: %s", strerror (errno));
+        glfs_close (fd);
+        if (glfs_symlink (fs, "dir", "link"))
+                FAIL ("glfs_symlink: %s", strerror (errno));
+        if (glfs_stat (fs, "dir/file", &fst))
+                FAIL ("glfs_stat: %s", strerror (errno));
+
+        root = glfs_h_lookupat (fs, NULL, "/", &st);
+        if (!root)
+                FAIL ("lookup of /: %s", strerror (errno));
+        dir = glfs_h_lookupat (fs, root, "dir", &st);
+        if (!dir)
+                FAIL ("lookup of dir: %s", strerror (errno));
+        file = glfs_h_lookupat (fs, dir, "file", &st);
+        if (!file)
+                FAIL ("lookup of file: %s", strerror (errno));
+
+        if (lookup (fs, root, "dir/file", &res[0]))
+                FAIL ("glfs_h_lookupat_async: %s", strerror (errno));
+        if (res[0].ret != 0 || !res[0].object ||
+            res[0].st.st_ino != fst.st_ino)
+                FAIL ("dir/file: %zd, %d", res[0].ret, res[0].op_errno);
+        glfs_h_close (res[0].object);
+
+        if (lookup (fs, dir, "file", &res[0]))
+                FAIL ("glfs_h_lookupat_async: %s", strerror (errno));
+        if (res[0].ret != 0 || res[0].st.st_ino != fst.st_ino)
+                FAIL ("file in dir: %zd, %d", res[0].ret, res[0].op_errno);
+        glfs_h_close (res[0].object);
+
+        if (lookup (fs, root, "link/file", &res[0]))
+                FAIL ("glfs_h_lookupat_async: %s", strerror (errno));
+        if (res[0].ret != 0 || res[0].st.st_ino != fst.st_ino)
+                FAIL ("link/file: %zd, %d", res[0].ret, res[0].op_errno);
+        glfs_h_close (res[0].object);
+
+        if (lookup (fs, root, "dir/missing", &res[0]))
+                FAIL ("glfs_h_lookupat_async: %s", strerror (errno));
+        if (res[0].ret != -1 || res[0].op_errno != ENOENT || res[0].object)
+                FAIL ("dir/missing: %zd, %d", res[0].ret, res[0].op_errno);
+
+        if (lookup (fs, root, "dir/file/x", &res[0]))
+                FAIL ("glfs_h_lookupat_async: %s", strerror (errno));
+        if (res[0].ret != -1 || res[0].op_errno != ENOTDIR || res[0].object)
+                FAIL ("dir/file/x: %zd, %d", res[0].ret, res[0].op_errno);
+
+        /* many of them in flight from one thread */
+        memset (res, 0, sizeof (res));
+        for (i = 0; i < LOOKUPS; i++)
+                if (glfs_h_lookupat_async (fs, root, "dir/file", &res[i].st,
+                                           h_cbk, &res[i]))
+                        FAIL ("glfs_h_lookupat_async: %s", strerror (errno));
+        wait_for (LOOKUPS);
+        for (i = 0; i < LOOKUPS; i++) {
+                if (res[i].ret != 0 || res[i].st.st_ino != fst.st_ino)
+                        FAIL ("lookup %d: %zd, %d", i, res[i].ret,
+                              res[i].op_errno);
+                glfs_h_close (res[i].object);
+        }
+
+        memset (res, 0, sizeof (res));
+        if (glfs_h_setxattrs_async (fs, file, "user.test", "abc", 3, 0,
+                                    h_cbk, &res[0]))
+                FAIL ("glfs_h_setxattrs_async: %s", strerror (errno));
+        wait_for (1);
+        if (res[0].ret != 0 || res[0].object != file)
+                FAIL ("setxattr: %zd, %d", res[0].ret, res[0].op_errno);
+
+        memset (value, 0, sizeof (value));
+        if (glfs_h_getxattrs_async (fs, file, "user.test", value,
+                                    sizeof (value), h_cbk, &res[0]))
+                FAIL ("glfs_h_getxattrs_async: %s", strerror (errno));
+        wait_for (1);
+        if (res[0].ret != 3 || strcmp (value, "abc"))
+                FAIL ("getxattr: %zd, %d", res[0].ret, res[0].op_errno);
+
+        if (glfs_h_removexattrs_async (fs, file, "user.test", h_cbk, &res[0]))
+                FAIL ("glfs_h_removexattrs_async: %s", strerror (errno));
+        wait_for (1);
+        if (res[0].ret != 0)
+                FAIL ("removexattr: %zd, %d", res[0].ret, res[0].op_errno);
+
+        if (glfs_h_getxattrs_async (fs, file, "user.test", value,
+                                    sizeof (value), h_cbk, &res[0]))
+                FAIL ("glfs_h_getxattrs_async: %s", strerror (errno));
+        wait_for (1);
+        if (res[0].ret != -1 || res[0].op_errno != ENODATA)
+                FAIL ("getxattr of a removed xattr: %zd, %d", res[0].ret,
+                      res[0].op_errno);
+
+        memset (&st, 0, sizeof (st));
+        st.st_mode = 0600;
+        if (glfs_h_setattrs_async (fs, file, &st, GFAPI_SET_ATTR_MODE,
+                                   h_cbk, &res[0]))
+                FAIL ("glfs_h_setattrs_async: %s", strerror (errno));
+        wait_for (1);
+        if (res[0].ret != 0)
+                FAIL ("setattr: %zd, %d", res[0].ret, res[0].op_errno);
+
+        if (glfs_h_stat_async (fs, file, &res[0].st, h_cbk, &res[0]))
+                FAIL ("glfs_h_stat_async: %s", strerror (errno));
+        wait_for (1);
+        if (res[0].ret != 0 || (res[0].st.st_mode & 0777) != 0600)
+                FAIL ("stat: %zd, mode %o", res[0].ret, res[0].st.st_mode);
+
+        /* the same through a completion queue */
+        cq = glfs_cq_new (fs);
+        if (!cq)
+                FAIL ("glfs_cq_new: %s", strerror (errno));
+        if (glfs_cq_h_lookupat (cq, root, "link/file", &res[0].st, &res[0]) ||
+            glfs_cq_h_lookupat (cq, dir, "missing", &res[1].st, &res[1]))
+                FAIL ("glfs_cq_h_lookupat: %s", strerror (errno));
+        if (glfs_cq_reap (cq, cqe, 2, 2, NULL) != 2)
+                FAIL ("lookups did not complete");
+        for (i = 0; i < 2; i++) {
+                if (cqe[i].data == &res[0] &&
+                    (cqe[i].ret != 0 || !cqe[i].object ||
+                     res[0].st.st_ino != fst.st_ino))
+                        FAIL ("link/file: %zd, %d", cqe[i].ret,
+                              cqe[i].op_errno);
+                if (cqe[i].data == &res[1] &&
+                    (cqe[i].ret != -1 || cqe[i].op_errno != ENOENT ||
+                     cqe[i].object))
+                        FAIL ("missing: %zd, %d", cqe[i].ret,
+                              cqe[i].op_errno);
+                if (cqe[i].object)
+                        glfs_h_close (cqe[i].object);
+        }
+
+        ret = 0;
+out:
+        if (cq)
+                glfs_cq_destroy (cq);
+        if (file)
+                glfs_h_close (file);
+        if (dir)
+                glfs_h_close (dir);
+        if (root)
+                glfs_h_close (root);
+        glfs_fini (fs);
+        return ret;
+}
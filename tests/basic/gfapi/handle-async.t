@@ -0,0 +1,33 @@
+#!/bin/bash
+#
+# Test the asynchronous handle calls of gfapi: lookups have to find what
+# exists, also through a symlink, and fail with ENOENT and ENOTDIR like
+# their synchronous counterpart does, and the calls on the object found
+# have to take effect on the brick.
+#
+###
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume start $V0
+
+logdir=`gluster --print-logdir`
+
+TEST build_tester $(dirname $0)/handle-async.c -lgfapi -lpthread
+TEST $(dirname $0)/handle-async $H0 $V0 $logdir/handle-async.log
+
+EXPECT "600" stat -c %a $B0/$V0/dir/file
+EXPECT "dir" readlink $B0/$V0/link
+
+TEST cleanup_tester $(dirname $0)/handle-async
+
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <glusterfs/api/glfs.h>
+
+/*
+ * Writes a file with glfs_pwritev_zc from two regions and reads it back
+ * with glfs_preadv_zc. The release callback of the write has to run
+ * exactly once, and the regions lent by the read have to hold what was
+ * written.
+ */
+
+#define REGION  (64 * 1024)
+
+static int released;
+
+static void
+zc_release (void *data)
+{
+        __sync_fetch_and_add ((int *) data, 1);
+}
+
+static int
+check_read (glfs_fd_t *fd, char *regions[2])
+{
+        glfs_zcbuf_t       *buf   = NULL;
+        const struct iovec *iov   = NULL;
+        ssize_t             ret   = 0;
+        size_t              done  = 0;
+        size_t              off   = 0;
+        size_t              len   = 0;
+        int                 count = 0;
+        int                 i     = 0;
+
+        ret = glfs_preadv_zc (fd, 2 * REGION, 0, 0, &buf);
+        if (ret != 2 * REGION || !buf) {
+                fprintf (stderr, "preadv_zc returned %zd\n", ret);
+                return -1;
+        }
+
+        count = glfs_zcbuf_iovec (buf, &iov);
+        for (i = 0; i < count; i++) {
+                for (off = 0; off < iov[i].iov_len; off += len) {
+                        len = REGION - (done % REGION);
+                        if (len > iov[i].iov_len - off)
+                                len = iov[i].iov_len - off;
+                        if (memcmp ((char *) iov[i].iov_base + off,
+                                    regions[done / REGION] + done % REGION,
+                                    len)) {
+                                fprintf (stderr, "data differs at %zu\n",
+                                         done);
+                                glfs_zcbuf_release (buf);
+                                return -1;
+                        }
+                        done += len;
+                }
+        }
+
+        glfs_zcbuf_release (buf);
+
+        if (done != 2 * REGION) {
+                fprintf (stderr, "regions hold %zu bytes\n", done);
+                return -1;
+        }
+
+        /* at the end of the file nothing is lent */
+        ret = glfs_preadv_zc (fd, REGION, 2 * REGION, 0, &buf);
+        if (ret != 0 || buf) {
+                fprintf (stderr, "preadv_zc at EOF returned %zd\n", ret);
+                return -1;
+        }
+
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glfs_t       *fs         = NULL;
+        glfs_fd_t    *fd         = NULL;
+        char         *regions[2] = {NULL, };
+        struct iovec  iov[2];
+        ssize_t       ret        = 0;
+        int           i          = 0;
+
+        if (argc != 4) {
+                fprintf (stderr, "usage: %s <host> <volname> <logfile>\n",
+                         argv[0]);
+                return 1;
+        }
+
+        fs = glfs_new (argv[2]);
+        if (!fs) {
+                fprintf (stderr, "glfs_new: %s\n", strerror (errno));
+                return 1;
+        }
+
+        glfs_set_volfile_server (fs, "tcp", argv[1], 24007);
+        glfs_set_logging (fs, argv[3], 7);
+
+        if (glfs_init (fs)) {
+                fprintf (stderr, "glfs_init: %s\n", strerror (errno));
+                return 1;
+        }
+
+        fd = glfs_creat (fs, "zero-copy", O_RDWR, 0644);
+        if (!fd) {
+                fprintf (stderr, "glfs_creat: %s\n", strerror (errno));
+                goto err;
+        }
+
+        for (i = 0; i < 2; i++) {
+                regions[i] = malloc (REGION);
+                if (!regions[i])
+                        goto err;
+                memset (regions[i], 'a' + i, REGION);
+                iov[i].iov_base = regions[i];
+                iov[i].iov_len = REGION;
+        }
+
+        ret = glfs_pwritev_zc (fd, iov, 2, 0, 0, zc_release, &released);
+        if (ret != 2 * REGION) {
+                fprintf (stderr, "pwritev_zc returned %zd\n", ret);
+                goto err;
+        }
+
+        if (glfs_fsync (fd)) {
+                fprintf (stderr, "glfs_fsync: %s\n", strerror (errno));
+                goto err;
+        }
+
+        if (check_read (fd, regions))
+                goto err;
+
+        glfs_close (fd);
+        fd = NULL;
+
+        /* the regions may be released from another thread */
+        for (i = 0; i < 50 && !__sync_fetch_and_add (&released, 0); i++)
+                usleep (100000);
+
+        if (released != 1) {
+                fprintf (stderr, "regions released %d times\n", released);
+                goto err;
+        }
+
+        glfs_fini (fs);
+        free (regions[0]);
+        free (regions[1]);
+        return 0;
+err:
+        if (fd)
+                glfs_close (fd);
+        glfs_fini (fs);
+        return 1;
+}
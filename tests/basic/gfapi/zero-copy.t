@@ -0,0 +1,34 @@
+#!/bin/bash
+#
+# Test zero-copy reads and writes of gfapi: the data has to make it to the
+# brick and back, and the regions of a write have to be handed back to the
+# application exactly once.
+#
+###
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume start $V0
+
+logdir=`gluster --print-logdir`
+
+TEST build_tester $(dirname $0)/zero-copy.c -lgfapi
+TEST $(dirname $0)/zero-copy $H0 $V0 $logdir/zero-copy.log
+
+# two regions of 64k, of 'a' and of 'b'
+EXPECT "131072" stat -c %s $B0/$V0/zero-copy
+EXPECT "65536" echo $(tr -cd a < $B0/$V0/zero-copy | wc -c)
+EXPECT "65536" echo $(tr -cd b < $B0/$V0/zero-copy | wc -c)
+
+TEST cleanup_tester $(dirname $0)/zero-copy
+
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -0,0 +1,63 @@
+#!/bin/bash
+#
+# Test cache invalidation. Two clients look at a file, one of them changes
+# it, and the other has to see the change long before its md-cache-timeout
+# runs out, because the brick tells it to drop what it cached.
+#
+###
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function upcall_notified {
+        local fpath=$(generate_brick_statedump $V0 $H0 $B0/$V0)
+        grep -A4 "xlator.features.upcall.priv" $fpath | grep "^notified=" | \
+                cut -f2 -d'='
+        rm -f $fpath
+}
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume set $V0 features.cache-invalidation on
+TEST $CLI volume set $V0 performance.cache-invalidation on
+TEST $CLI volume set $V0 performance.md-cache-timeout 600
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0 \
+          --attribute-timeout=0 --entry-timeout=0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M1 \
+          --attribute-timeout=0 --entry-timeout=0
+
+TEST 'echo abc > $M0/file'
+
+# both clients have the file open, and the second one caches its size
+exec 5<$M0/file
+exec 6<$M1/file
+EXPECT "4" stat -c %s $M1/file
+EXPECT "4" stat -c %s $M1/file
+EXPECT "0" upcall_notified
+
+TEST 'echo defgh >> $M0/file'
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "10" stat -c %s $M1/file
+EXPECT_NOT "0" upcall_notified
+
+# turning it off reconfigures the upcall xlator in place, which then stops
+# telling clients about changes
+TEST $CLI volume set $V0 features.cache-invalidation off
+notified=$(upcall_notified)
+TEST 'echo ijk >> $M0/file'
+TEST stat $M1/file
+EXPECT "$notified" upcall_notified
+
+exec 5<&-
+exec 6<&-
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M1
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
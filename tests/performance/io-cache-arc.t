@@ -0,0 +1,59 @@
+#!/bin/bash
+#
+# Test that a file read again and again stays in io-cache while many other
+# files, together larger than the cache, are read once each.
+#
+###
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function ioc_priv_value {
+        local key=$1
+        local fpath=$(generate_mount_statedump $V0)
+        grep -A20 "io-cache.priv" $fpath | grep "^$key=" | head -1 | \
+                cut -f2 -d'='
+        rm -f $fpath
+}
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume set $V0 performance.io-cache on
+TEST $CLI volume set $V0 performance.cache-size 4MB
+TEST $CLI volume set $V0 performance.cache-refresh-timeout 60
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=yes $M0
+
+for i in $(seq 0 16); do
+        TEST dd if=/dev/urandom of=$M0/file$i bs=128k count=8
+done
+
+# read twice, the second open promotes it to the frequently used list
+TEST "cat $M0/file0 > /dev/null"
+TEST "cat $M0/file0 > /dev/null"
+
+# a sweep over 16MB of files read once
+for i in $(seq 1 16); do
+        TEST "cat $M0/file$i > /dev/null"
+done
+
+EXPECT "1048576" ioc_priv_value t2_used
+
+misses=$(ioc_priv_value misses)
+TEST "cat $M0/file0 > /dev/null"
+EXPECT "$misses" ioc_priv_value misses
+
+TEST rm -f $M0/file*
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/*
+ * Reads a file through one fd as two readers would, one from the start
+ * and one from the middle, alternating between them a block at a time.
+ */
+
+#define BLOCK   (128 * 1024)
+
+int
+main (int argc, char **argv)
+{
+        static char buf[BLOCK];
+        off_t       size = 0;
+        off_t       off  = 0;
+        ssize_t     ret  = 0;
+        int         fd   = -1;
+
+        if (argc != 3) {
+                fprintf (stderr, "usage: %s <file> <size>\n", argv[0]);
+                return 1;
+        }
+
+        size = atoll (argv[2]);
+
+        fd = open (argv[1], O_RDONLY);
+        if (fd < 0) {
+                perror ("open");
+                return 1;
+        }
+
+        for (off = 0; off < size / 2; off += BLOCK) {
+                ret = pread (fd, buf, BLOCK, off);
+                if (ret != BLOCK)
+                        goto err;
+                ret = pread (fd, buf, BLOCK, size / 2 + off);
+                if (ret != BLOCK)
+                        goto err;
+        }
+
+        close (fd);
+        return 0;
+err:
+        fprintf (stderr, "read at %lld returned %zd\n", (long long) off, ret);
+        close (fd);
+        return 1;
+}
@@ -0,0 +1,55 @@
+#!/bin/bash
+#
+# Test that read-ahead follows two readers interleaved on one fd. Each of
+# them has to be taken as a sequential stream of its own, and the reads of
+# one must not throw away what was read ahead for the other.
+#
+###
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function ra_priv_value {
+        local key=$1
+        local fpath=$(generate_mount_statedump $V0)
+        grep -A10 "xlator.performance.read-ahead.priv" $fpath | \
+                grep "^$key=" | head -1 | cut -f2 -d'='
+        rm -f $fpath
+}
+
+function ra_mostly_hits {
+        local hits=$(ra_priv_value ra_hits)
+        # 64 reads, of which only the first of each stream has to miss
+        if [ "$hits" -ge 56 ]; then echo "Y"; else echo "N"; fi
+}
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST $CLI volume set $V0 performance.read-ahead on
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=yes $M0
+
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=64
+
+TEST build_tester $(dirname $0)/read-ahead-streams.c
+TEST $(dirname $0)/read-ahead-streams $M0/file $((128 * 1024 * 64))
+
+EXPECT "2" ra_priv_value sequential_streams
+EXPECT "0" ra_priv_value strided_streams
+EXPECT "Y" ra_mostly_hits
+
+TEST cleanup_tester $(dirname $0)/read-ahead-streams
+TEST rm -f $M0/file
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
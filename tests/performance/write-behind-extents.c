@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+/*
+ * Writes a file a block at a time from its end to its start, and after
+ * every fourth block writes again a block two ahead of it, which was
+ * written a moment ago. The same is written to a reference file.
+ */
+
+#define BLOCK   4096
+#define BLOCKS  64
+
+static int
+write_block (int fd, int ref, int i, char c)
+{
+        static char buf[BLOCK];
+
+        memset (buf, c, BLOCK);
+
+        if (pwrite (fd, buf, BLOCK, (off_t) i * BLOCK) != BLOCK)
+                return -1;
+        if (pwrite (ref, buf, BLOCK, (off_t) i * BLOCK) != BLOCK)
+                return -1;
+
+        return 0;
+}
+
+int
+main (int argc, char **argv)
+{
+        int fd  = -1;
+        int ref = -1;
+        int i   = 0;
+
+        if (argc != 3) {
+                fprintf (stderr, "usage: %s <file> <reference>\n", argv[0]);
+                return 1;
+        }
+
+        fd = open (argv[1], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+                perror ("open");
+                return 1;
+        }
+
+        ref = open (argv[2], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (ref < 0) {
+                perror ("open");
+                close (fd);
+                return 1;
+        }
+
+        for (i = BLOCKS - 1; i >= 0; i--) {
+                if (write_block (fd, ref, i, 'a' + i % 26))
+                        goto err;
+                if (i % 4 == 0 && write_block (fd, ref, i + 2, 'A' + i % 26))
+                        goto err;
+        }
+
+        if (fsync (fd)) {
+                perror ("fsync");
+                goto out;
+        }
+
+        close (ref);
+        close (fd);
+        return 0;
+err:
+        fprintf (stderr, "write of block %d failed\n", i);
+out:
+        close (ref);
+        close (fd);
+        return 1;
+}
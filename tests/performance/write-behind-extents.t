@@ -0,0 +1,59 @@
+#!/bin/bash
+#
+# Test that write-behind, given a batch window, merges small writes which
+# are adjacent to or overlap one another into extents, and sends those
+# instead of each write on its own, without getting the data wrong.
+#
+###
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function wb_priv_value {
+        local key=$1
+        local fpath=$(generate_mount_statedump $V0)
+        grep -A10 "xlator.performance.write-behind.priv" $fpath | \
+                grep "^$key=" | head -1 | cut -f2 -d'='
+        rm -f $fpath
+}
+
+function brick_writes {
+        $CLI volume profile $V0 info | \
+                awk '$NF == "WRITE" && $(NF-1) ~ /^[0-9]+$/ { print $(NF-1); exit }'
+}
+
+function brick_writes_batched {
+        # 80 writes of 4k, which the batch window turns into a handful
+        if [ "$(brick_writes)" -lt 16 ]; then echo "Y"; else echo "N"; fi
+}
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/$V0
+TEST $CLI volume set $V0 performance.write-behind on
+TEST $CLI volume set $V0 performance.write-behind-batch-window 1000
+TEST $CLI volume start $V0
+TEST $CLI volume profile $V0 start
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+
+TEST build_tester $(dirname $0)/write-behind-extents.c
+TEST $(dirname $0)/write-behind-extents $M0/file $B0/reference
+
+TEST cmp $M0/file $B0/reference
+TEST cmp $B0/$V0/file $B0/reference
+
+EXPECT_NOT "0" wb_priv_value merged_writes
+EXPECT_NOT "0" wb_priv_value overwritten_bytes
+EXPECT "Y" brick_writes_batched
+
+TEST cleanup_tester $(dirname $0)/write-behind-extents
+TEST rm -f $M0/file $B0/reference
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -3491,6 +3491,10 @@ afr_notify (xlator_t *this, int32_t event,
         if (!priv)
                 return 0;
 
+        /* not about a child, nothing to aggregate */
+        if (event == GF_EVENT_UPCALL)
+                return default_notify (this, event, data);
+
         /*
          * We need to reset this in case children come up in "staggered"
          * fashion, so that we discover a late-arriving local subvolume.  Note
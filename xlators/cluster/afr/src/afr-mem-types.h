@@ -43,6 +43,8 @@ enum gf_afr_mem_types_ {
         gf_afr_mt_pos_data_t,
 	gf_afr_mt_reply_t,
 	gf_afr_mt_subvol_healer_t,
+	gf_afr_mt_shd_heal_entry_t,
+	gf_afr_mt_shd_worker_t,
         gf_afr_mt_end
 };
 #endif
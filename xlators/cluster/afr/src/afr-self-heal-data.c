@@ -23,6 +23,15 @@ enum {
 	AFR_SELFHEAL_DATA_DIFF,
 };
 
+/*
+  The diff algorithm compares the copies a range at a time, starting with
+  ranges of FANOUT^2 blocks. Bricks answer a tree rchecksum of a range from
+  the checksums of its blocks, which they keep from one request to the next,
+  so a range which differs is split into FANOUT parts, down to the blocks
+  which really need to be copied, without reading the data again.
+*/
+#define AFR_DATA_TREE_FANOUT 8
+
 
 #define HAS_HOLES(i) ((i->ia_blocks * 512) < (i->ia_size))
 static int
@@ -40,6 +49,8 @@ __checksum_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 	local->replies[i].op_errno = op_errno;
 	if (strong)
 		memcpy (local->replies[i].checksum, strong, MD5_DIGEST_LENGTH);
+	if (xdata)
+		local->replies[i].xdata = dict_ref (xdata);
 
 	syncbarrier_wake (&local->barrier);
 	return 0;
@@ -72,15 +83,22 @@ attr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 }
 
 
+/*
+  With *tree set, asks for tree checksums of @block sized leaves. If one of
+  the bricks answers with a plain MD5, *tree is cleared for the rest of the
+  heal, and a single block is compared again with MD5 on all of them.
+*/
 static gf_boolean_t
 __afr_selfheal_data_checksums_match (call_frame_t *frame, xlator_t *this,
 				     fd_t *fd, int source,
 				     unsigned char *healed_sinks,
-				     off_t offset, size_t size)
+				     off_t offset, size_t size, size_t block,
+				     gf_boolean_t *tree)
 {
 	afr_private_t *priv = NULL;
 	afr_local_t *local = NULL;
 	unsigned char *wind_subvols = NULL;
+	dict_t *xdata = NULL;
 	int i = 0;
 
 	priv = this->private;
@@ -92,14 +110,45 @@ __afr_selfheal_data_checksums_match (call_frame_t *frame, xlator_t *this,
 			wind_subvols[i] = 1;
 	}
 
+again:
+	if (*tree) {
+		xdata = dict_new ();
+		if (!xdata ||
+		    dict_set_int32 (xdata, GLUSTERFS_RCHECKSUM_TREE, block)) {
+			if (xdata)
+				dict_unref (xdata);
+			return _gf_false;
+		}
+	}
+
 	AFR_ONLIST (wind_subvols, frame, __checksum_cbk, rchecksum, fd,
-		    offset, size, NULL);
+		    offset, size, xdata);
 
-	if (!local->replies[source].valid || local->replies[source].op_ret != 0)
-		return _gf_false;
+	if (xdata) {
+		dict_unref (xdata);
+		xdata = NULL;
+	}
+
+	for (i = 0; i < priv->child_count; i++) {
+		if (!wind_subvols[i])
+			continue;
+		if (!local->replies[i].valid || local->replies[i].op_ret != 0)
+			return _gf_false;
+		if (*tree && (!local->replies[i].xdata ||
+			      !dict_get (local->replies[i].xdata,
+					 GLUSTERFS_RCHECKSUM_TREE))) {
+			gf_log (this->name, GF_LOG_DEBUG, "%s does not support "
+				"tree checksums, comparing blocks with MD5",
+				priv->children[i]->name);
+			*tree = _gf_false;
+			if (size <= block)
+				goto again;
+			return _gf_false;
+		}
+	}
 
 	for (i = 0; i < priv->child_count; i++) {
-		if (i == source)
+		if (i == source || !wind_subvols[i])
 			continue;
 		if (memcmp (local->replies[source].checksum,
 			    local->replies[i].checksum,
@@ -186,7 +235,8 @@ __afr_selfheal_data_read_write (call_frame_t *frame, xlator_t *this, fd_t *fd,
 static int
 afr_selfheal_data_block (call_frame_t *frame, xlator_t *this, fd_t *fd,
 			 int source, unsigned char *healed_sinks, off_t offset,
-			 size_t size, int type, struct afr_reply *replies)
+			 size_t size, int type, gf_boolean_t *tree,
+			 struct afr_reply *replies)
 {
 	int ret = -1;
 	int sink_count = 0;
@@ -207,7 +257,8 @@ afr_selfheal_data_block (call_frame_t *frame, xlator_t *this, fd_t *fd,
 
 		if (type == AFR_SELFHEAL_DATA_DIFF &&
 		    __afr_selfheal_data_checksums_match (frame, this, fd, source,
-							 healed_sinks, offset, size)) {
+							 healed_sinks, offset,
+							 size, size, tree)) {
 			ret = 0;
 			goto unlock;
 		}
@@ -224,6 +275,96 @@ unlock:
 
 
 
+/* Returns 1 if [@offset, @offset + @size) is the same on the source and all
+   the sinks, 0 if it is not or cannot be told by a tree checksum. */
+static int
+afr_selfheal_data_range_match (call_frame_t *frame, xlator_t *this, fd_t *fd,
+			       int source, unsigned char *healed_sinks,
+			       off_t offset, size_t size, size_t block,
+			       gf_boolean_t *tree)
+{
+	int ret = -1;
+	int sink_count = 0;
+	afr_private_t *priv = NULL;
+	unsigned char *data_lock = NULL;
+
+	priv = this->private;
+	sink_count = AFR_COUNT (healed_sinks, priv->child_count);
+	data_lock = alloca0 (priv->child_count);
+
+	ret = afr_selfheal_inodelk (frame, this, fd->inode, this->name,
+				    offset, size, data_lock);
+	{
+		if (ret < sink_count) {
+			ret = -ENOTCONN;
+			goto unlock;
+		}
+
+		ret = __afr_selfheal_data_checksums_match (frame, this, fd,
+							   source, healed_sinks,
+							   offset, size, block,
+							   tree);
+	}
+unlock:
+	afr_selfheal_uninodelk (frame, this, fd->inode, this->name,
+				offset, size, data_lock);
+	return ret;
+}
+
+
+static int
+afr_selfheal_data_tree (call_frame_t *frame, xlator_t *this, fd_t *fd,
+			int source, unsigned char *healed_sinks, off_t offset,
+			size_t size, size_t block, gf_boolean_t *tree,
+			struct afr_reply *replies)
+{
+	off_t off = 0;
+	off_t end = 0;
+	size_t part = 0;
+	int ret = 0;
+
+	end = offset + size;
+	if (end > replies[source].poststat.ia_size)
+		end = replies[source].poststat.ia_size;
+
+	if (size <= block) {
+		ret = afr_selfheal_data_block (frame, this, fd, source,
+					       healed_sinks, offset, block,
+					       AFR_SELFHEAL_DATA_DIFF, tree,
+					       replies);
+		AFR_STACK_RESET (frame);
+		return ret;
+	}
+
+	if (*tree) {
+		/* no need to checksum the empty leaves past EOF */
+		ret = afr_selfheal_data_range_match (frame, this, fd, source,
+						     healed_sinks, offset,
+						     min (size, (end - offset +
+								 block - 1) /
+							  block * block),
+						     block, tree);
+		AFR_STACK_RESET (frame);
+		if (ret != 0)
+			return (ret < 0) ? ret : 0;
+	}
+
+	/* once a brick turns out not to support tree checksums, the rest
+	   is compared a block at a time */
+	part = *tree ? size / AFR_DATA_TREE_FANOUT : block;
+
+	for (off = offset; off < end; off += part) {
+		ret = afr_selfheal_data_tree (frame, this, fd, source,
+					      healed_sinks, off, part, block,
+					      tree, replies);
+		if (ret < 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+
 static int
 afr_selfheal_data_fsync (call_frame_t *frame, xlator_t *this, fd_t *fd,
 			 unsigned char *healed_sinks)
@@ -301,7 +442,9 @@ afr_selfheal_data_do (call_frame_t *frame, xlator_t *this, fd_t *fd,
 	int i = 0;
 	off_t off = 0;
 	size_t block = 128 * 1024;
+	size_t range = 0;
 	int type = AFR_SELFHEAL_DATA_FULL;
+	gf_boolean_t tree = _gf_false;
 	int ret = -1;
 	call_frame_t *iter_frame = NULL;
 	char *sinks_str = NULL;
@@ -328,14 +471,31 @@ afr_selfheal_data_do (call_frame_t *frame, xlator_t *this, fd_t *fd,
 	if (!iter_frame)
 		return -ENOMEM;
 
-	for (off = 0; off < replies[source].poststat.ia_size; off += block) {
-		ret = afr_selfheal_data_block (iter_frame, this, fd, source,
-					       healed_sinks, off, block, type,
-					       replies);
-		if (ret < 0)
-			goto out;
+	if (type == AFR_SELFHEAL_DATA_DIFF) {
+		tree = _gf_true;
+		range = block * AFR_DATA_TREE_FANOUT * AFR_DATA_TREE_FANOUT;
 
-		AFR_STACK_RESET (iter_frame);
+		for (off = 0; off < replies[source].poststat.ia_size;
+		     off += range) {
+			ret = afr_selfheal_data_tree (iter_frame, this, fd,
+						      source, healed_sinks,
+						      off, range, block, &tree,
+						      replies);
+			if (ret < 0)
+				goto out;
+		}
+	} else {
+		for (off = 0; off < replies[source].poststat.ia_size;
+		     off += block) {
+			ret = afr_selfheal_data_block (iter_frame, this, fd,
+						       source, healed_sinks,
+						       off, block, type, &tree,
+						       replies);
+			if (ret < 0)
+				goto out;
+
+			AFR_STACK_RESET (iter_frame);
+		}
 	}
 
 	afr_selfheal_data_restore_time (frame, this, fd->inode, source,
@@ -22,6 +22,7 @@
 #define SHD_INODE_LRU_LIMIT          2048
 #define AFR_EH_SPLIT_BRAIN_LIMIT     1024
 #define AFR_STATISTICS_HISTORY_SIZE    50
+#define AFR_SHD_INFLIGHT_BUCKETS     1024
 
 
 #define ASSERT_LOCAL(this, healer)				\
@@ -308,14 +309,18 @@ afr_shd_selfheal (struct subvol_healer *healer, int child, uuid_t gfid)
 
 	ret = afr_selfheal (this, gfid);
 
-	if (ret == -EIO) {
-		eh = shd->split_brain;
-		crawl_event->split_brain_count++;
-	} else if (ret < 0) {
-		crawl_event->heal_failed_count++;
-	} else if (ret == 0) {
-		crawl_event->healed_count++;
+	pthread_mutex_lock (&healer->mutex);
+	{
+		if (ret == -EIO) {
+			eh = shd->split_brain;
+			crawl_event->split_brain_count++;
+		} else if (ret < 0) {
+			crawl_event->heal_failed_count++;
+		} else if (ret == 0) {
+			crawl_event->healed_count++;
+		}
 	}
+	pthread_mutex_unlock (&healer->mutex);
 
 	if (eh) {
 		shd_event = GF_CALLOC (1, sizeof(*shd_event),
@@ -349,6 +354,9 @@ afr_shd_sweep_prepare (struct subvol_healer *healer)
 	event->healed_count = 0;
 	event->split_brain_count = 0;
 	event->heal_failed_count = 0;
+	event->index_count = 0;
+	event->pending_count = 0;
+	event->skipped_count = 0;
 
 	time (&event->start_time);
 	event->end_time = 0;
@@ -377,6 +385,270 @@ afr_shd_sweep_done (struct subvol_healer *healer)
 }
 
 
+struct afr_shd_heal_entry {
+	struct list_head  list;     /* in healer->queue */
+	struct list_head  inflight; /* in shd->inflight */
+	uuid_t            gfid;
+	char              name[UUID_CANONICAL_FORM_LEN + 1];
+};
+typedef struct afr_shd_heal_entry afr_shd_heal_entry_t;
+
+
+static struct list_head *
+afr_shd_inflight_bucket (afr_self_heald_t *shd, uuid_t gfid)
+{
+	uint32_t hash = 0;
+
+	memcpy (&hash, &gfid[12], sizeof (hash));
+
+	return &shd->inflight[hash % AFR_SHD_INFLIGHT_BUCKETS];
+}
+
+
+/* Marks the gfid of @entry as taken. Fails if another healer (of this or
+   another subvolume) already has it queued or under heal. */
+static gf_boolean_t
+afr_shd_inflight_claim (afr_self_heald_t *shd, afr_shd_heal_entry_t *entry)
+{
+	struct list_head *bucket = NULL;
+	afr_shd_heal_entry_t *tmp = NULL;
+	gf_boolean_t claimed = _gf_true;
+
+	bucket = afr_shd_inflight_bucket (shd, entry->gfid);
+
+	pthread_mutex_lock (&shd->inflight_lock);
+	{
+		list_for_each_entry (tmp, bucket, inflight) {
+			if (uuid_compare (tmp->gfid, entry->gfid) == 0) {
+				claimed = _gf_false;
+				goto unlock;
+			}
+		}
+		list_add (&entry->inflight, bucket);
+	}
+unlock:
+	pthread_mutex_unlock (&shd->inflight_lock);
+
+	return claimed;
+}
+
+
+static void
+afr_shd_inflight_release (afr_self_heald_t *shd, afr_shd_heal_entry_t *entry)
+{
+	pthread_mutex_lock (&shd->inflight_lock);
+	{
+		list_del_init (&entry->inflight);
+	}
+	pthread_mutex_unlock (&shd->inflight_lock);
+}
+
+
+static uint64_t
+afr_shd_now_usec (void)
+{
+	struct timeval tv = {0, };
+
+	gettimeofday (&tv, NULL);
+
+	return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+
+/* Spaces out heals on a subvolume so that at most shd-max-heal-rate of
+   them start every second, whatever the number of heal workers. */
+static void
+afr_shd_heal_throttle (struct subvol_healer *healer)
+{
+	afr_private_t *priv = NULL;
+	uint32_t rate = 0;
+	uint64_t now = 0;
+	uint64_t delay = 0;
+
+	priv = healer->this->private;
+	rate = priv->shd.max_heal_rate;
+	if (!rate)
+		return;
+
+	now = afr_shd_now_usec ();
+
+	pthread_mutex_lock (&healer->mutex);
+	{
+		if (healer->next_heal > now)
+			delay = healer->next_heal - now;
+		else
+			healer->next_heal = now;
+		healer->next_heal += 1000000 / rate;
+	}
+	pthread_mutex_unlock (&healer->mutex);
+
+	if (delay)
+		usleep (delay);
+}
+
+
+static void
+afr_shd_index_heal (struct subvol_healer *healer, inode_t *index,
+		    afr_shd_heal_entry_t *entry)
+{
+	afr_private_t *priv = NULL;
+	xlator_t *subvol = NULL;
+	int ret = 0;
+
+	priv = healer->this->private;
+	subvol = priv->children[healer->subvol];
+
+	/* entries queued before the daemon got disabled are dropped */
+	if (!priv->shd.enabled)
+		goto out;
+
+	afr_shd_heal_throttle (healer);
+
+	ret = afr_shd_selfheal (healer, healer->subvol, entry->gfid);
+
+	if (ret == -ENOENT || ret == -ESTALE)
+		afr_shd_index_purge (subvol, index, entry->name);
+out:
+	afr_shd_inflight_release (&priv->shd, entry);
+
+	pthread_mutex_lock (&healer->mutex);
+	{
+		healer->crawl_event.pending_count--;
+	}
+	pthread_mutex_unlock (&healer->mutex);
+
+	GF_FREE (entry);
+}
+
+
+struct afr_shd_worker {
+	struct subvol_healer *healer;
+	inode_t              *index;
+	pthread_t             thread;
+};
+
+
+static void *
+afr_shd_index_worker (void *data)
+{
+	struct afr_shd_worker *worker = data;
+	struct subvol_healer *healer = NULL;
+	afr_shd_heal_entry_t *entry = NULL;
+
+	healer = worker->healer;
+	THIS = healer->this;
+
+	for (;;) {
+		pthread_mutex_lock (&healer->mutex);
+		{
+			while (list_empty (&healer->queue) &&
+			       !healer->queue_done)
+				pthread_cond_wait (&healer->queue_cond,
+						   &healer->mutex);
+
+			entry = NULL;
+			if (!list_empty (&healer->queue)) {
+				entry = list_entry (healer->queue.next,
+						    afr_shd_heal_entry_t, list);
+				list_del_init (&entry->list);
+				healer->queued--;
+				healer->healing++;
+				pthread_cond_signal (&healer->room_cond);
+			}
+		}
+		pthread_mutex_unlock (&healer->mutex);
+
+		if (!entry)
+			break;
+
+		afr_shd_index_heal (healer, worker->index, entry);
+
+		pthread_mutex_lock (&healer->mutex);
+		{
+			healer->healing--;
+		}
+		pthread_mutex_unlock (&healer->mutex);
+	}
+
+	return NULL;
+}
+
+
+static void
+afr_shd_index_enqueue (struct subvol_healer *healer,
+		       afr_shd_heal_entry_t *entry, uint32_t qlength)
+{
+	pthread_mutex_lock (&healer->mutex);
+	{
+		while (healer->queued >= qlength)
+			pthread_cond_wait (&healer->room_cond, &healer->mutex);
+
+		list_add_tail (&entry->list, &healer->queue);
+		healer->queued++;
+		pthread_cond_signal (&healer->queue_cond);
+	}
+	pthread_mutex_unlock (&healer->mutex);
+}
+
+
+/* Starts up to @count heal workers for a sweep. Returns how many could be
+   started; with none the sweep heals in the calling thread. */
+static int
+afr_shd_index_workers_start (struct subvol_healer *healer, inode_t *index,
+			     struct afr_shd_worker *workers, int count)
+{
+	int i = 0;
+
+	pthread_mutex_lock (&healer->mutex);
+	{
+		healer->queue_done = _gf_false;
+	}
+	pthread_mutex_unlock (&healer->mutex);
+
+	for (i = 0; i < count; i++) {
+		workers[i].healer = healer;
+		workers[i].index = index;
+		if (gf_thread_create (&workers[i].thread, NULL,
+				      afr_shd_index_worker, &workers[i]))
+			break;
+	}
+
+	if (i < count)
+		gf_log (healer->this->name, GF_LOG_WARNING,
+			"started %d of %d heal workers on %s", i, count,
+			afr_subvol_name (healer->this, healer->subvol));
+
+	return i;
+}
+
+
+static void
+afr_shd_index_workers_stop (struct subvol_healer *healer,
+			    struct afr_shd_worker *workers, int count)
+{
+	int i = 0;
+
+	pthread_mutex_lock (&healer->mutex);
+	{
+		healer->queue_done = _gf_true;
+		pthread_cond_broadcast (&healer->queue_cond);
+	}
+	pthread_mutex_unlock (&healer->mutex);
+
+	for (i = 0; i < count; i++)
+		pthread_join (workers[i].thread, NULL);
+}
+
+
+/*
+  Reads the index and hands every gfid in it to a pool of shd-max-threads
+  heal workers, through a queue of at most shd-wait-qlength entries. A gfid
+  which is already queued or being healed by any healer of this daemon is
+  skipped. With a single thread the heals are done inline, as before.
+
+  Returns the number of gfids healed, or a negative errno if the index could
+  not be read or the daemon got disabled.
+*/
 int
 afr_shd_index_sweep (struct subvol_healer *healer)
 {
@@ -385,16 +657,21 @@ afr_shd_index_sweep (struct subvol_healer *healer)
 	fd_t *fd = NULL;
 	xlator_t *subvol = NULL;
 	afr_private_t *priv = NULL;
+	afr_self_heald_t *shd = NULL;
 	off_t offset = 0;
 	gf_dirent_t entries;
 	gf_dirent_t *entry = NULL;
-	uuid_t gfid;
+	afr_shd_heal_entry_t *heal = NULL;
+	struct afr_shd_worker *workers = NULL;
+	int nworkers = 0;
+	uint32_t max_threads = 0;
+	uint32_t qlength = 0;
 	int ret = 0;
-	int count = 0;
 
 	this = healer->this;
 	child = healer->subvol;
 	priv = this->private;
+	shd = &priv->shd;
 	subvol = priv->children[child];
 
 	fd = afr_shd_index_opendir (this, child);
@@ -404,6 +681,18 @@ afr_shd_index_sweep (struct subvol_healer *healer)
 		return -errno;
 	}
 
+	max_threads = shd->max_threads;
+	qlength = shd->wait_qlength;
+	if (max_threads > 1) {
+		workers = GF_CALLOC (max_threads, sizeof (*workers),
+				     gf_afr_mt_shd_worker_t);
+		if (workers)
+			nworkers = afr_shd_index_workers_start (healer,
+								fd->inode,
+								workers,
+								max_threads);
+	}
+
 	INIT_LIST_HEAD (&entries.list);
 
 	while ((ret = syncop_readdir (subvol, fd, 131072, offset, &entries))) {
@@ -424,19 +713,44 @@ afr_shd_index_sweep (struct subvol_healer *healer)
 			gf_log (this->name, GF_LOG_DEBUG, "got entry: %s",
 				entry->d_name);
 
-			ret = uuid_parse (entry->d_name, gfid);
-			if (ret)
-				continue;
+			heal = GF_CALLOC (1, sizeof (*heal),
+					  gf_afr_mt_shd_heal_entry_t);
+			if (!heal) {
+				ret = -ENOMEM;
+				break;
+			}
+			INIT_LIST_HEAD (&heal->list);
+			INIT_LIST_HEAD (&heal->inflight);
 
-			ret = afr_shd_selfheal (healer, child, gfid);
-			if (ret == 0)
-				count++;
+			if (uuid_parse (entry->d_name, heal->gfid)) {
+				GF_FREE (heal);
+				continue;
+			}
+			strncpy (heal->name, entry->d_name,
+				 UUID_CANONICAL_FORM_LEN);
+
+			if (!afr_shd_inflight_claim (shd, heal)) {
+				pthread_mutex_lock (&healer->mutex);
+				{
+					healer->crawl_event.index_count++;
+					healer->crawl_event.skipped_count++;
+				}
+				pthread_mutex_unlock (&healer->mutex);
+				GF_FREE (heal);
+				continue;
+			}
 
-			if (ret == -ENOENT || ret == -ESTALE) {
-				afr_shd_index_purge (subvol, fd->inode,
-						     entry->d_name);
-				ret = 0;
+			pthread_mutex_lock (&healer->mutex);
+			{
+				healer->crawl_event.index_count++;
+				healer->crawl_event.pending_count++;
 			}
+			pthread_mutex_unlock (&healer->mutex);
+
+			if (nworkers)
+				afr_shd_index_enqueue (healer, heal, qlength);
+			else
+				afr_shd_index_heal (healer, fd->inode, heal);
 		}
 
 		gf_dirent_free (&entries);
@@ -444,6 +758,10 @@ afr_shd_index_sweep (struct subvol_healer *healer)
 			break;
 	}
 
+	if (nworkers)
+		afr_shd_index_workers_stop (healer, workers, nworkers);
+	GF_FREE (workers);
+
 	if (fd) {
                 if (fd->inode)
                         inode_forget (fd->inode, 1);
@@ -451,7 +769,7 @@ afr_shd_index_sweep (struct subvol_healer *healer)
         }
 
 	if (!ret)
-		ret = count;
+		ret = healer->crawl_event.healed_count;
 	return ret;
 }
 
@@ -627,6 +945,20 @@ afr_shd_healer_init (xlator_t *this, struct subvol_healer *healer)
 	if (ret)
 		goto out;
 
+	ret = pthread_cond_init (&healer->queue_cond, NULL);
+	if (ret)
+		goto out;
+
+	ret = pthread_cond_init (&healer->room_cond, NULL);
+	if (ret)
+		goto out;
+
+	INIT_LIST_HEAD (&healer->queue);
+	healer->queued = 0;
+	healer->healing = 0;
+	healer->queue_done = _gf_false;
+	healer->next_heal = 0;
+
 	healer->this = this;
 	healer->running = _gf_false;
 	healer->rerun = _gf_false;
@@ -695,6 +1027,7 @@ afr_shd_dict_add_crawl_event (xlator_t *this, dict_t *output,
         char            *crawl_type = NULL;
         int             progress = -1;
 	int             child = -1;
+	time_t          elapsed = 0;
 
 	child = crawl_event->child;
         healed_count = crawl_event->healed_count;
@@ -785,6 +1118,46 @@ afr_shd_dict_add_crawl_event (xlator_t *this, dict_t *output,
 		end_time_str = NULL;
 	}
 
+        snprintf (key, sizeof (key), "statistics_index_cnt-%d-%d-%"PRIu64,
+                  xl_id, child, count);
+        ret = dict_set_uint64 (output, key, crawl_event->index_count);
+	if (ret) {
+                gf_log (this->name, GF_LOG_ERROR,
+			"Could not add statistics_index_count to output");
+                goto out;
+        }
+
+        snprintf (key, sizeof (key), "statistics_pending_cnt-%d-%d-%"PRIu64,
+                  xl_id, child, count);
+        ret = dict_set_uint64 (output, key, crawl_event->pending_count);
+	if (ret) {
+                gf_log (this->name, GF_LOG_ERROR,
+			"Could not add statistics_pending_count to output");
+                goto out;
+        }
+
+        snprintf (key, sizeof (key), "statistics_skipped_cnt-%d-%d-%"PRIu64,
+                  xl_id, child, count);
+        ret = dict_set_uint64 (output, key, crawl_event->skipped_count);
+	if (ret) {
+                gf_log (this->name, GF_LOG_ERROR,
+			"Could not add statistics_skipped_count to output");
+                goto out;
+        }
+
+	/* heals per second over the crawl so far */
+	elapsed = (crawl_event->end_time ? crawl_event->end_time : time (NULL))
+		  - crawl_event->start_time;
+        snprintf (key, sizeof (key), "statistics_heal_rate-%d-%d-%"PRIu64,
+                  xl_id, child, count);
+        ret = dict_set_uint64 (output, key, (elapsed > 0) ?
+			       healed_count / elapsed : healed_count);
+	if (ret) {
+                gf_log (this->name, GF_LOG_ERROR,
+			"Could not add statistics_heal_rate to output");
+                goto out;
+        }
+
         snprintf (key, sizeof (key), "statistics_inprogress-%d-%d-%"PRIu64,
                   xl_id, child, count);
 
@@ -1027,6 +1400,19 @@ afr_selfheal_daemon_init (xlator_t *this)
 	if (!this->itable)
 		goto out;
 
+	ret = pthread_mutex_init (&shd->inflight_lock, NULL);
+	if (ret)
+		goto out;
+	ret = -1;
+
+	shd->inflight = GF_CALLOC (AFR_SHD_INFLIGHT_BUCKETS,
+				   sizeof (*shd->inflight),
+				   gf_common_mt_list_head);
+	if (!shd->inflight)
+		goto out;
+	for (i = 0; i < AFR_SHD_INFLIGHT_BUCKETS; i++)
+		INIT_LIST_HEAD (&shd->inflight[i]);
+
 	shd->index_healers = GF_CALLOC (sizeof(*shd->index_healers),
 					priv->child_count,
 					gf_afr_mt_subvol_healer_t);
@@ -25,6 +25,9 @@ typedef struct {
 	uint64_t healed_count;
         uint64_t split_brain_count;
         uint64_t heal_failed_count;
+        uint64_t index_count;      /* gfids read from the index */
+        uint64_t pending_count;    /* queued or being healed */
+        uint64_t skipped_count;    /* already being healed elsewhere */
 
 	/* If start_time is 0, it means crawler is not in progress
 	   and stats are not valid */
@@ -45,6 +48,15 @@ struct subvol_healer {
 	pthread_mutex_t  mutex;
 	pthread_cond_t   cond;
 	pthread_t        thread;
+
+	/* index entries waiting for a heal worker, under mutex */
+	struct list_head queue;
+	int              queued;
+	int              healing;
+	gf_boolean_t     queue_done;
+	pthread_cond_t   queue_cond;
+	pthread_cond_t   room_cond;
+	uint64_t         next_heal;   /* usec, for shd-max-heal-rate */
 };
 
 typedef struct {
@@ -55,6 +67,14 @@ typedef struct {
 
         eh_t                    *split_brain;
         eh_t                    **statistics;
+
+	uint32_t                max_threads;
+	uint32_t                wait_qlength;
+	uint32_t                max_heal_rate;
+
+	/* gfids queued or being healed by any healer */
+	pthread_mutex_t         inflight_lock;
+	struct list_head       *inflight;
 } afr_self_heald_t;
 
 
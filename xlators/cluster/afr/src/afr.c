@@ -200,6 +200,15 @@ reconfigure (xlator_t *this, dict_t *options)
 	GF_OPTION_RECONF ("iam-self-heal-daemon", priv->shd.iamshd, options,
 			  bool, out);
 
+	GF_OPTION_RECONF ("shd-max-threads", priv->shd.max_threads, options,
+			  uint32, out);
+
+	GF_OPTION_RECONF ("shd-wait-qlength", priv->shd.wait_qlength, options,
+			  uint32, out);
+
+	GF_OPTION_RECONF ("shd-max-heal-rate", priv->shd.max_heal_rate,
+			  options, uint32, out);
+
         priv->did_discovery = _gf_false;
 
         ret = 0;
@@ -347,6 +356,14 @@ init (xlator_t *this)
 
 	GF_OPTION_INIT ("iam-self-heal-daemon", priv->shd.iamshd, bool, out);
 
+	GF_OPTION_INIT ("shd-max-threads", priv->shd.max_threads, uint32, out);
+
+	GF_OPTION_INIT ("shd-wait-qlength", priv->shd.wait_qlength, uint32,
+			out);
+
+	GF_OPTION_INIT ("shd-max-heal-rate", priv->shd.max_heal_rate, uint32,
+			out);
+
         priv->wait_count = 1;
 
         priv->child_up = GF_CALLOC (sizeof (unsigned char), child_count,
@@ -749,5 +766,32 @@ struct volume_options options[] = {
 	  .type = GF_OPTION_TYPE_BOOL,
 	  .default_value = "off",
 	},
+        { .key = {"shd-max-threads"},
+          .type = GF_OPTION_TYPE_INT,
+          .min = 1,
+          .max = 64,
+          .default_value = "1",
+          .description = "Maximum number of heals the self-heal-daemon runs "
+                         "in parallel on each brick while crawling the "
+                         "index."
+        },
+        { .key = {"shd-wait-qlength"},
+          .type = GF_OPTION_TYPE_INT,
+          .min = 1,
+          .max = 65536,
+          .default_value = "1024",
+          .description = "Number of index entries of a brick which the "
+                         "self-heal-daemon keeps queued for its heal "
+                         "threads."
+        },
+        { .key = {"shd-max-heal-rate"},
+          .type = GF_OPTION_TYPE_INT,
+          .min = 0,
+          .max = 1000000,
+          .default_value = "0",
+          .description = "Maximum number of heals the self-heal-daemon "
+                         "starts per second on each brick, so that healing "
+                         "does not starve client I/O. 0 means no limit."
+        },
         { .key  = {NULL} },
 };
@@ -50,6 +50,13 @@ struct dht_layout {
         int                type;
         int                ref; /* use with dht_conf_t->layout_lock */
         gf_boolean_t       search_unhashed;
+        int                search_cnt;  /* ranges in search[], -1 when
+                                           dht_layout_search () has to scan
+                                           list[] */
+        int                search_zero; /* first entry with a 0-0 range */
+        int               *search;      /* list[] positions of the ranges
+                                           sorted by start, stored after
+                                           list[] */
         struct {
                 int        err;   /* 0 = normal
                                      -1 = dir exists and no xattr
@@ -62,6 +69,31 @@ struct dht_layout {
 };
 typedef struct dht_layout  dht_layout_t;
 
+/* With fewer ranges than this scanning list[] is as fast as bisecting. */
+#define DHT_LAYOUT_INDEX_MIN    64
+
+/* Running the rsync and extra hash regexes costs more than everything
+   else in hashing a name, and fops on one name tend to come in bursts.
+   The cache is split in shards with a lock each, so that threads hashing
+   different names rarely contend. An entry only counts when its gen is
+   that of the cache, which changing the regexes bumps. */
+#define DHT_NAME_CACHE_SIZE     1024 /* power of 2 */
+#define DHT_NAME_CACHE_SHARDS   16   /* power of 2 */
+#define DHT_NAME_CACHE_NAME_MAX 52
+
+struct dht_name_cache {
+        uint32_t           gen;
+        struct {
+                gf_lock_t  lock;
+                struct {
+                        uint32_t   hash;
+                        int        type;
+                        uint32_t   gen;
+                        char       name[DHT_NAME_CACHE_NAME_MAX];
+                } entries[DHT_NAME_CACHE_SIZE / DHT_NAME_CACHE_SHARDS];
+        } shards[DHT_NAME_CACHE_SHARDS];
+};
+
 struct dht_stat_time {
         uint32_t        atime;
         uint32_t        atime_nsec;
@@ -346,6 +378,7 @@ struct dht_conf {
         gf_boolean_t    rsync_regex_valid;
         regex_t         extra_regex;
         gf_boolean_t    extra_regex_valid;
+        struct dht_name_cache *name_cache; /* hashes of munged names */
 
         /* Support variable xattr names. */
         char            *xattr_name;
@@ -458,6 +491,7 @@ dht_layout_t                            *dht_layout_get (xlator_t *this, inode_t
 dht_layout_t                            *dht_layout_for_subvol (xlator_t *this, xlator_t *subvol);
 xlator_t *dht_layout_search (xlator_t   *this, dht_layout_t *layout,
                              const char *name);
+void                                     dht_layout_index (dht_layout_t *layout);
 int                                      dht_layout_normalize (xlator_t *this, loc_t *loc, dht_layout_t *layout);
 int dht_layout_anomalies (xlator_t      *this, loc_t *loc, dht_layout_t *layout,
                           uint32_t      *holes_p, uint32_t *overlaps_p,
@@ -500,6 +534,8 @@ xlator_t *dht_subvol_next_available (xlator_t *this, xlator_t *prev);
 int       dht_subvol_cnt (xlator_t *this, xlator_t *subvol);
 
 int dht_hash_compute (xlator_t *this, int type, const char *name, uint32_t *hash_p);
+struct dht_name_cache *dht_name_cache_new (void);
+void dht_name_cache_clear (dht_conf_t *priv);
 
 int dht_linkfile_create (call_frame_t    *frame, fop_mknod_cbk_t linkfile_cbk,
                          xlator_t        *this, xlator_t *tovol,
@@ -69,6 +69,82 @@ dht_munge_name (const char *original, char *modified, size_t len, regex_t *re)
         return _gf_false;
 }
 
+struct dht_name_cache *
+dht_name_cache_new (void)
+{
+        struct dht_name_cache *cache = NULL;
+        int                    i     = 0;
+
+        cache = GF_CALLOC (1, sizeof (*cache), gf_dht_mt_name_cache_t);
+        if (!cache)
+                return NULL;
+
+        /* the entries start out at gen 0, i.e. empty */
+        cache->gen = 1;
+        for (i = 0; i < DHT_NAME_CACHE_SHARDS; i++)
+                LOCK_INIT (&cache->shards[i].lock);
+
+        return cache;
+}
+
+
+static int
+dht_name_cache_get (struct dht_name_cache *cache, uint32_t slot, uint32_t gen,
+                    int type, const char *name, uint32_t *hash_p)
+{
+        int        shard = slot & (DHT_NAME_CACHE_SHARDS - 1);
+        int        i     = slot / DHT_NAME_CACHE_SHARDS;
+        int        ret   = -1;
+
+        LOCK (&cache->shards[shard].lock);
+        {
+                if (cache->shards[shard].entries[i].gen == gen &&
+                    cache->shards[shard].entries[i].type == type &&
+                    !strcmp (cache->shards[shard].entries[i].name, name)) {
+                        *hash_p = cache->shards[shard].entries[i].hash;
+                        ret = 0;
+                }
+        }
+        UNLOCK (&cache->shards[shard].lock);
+
+        return ret;
+}
+
+
+/* @gen is that of the cache from before the regexes were looked at: when
+   they changed since, @hash may be computed with the old ones. */
+static void
+dht_name_cache_set (struct dht_name_cache *cache, uint32_t slot, uint32_t gen,
+                    int type, const char *name, size_t len, uint32_t hash)
+{
+        int        shard = slot & (DHT_NAME_CACHE_SHARDS - 1);
+        int        i     = slot / DHT_NAME_CACHE_SHARDS;
+
+        LOCK (&cache->shards[shard].lock);
+        {
+                if (gen == __sync_fetch_and_add (&cache->gen, 0)) {
+                        cache->shards[shard].entries[i].gen = gen;
+                        cache->shards[shard].entries[i].type = type;
+                        cache->shards[shard].entries[i].hash = hash;
+                        memcpy (cache->shards[shard].entries[i].name, name,
+                                len);
+                }
+        }
+        UNLOCK (&cache->shards[shard].lock);
+}
+
+
+/* Forgets all names, for when the regexes change. */
+void
+dht_name_cache_clear (dht_conf_t *priv)
+{
+        if (!priv->name_cache)
+                return;
+
+        __sync_fetch_and_add (&priv->name_cache->gen, 1);
+}
+
+
 int
 dht_hash_compute (xlator_t *this, int type, const char *name, uint32_t *hash_p)
 {
@@ -76,6 +152,25 @@ dht_hash_compute (xlator_t *this, int type, const char *name, uint32_t *hash_p)
         dht_conf_t      *priv                   = this->private;
         size_t           len                    = 0;
         gf_boolean_t     munged                 = _gf_false;
+        gf_boolean_t     cached                 = _gf_false;
+        uint32_t         slot                   = 0;
+        uint32_t         gen                    = 0;
+        int              ret                    = 0;
+
+        if (!priv->extra_regex_valid && !priv->rsync_regex_valid)
+                return dht_hash_compute_internal (type, name, hash_p);
+
+        len = strlen(name) + 1;
+
+        if (priv->name_cache && len <= DHT_NAME_CACHE_NAME_MAX) {
+                cached = _gf_true;
+                slot = gf_dm_hashfn (name, len - 1) &
+                        (DHT_NAME_CACHE_SIZE - 1);
+                gen = __sync_fetch_and_add (&priv->name_cache->gen, 0);
+                if (dht_name_cache_get (priv->name_cache, slot, gen, type,
+                                        name, hash_p) == 0)
+                        return 0;
+        }
 
         /*
          * It wouldn't be safe to use alloca in an inline function that doesn't
@@ -85,14 +180,12 @@ dht_hash_compute (xlator_t *this, int type, const char *name, uint32_t *hash_p)
          */
 
         if (priv->extra_regex_valid) {
-                len = strlen(name) + 1;
                 rsync_friendly_name = alloca(len);
                 munged = dht_munge_name (name, rsync_friendly_name, len,
                                          &priv->extra_regex);
         }
 
         if (!munged && priv->rsync_regex_valid) {
-                len = strlen(name) + 1;
                 rsync_friendly_name = alloca(len);
                 gf_msg_trace (this->name, 0, "trying regex for %s", name);
                 munged = dht_munge_name (name, rsync_friendly_name, len,
@@ -107,5 +200,10 @@ dht_hash_compute (xlator_t *this, int type, const char *name, uint32_t *hash_p)
                 rsync_friendly_name = (char *)name;
         }
 
-        return dht_hash_compute_internal (type, rsync_friendly_name, hash_p);
+        ret = dht_hash_compute_internal (type, rsync_friendly_name, hash_p);
+        if (ret == 0 && cached)
+                dht_name_cache_set (priv->name_cache, slot, gen, type, name,
+                                    len, *hash_p);
+
+        return ret;
 }
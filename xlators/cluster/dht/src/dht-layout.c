@@ -25,7 +25,8 @@
 
 #define layout_entry_size (sizeof ((dht_layout_t *)NULL)->list[0])
 
-#define layout_size(cnt) (layout_base_size + (cnt * layout_entry_size))
+#define layout_size(cnt) (layout_base_size + (cnt * layout_entry_size) + \
+                          (cnt * sizeof (int)))
 
 #include <cmockery/pbc.h>
 #include <cmockery/cmockery_override.h>
@@ -58,6 +59,8 @@ dht_layout_new (xlator_t *this, int cnt)
 
         layout->type = DHT_HASH_TYPE_DM;
         layout->cnt = cnt;
+        layout->search_cnt = -1;
+        layout->search = (int *)&layout->list[cnt];
 
         if (conf) {
                 layout->spread_cnt = conf->dir_spread_cnt;
@@ -111,6 +114,8 @@ dht_layout_set (xlator_t *this, inode_t *inode, dht_layout_t *layout)
         if (!conf)
                 goto out;
 
+        dht_layout_index (layout);
+
         LOCK (&conf->layout_lock);
         {
                 oldret = dht_inode_ctx_layout_get (inode, this, &old_layout);
@@ -169,6 +174,86 @@ dht_layout_ref (xlator_t *this, dht_layout_t *layout)
 }
 
 
+/* Sorts the positions of the ranges of the layout by start, so that
+   dht_layout_search () can bisect them. Entries without a range (0-0) are
+   left out, except for the first one which still matches hash 0. Small
+   layouts and layouts with overlapping ranges are left to the linear
+   scan. */
+void
+dht_layout_index (dht_layout_t *layout)
+{
+        int       *search = layout->search;
+        uint32_t   start = 0;
+        int        cnt = 0;
+        int        pos = 0;
+        int        i = 0;
+        int        j = 0;
+
+        layout->search_cnt = -1;
+        layout->search_zero = -1;
+
+        for (i = 0; i < layout->cnt; i++) {
+                if (layout->list[i].start > layout->list[i].stop)
+                        return;
+
+                if (!layout->list[i].start && !layout->list[i].stop) {
+                        if (layout->search_zero < 0)
+                                layout->search_zero = i;
+                        continue;
+                }
+
+                /* insertion sort, list[] is usually sorted already */
+                start = layout->list[i].start;
+                for (j = cnt; j > 0; j--) {
+                        pos = search[j - 1];
+                        if (layout->list[pos].start <= start)
+                                break;
+                        search[j] = pos;
+                }
+                search[j] = i;
+                cnt++;
+        }
+
+        for (i = 1; i < cnt; i++) {
+                if (layout->list[search[i]].start <=
+                    layout->list[search[i - 1]].stop)
+                        return;
+        }
+
+        if (cnt >= DHT_LAYOUT_INDEX_MIN)
+                layout->search_cnt = cnt;
+}
+
+
+/* Returns the list[] position of the entry the linear scan would find
+   first, or -1. */
+static int
+dht_layout_bisect (dht_layout_t *layout, uint32_t hash)
+{
+        int   lo = 0;
+        int   hi = layout->search_cnt;
+        int   mid = 0;
+        int   pos = -1;
+
+        while (lo < hi) {
+                mid = (lo + hi) / 2;
+                if (layout->list[layout->search[mid]].start <= hash)
+                        lo = mid + 1;
+                else
+                        hi = mid;
+        }
+
+        if (lo > 0 && layout->list[layout->search[lo - 1]].stop >= hash)
+                pos = layout->search[lo - 1];
+
+        if (!hash && layout->search_zero >= 0 &&
+            (pos < 0 || layout->search_zero < pos))
+                pos = layout->search_zero;
+
+        return pos;
+}
+
+
 xlator_t *
 dht_layout_search (xlator_t *this, dht_layout_t *layout, const char *name)
 {
@@ -186,6 +271,18 @@ dht_layout_search (xlator_t *this, dht_layout_t *layout, const char *name)
                 goto out;
         }
 
+        /* The index is only a hint: list[] may have been changed since it
+           was built, so the entry is checked again and a miss scans. */
+        if (layout->search_cnt >= 0) {
+                i = dht_layout_bisect (layout, hash);
+                if (i >= 0 && i < layout->cnt
+                    && layout->list[i].start <= hash
+                    && layout->list[i].stop >= hash) {
+                        subvol = layout->list[i].xlator;
+                        goto out;
+                }
+        }
+
         for (i = 0; i < layout->cnt; i++) {
                 if (layout->list[i].start <= hash
                     && layout->list[i].stop >= hash) {
@@ -30,6 +30,7 @@ enum gf_dht_mem_types_ {
         gf_defrag_info_mt,
         gf_dht_mt_inode_ctx_t,
         gf_dht_mt_ctx_stat_time_t,
+        gf_dht_mt_name_cache_t,
         gf_dht_mt_end
 };
 #endif
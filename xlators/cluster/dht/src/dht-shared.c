@@ -218,6 +218,8 @@ dht_fini (xlator_t *this)
 
                 GF_FREE (conf->subvolume_status);
 
+                GF_FREE (conf->name_cache);
+
                 if (conf->lock_pool)
                         mem_pool_destroy (conf->lock_pool);
 
@@ -421,6 +423,7 @@ dht_reconfigure (xlator_t *this, dict_t *options)
                         &conf->rsync_regex, &conf->rsync_regex_valid);
         dht_init_regex (this, options, "extra-hash-regex",
                         &conf->extra_regex, &conf->extra_regex_valid);
+        dht_name_cache_clear (conf);
 
         GF_OPTION_RECONF ("weighted-rebalance", conf->do_weighting, options,
                           bool, out);
@@ -634,6 +637,11 @@ dht_init (xlator_t *this)
         dht_init_regex (this, this->options, "extra-hash-regex",
                         &conf->extra_regex, &conf->extra_regex_valid);
 
+        conf->name_cache = dht_name_cache_new ();
+        if (!conf->name_cache) {
+                goto err;
+        }
+
         ret = dht_layouts_init (this, conf);
         if (ret == -1) {
                 goto err;
@@ -699,6 +707,8 @@ err:
                 GF_FREE (conf->link_xattr_name);
                 GF_FREE (conf->wild_xattr_name);
 
+                GF_FREE (conf->name_cache);
+
                 if (conf->lock_pool)
                         mem_pool_destroy (conf->lock_pool);
 
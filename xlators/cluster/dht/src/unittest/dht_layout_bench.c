@@ -0,0 +1,190 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Name to subvolume lookups per second (dht_layout_search) as the number of
+ * distribute subvolumes grows, with the linear scan of the layout and with
+ * the sorted index (used from DHT_LAYOUT_INDEX_MIN subvolumes on), and the
+ * cost of the rsync-hash-regex with and without the name cache.
+ *
+ * usage: dht_layout_bench [max-subvolumes] [lookups]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "dht-common.h"
+
+#define BENCH_NAMES 1000
+#define BENCH_RSYNC_NAMES 64 /* files rsync has in flight */
+
+static char bench_names[BENCH_NAMES][32];
+
+/* dht-helper.c is not linked in */
+int
+dht_inode_ctx_layout_get (inode_t *inode, xlator_t *this,
+                          dht_layout_t **layout)
+{
+        return -1;
+}
+
+int
+dht_inode_ctx_layout_set (inode_t *inode, xlator_t *this,
+                          dht_layout_t *layout_int)
+{
+        return 0;
+}
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double
+bench_lookups (xlator_t *this, dht_layout_t *layout, int names,
+               long lookups, xlator_t **found)
+{
+        double   start = 0;
+        long     i = 0;
+
+        start = bench_now ();
+        for (i = 0; i < lookups; i++)
+                found[i % names] = dht_layout_search (this, layout,
+                                                      bench_names[i % names]);
+
+        return lookups / (bench_now () - start);
+}
+
+static dht_layout_t *
+bench_layout (xlator_t *this, xlator_t *subvols, int cnt)
+{
+        dht_layout_t *layout = NULL;
+        uint32_t      chunk = 0;
+        int           i = 0;
+
+        layout = dht_layout_new (this, cnt);
+        if (!layout)
+                return NULL;
+
+        chunk = 0xffffffff / cnt;
+        for (i = 0; i < cnt; i++) {
+                layout->list[i].xlator = &subvols[i];
+                layout->list[i].start = i * chunk;
+                layout->list[i].stop = (i == cnt - 1) ? 0xffffffff
+                                                      : (i + 1) * chunk - 1;
+        }
+
+        return layout;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t  *ctx = NULL;
+        xlator_t          xl = {0, };
+        xlator_t         *subvols = NULL;
+        dht_conf_t       *conf = NULL;
+        dht_layout_t     *layout = NULL;
+        struct dht_name_cache *cache = NULL;
+        xlator_t         *linear[BENCH_NAMES];
+        xlator_t         *indexed[BENCH_NAMES];
+        double            slow = 0;
+        double            fast = 0;
+        int               max = 256;
+        long              lookups = 2000000;
+        int               cnt = 0;
+        int               i = 0;
+        int               ret = 0;
+
+        if (argc > 1)
+                max = atoi (argv[1]);
+        if (argc > 2)
+                lookups = atol (argv[2]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        conf = calloc (1, sizeof (*conf));
+        subvols = calloc (max, sizeof (*subvols));
+        cache = dht_name_cache_new ();
+        if (!conf || !subvols || !cache)
+                return 1;
+
+        xl.name = "bench-dht";
+        xl.ctx = ctx;
+        xl.private = conf;
+
+        for (i = 0; i < BENCH_NAMES; i++)
+                snprintf (bench_names[i], sizeof (bench_names[i]),
+                          "file.%d", i);
+
+        printf ("%9s %16s %16s\n", "subvols", "linear lookups/s",
+                "indexed lookups/s");
+
+        for (cnt = 1; cnt <= max; cnt *= 2) {
+                layout = bench_layout (&xl, subvols, cnt);
+                if (!layout)
+                        return 1;
+
+                slow = bench_lookups (&xl, layout, BENCH_NAMES, lookups,
+                                      linear);
+                dht_layout_index (layout);
+                fast = bench_lookups (&xl, layout, BENCH_NAMES, lookups,
+                                      indexed);
+
+                if (memcmp (linear, indexed, sizeof (linear)))
+                        ret = 1;
+
+                printf ("%9d %16.0f %16.0f %s\n", cnt, slow, fast,
+                        ret ? "MISMATCH" : "");
+                GF_FREE (layout);
+        }
+
+        /* the default rsync-hash-regex and the temporary names rsync
+           creates, which it maps back to the final ones */
+        for (i = 0; i < BENCH_RSYNC_NAMES; i++)
+                snprintf (bench_names[i], sizeof (bench_names[i]),
+                          ".file.%d.Xa3b9Q", i);
+
+        if (regcomp (&conf->rsync_regex, "^\\.(.+)\\.[^.]+$", REG_EXTENDED))
+                return 1;
+        conf->rsync_regex_valid = _gf_true;
+
+        layout = bench_layout (&xl, subvols, 16);
+        if (!layout)
+                return 1;
+        dht_layout_index (layout);
+
+        slow = bench_lookups (&xl, layout, BENCH_RSYNC_NAMES,
+                              lookups / 4, linear);
+        conf->name_cache = cache;
+        fast = bench_lookups (&xl, layout, BENCH_RSYNC_NAMES,
+                              lookups / 4, indexed);
+
+        if (memcmp (linear, indexed, BENCH_RSYNC_NAMES * sizeof (*linear)))
+                ret = 1;
+
+        printf ("rsync-hash-regex, 16 subvols: %.0f lookups/s uncached, "
+                "%.0f cached %s\n", slow, fast, ret ? "MISMATCH" : "");
+
+        return ret;
+}
@@ -27,7 +27,14 @@
 #define EC_GF_SIZE (1 << EC_GF_BITS)
 #define EC_GF_WORD_SIZE sizeof(uint64_t)
 
-extern void (* ec_gf_muladd[])(uint8_t * out, uint8_t * in,
-                               unsigned int width);
+typedef void (* ec_gf_muladd_t)(uint8_t * out, uint8_t * in,
+                                unsigned int width);
+
+/* Kernels of the implementation chosen by ec_gf_select(), indexed by the
+ * constant to multiply by. All of them produce the same bytes. */
+extern ec_gf_muladd_t * ec_gf_muladd;
+
+const char * ec_gf_select(const char * name);
+const char * ec_gf_name(uint32_t idx);
 
 #endif /* __EC_GF8_H__ */
@@ -0,0 +1,12162 @@
+/*
+  Copyright (c) 2012 DataLab, s.l. <http://www.datalab.es>
+
+  This file is part of the cluster/ec translator for GlusterFS.
+
+  The cluster/ec translator for GlusterFS is free software: you can
+  redistribute it and/or modify it under the terms of the GNU General
+  Public License as published by the Free Software Foundation, either
+  version 3 of the License, or (at your option) any later version.
+
+  The cluster/ec translator for GlusterFS is distributed in the hope
+  that it will be useful, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE. See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with the cluster/ec translator for GlusterFS. If not, see
+  <http://www.gnu.org/licenses/>.
+*/
+
+/*
+ * Multiply-add kernels for every constant of GF(2^8), generated. Each one
+ * computes out = out * C + in over a bit-sliced chunk: 8 planes of `width`
+ * 64-bit words, plane b holding bit b of every element. ec-gf.c includes
+ * this file once per word type with these defined:
+ *
+ *   EC_GF_WORD      type the planes are processed in
+ *   EC_GF_LANES     number of 64-bit words in an EC_GF_WORD
+ *   EC_GF_NAME(x)   name of the kernel for constant 0x<x>
+ *   EC_GF_TABLE     name of the table of all 256 kernels
+ */
+
+static void EC_GF_NAME(00)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    memcpy(out, in, sizeof(uint64_t) * 8 * width);
+}
+
+static void EC_GF_NAME(01)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        out_ptr[0] ^= in_ptr[0];
+        out_ptr[width] ^= in_ptr[width];
+        out_ptr[width * 2] ^= in_ptr[width * 2];
+        out_ptr[width * 3] ^= in_ptr[width * 3];
+        out_ptr[width * 4] ^= in_ptr[width * 4];
+        out_ptr[width * 5] ^= in_ptr[width * 5];
+        out_ptr[width * 6] ^= in_ptr[width * 6];
+        out_ptr[width * 7] ^= in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(02)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in7;
+        out1 = in0;
+        out7 = in6;
+        out5 = in4;
+        out6 = in5;
+        out3 = in2 ^ in7;
+        out4 = in3 ^ in7;
+        out2 = in1 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(03)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in0 ^ in7;
+        tmp0 = in2 ^ in7;
+        out1 = in0 ^ in1;
+        out7 = in6 ^ in7;
+        out5 = in4 ^ in5;
+        out6 = in5 ^ in6;
+        out4 = in3 ^ in4 ^ in7;
+        out2 = tmp0 ^ in1;
+        out3 = tmp0 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(04)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in6;
+        out1 = in7;
+        out7 = in5;
+        out6 = in4;
+        tmp0 = in6 ^ in7;
+        out2 = in0 ^ in6;
+        out5 = in3 ^ in7;
+        out3 = tmp0 ^ in1;
+        out4 = tmp0 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(05)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in0 ^ in6;
+        out1 = in1 ^ in7;
+        out7 = in5 ^ in7;
+        out6 = in4 ^ in6;
+        out2 = out0 ^ in2;
+        out3 = out1 ^ in3 ^ in6;
+        out5 = out7 ^ in3;
+        out4 = out6 ^ in2 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(06)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in6 ^ in7;
+        tmp0 = in1 ^ in6;
+        out1 = in0 ^ in7;
+        out7 = in5 ^ in6;
+        out6 = in4 ^ in5;
+        out4 = in2 ^ in3 ^ in6;
+        out5 = in3 ^ in4 ^ in7;
+        out3 = tmp0 ^ in2;
+        out2 = tmp0 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(07)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in6;
+        tmp1 = in5 ^ in6;
+        tmp2 = in0 ^ in7;
+        tmp3 = tmp0 ^ in3;
+        out6 = tmp1 ^ in4;
+        out7 = tmp1 ^ in7;
+        out0 = tmp2 ^ in6;
+        out1 = tmp2 ^ in1;
+        out3 = tmp3 ^ in1;
+        out4 = tmp3 ^ in4;
+        out5 = out4 ^ out7 ^ in2;
+        out2 = tmp0 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(08)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in5;
+        out1 = in6;
+        out7 = in4;
+        out6 = in3 ^ in7;
+        out3 = in0 ^ in5 ^ in6;
+        out5 = in2 ^ in6 ^ in7;
+        out2 = in5 ^ in7;
+        out4 = out2 ^ in1 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(09)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in0 ^ in5;
+        tmp0 = in3 ^ in6;
+        out1 = in1 ^ in6;
+        out7 = in4 ^ in7;
+        out2 = in2 ^ in5 ^ in7;
+        out3 = tmp0 ^ out0;
+        out6 = tmp0 ^ in7;
+        out4 = out1 ^ out7 ^ in5;
+        out5 = out2 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(0A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in5 ^ in7;
+        out1 = in0 ^ in6;
+        out7 = in4 ^ in6;
+        out2 = in1 ^ in5;
+        out6 = out0 ^ in3;
+        out3 = out0 ^ out1 ^ in2;
+        out5 = out7 ^ in2 ^ in7;
+        out4 = out2 ^ in3 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(0B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        tmp1 = in0 ^ in6;
+        tmp2 = in4 ^ in7;
+        out0 = in0 ^ in5 ^ in7;
+        out2 = tmp0 ^ in1;
+        out1 = tmp1 ^ in1;
+        out6 = tmp1 ^ out0 ^ in3;
+        out7 = tmp2 ^ in6;
+        out4 = tmp2 ^ out6 ^ in1;
+        out3 = out6 ^ in0 ^ in2;
+        out5 = tmp0 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(0C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in5 ^ in6;
+        out1 = in6 ^ in7;
+        out7 = in4 ^ in5;
+        tmp0 = in1 ^ in5;
+        tmp1 = in0 ^ in7;
+        out5 = in2 ^ in3 ^ in6;
+        out6 = in3 ^ in4 ^ in7;
+        out2 = tmp1 ^ out0;
+        out4 = tmp0 ^ in2;
+        out3 = tmp0 ^ tmp1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(0D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in5;
+        tmp1 = in5 ^ in6;
+        out1 = in1 ^ in6 ^ in7;
+        out7 = tmp0 ^ in7;
+        out4 = tmp0 ^ in1 ^ in2;
+        out0 = tmp1 ^ in0;
+        tmp2 = tmp1 ^ in3;
+        out6 = tmp2 ^ out7;
+        out2 = out0 ^ in2 ^ in7;
+        out3 = out0 ^ out1 ^ in3;
+        out5 = tmp2 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(0E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in2 ^ in5;
+        tmp2 = in5 ^ in6;
+        out1 = in0 ^ in6 ^ in7;
+        out3 = tmp0 ^ tmp1;
+        out2 = tmp0 ^ tmp2;
+        tmp3 = tmp1 ^ in3;
+        out7 = tmp2 ^ in4;
+        out0 = tmp2 ^ in7;
+        out4 = tmp3 ^ in1 ^ in7;
+        out5 = tmp3 ^ out7;
+        out6 = out0 ^ out5 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(0F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in6 ^ in7;
+        tmp1 = tmp0 ^ in1;
+        tmp2 = tmp0 ^ in5;
+        out1 = tmp1 ^ in0;
+        out7 = tmp2 ^ in4;
+        out0 = tmp2 ^ in0;
+        out6 = out7 ^ in3;
+        out5 = out6 ^ in2 ^ in7;
+        tmp3 = tmp1 ^ out0 ^ in2;
+        out4 = tmp1 ^ out5;
+        out2 = tmp3 ^ in6;
+        out3 = tmp3 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(10)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in4;
+        out1 = in5;
+        out7 = in3 ^ in7;
+        tmp0 = in6 ^ in7;
+        out2 = in4 ^ in6;
+        tmp1 = out2 ^ in5;
+        out6 = tmp0 ^ in2;
+        out3 = tmp0 ^ tmp1;
+        out5 = out2 ^ out3 ^ in1;
+        out4 = tmp1 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(11)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out7 = in3;
+        out0 = in0 ^ in4;
+        out1 = in1 ^ in5;
+        out6 = in2 ^ in7;
+        out4 = in0 ^ in5 ^ in6;
+        out5 = in1 ^ in6 ^ in7;
+        out2 = in2 ^ in4 ^ in6;
+        out3 = in3 ^ in4 ^ in5 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(12)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in4 ^ in7;
+        out1 = in0 ^ in5;
+        out3 = in2 ^ in4 ^ in5;
+        tmp0 = out0 ^ in6;
+        out2 = tmp0 ^ in1;
+        tmp1 = tmp0 ^ in3;
+        out6 = tmp0 ^ out3;
+        out5 = out2 ^ in5;
+        out7 = tmp1 ^ in4;
+        out4 = tmp1 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(13)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out7 = in3 ^ in6;
+        tmp0 = in0 ^ in5;
+        tmp1 = in4 ^ in7;
+        out6 = in2 ^ in5 ^ in7;
+        out4 = tmp0 ^ out7 ^ in7;
+        out1 = tmp0 ^ in1;
+        out0 = tmp1 ^ in0;
+        out5 = tmp1 ^ in1 ^ in6;
+        out3 = tmp1 ^ out6 ^ in3;
+        out2 = out5 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(14)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in4 ^ in6;
+        out1 = in5 ^ in7;
+        out2 = in0 ^ in4;
+        tmp0 = out0 ^ in5;
+        out7 = out1 ^ in3;
+        tmp1 = out1 ^ in2;
+        out3 = tmp0 ^ in1;
+        out6 = tmp0 ^ tmp1;
+        out4 = tmp1 ^ out2;
+        out5 = out3 ^ in3 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(15)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out7 = in3 ^ in5;
+        tmp0 = in0 ^ in4;
+        out1 = in1 ^ in5 ^ in7;
+        out5 = in1 ^ in3 ^ in6;
+        out0 = tmp0 ^ in6;
+        out2 = tmp0 ^ in2;
+        out3 = out5 ^ in4 ^ in5;
+        out6 = out2 ^ in0 ^ in7;
+        out4 = tmp0 ^ out6 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(16)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in5;
+        tmp1 = in4 ^ in7;
+        tmp2 = in2 ^ in3 ^ in4;
+        out1 = tmp0 ^ in7;
+        out4 = tmp0 ^ tmp2;
+        out0 = tmp1 ^ in6;
+        tmp3 = tmp1 ^ in1;
+        out6 = out0 ^ in2 ^ in5;
+        out2 = tmp3 ^ in0;
+        out3 = out6 ^ in1;
+        out7 = tmp2 ^ out6;
+        out5 = tmp3 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(17)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        tmp1 = in3 ^ in6;
+        tmp2 = tmp0 ^ in4;
+        out4 = tmp0 ^ in0 ^ in3;
+        out7 = tmp1 ^ in5;
+        tmp3 = tmp1 ^ in1;
+        out6 = tmp2 ^ in7;
+        out5 = tmp3 ^ in4;
+        out3 = tmp3 ^ out6;
+        out0 = out3 ^ out4 ^ in1;
+        out2 = out3 ^ out7 ^ in0;
+        out1 = tmp2 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(18)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in4 ^ in5;
+        out1 = in5 ^ in6;
+        tmp0 = in4 ^ in7;
+        out5 = in1 ^ in2 ^ in5;
+        out6 = in2 ^ in3 ^ in6;
+        out2 = tmp0 ^ out1;
+        out7 = tmp0 ^ in3;
+        tmp1 = tmp0 ^ in0;
+        out3 = tmp1 ^ in6;
+        out4 = tmp1 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(19)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in1 ^ in2;
+        out7 = in3 ^ in4;
+        tmp0 = in0 ^ in7;
+        out6 = in2 ^ in3;
+        out1 = in1 ^ in5 ^ in6;
+        out0 = in0 ^ in4 ^ in5;
+        out4 = tmp0 ^ in1;
+        tmp1 = tmp0 ^ in6;
+        out2 = tmp1 ^ out0 ^ in2;
+        out3 = tmp1 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(1A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in5;
+        tmp1 = in5 ^ in6;
+        tmp2 = tmp0 ^ in1;
+        out0 = tmp0 ^ in7;
+        out1 = tmp1 ^ in0;
+        tmp3 = tmp1 ^ in3;
+        out5 = tmp2 ^ in2;
+        out2 = tmp2 ^ in6;
+        out7 = tmp3 ^ out0;
+        out6 = tmp3 ^ in2;
+        out4 = tmp3 ^ out2 ^ in0;
+        out3 = tmp0 ^ out1 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(1B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in4;
+        tmp1 = in2 ^ in5;
+        tmp2 = in3 ^ in6;
+        out5 = tmp0 ^ in1;
+        tmp3 = tmp0 ^ in0;
+        out6 = tmp1 ^ in3;
+        out0 = tmp1 ^ tmp3 ^ in7;
+        out7 = tmp2 ^ in4;
+        tmp4 = out5 ^ in6;
+        out3 = tmp2 ^ tmp3;
+        out2 = tmp4 ^ in5;
+        out4 = tmp4 ^ out3;
+        out1 = tmp3 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(1C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        tmp1 = in4 ^ in6;
+        tmp2 = in5 ^ in7;
+        out6 = tmp0 ^ tmp1;
+        out0 = tmp1 ^ in5;
+        out1 = tmp2 ^ in6;
+        tmp3 = tmp2 ^ in1;
+        tmp4 = tmp2 ^ in4;
+        out2 = tmp4 ^ in0;
+        out7 = tmp4 ^ in3;
+        out5 = tmp0 ^ tmp3;
+        out3 = tmp3 ^ out2;
+        out4 = out3 ^ in2 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(1D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in3;
+        tmp1 = in0 ^ in4;
+        tmp2 = in3 ^ in4;
+        tmp3 = in2 ^ in7;
+        out3 = tmp0 ^ tmp1;
+        out5 = tmp0 ^ tmp3;
+        tmp4 = tmp1 ^ in5;
+        out6 = tmp2 ^ in2;
+        out7 = tmp2 ^ in5;
+        out2 = tmp3 ^ tmp4;
+        out4 = out3 ^ out6 ^ in6;
+        out0 = tmp4 ^ in6;
+        out1 = out2 ^ out4 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(1E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in4;
+        tmp1 = in2 ^ in7;
+        tmp2 = tmp0 ^ in1;
+        out3 = tmp1 ^ tmp2;
+        out2 = tmp2 ^ in5;
+        out4 = out3 ^ in3 ^ in6;
+        tmp3 = out4 ^ in7;
+        out6 = tmp3 ^ out2 ^ in4;
+        out7 = tmp1 ^ out6;
+        out0 = out7 ^ in3;
+        out1 = tmp0 ^ out0;
+        out5 = tmp3 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(1F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in6;
+        tmp1 = tmp0 ^ in5;
+        out7 = tmp1 ^ in3;
+        out0 = tmp1 ^ in0 ^ in7;
+        out6 = out7 ^ in2 ^ in6;
+        out1 = out0 ^ in1 ^ in4;
+        out4 = out0 ^ out6 ^ in1;
+        out3 = tmp0 ^ out4;
+        out2 = out4 ^ out7 ^ in7;
+        out5 = out3 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(20)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in4;
+        out0 = in3 ^ in7;
+        tmp0 = in3 ^ in4;
+        tmp1 = in6 ^ in7;
+        out2 = out0 ^ in5;
+        out4 = tmp0 ^ in5;
+        out3 = tmp0 ^ tmp1;
+        out7 = tmp1 ^ in2;
+        out6 = tmp1 ^ in1 ^ in5;
+        out5 = out2 ^ out3 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(21)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in1 ^ in4;
+        tmp0 = in4 ^ in6;
+        out4 = in3 ^ in5;
+        out7 = in2 ^ in6;
+        out0 = in0 ^ in3 ^ in7;
+        out6 = in1 ^ in5 ^ in7;
+        out3 = tmp0 ^ in7;
+        out5 = tmp0 ^ in0;
+        out2 = out4 ^ in2 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(22)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in3;
+        out1 = in0 ^ in4;
+        out7 = in2 ^ in7;
+        out4 = in4 ^ in5 ^ in7;
+        out5 = in0 ^ in5 ^ in6;
+        out6 = in1 ^ in6 ^ in7;
+        out3 = in2 ^ in3 ^ in4 ^ in6;
+        out2 = in1 ^ in3 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(23)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out7 = in2;
+        out0 = in0 ^ in3;
+        out4 = in5 ^ in7;
+        out5 = in0 ^ in6;
+        out6 = in1 ^ in7;
+        out3 = in2 ^ in4 ^ in6;
+        out1 = in0 ^ in1 ^ in4;
+        out2 = out4 ^ out6 ^ in2 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(24)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in4 ^ in7;
+        tmp0 = in3 ^ in4;
+        out0 = in3 ^ in6 ^ in7;
+        out3 = tmp0 ^ in1;
+        tmp1 = out0 ^ in5;
+        out6 = tmp1 ^ out3;
+        out2 = tmp1 ^ in0;
+        out7 = tmp1 ^ in2 ^ in3;
+        out5 = out2 ^ in4;
+        out4 = tmp0 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(25)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in1 ^ in4;
+        tmp0 = in2 ^ in5;
+        out1 = out3 ^ in7;
+        out7 = tmp0 ^ in6;
+        out6 = out1 ^ in5;
+        out4 = out7 ^ in3 ^ in7;
+        out2 = out4 ^ in0;
+        out0 = tmp0 ^ out2;
+        out5 = out0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(26)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in3 ^ in6;
+        tmp0 = in4 ^ in7;
+        out7 = in2 ^ in5 ^ in7;
+        tmp1 = out0 ^ in0 ^ in5;
+        out1 = tmp0 ^ in0;
+        tmp2 = tmp0 ^ in6;
+        out2 = tmp1 ^ in1;
+        out5 = tmp1 ^ in7;
+        out6 = tmp2 ^ in1;
+        out4 = tmp2 ^ out7;
+        out3 = out0 ^ out6 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(27)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out7 = in2 ^ in5;
+        out0 = in0 ^ in3 ^ in6;
+        out6 = in1 ^ in4 ^ in7;
+        out4 = out7 ^ in6;
+        out2 = out0 ^ out7 ^ in1;
+        out5 = out0 ^ in7;
+        out1 = out6 ^ in0;
+        out3 = out6 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(28)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in3;
+        out1 = in4 ^ in6;
+        out0 = in3 ^ in5 ^ in7;
+        tmp0 = out1 ^ in7;
+        tmp1 = out0 ^ in4;
+        out7 = tmp0 ^ in2;
+        tmp2 = tmp0 ^ in1;
+        out3 = tmp1 ^ in0;
+        out6 = tmp1 ^ tmp2;
+        out4 = tmp2 ^ in3;
+        out5 = out3 ^ in2 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(29)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in2 ^ in3;
+        tmp0 = in1 ^ in3;
+        tmp1 = in4 ^ in6;
+        tmp2 = in0 ^ in4 ^ in7;
+        out6 = tmp0 ^ in5;
+        out4 = tmp0 ^ in6 ^ in7;
+        out1 = tmp1 ^ in1;
+        out7 = tmp1 ^ in2;
+        out3 = tmp2 ^ in5;
+        out5 = tmp2 ^ in2;
+        out0 = out3 ^ in3 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(2A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in3 ^ in5;
+        tmp0 = in1 ^ in3;
+        tmp1 = in0 ^ in4;
+        out7 = in2 ^ in4 ^ in7;
+        out3 = tmp1 ^ out0 ^ in2;
+        out2 = tmp0 ^ in7;
+        out6 = tmp0 ^ in6;
+        out1 = tmp1 ^ in6;
+        out5 = tmp1 ^ out7 ^ in5;
+        out4 = out1 ^ in0 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(2B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in1 ^ in6;
+        out7 = in2 ^ in4;
+        tmp0 = in0 ^ in5;
+        tmp1 = in2 ^ in7;
+        out6 = in1 ^ in3;
+        out1 = out4 ^ in0 ^ in4;
+        out3 = tmp0 ^ out7;
+        out0 = tmp0 ^ in3;
+        out5 = tmp1 ^ in0;
+        out2 = tmp1 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(2C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        tmp1 = in2 ^ in3 ^ in4;
+        tmp2 = tmp0 ^ in6;
+        out4 = tmp1 ^ in1;
+        out5 = tmp1 ^ in0 ^ in5;
+        tmp3 = tmp2 ^ in4;
+        out6 = tmp2 ^ out4;
+        out7 = tmp3 ^ in7;
+        out2 = tmp3 ^ out5;
+        out3 = out6 ^ in0;
+        out0 = tmp1 ^ out7;
+        out1 = tmp0 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(2D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        out4 = tmp0 ^ in1;
+        tmp1 = tmp0 ^ in0;
+        out2 = tmp1 ^ in6;
+        out5 = tmp1 ^ in4;
+        tmp2 = out2 ^ in2;
+        tmp3 = tmp2 ^ in5;
+        out0 = tmp3 ^ in7;
+        out7 = tmp3 ^ out5;
+        out6 = out4 ^ out7 ^ in6;
+        out3 = tmp2 ^ out6;
+        out1 = out0 ^ out6 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(2E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in7;
+        out0 = in3 ^ in5 ^ in6;
+        tmp1 = tmp0 ^ in0;
+        tmp2 = tmp0 ^ in2;
+        out1 = tmp1 ^ in6;
+        out4 = tmp2 ^ in1;
+        out7 = tmp2 ^ in5;
+        out3 = out0 ^ out4 ^ in0;
+        out2 = out3 ^ out7 ^ in7;
+        out6 = tmp1 ^ out2;
+        out5 = tmp1 ^ out7 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(2F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = in2 ^ in5;
+        out4 = in1 ^ in2 ^ in7;
+        out6 = in1 ^ in3 ^ in4;
+        out5 = tmp0 ^ in2;
+        tmp2 = tmp0 ^ in6;
+        out7 = tmp1 ^ in4;
+        out0 = tmp2 ^ in5;
+        out2 = tmp2 ^ out4;
+        out1 = tmp2 ^ out6 ^ in7;
+        out3 = tmp1 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(30)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in4 ^ in5;
+        tmp0 = in3 ^ in6;
+        tmp1 = in4 ^ in7;
+        out6 = in1 ^ in2 ^ in5;
+        out3 = tmp0 ^ in5;
+        out4 = tmp0 ^ in0;
+        out7 = tmp0 ^ in2;
+        out0 = tmp1 ^ in3;
+        out2 = tmp1 ^ out3;
+        out5 = tmp1 ^ in0 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(31)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in5 ^ in6;
+        tmp0 = in4 ^ in5;
+        tmp1 = in0 ^ in3 ^ in4;
+        tmp2 = out3 ^ in2;
+        out1 = tmp0 ^ in1;
+        out0 = tmp1 ^ in7;
+        out4 = tmp1 ^ in6;
+        out6 = tmp2 ^ in1;
+        out2 = tmp2 ^ out0 ^ in0;
+        out5 = out1 ^ in0 ^ in7;
+        out7 = tmp0 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(32)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in3 ^ in4;
+        out7 = in2 ^ in3;
+        tmp0 = in5 ^ in6;
+        tmp1 = in0 ^ in7;
+        out6 = in1 ^ in2;
+        out1 = in0 ^ in4 ^ in5;
+        out2 = tmp0 ^ out0 ^ in1;
+        out3 = tmp0 ^ out7 ^ in7;
+        out4 = tmp1 ^ in6;
+        out5 = tmp1 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(33)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        tmp1 = in0 ^ in4;
+        tmp2 = in1 ^ in5;
+        out6 = in1 ^ in2 ^ in6;
+        out7 = tmp0 ^ in7;
+        out0 = tmp1 ^ in3;
+        out1 = tmp1 ^ tmp2;
+        tmp3 = tmp2 ^ in7;
+        tmp4 = tmp2 ^ in4 ^ in6;
+        out5 = tmp3 ^ in0;
+        out3 = tmp3 ^ out6;
+        out4 = tmp4 ^ out5;
+        out2 = tmp0 ^ tmp4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(34)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in4;
+        tmp1 = in4 ^ in5;
+        tmp2 = tmp0 ^ in1;
+        tmp3 = tmp0 ^ in6;
+        out1 = tmp1 ^ in7;
+        tmp4 = tmp1 ^ in2;
+        out5 = tmp2 ^ in0;
+        out3 = tmp2 ^ out1;
+        out0 = tmp3 ^ in7;
+        out7 = tmp3 ^ tmp4;
+        out6 = tmp4 ^ in1;
+        out2 = out3 ^ out5 ^ in3;
+        out4 = tmp4 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(35)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in6;
+        tmp1 = in5 ^ in7;
+        out7 = tmp0 ^ tmp1 ^ in3;
+        out3 = tmp1 ^ in1;
+        out1 = out3 ^ in4;
+        tmp2 = out1 ^ in7;
+        out5 = tmp2 ^ in0 ^ in3;
+        out6 = tmp0 ^ tmp2;
+        out0 = out3 ^ out5 ^ in6;
+        out4 = tmp0 ^ out0;
+        out2 = out4 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(36)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in0 ^ in2;
+        tmp0 = in1 ^ in3;
+        out0 = in3 ^ in4 ^ in6;
+        out6 = in1 ^ in2 ^ in4;
+        out5 = tmp0 ^ in0;
+        tmp1 = out5 ^ in5;
+        out2 = tmp1 ^ in4;
+        out3 = tmp1 ^ out4;
+        out1 = tmp0 ^ out2 ^ in7;
+        out7 = out3 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(37)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = in2 ^ in4;
+        tmp2 = tmp0 ^ in6;
+        out3 = tmp0 ^ in5;
+        out4 = tmp1 ^ in0;
+        out6 = tmp2 ^ in4;
+        out1 = out3 ^ out4 ^ in7;
+        tmp3 = out4 ^ in1 ^ in3;
+        out7 = tmp3 ^ out1;
+        out2 = tmp3 ^ in5;
+        out5 = tmp1 ^ out2;
+        out0 = tmp2 ^ tmp3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(38)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0 ^ in3;
+        tmp0 = in3 ^ in4;
+        tmp1 = in5 ^ in7;
+        tmp2 = out3 ^ in1;
+        out2 = tmp0 ^ in6;
+        out0 = tmp0 ^ tmp1;
+        out4 = tmp1 ^ tmp2;
+        out7 = out2 ^ in2;
+        out1 = out2 ^ in3 ^ in5;
+        out6 = out4 ^ in0 ^ in2;
+        out5 = tmp2 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(39)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0;
+        tmp0 = in1 ^ in5;
+        tmp1 = tmp0 ^ in4;
+        out1 = tmp1 ^ in6;
+        out5 = out1 ^ in0 ^ in2;
+        tmp2 = tmp0 ^ out5;
+        out2 = tmp2 ^ in0 ^ in3;
+        out7 = out2 ^ in7;
+        out6 = tmp1 ^ out7;
+        out4 = tmp2 ^ out6;
+        out0 = out4 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(3A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in0 ^ in2;
+        tmp2 = in3 ^ in4;
+        tmp3 = in1 ^ in6;
+        tmp4 = in3 ^ in7;
+        out4 = tmp0 ^ in5;
+        out5 = tmp1 ^ tmp3;
+        out3 = tmp1 ^ tmp4;
+        out0 = tmp2 ^ in5;
+        out7 = tmp2 ^ in2;
+        tmp5 = tmp3 ^ in4;
+        out2 = tmp4 ^ tmp5;
+        out1 = tmp5 ^ out4;
+        out6 = tmp0 ^ out3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(3B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in6;
+        tmp1 = in2 ^ in7;
+        tmp2 = tmp0 ^ in3;
+        out3 = tmp1 ^ in0;
+        out6 = tmp1 ^ tmp2;
+        out2 = out6 ^ in4;
+        out7 = tmp0 ^ out2;
+        out0 = out3 ^ out7 ^ in5;
+        out5 = out0 ^ out2 ^ in7;
+        out1 = tmp2 ^ out0;
+        out4 = out1 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(3C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = in2 ^ in7;
+        tmp2 = in1 ^ in6 ^ in7;
+        out2 = tmp0 ^ in4;
+        out3 = tmp0 ^ tmp2;
+        out4 = tmp1 ^ out3 ^ in5;
+        out5 = tmp2 ^ out2 ^ in2;
+        out1 = out4 ^ out5 ^ in6;
+        out0 = out1 ^ in3;
+        out7 = tmp1 ^ out0;
+        out6 = tmp2 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(3D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in2;
+        tmp1 = tmp0 ^ in3;
+        out2 = tmp1 ^ in4;
+        tmp2 = out2 ^ in5;
+        out4 = tmp2 ^ in1 ^ in6;
+        out5 = out4 ^ in7;
+        out6 = out5 ^ in0;
+        out7 = out6 ^ in1;
+        out0 = tmp0 ^ out7;
+        out1 = tmp1 ^ out5;
+        out3 = tmp2 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(3E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in5;
+        tmp1 = tmp0 ^ in4;
+        out0 = tmp1 ^ in6;
+        out7 = tmp1 ^ in2;
+        out6 = out7 ^ in1 ^ in5 ^ in7;
+        out2 = out6 ^ in0 ^ in2;
+        out4 = out0 ^ out6 ^ in0;
+        out5 = tmp0 ^ out4;
+        out3 = out5 ^ in7;
+        out1 = out3 ^ out6 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(3F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        out3 = tmp0 ^ in2 ^ in6;
+        tmp1 = out3 ^ in5 ^ in7;
+        out4 = tmp1 ^ in4;
+        out5 = tmp1 ^ in3;
+        out1 = out4 ^ in2;
+        out7 = out1 ^ out3 ^ in3;
+        out2 = tmp0 ^ out7 ^ in5;
+        tmp2 = out2 ^ in0;
+        out6 = tmp2 ^ in6;
+        out0 = tmp1 ^ tmp2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(40)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in3 ^ in7;
+        tmp0 = in3 ^ in4;
+        tmp1 = in6 ^ in7;
+        out4 = tmp0 ^ in2;
+        out5 = tmp0 ^ in5;
+        out0 = tmp1 ^ in2;
+        out7 = tmp1 ^ in1 ^ in5;
+        out2 = out0 ^ in4;
+        out3 = out2 ^ out5 ^ in7;
+        out6 = out3 ^ out4 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(41)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in2 ^ in3;
+        tmp0 = in5 ^ in6;
+        tmp1 = in6 ^ in7;
+        out5 = in3 ^ in4;
+        out1 = in1 ^ in3 ^ in7;
+        out6 = in0 ^ in4 ^ in5;
+        out3 = tmp0 ^ in2;
+        out7 = tmp0 ^ in1;
+        out2 = tmp1 ^ in4;
+        out0 = tmp1 ^ in0 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(42)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in2 ^ in6;
+        out5 = in3 ^ in5;
+        out1 = in0 ^ in3 ^ in7;
+        out7 = in1 ^ in5 ^ in7;
+        out4 = in2 ^ in4 ^ in7;
+        out6 = in0 ^ in4 ^ in6;
+        out2 = out0 ^ in1 ^ in4;
+        out3 = out5 ^ in6 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(43)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in3;
+        out7 = in1 ^ in5;
+        out4 = in2 ^ in7;
+        out6 = in0 ^ in4;
+        out0 = in0 ^ in2 ^ in6;
+        out3 = in5 ^ in6 ^ in7;
+        out2 = in1 ^ in4 ^ in6;
+        out1 = in0 ^ in1 ^ in3 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(44)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in3;
+        out0 = in2 ^ in7;
+        tmp0 = in4 ^ in7;
+        out7 = in1 ^ in6 ^ in7;
+        out6 = in0 ^ in5 ^ in6;
+        out4 = tmp0 ^ in3 ^ in6;
+        out3 = out0 ^ in1 ^ in3 ^ in5;
+        out2 = out0 ^ in0 ^ in4;
+        out5 = tmp0 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(45)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in1 ^ in3;
+        out7 = in1 ^ in6;
+        out5 = in4 ^ in7;
+        out6 = in0 ^ in5;
+        out0 = in0 ^ in2 ^ in7;
+        out4 = in3 ^ in6 ^ in7;
+        out2 = out5 ^ in0;
+        out3 = out0 ^ out6 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(46)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in2;
+        out1 = in0 ^ in3;
+        out7 = in1 ^ in7;
+        out4 = in4 ^ in6;
+        out5 = in5 ^ in7;
+        out6 = in0 ^ in6;
+        out3 = in1 ^ in3 ^ in5;
+        out2 = out4 ^ out6 ^ in1 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(47)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in6;
+        out7 = in1;
+        out5 = in7;
+        out6 = in0;
+        tmp0 = in0 ^ in1;
+        out3 = in1 ^ in5;
+        out0 = in0 ^ in2;
+        out1 = tmp0 ^ in3;
+        out2 = tmp0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(48)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        out1 = in3 ^ in6 ^ in7;
+        out3 = tmp0 ^ in0;
+        out0 = tmp0 ^ out1 ^ in5;
+        tmp1 = out0 ^ in4;
+        out2 = tmp1 ^ in7;
+        out5 = tmp1 ^ in3;
+        out4 = out5 ^ in1;
+        out7 = tmp0 ^ out4;
+        out6 = tmp1 ^ out3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(49)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0 ^ in2;
+        tmp0 = in2 ^ in5;
+        out2 = in4 ^ in5 ^ in6;
+        tmp1 = tmp0 ^ out2 ^ in3;
+        out7 = out2 ^ in1;
+        out5 = tmp1 ^ in7;
+        out4 = out5 ^ out7 ^ in6;
+        out1 = tmp0 ^ out4;
+        out6 = out1 ^ out7 ^ in0;
+        out0 = tmp1 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(4A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in6;
+        tmp1 = in3 ^ in7;
+        out0 = tmp0 ^ in5;
+        out3 = tmp1 ^ in0;
+        out5 = tmp1 ^ out0;
+        out4 = out0 ^ in1 ^ in4;
+        out1 = out3 ^ in6;
+        out2 = out4 ^ in7;
+        out6 = out1 ^ in4;
+        out7 = tmp0 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(4B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0 ^ in7;
+        tmp0 = in1 ^ in5;
+        tmp1 = in2 ^ in6;
+        tmp2 = out3 ^ in3;
+        out7 = tmp0 ^ in4;
+        out4 = tmp0 ^ tmp1;
+        tmp3 = tmp1 ^ in0;
+        out6 = tmp2 ^ in4;
+        out5 = tmp2 ^ tmp3;
+        out1 = tmp2 ^ in1 ^ in6;
+        out2 = out7 ^ in6 ^ in7;
+        out0 = tmp3 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(4C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in3 ^ in6;
+        tmp0 = in2 ^ in5;
+        tmp1 = out1 ^ in5 ^ in7;
+        out0 = tmp0 ^ in7;
+        tmp2 = tmp0 ^ in4;
+        out6 = tmp1 ^ in0;
+        out2 = tmp2 ^ in0;
+        out5 = tmp2 ^ in6;
+        out3 = tmp0 ^ out6 ^ in1;
+        out7 = out0 ^ out5 ^ in1;
+        out4 = tmp1 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(4D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in5;
+        tmp1 = in1 ^ in6;
+        out4 = in1 ^ in3 ^ in5;
+        tmp2 = tmp0 ^ in7;
+        out2 = tmp0 ^ in4;
+        out1 = tmp1 ^ in3;
+        out7 = tmp1 ^ in4;
+        out0 = tmp2 ^ in2;
+        out6 = tmp2 ^ in3;
+        out5 = out7 ^ in1 ^ in2;
+        out3 = tmp1 ^ out0 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(4E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in2 ^ in5;
+        out7 = in1 ^ in4 ^ in7;
+        out1 = in0 ^ in3 ^ in6;
+        out5 = out0 ^ in6;
+        out4 = out7 ^ in5;
+        out3 = out1 ^ in1;
+        out6 = out1 ^ in7;
+        out2 = out4 ^ in0 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(4F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in2 ^ in6;
+        out7 = in1 ^ in4;
+        out3 = in0 ^ in1 ^ in6;
+        out4 = in1 ^ in5 ^ in7;
+        out0 = in0 ^ in2 ^ in5;
+        out6 = in0 ^ in3 ^ in7;
+        out1 = out3 ^ in3;
+        out2 = out4 ^ in0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(50)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in2 ^ in7;
+        tmp0 = in3 ^ in5;
+        out0 = out2 ^ in4 ^ in6;
+        out1 = tmp0 ^ in7;
+        tmp1 = tmp0 ^ in6;
+        out3 = out0 ^ in3;
+        out7 = tmp1 ^ in1;
+        tmp2 = tmp1 ^ in0;
+        out5 = out3 ^ in1 ^ in2;
+        out4 = tmp2 ^ in2;
+        out6 = tmp2 ^ out3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(51)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in7;
+        out3 = in2 ^ in4 ^ in6 ^ in7;
+        out0 = out3 ^ in0;
+        out6 = out0 ^ in5;
+        out4 = out6 ^ in3 ^ in7;
+        out1 = out0 ^ out4 ^ in1;
+        out7 = out1 ^ in6;
+        out5 = out7 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(52)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in1 ^ in2;
+        tmp0 = in2 ^ in4;
+        tmp1 = in3 ^ in5;
+        tmp2 = in3 ^ in6;
+        tmp3 = in0 ^ in7;
+        out0 = tmp0 ^ in6;
+        out6 = tmp0 ^ tmp3;
+        out7 = tmp1 ^ in1;
+        out1 = tmp1 ^ tmp3;
+        out3 = tmp2 ^ in4;
+        out5 = tmp2 ^ in1 ^ in7;
+        out4 = tmp2 ^ out1 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(53)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in1;
+        out3 = in4 ^ in6;
+        out0 = out3 ^ in0 ^ in2;
+        out6 = out0 ^ in7;
+        out4 = out6 ^ in5;
+        out7 = out0 ^ out4 ^ in1 ^ in3;
+        out1 = out7 ^ in0;
+        out5 = out7 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(54)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in3 ^ in5;
+        tmp0 = in1 ^ in3;
+        tmp1 = in2 ^ in4;
+        tmp2 = in0 ^ in7;
+        out5 = in1 ^ in4 ^ in6;
+        out4 = tmp2 ^ out1;
+        out7 = tmp0 ^ in6;
+        out3 = tmp0 ^ tmp1;
+        out0 = tmp1 ^ in7;
+        tmp3 = tmp2 ^ in2;
+        out2 = tmp3 ^ in6;
+        out6 = tmp3 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(55)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in3;
+        tmp1 = in1 ^ in4;
+        tmp2 = in6 ^ in7;
+        out7 = tmp0 ^ tmp2;
+        out1 = tmp0 ^ in5;
+        out3 = tmp1 ^ in2;
+        out5 = tmp1 ^ in5 ^ in6;
+        out2 = tmp2 ^ in0;
+        out4 = out5 ^ out7 ^ in0;
+        out6 = out2 ^ in2 ^ in5;
+        out0 = out5 ^ out6 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(56)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in2 ^ in4;
+        tmp0 = in0 ^ in2;
+        out4 = in0 ^ in5;
+        out7 = in1 ^ in3;
+        out5 = in1 ^ in6;
+        out6 = tmp0 ^ in7;
+        out2 = tmp0 ^ out5;
+        out1 = out4 ^ in3;
+        out3 = out7 ^ in4 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(57)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in5;
+        tmp1 = in1 ^ in7;
+        out0 = in0 ^ in2 ^ in4;
+        out5 = in1 ^ in5 ^ in6;
+        out4 = tmp0 ^ in4;
+        out1 = tmp0 ^ in1 ^ in3;
+        out2 = tmp0 ^ out5;
+        out3 = tmp1 ^ in4;
+        out7 = tmp1 ^ in3;
+        out6 = tmp1 ^ out2 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(58)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in2 ^ in5;
+        tmp0 = in2 ^ in3 ^ in4;
+        out5 = tmp0 ^ in1;
+        out6 = tmp0 ^ in0 ^ in5;
+        out3 = out6 ^ in7;
+        tmp1 = out2 ^ out5;
+        out7 = tmp1 ^ in6;
+        out4 = tmp1 ^ out3 ^ in3;
+        out0 = out4 ^ out7 ^ in0;
+        out1 = tmp0 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(59)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in5;
+        tmp0 = in0 ^ in5 ^ in7;
+        out3 = tmp0 ^ in2 ^ in4;
+        out0 = out3 ^ in6;
+        tmp1 = out0 ^ in7;
+        out6 = tmp1 ^ in3;
+        out5 = out6 ^ in0 ^ in1 ^ in6;
+        out4 = tmp0 ^ out5;
+        out1 = tmp1 ^ out4;
+        out7 = out1 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(5A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = in2 ^ in5;
+        out5 = tmp0 ^ in3;
+        out4 = tmp0 ^ in0;
+        tmp2 = tmp1 ^ in4;
+        out2 = tmp1 ^ in1 ^ in7;
+        out7 = tmp2 ^ out5;
+        out6 = out4 ^ out7 ^ in5;
+        out0 = tmp2 ^ in6;
+        out1 = out0 ^ out6 ^ in7;
+        out3 = tmp1 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(5B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        tmp1 = in0 ^ in4;
+        tmp2 = in1 ^ in5;
+        out5 = tmp0 ^ tmp2;
+        tmp3 = tmp1 ^ in6;
+        out3 = tmp1 ^ in5;
+        out2 = tmp2 ^ in7;
+        tmp4 = out3 ^ in2;
+        out7 = out2 ^ in3 ^ in4;
+        out0 = tmp4 ^ in6;
+        out6 = tmp0 ^ tmp3;
+        out4 = tmp2 ^ tmp4;
+        out1 = tmp3 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(5C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in6;
+        tmp1 = in0 ^ in2 ^ in5;
+        out1 = tmp0 ^ in5;
+        tmp2 = tmp0 ^ in1;
+        out2 = tmp1 ^ in6;
+        out6 = tmp1 ^ in3;
+        out4 = tmp2 ^ in0;
+        out7 = tmp2 ^ in4;
+        out3 = tmp1 ^ out7;
+        out0 = out3 ^ out4 ^ in7;
+        out5 = out0 ^ in1 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(5D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in0 ^ in6;
+        out2 = tmp1 ^ in5;
+        tmp2 = out2 ^ in3;
+        out6 = tmp2 ^ in2;
+        out1 = tmp0 ^ tmp2;
+        tmp3 = out1 ^ in4 ^ in5;
+        out4 = tmp3 ^ in0;
+        out7 = tmp3 ^ in7;
+        tmp4 = out4 ^ out6;
+        out5 = tmp4 ^ in7;
+        out0 = tmp0 ^ out5;
+        out3 = tmp1 ^ tmp4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(5E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        tmp1 = in3 ^ in5;
+        tmp2 = in1 ^ in7;
+        out7 = in1 ^ in3 ^ in4;
+        out0 = tmp0 ^ in4;
+        tmp3 = tmp1 ^ in0;
+        out5 = tmp2 ^ in2;
+        out1 = tmp3 ^ in6;
+        out6 = tmp0 ^ tmp3;
+        tmp4 = tmp2 ^ out1;
+        out3 = tmp4 ^ in4;
+        out4 = tmp1 ^ tmp4;
+        out2 = tmp0 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(5F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in5;
+        tmp1 = in0 ^ in6;
+        tmp2 = tmp0 ^ in7;
+        tmp3 = tmp1 ^ in3;
+        out2 = tmp1 ^ tmp2;
+        out5 = tmp2 ^ in2;
+        out6 = tmp3 ^ in2;
+        out3 = out2 ^ in4;
+        out4 = out3 ^ in5;
+        out1 = tmp0 ^ tmp3;
+        out7 = tmp3 ^ out4;
+        out0 = out4 ^ out5 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(60)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in2 ^ in5;
+        tmp0 = in3 ^ in6;
+        out1 = in3 ^ in4 ^ in7;
+        out7 = out4 ^ in1;
+        tmp1 = out4 ^ in4;
+        out0 = tmp0 ^ in2;
+        out5 = tmp0 ^ in0;
+        out2 = tmp0 ^ tmp1;
+        out3 = tmp1 ^ in7;
+        out6 = out3 ^ out7 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(61)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        out4 = tmp0 ^ in4;
+        tmp1 = out4 ^ in3;
+        out3 = tmp1 ^ in7;
+        out2 = tmp1 ^ in2 ^ in6;
+        out1 = tmp0 ^ out3 ^ in1;
+        out0 = out2 ^ out4 ^ in0;
+        out7 = tmp1 ^ out1;
+        out6 = out0 ^ out1 ^ in2;
+        out5 = tmp0 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(62)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in4 ^ in5;
+        tmp0 = in0 ^ in3 ^ in4;
+        out1 = tmp0 ^ in7;
+        out5 = tmp0 ^ in6;
+        tmp1 = out1 ^ in0;
+        tmp2 = tmp1 ^ out3;
+        out4 = tmp2 ^ in2;
+        tmp3 = tmp2 ^ in1;
+        out0 = out4 ^ in5 ^ in6;
+        out7 = tmp3 ^ out0;
+        out6 = tmp0 ^ tmp3;
+        out2 = tmp1 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(63)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in4;
+        tmp1 = in1 ^ in7;
+        out3 = tmp0 ^ in5;
+        tmp2 = out3 ^ in6;
+        out4 = out3 ^ in2 ^ in7;
+        out5 = tmp2 ^ in0;
+        tmp3 = out5 ^ in3;
+        out0 = tmp3 ^ out4;
+        out2 = tmp1 ^ tmp2;
+        out6 = tmp1 ^ tmp3;
+        tmp4 = tmp0 ^ out2;
+        out1 = tmp4 ^ out5;
+        out7 = tmp4 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(64)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in2 ^ in3;
+        out1 = in3 ^ in4;
+        out7 = in1 ^ in2;
+        tmp0 = in4 ^ in5;
+        tmp1 = in0 ^ in7;
+        out4 = in5 ^ in6 ^ in7;
+        out2 = tmp0 ^ out0 ^ in0;
+        out3 = tmp0 ^ out7 ^ in6;
+        out5 = tmp1 ^ in6;
+        out6 = tmp1 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(65)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = in4 ^ in5;
+        tmp2 = in6 ^ in7;
+        out7 = in1 ^ in2 ^ in7;
+        out1 = in1 ^ in3 ^ in4;
+        out0 = tmp0 ^ in2;
+        out2 = tmp0 ^ tmp1;
+        out4 = tmp1 ^ tmp2;
+        tmp3 = tmp2 ^ in0;
+        out3 = out4 ^ out7 ^ in3;
+        out5 = tmp3 ^ in5;
+        out6 = tmp3 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(66)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = in2 ^ in3;
+        tmp2 = in0 ^ in4;
+        out7 = tmp0 ^ in6;
+        out0 = tmp1 ^ in7;
+        out1 = tmp2 ^ in3;
+        tmp3 = tmp2 ^ in6;
+        tmp4 = out1 ^ in5;
+        out5 = tmp3 ^ in7;
+        out4 = tmp3 ^ tmp4;
+        out2 = tmp0 ^ tmp4 ^ in7;
+        out6 = tmp1 ^ out2 ^ in4;
+        out3 = tmp3 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(67)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = tmp0 ^ in1;
+        tmp2 = tmp0 ^ in7;
+        out1 = tmp1 ^ in4;
+        out0 = tmp2 ^ in2;
+        tmp3 = out1 ^ in7;
+        out2 = tmp3 ^ in5;
+        out3 = out2 ^ in0 ^ in6;
+        out7 = tmp1 ^ out0 ^ in6;
+        out5 = tmp1 ^ out3;
+        out4 = tmp2 ^ out5;
+        out6 = tmp3 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(68)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in4;
+        tmp1 = in2 ^ in3 ^ in5;
+        tmp2 = tmp0 ^ in1;
+        tmp3 = tmp0 ^ in6;
+        out0 = tmp1 ^ in6;
+        out6 = tmp2 ^ in0;
+        out7 = tmp1 ^ tmp2;
+        out1 = tmp3 ^ in7;
+        out2 = out1 ^ in2;
+        out4 = tmp2 ^ out2;
+        out3 = out4 ^ out6 ^ in3;
+        out5 = tmp3 ^ out3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(69)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in6 ^ in7;
+        out2 = tmp0 ^ in3 ^ in4;
+        out1 = out2 ^ in1;
+        out3 = out2 ^ in0 ^ in2;
+        out4 = out1 ^ in2 ^ in3;
+        out6 = out1 ^ in0 ^ in7;
+        out7 = out4 ^ in5 ^ in6;
+        out5 = out4 ^ out6 ^ in5;
+        out0 = tmp0 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(6A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in6;
+        out3 = in0 ^ in4 ^ in6;
+        tmp1 = tmp0 ^ in3;
+        out4 = tmp1 ^ in1;
+        tmp2 = tmp1 ^ in7;
+        out2 = out4 ^ in4;
+        out0 = tmp2 ^ in5;
+        out5 = tmp2 ^ out3;
+        out7 = out2 ^ in3 ^ in5;
+        out1 = tmp0 ^ out5;
+        out6 = tmp1 ^ out7 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(6B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in6;
+        out2 = tmp0 ^ in1 ^ in3;
+        out4 = out2 ^ in2;
+        tmp1 = out2 ^ in0;
+        out7 = out4 ^ in3 ^ in5 ^ in7;
+        out1 = tmp1 ^ in7;
+        out3 = tmp1 ^ in1;
+        out6 = tmp1 ^ in5;
+        out0 = tmp1 ^ out7 ^ in6;
+        out5 = tmp0 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(6C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in1;
+        tmp0 = in2 ^ in3;
+        out5 = in0 ^ in2;
+        out1 = in3 ^ in4 ^ in6;
+        tmp1 = out5 ^ in1;
+        out0 = tmp0 ^ in5;
+        out6 = tmp0 ^ tmp1;
+        out3 = tmp1 ^ in4;
+        out7 = out3 ^ in0;
+        out2 = out6 ^ out7 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(6D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in1 ^ in4;
+        tmp0 = in0 ^ in2;
+        tmp1 = out4 ^ in3;
+        out7 = out4 ^ in2 ^ in7;
+        out5 = tmp0 ^ in5;
+        out3 = tmp0 ^ tmp1;
+        out1 = tmp1 ^ in6;
+        out0 = out5 ^ in3;
+        out2 = out3 ^ out7 ^ in4;
+        out6 = out1 ^ in0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(6E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in3;
+        tmp1 = in0 ^ in4;
+        out4 = tmp0 ^ in7;
+        out6 = tmp0 ^ in0 ^ in5;
+        out5 = tmp1 ^ in2;
+        tmp2 = tmp1 ^ in3;
+        out3 = tmp2 ^ out4;
+        out1 = tmp2 ^ in6;
+        out2 = tmp0 ^ out5;
+        out0 = out2 ^ out3 ^ in5;
+        out7 = out1 ^ out2 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(6F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in7;
+        tmp1 = tmp0 ^ in4;
+        tmp2 = tmp0 ^ in0 ^ in2;
+        out4 = tmp1 ^ in1;
+        out0 = tmp2 ^ in5;
+        out3 = out4 ^ in0;
+        out2 = out3 ^ in7;
+        out1 = out2 ^ in6;
+        out6 = out1 ^ in4 ^ in5;
+        out7 = tmp2 ^ out1;
+        out5 = tmp1 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(70)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in2;
+        tmp0 = in2 ^ in4;
+        out2 = in2 ^ in3 ^ in5;
+        tmp1 = tmp0 ^ in6;
+        tmp2 = out2 ^ in7;
+        out0 = tmp1 ^ in3;
+        out4 = tmp1 ^ in0;
+        out7 = tmp2 ^ in1;
+        out6 = out4 ^ in1;
+        out5 = out7 ^ in0 ^ in2;
+        out1 = tmp0 ^ tmp2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(71)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in3 ^ in5;
+        out3 = in2 ^ in3;
+        tmp0 = in0 ^ in2;
+        tmp1 = out2 ^ in1;
+        out4 = tmp0 ^ in6;
+        tmp2 = tmp0 ^ in1;
+        out7 = tmp1 ^ in2;
+        out1 = tmp1 ^ in4 ^ in7;
+        out0 = out4 ^ in3 ^ in4;
+        out6 = tmp2 ^ in4;
+        out5 = tmp2 ^ out3 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(72)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in7;
+        tmp0 = in0 ^ in4;
+        tmp1 = tmp0 ^ in3 ^ in7;
+        out1 = tmp1 ^ in5;
+        out5 = out1 ^ in1;
+        tmp2 = tmp0 ^ out5;
+        out2 = tmp2 ^ in2;
+        out7 = out2 ^ in6;
+        out6 = tmp1 ^ out7;
+        out4 = tmp2 ^ out6;
+        out0 = out4 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(73)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in3 ^ in7;
+        out2 = out3 ^ in1 ^ in5;
+        out1 = out2 ^ in0 ^ in4;
+        out5 = out1 ^ in5;
+        out6 = out1 ^ out3 ^ in2;
+        out0 = out2 ^ out6 ^ in6;
+        out7 = out0 ^ out1 ^ in3;
+        out4 = out0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(74)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in4;
+        tmp1 = in1 ^ in2 ^ in6;
+        out4 = in0 ^ in4 ^ in7;
+        out5 = in0 ^ in1 ^ in5;
+        out0 = tmp0 ^ in2;
+        out1 = tmp0 ^ in5;
+        out3 = tmp1 ^ in7;
+        out6 = tmp1 ^ in0;
+        out2 = tmp1 ^ out5 ^ in3;
+        out7 = out3 ^ in3 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(75)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in0 ^ in7;
+        tmp0 = in1 ^ in3;
+        out5 = in0 ^ in1;
+        out7 = tmp0 ^ in2;
+        tmp1 = tmp0 ^ in4;
+        out6 = out5 ^ in2;
+        tmp2 = out7 ^ in6;
+        out1 = tmp1 ^ in5;
+        out0 = tmp1 ^ out6;
+        out3 = tmp2 ^ in7;
+        out2 = tmp2 ^ out6 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(76)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in1 ^ in6;
+        tmp0 = in0 ^ in5;
+        tmp1 = in3 ^ in7;
+        tmp2 = tmp0 ^ in4;
+        tmp3 = tmp1 ^ in2;
+        out5 = tmp2 ^ in1;
+        out1 = tmp2 ^ in3;
+        out0 = tmp3 ^ in4;
+        out4 = out1 ^ in5;
+        out7 = tmp3 ^ out3;
+        out2 = tmp0 ^ out7;
+        out6 = tmp1 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(77)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in0 ^ in3;
+        tmp0 = in1 ^ in4;
+        tmp1 = in1 ^ in6;
+        tmp2 = out4 ^ in5;
+        out5 = tmp0 ^ in0;
+        out1 = tmp0 ^ tmp2;
+        out3 = tmp1 ^ in3;
+        out2 = tmp1 ^ tmp2 ^ in7;
+        out7 = out3 ^ in2;
+        tmp3 = out7 ^ in6;
+        out6 = tmp2 ^ tmp3;
+        out0 = tmp3 ^ out5 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(78)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = in2 ^ in7;
+        tmp2 = in0 ^ in5 ^ in6;
+        out2 = tmp1 ^ in3;
+        out3 = tmp2 ^ in2;
+        out5 = out3 ^ in1 ^ in3;
+        out0 = tmp0 ^ out3 ^ in4;
+        out1 = tmp1 ^ out0;
+        out4 = out1 ^ out5 ^ in5;
+        out7 = tmp0 ^ out4;
+        out6 = tmp2 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(79)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in3 ^ in7;
+        tmp0 = in3 ^ in4;
+        tmp1 = in1 ^ in5;
+        tmp2 = tmp1 ^ in2;
+        out4 = tmp2 ^ in0 ^ in7;
+        tmp3 = out4 ^ in5;
+        out5 = tmp3 ^ out2 ^ in6;
+        out7 = tmp0 ^ tmp2;
+        out6 = tmp0 ^ tmp3;
+        out3 = tmp1 ^ out5;
+        out0 = out3 ^ in4;
+        out1 = tmp3 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(7A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        out2 = tmp0 ^ in3;
+        tmp1 = out2 ^ in4;
+        out4 = tmp1 ^ in0 ^ in5;
+        out5 = out4 ^ in6;
+        out6 = out5 ^ in7;
+        out7 = out6 ^ in0;
+        out0 = out7 ^ in1;
+        out1 = tmp0 ^ out6;
+        out3 = tmp1 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(7B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in1 ^ in3;
+        tmp0 = in0 ^ in5;
+        out4 = tmp0 ^ out2 ^ in2;
+        tmp1 = out4 ^ in4;
+        out6 = tmp1 ^ in7;
+        out5 = tmp1 ^ in5 ^ in6;
+        out0 = out6 ^ in1 ^ in6;
+        tmp2 = out0 ^ in2;
+        out1 = tmp2 ^ in1;
+        out3 = tmp2 ^ in4;
+        out7 = tmp0 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(7C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in5;
+        tmp1 = tmp0 ^ in4;
+        out0 = tmp1 ^ in2;
+        out1 = tmp1 ^ in6;
+        out7 = out0 ^ in1 ^ in5 ^ in7;
+        out5 = out1 ^ out7 ^ in0;
+        out3 = out5 ^ in6;
+        out6 = tmp0 ^ out5;
+        out2 = out6 ^ in1;
+        out4 = out2 ^ out7 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(7D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = tmp0 ^ in3;
+        tmp2 = tmp0 ^ in6;
+        out7 = tmp1 ^ in4;
+        tmp3 = tmp2 ^ in0;
+        out5 = tmp3 ^ in7;
+        out4 = tmp3 ^ in2 ^ in5;
+        out2 = tmp1 ^ out5;
+        out6 = tmp2 ^ out2;
+        out0 = out4 ^ out7 ^ in6;
+        out1 = tmp3 ^ out0;
+        out3 = out6 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(7E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in4;
+        tmp1 = in0 ^ in5;
+        out1 = tmp0 ^ tmp1 ^ in6;
+        out3 = tmp1 ^ in1;
+        out4 = out1 ^ in1 ^ in7;
+        tmp2 = out4 ^ in3;
+        out5 = tmp2 ^ in2;
+        out6 = tmp0 ^ out5;
+        out7 = tmp1 ^ out4 ^ in2;
+        out2 = out6 ^ in5 ^ in7;
+        out0 = tmp2 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(7F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in7;
+        tmp1 = tmp0 ^ in3 ^ in5;
+        tmp2 = tmp1 ^ in0;
+        out0 = tmp2 ^ in4;
+        out6 = tmp2 ^ in1;
+        out3 = tmp0 ^ out6;
+        tmp3 = out3 ^ in6;
+        out1 = tmp3 ^ in4;
+        out2 = tmp3 ^ in5;
+        out4 = tmp3 ^ in7;
+        out5 = tmp1 ^ out1;
+        out7 = out0 ^ out4 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(80)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        tmp1 = in4 ^ in5;
+        out1 = in2 ^ in6 ^ in7;
+        out5 = tmp0 ^ in4;
+        tmp2 = tmp0 ^ in1;
+        out6 = tmp1 ^ in3;
+        out7 = tmp1 ^ in0 ^ in6;
+        out4 = tmp2 ^ in7;
+        out3 = tmp2 ^ out6;
+        out2 = out3 ^ out5 ^ in6;
+        out0 = out2 ^ in3 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(81)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in6;
+        tmp1 = tmp0 ^ in3;
+        out6 = tmp1 ^ in5;
+        out5 = out6 ^ in2 ^ in6;
+        out3 = out5 ^ in1;
+        out2 = tmp0 ^ out3;
+        out1 = out3 ^ out6 ^ in7;
+        out4 = tmp1 ^ out1;
+        out7 = out2 ^ out4 ^ in0;
+        out0 = out7 ^ in1 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(82)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in1 ^ in2;
+        tmp0 = in6 ^ in7;
+        out5 = in2 ^ in3;
+        out6 = in3 ^ in4;
+        out7 = in0 ^ in4 ^ in5;
+        out0 = in1 ^ in5 ^ in6;
+        out1 = tmp0 ^ in0 ^ in2;
+        out2 = tmp0 ^ in3 ^ in5;
+        out3 = tmp0 ^ out0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(83)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in2 ^ in5;
+        tmp2 = in3 ^ in6;
+        out4 = in1 ^ in2 ^ in4;
+        out0 = tmp0 ^ in5 ^ in6;
+        out5 = tmp1 ^ in3;
+        tmp3 = tmp1 ^ in7;
+        out6 = tmp2 ^ in4;
+        out2 = tmp2 ^ tmp3;
+        tmp4 = tmp3 ^ out4;
+        out1 = tmp3 ^ out0;
+        out3 = tmp4 ^ in3;
+        out7 = tmp0 ^ tmp4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(84)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in2 ^ in6;
+        out6 = in3 ^ in5;
+        out0 = in1 ^ in5 ^ in7;
+        out7 = in0 ^ in4 ^ in6;
+        out4 = in1 ^ in3 ^ in6;
+        out5 = in2 ^ in4 ^ in7;
+        out2 = out6 ^ in0 ^ in1;
+        out3 = out5 ^ in5 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(85)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in6;
+        tmp1 = in3 ^ in6;
+        tmp2 = tmp0 ^ in4;
+        out1 = tmp0 ^ in2;
+        out6 = tmp1 ^ in5;
+        out4 = tmp2 ^ in3;
+        tmp3 = out1 ^ out6;
+        out2 = tmp3 ^ in0;
+        out3 = tmp2 ^ tmp3 ^ in7;
+        out7 = out2 ^ out3 ^ in1;
+        out5 = tmp1 ^ out3;
+        out0 = tmp2 ^ out7 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(86)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out6 = in3;
+        out7 = in0 ^ in4;
+        out0 = in1 ^ in5;
+        out5 = in2 ^ in7;
+        out3 = in4 ^ in5 ^ in6;
+        out1 = in0 ^ in2 ^ in6;
+        out4 = in1 ^ in6 ^ in7;
+        out2 = in0 ^ in3 ^ in5 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(87)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out6 = in3 ^ in6;
+        tmp0 = in0 ^ in1;
+        out7 = in0 ^ in4 ^ in7;
+        out5 = in2 ^ in5 ^ in7;
+        out3 = out6 ^ in4 ^ in5;
+        out0 = tmp0 ^ in5;
+        tmp1 = tmp0 ^ in6;
+        out2 = out5 ^ in0 ^ in3;
+        out1 = tmp1 ^ in2;
+        out4 = tmp1 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(88)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in2 ^ in7;
+        tmp0 = in5 ^ in6;
+        out0 = in1 ^ in6 ^ in7;
+        out6 = in4 ^ in5 ^ in7;
+        out3 = out0 ^ out1 ^ in0 ^ in4;
+        out7 = tmp0 ^ in0;
+        tmp1 = tmp0 ^ in3;
+        out2 = out0 ^ in3;
+        out4 = tmp1 ^ in2;
+        out5 = tmp1 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(89)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in7;
+        tmp1 = in2 ^ in7;
+        tmp2 = tmp0 ^ in6;
+        out1 = tmp1 ^ in1;
+        out7 = tmp2 ^ in5;
+        out0 = tmp2 ^ in1;
+        out2 = out1 ^ in3 ^ in6;
+        out6 = out7 ^ in0 ^ in4;
+        out5 = out6 ^ in3;
+        out3 = tmp0 ^ out2 ^ in4;
+        out4 = tmp1 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(8A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in1 ^ in6;
+        out7 = in0 ^ in5;
+        out2 = in3 ^ in6;
+        out6 = in4 ^ in7;
+        out1 = in0 ^ in2 ^ in7;
+        out3 = out0 ^ out6 ^ in0;
+        out4 = out1 ^ out7 ^ in6;
+        out5 = out2 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(8B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in3 ^ in6;
+        tmp2 = in5 ^ in7;
+        tmp3 = tmp0 ^ in7;
+        out0 = tmp0 ^ in6;
+        out2 = tmp1 ^ in2;
+        out5 = tmp1 ^ tmp2;
+        out7 = tmp2 ^ in0;
+        tmp4 = tmp3 ^ in4;
+        out1 = tmp3 ^ in2;
+        out6 = tmp4 ^ out0;
+        out4 = out6 ^ in2 ^ in5;
+        out3 = tmp1 ^ tmp4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(8C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in2;
+        out0 = in1 ^ in7;
+        out7 = in0 ^ in6;
+        out5 = in4 ^ in6;
+        out6 = in5 ^ in7;
+        out2 = out0 ^ in0 ^ in3;
+        out3 = out5 ^ out7 ^ in2 ^ in7;
+        out4 = out6 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(8D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in1 ^ in2;
+        tmp0 = in6 ^ in7;
+        out0 = in0 ^ in1 ^ in7;
+        out5 = in4 ^ in5 ^ in6;
+        out6 = tmp0 ^ in5;
+        out7 = tmp0 ^ in0;
+        out4 = tmp0 ^ out5 ^ in3;
+        out2 = out0 ^ in2 ^ in3;
+        out3 = out2 ^ in1 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(8E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in1;
+        out4 = in5;
+        out7 = in0;
+        out5 = in6;
+        out6 = in7;
+        out3 = in0 ^ in4;
+        out1 = in0 ^ in2;
+        out2 = in0 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(8F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in0 ^ in1;
+        tmp0 = in0 ^ in3;
+        out4 = in4 ^ in5;
+        out7 = in0 ^ in7;
+        out5 = in5 ^ in6;
+        out6 = in6 ^ in7;
+        out1 = out0 ^ in2;
+        out2 = tmp0 ^ in2;
+        out3 = tmp0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(90)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = in2 ^ in6 ^ in7;
+        out3 = tmp0 ^ in7;
+        out1 = tmp1 ^ in5;
+        tmp2 = out1 ^ in4;
+        out6 = tmp2 ^ in3;
+        out5 = out6 ^ in1;
+        out4 = out5 ^ in0;
+        out0 = tmp0 ^ tmp2;
+        out7 = tmp0 ^ out4;
+        out2 = tmp1 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(91)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in4;
+        tmp1 = tmp0 ^ in3 ^ in5;
+        out2 = tmp1 ^ in1;
+        out6 = tmp1 ^ in7;
+        tmp2 = out2 ^ in5 ^ in7;
+        out3 = tmp2 ^ in4;
+        out5 = tmp2 ^ in6;
+        out1 = tmp1 ^ out5 ^ in2;
+        tmp3 = out1 ^ in0;
+        out4 = tmp3 ^ in3;
+        out0 = tmp0 ^ tmp3;
+        out7 = tmp2 ^ tmp3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(92)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in1;
+        tmp0 = in4 ^ in5;
+        tmp1 = tmp0 ^ in1;
+        out2 = tmp0 ^ in3 ^ in7;
+        out0 = tmp1 ^ in6;
+        out7 = out2 ^ in0;
+        out4 = out0 ^ in0 ^ in2;
+        out5 = out4 ^ out7 ^ in5;
+        out6 = tmp1 ^ out5;
+        out1 = out6 ^ out7 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(93)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in1 ^ in3;
+        tmp0 = in2 ^ in7;
+        tmp1 = out3 ^ in6;
+        tmp2 = tmp0 ^ in4;
+        out5 = tmp0 ^ tmp1;
+        out6 = tmp2 ^ in3;
+        out2 = out6 ^ in5;
+        out0 = out2 ^ out5 ^ in0;
+        out7 = tmp1 ^ out0;
+        out1 = tmp2 ^ out0;
+        out4 = out1 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(94)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in2 ^ in6;
+        tmp0 = in1 ^ in4 ^ in5;
+        out1 = out3 ^ in5;
+        out5 = tmp0 ^ out3;
+        out0 = tmp0 ^ in7;
+        out4 = tmp0 ^ in0 ^ in3;
+        out6 = out1 ^ in3 ^ in7;
+        out2 = out4 ^ in6;
+        out7 = out0 ^ out2 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(95)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        out3 = tmp0 ^ in6;
+        tmp1 = tmp0 ^ in7;
+        tmp2 = out3 ^ in0;
+        out6 = tmp1 ^ in5;
+        tmp3 = tmp2 ^ in4;
+        out7 = tmp3 ^ in2;
+        tmp4 = tmp3 ^ in5;
+        out2 = tmp4 ^ in1;
+        tmp5 = out2 ^ in6;
+        out0 = tmp1 ^ tmp5;
+        out1 = tmp5 ^ out7;
+        out4 = tmp2 ^ out1;
+        out5 = tmp4 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(96)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in6 ^ in7;
+        tmp0 = in1 ^ in5;
+        tmp1 = in5 ^ in6;
+        out6 = out3 ^ in2 ^ in3;
+        out0 = tmp0 ^ in4;
+        tmp2 = tmp1 ^ in2;
+        out4 = out0 ^ in0 ^ in7;
+        out1 = tmp2 ^ in0;
+        out5 = tmp2 ^ in1;
+        out7 = tmp0 ^ out4 ^ in3;
+        out2 = tmp1 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(97)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in4;
+        tmp1 = in2 ^ in6;
+        out3 = in3 ^ in6 ^ in7;
+        out7 = tmp0 ^ in3;
+        tmp2 = tmp0 ^ in5;
+        out5 = tmp1 ^ in1;
+        out6 = tmp1 ^ out3;
+        out0 = tmp2 ^ in1;
+        out2 = tmp2 ^ out3 ^ in2;
+        tmp3 = out0 ^ in4;
+        out4 = tmp3 ^ in7;
+        out1 = tmp1 ^ tmp3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(98)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in5 ^ in7;
+        tmp1 = in1 ^ in4 ^ in7;
+        out1 = tmp0 ^ in2;
+        out0 = tmp1 ^ in6;
+        out2 = tmp1 ^ in3;
+        out6 = out0 ^ out1 ^ in1;
+        out5 = tmp0 ^ out2;
+        out3 = tmp1 ^ out6 ^ in0;
+        out7 = out0 ^ out5 ^ in0;
+        out4 = out6 ^ out7 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(99)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        out5 = in1 ^ in3 ^ in4;
+        out6 = in2 ^ in4 ^ in5;
+        out4 = tmp0 ^ in2;
+        tmp1 = tmp0 ^ in6;
+        tmp2 = out5 ^ in7;
+        out7 = tmp1 ^ in5;
+        out0 = tmp1 ^ tmp2;
+        out2 = tmp2 ^ in2;
+        out3 = out0 ^ out6 ^ in3;
+        out1 = tmp1 ^ out3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(9A)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in3 ^ in4;
+        tmp0 = in0 ^ in5;
+        tmp1 = in1 ^ in6;
+        out5 = in1 ^ in3 ^ in5;
+        tmp2 = tmp0 ^ in7;
+        out3 = tmp0 ^ tmp1;
+        out0 = tmp1 ^ in4;
+        out7 = tmp2 ^ in3;
+        out1 = tmp2 ^ in2;
+        out6 = out0 ^ in1 ^ in2;
+        out4 = out1 ^ in4 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(9B)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in1 ^ in3;
+        tmp0 = in3 ^ in5;
+        out6 = in2 ^ in4;
+        out4 = in0 ^ in2 ^ in7;
+        out7 = tmp0 ^ in0;
+        out2 = out6 ^ in3;
+        out1 = out4 ^ in1 ^ in5;
+        out3 = out7 ^ in1 ^ in6;
+        out0 = tmp0 ^ out3 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(9C)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out1 = in2 ^ in5;
+        tmp0 = in0 ^ in3 ^ in6;
+        out3 = out1 ^ in0;
+        out6 = out1 ^ in6;
+        out7 = tmp0 ^ in7;
+        out4 = out7 ^ in4;
+        out2 = out4 ^ in1;
+        out0 = tmp0 ^ out2;
+        out5 = out0 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(9D)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out6 = in2 ^ in5;
+        tmp0 = in0 ^ in3;
+        out5 = in1 ^ in4 ^ in7;
+        out1 = out6 ^ in1;
+        out3 = tmp0 ^ out6;
+        out7 = tmp0 ^ in6;
+        out0 = out5 ^ in0;
+        out4 = out7 ^ in7;
+        out2 = out5 ^ out7 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(9E)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in1 ^ in4;
+        tmp0 = in0 ^ in5;
+        out6 = in2 ^ in6;
+        out7 = in0 ^ in3 ^ in7;
+        out4 = in0 ^ in4 ^ in6;
+        out5 = in1 ^ in5 ^ in7;
+        out1 = tmp0 ^ in2;
+        out3 = tmp0 ^ in7;
+        out2 = out4 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(9F)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out6 = in2;
+        out7 = in0 ^ in3;
+        tmp0 = in0 ^ in1;
+        out4 = in0 ^ in6;
+        out5 = in1 ^ in7;
+        out1 = tmp0 ^ in2 ^ in5;
+        out2 = out7 ^ in2 ^ in4 ^ in6;
+        out3 = out7 ^ in5 ^ in7;
+        out0 = tmp0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A0)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in6;
+        out2 = tmp0 ^ in7;
+        tmp1 = tmp0 ^ in5;
+        out6 = out2 ^ in3 ^ in4;
+        out0 = tmp1 ^ in3;
+        tmp2 = out0 ^ in2;
+        out3 = tmp2 ^ in7;
+        tmp3 = tmp2 ^ in1;
+        out5 = tmp3 ^ in0;
+        out4 = tmp3 ^ out6;
+        out7 = out5 ^ out6 ^ in1;
+        out1 = tmp1 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A1)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        tmp1 = tmp0 ^ in1;
+        tmp2 = tmp0 ^ in4;
+        out4 = tmp1 ^ in7;
+        out7 = tmp2 ^ in0;
+        out6 = tmp2 ^ out4 ^ in3;
+        out3 = out4 ^ in6;
+        out2 = out3 ^ in5;
+        out1 = out2 ^ in4;
+        out5 = out1 ^ out6 ^ in0;
+        out0 = tmp1 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A2)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in6;
+        tmp0 = in1 ^ in3 ^ in5;
+        out3 = tmp0 ^ in6;
+        out4 = tmp0 ^ in2 ^ in4;
+        out0 = out3 ^ in7;
+        out6 = out0 ^ in4;
+        out1 = out0 ^ out4 ^ in0;
+        out7 = out1 ^ in5;
+        out5 = out7 ^ in3 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A3)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in2 ^ in6;
+        out3 = in1 ^ in5 ^ in6;
+        tmp0 = out2 ^ in0;
+        out4 = out2 ^ out3 ^ in3;
+        tmp1 = tmp0 ^ in4;
+        out0 = tmp0 ^ out4 ^ in7;
+        out5 = tmp1 ^ in3;
+        out7 = tmp1 ^ in5;
+        out1 = tmp1 ^ in1 ^ in7;
+        out6 = tmp1 ^ out0 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A4)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in3;
+        tmp1 = in2 ^ in4;
+        tmp2 = in2 ^ in5;
+        tmp3 = in0 ^ in7;
+        out0 = tmp0 ^ in5;
+        out6 = tmp0 ^ in6 ^ in7;
+        out1 = tmp1 ^ in6;
+        out7 = tmp1 ^ tmp3;
+        out3 = tmp2 ^ in3;
+        tmp4 = tmp2 ^ out1;
+        out2 = tmp3 ^ in1;
+        out5 = tmp4 ^ out7;
+        out4 = tmp4 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A5)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in2 ^ in5;
+        tmp0 = in1 ^ in6;
+        tmp1 = in0 ^ in1;
+        tmp2 = in2 ^ in4;
+        out6 = in1 ^ in3 ^ in7;
+        out4 = tmp0 ^ in5;
+        out1 = tmp0 ^ tmp2;
+        out0 = tmp1 ^ in3 ^ in5;
+        out2 = tmp1 ^ in2 ^ in7;
+        out7 = tmp2 ^ in0;
+        out5 = tmp0 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A6)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0;
+        out3 = in3 ^ in5 ^ in7;
+        out1 = in0 ^ in2 ^ in4 ^ in6;
+        out0 = out3 ^ in1;
+        out7 = out1 ^ in7;
+        out6 = out0 ^ in6;
+        out5 = out7 ^ in5;
+        out4 = out6 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A7)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0 ^ in2;
+        out3 = in5 ^ in7;
+        out7 = out2 ^ in4 ^ in6;
+        out6 = out3 ^ in1 ^ in3;
+        out1 = out7 ^ in1;
+        out5 = out7 ^ in7;
+        out0 = out6 ^ in0;
+        out4 = out6 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A8)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in4;
+        tmp1 = in1 ^ in6;
+        tmp2 = in0 ^ in2 ^ in7;
+        out1 = tmp0 ^ in7;
+        out4 = tmp0 ^ in6;
+        out0 = tmp1 ^ in3;
+        out2 = tmp1 ^ in5;
+        out6 = tmp1 ^ in4;
+        out7 = tmp2 ^ in5;
+        out3 = tmp2 ^ out0 ^ in6;
+        out5 = out7 ^ in2 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(A9)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in2 ^ in6;
+        out6 = in1 ^ in4;
+        out7 = in0 ^ in2 ^ in5;
+        out5 = in0 ^ in3 ^ in7;
+        out2 = out4 ^ in1 ^ in5;
+        out1 = out6 ^ in2 ^ in7;
+        out0 = out2 ^ out7 ^ in3;
+        out3 = out1 ^ in0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(AA)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in2;
+        tmp1 = in1 ^ in3;
+        tmp2 = in6 ^ in7;
+        out1 = tmp0 ^ in4 ^ in7;
+        out3 = tmp1 ^ in0;
+        out0 = tmp1 ^ tmp2;
+        out2 = tmp2 ^ in5;
+        out7 = tmp0 ^ out2;
+        out6 = out1 ^ out7 ^ in1;
+        out5 = out0 ^ out6 ^ in0;
+        out4 = out5 ^ out7 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(AB)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0 ^ in1;
+        tmp0 = in1 ^ in4;
+        tmp1 = in0 ^ in7;
+        out6 = tmp0 ^ in5;
+        out1 = tmp0 ^ tmp1 ^ in2;
+        out5 = tmp1 ^ in3 ^ in4;
+        out0 = tmp0 ^ out5 ^ in6;
+        out4 = out0 ^ out3 ^ in2;
+        out2 = out4 ^ in3 ^ in5;
+        out7 = tmp1 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(AC)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in1 ^ in3;
+        out1 = in2 ^ in4;
+        tmp0 = in0 ^ in2;
+        out4 = in4 ^ in7;
+        out5 = in0 ^ in5;
+        out6 = in1 ^ in6;
+        out7 = tmp0 ^ in7;
+        out3 = tmp0 ^ in3 ^ in6;
+        out2 = out5 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(AD)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in7;
+        out5 = in0;
+        out6 = in1;
+        out7 = in0 ^ in2;
+        out0 = in0 ^ in1 ^ in3;
+        out2 = out7 ^ in1 ^ in5;
+        out1 = in1 ^ in2 ^ in4;
+        out3 = out7 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(AE)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in3 ^ in4;
+        tmp0 = in0 ^ in4;
+        tmp1 = in0 ^ in7;
+        out0 = in1 ^ in3 ^ in7;
+        out1 = tmp0 ^ in2;
+        out5 = tmp0 ^ in5;
+        tmp2 = tmp1 ^ in6;
+        out2 = tmp1 ^ in5;
+        out3 = tmp2 ^ in3;
+        out7 = tmp2 ^ in2;
+        out6 = tmp2 ^ out2 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(AF)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in3;
+        tmp0 = in0 ^ in7;
+        out5 = in0 ^ in4;
+        out6 = in1 ^ in5;
+        out7 = in0 ^ in2 ^ in6;
+        out0 = tmp0 ^ in1 ^ in3;
+        out3 = tmp0 ^ in6;
+        out2 = tmp0 ^ in2 ^ in5;
+        out1 = out5 ^ in1 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B0)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in4;
+        tmp1 = in3 ^ in6;
+        out2 = tmp0 ^ in7;
+        tmp2 = tmp0 ^ tmp1;
+        out0 = tmp2 ^ in5;
+        out3 = tmp2 ^ in2;
+        out6 = out3 ^ in6;
+        tmp3 = out6 ^ in0 ^ in1;
+        out7 = tmp3 ^ in5;
+        out5 = tmp3 ^ out2;
+        out1 = out0 ^ out5 ^ in0;
+        out4 = tmp1 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B1)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in4;
+        out2 = tmp0 ^ in2 ^ in7;
+        tmp1 = out2 ^ in6;
+        out1 = tmp1 ^ in5;
+        out3 = tmp1 ^ in7;
+        out4 = tmp1 ^ in0;
+        out6 = out3 ^ in3;
+        out0 = out6 ^ in0 ^ in2 ^ in5;
+        out5 = tmp1 ^ out0 ^ in1;
+        out7 = tmp0 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B2)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in4;
+        tmp0 = in4 ^ in7;
+        tmp1 = in1 ^ in3 ^ in6;
+        out3 = tmp0 ^ tmp1;
+        tmp2 = tmp1 ^ in0;
+        out0 = out3 ^ in5;
+        out4 = tmp2 ^ in2;
+        tmp3 = out4 ^ in6;
+        out5 = tmp0 ^ tmp3;
+        out1 = tmp3 ^ out0;
+        tmp4 = out1 ^ in7;
+        out7 = tmp4 ^ in3;
+        out6 = tmp2 ^ tmp4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B3)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in2 ^ in4;
+        tmp0 = in0 ^ in5;
+        tmp1 = in1 ^ in6;
+        out3 = tmp1 ^ in4 ^ in7;
+        tmp2 = tmp0 ^ out3;
+        out0 = tmp2 ^ in3;
+        out1 = tmp2 ^ in2;
+        out5 = out0 ^ in2 ^ in6;
+        out7 = tmp1 ^ out5;
+        out4 = out7 ^ in1 ^ in5 ^ in7;
+        out6 = tmp0 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B4)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in0 ^ in1;
+        out5 = out4 ^ in2;
+        tmp0 = out4 ^ in4;
+        out6 = out5 ^ in0 ^ in3;
+        out7 = tmp0 ^ out6;
+        out2 = tmp0 ^ in6 ^ in7;
+        out3 = out7 ^ in0 ^ in7;
+        out0 = out5 ^ out7 ^ in5;
+        out1 = out0 ^ out6 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B5)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in2 ^ in4;
+        out4 = tmp0 ^ in4;
+        out3 = tmp1 ^ in7;
+        tmp2 = out4 ^ in5;
+        out7 = out3 ^ in0 ^ in3;
+        out0 = tmp2 ^ in3;
+        out2 = tmp0 ^ out3 ^ in6;
+        out5 = tmp1 ^ tmp2;
+        out6 = out2 ^ out7 ^ in2;
+        out1 = tmp0 ^ out0 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B6)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in3 ^ in4;
+        tmp0 = in1 ^ in2;
+        tmp1 = in0 ^ in4;
+        tmp2 = in3 ^ in5;
+        tmp3 = out3 ^ in1 ^ in7;
+        out5 = tmp0 ^ tmp1;
+        out6 = tmp0 ^ tmp2;
+        out2 = tmp1 ^ in6;
+        out4 = tmp1 ^ tmp3;
+        out0 = tmp3 ^ in5;
+        out1 = out2 ^ in2 ^ in5;
+        out7 = tmp2 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B7)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in4;
+        tmp0 = in0 ^ in4;
+        out2 = tmp0 ^ in2 ^ in6;
+        tmp1 = out2 ^ in7;
+        out1 = out2 ^ in1 ^ in5;
+        out7 = tmp1 ^ in3;
+        out5 = out1 ^ in6;
+        out6 = tmp0 ^ out1 ^ in3;
+        out0 = tmp1 ^ out6;
+        out4 = out0 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B8)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in4;
+        tmp1 = in2 ^ in5;
+        out2 = tmp0 ^ in5;
+        out4 = tmp1 ^ in0;
+        tmp2 = tmp1 ^ in7;
+        out6 = tmp2 ^ out2;
+        out7 = out4 ^ in3;
+        out1 = tmp2 ^ in4;
+        out3 = tmp0 ^ out7;
+        out0 = out3 ^ out4 ^ in6;
+        out5 = out0 ^ in0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(B9)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in2;
+        tmp1 = in4 ^ in5;
+        out4 = tmp0 ^ tmp1;
+        tmp2 = tmp0 ^ in3 ^ in7;
+        out3 = out4 ^ in1;
+        out7 = tmp2 ^ in5;
+        out2 = out3 ^ in0;
+        out1 = out2 ^ in7;
+        out6 = out1 ^ in5 ^ in6;
+        out0 = tmp2 ^ out6;
+        out5 = tmp1 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(BA)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in5 ^ in7;
+        out2 = tmp0 ^ in4;
+        tmp1 = out2 ^ in2;
+        out1 = tmp1 ^ in0;
+        out6 = tmp1 ^ in1;
+        out4 = out1 ^ in3 ^ in4;
+        tmp2 = out4 ^ out6;
+        out7 = out4 ^ in6 ^ in7;
+        out5 = tmp2 ^ in6;
+        out3 = tmp0 ^ tmp2;
+        out0 = out6 ^ out7 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(BB)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in2 ^ in4 ^ in5 ^ in7;
+        tmp0 = out2 ^ in1;
+        out4 = out2 ^ in0 ^ in3;
+        out1 = tmp0 ^ in0;
+        out6 = tmp0 ^ in6;
+        out3 = out1 ^ in2;
+        tmp1 = out4 ^ out6 ^ in4;
+        out0 = tmp1 ^ in7;
+        out5 = tmp1 ^ in5;
+        out7 = tmp0 ^ tmp1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(BC)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in2;
+        tmp1 = in2 ^ in4;
+        out0 = in1 ^ in3 ^ in4;
+        out6 = in1 ^ in2 ^ in7;
+        out7 = tmp0 ^ in3;
+        out5 = tmp0 ^ out6 ^ in6;
+        out1 = tmp1 ^ in5;
+        tmp2 = out1 ^ out5 ^ in1;
+        out3 = tmp2 ^ in3;
+        out4 = tmp1 ^ tmp2;
+        out2 = tmp2 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(BD)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = in1 ^ in4;
+        out0 = tmp0 ^ tmp1;
+        out7 = tmp0 ^ in2 ^ in7;
+        out1 = tmp1 ^ in2 ^ in5;
+        tmp2 = out1 ^ in0;
+        out2 = tmp2 ^ in6;
+        out3 = out2 ^ in1 ^ in7;
+        out4 = out3 ^ in2;
+        out5 = tmp1 ^ out4;
+        out6 = tmp2 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(BE)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3 ^ in6;
+        out4 = tmp0 ^ in5;
+        out7 = tmp0 ^ in2;
+        out3 = out4 ^ in4;
+        out1 = out3 ^ out7 ^ in0;
+        out2 = out3 ^ in3 ^ in7;
+        out0 = out2 ^ out4 ^ in1;
+        out5 = tmp0 ^ out0;
+        out6 = out1 ^ out5 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(BF)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in4;
+        out3 = tmp0 ^ in5 ^ in6;
+        out4 = out3 ^ in3;
+        tmp1 = out3 ^ in7;
+        out2 = tmp1 ^ in2;
+        out5 = tmp1 ^ in1;
+        tmp2 = out2 ^ in5;
+        out7 = tmp2 ^ in3 ^ in4;
+        tmp3 = tmp0 ^ out5;
+        out0 = tmp3 ^ out4;
+        out1 = tmp2 ^ tmp3;
+        out6 = tmp3 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C0)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in2 ^ in5;
+        tmp0 = in1 ^ in4;
+        tmp1 = in3 ^ in6;
+        out0 = out5 ^ in1;
+        out4 = tmp0 ^ in7;
+        out3 = tmp0 ^ tmp1;
+        out1 = tmp1 ^ in2;
+        out6 = tmp1 ^ in0;
+        out7 = out4 ^ in0;
+        out2 = out4 ^ out5 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C1)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in2;
+        tmp0 = in0 ^ in1;
+        out4 = in1 ^ in7;
+        out6 = in0 ^ in3;
+        out3 = in1 ^ in4 ^ in6;
+        tmp1 = tmp0 ^ in2;
+        out7 = tmp0 ^ in4;
+        out0 = tmp1 ^ in5;
+        out1 = tmp1 ^ out6 ^ in6;
+        out2 = out6 ^ out7 ^ in5 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C2)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in1 ^ in3 ^ in4;
+        tmp0 = in0 ^ in3 ^ in6;
+        out5 = in2 ^ in4 ^ in5;
+        tmp1 = out4 ^ in7;
+        out1 = tmp0 ^ in2;
+        out6 = tmp0 ^ in5;
+        out2 = out5 ^ in3;
+        out7 = tmp0 ^ tmp1;
+        out3 = tmp1 ^ in2 ^ in6;
+        out0 = tmp1 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C3)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in1 ^ in3;
+        tmp0 = in0 ^ in2;
+        tmp1 = in3 ^ in5;
+        out5 = in2 ^ in4;
+        tmp2 = tmp0 ^ out4;
+        out2 = tmp1 ^ in4;
+        out6 = tmp1 ^ in0;
+        out0 = tmp1 ^ tmp2 ^ in7;
+        out1 = tmp2 ^ in6;
+        out7 = out1 ^ out5 ^ in3;
+        out3 = tmp0 ^ out7 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C4)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in7;
+        out3 = tmp0 ^ in4;
+        tmp1 = tmp0 ^ in2;
+        out1 = tmp1 ^ in6;
+        out5 = tmp1 ^ in5;
+        out4 = out1 ^ out3 ^ in1;
+        out0 = out4 ^ in4 ^ in5;
+        out2 = out0 ^ out3 ^ in0;
+        out7 = out1 ^ out2 ^ in7;
+        out6 = tmp1 ^ out0 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C5)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in4 ^ in7;
+        tmp0 = in3 ^ in7;
+        out4 = in1 ^ in2 ^ in6;
+        out6 = in0 ^ in3 ^ in4;
+        out5 = tmp0 ^ in2;
+        out1 = tmp0 ^ out4;
+        out0 = out4 ^ in0 ^ in5;
+        out2 = out0 ^ out5 ^ in4;
+        out7 = tmp0 ^ out2 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C6)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in5 ^ in6;
+        tmp1 = in1 ^ in7;
+        tmp2 = tmp0 ^ in0;
+        tmp3 = tmp0 ^ tmp1;
+        tmp4 = tmp2 ^ in4;
+        out0 = tmp3 ^ in2;
+        out6 = tmp4 ^ in3;
+        out2 = out6 ^ in2;
+        out7 = tmp1 ^ tmp4;
+        out3 = tmp2 ^ out2;
+        tmp5 = out3 ^ in5;
+        out5 = tmp5 ^ in7;
+        out4 = tmp3 ^ tmp5;
+        out1 = tmp4 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C7)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in2 ^ in4;
+        tmp0 = in3 ^ in5;
+        tmp1 = out3 ^ in7;
+        out6 = tmp0 ^ in0 ^ in4;
+        out5 = tmp1 ^ in3;
+        out2 = out6 ^ in6;
+        out7 = out2 ^ in1 ^ in3;
+        out0 = tmp1 ^ out7;
+        out1 = tmp0 ^ out0;
+        out4 = out1 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C8)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out0 = in1 ^ in2;
+        out1 = in2 ^ in3;
+        tmp0 = in5 ^ in6;
+        tmp1 = in0 ^ in7;
+        out2 = out1 ^ in1 ^ in4;
+        out4 = tmp0 ^ in4;
+        out5 = tmp0 ^ in7;
+        out6 = tmp1 ^ in6;
+        out7 = tmp1 ^ in1;
+        out3 = out2 ^ in0 ^ in2 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(C9)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in5 ^ in6;
+        out7 = in0 ^ in1;
+        tmp0 = in1 ^ in3;
+        out5 = in6 ^ in7;
+        out6 = in0 ^ in7;
+        out0 = out7 ^ in2;
+        out3 = out7 ^ in4 ^ in5;
+        out1 = tmp0 ^ in2;
+        out2 = tmp0 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(CA)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in7;
+        tmp1 = in2 ^ in7;
+        tmp2 = tmp0 ^ in6;
+        out0 = tmp1 ^ in1;
+        tmp3 = tmp1 ^ in3;
+        out6 = tmp2 ^ in5;
+        out7 = tmp2 ^ in1;
+        out2 = tmp3 ^ in4;
+        out5 = out6 ^ in0 ^ in4;
+        out4 = out5 ^ in3;
+        out1 = tmp0 ^ tmp3;
+        out3 = tmp3 ^ out5 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(CB)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in7;
+        tmp1 = in5 ^ in7;
+        out7 = in0 ^ in1 ^ in6;
+        out5 = tmp0 ^ in6;
+        out2 = tmp0 ^ in3;
+        out6 = tmp1 ^ in0;
+        out4 = tmp1 ^ in3 ^ in6;
+        tmp2 = out5 ^ out7 ^ in2;
+        out1 = tmp2 ^ out2;
+        out0 = tmp2 ^ in4;
+        out3 = tmp2 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(CC)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in5;
+        tmp1 = in1 ^ in6;
+        out1 = in2 ^ in3 ^ in7;
+        out5 = tmp0 ^ in6;
+        out0 = tmp1 ^ in2;
+        tmp2 = out5 ^ in0 ^ in7;
+        out3 = tmp2 ^ in4;
+        out6 = tmp0 ^ out3;
+        out7 = tmp1 ^ tmp2 ^ in3;
+        tmp3 = out1 ^ out6;
+        out4 = tmp2 ^ tmp3;
+        out2 = tmp3 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(CD)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in3 ^ in6;
+        tmp0 = in0 ^ in1;
+        tmp1 = in2 ^ in7;
+        out6 = in0 ^ in4 ^ in7;
+        out2 = tmp0 ^ out5 ^ in4;
+        out7 = tmp0 ^ in5;
+        out0 = tmp0 ^ in2 ^ in6;
+        out4 = tmp1 ^ in5;
+        out1 = tmp1 ^ in1 ^ in3;
+        out3 = out6 ^ in5 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(CE)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in5;
+        tmp1 = tmp0 ^ in3;
+        out4 = tmp1 ^ in4;
+        tmp2 = out4 ^ in6;
+        out3 = tmp2 ^ in0;
+        out5 = tmp2 ^ in2;
+        out2 = out3 ^ in5 ^ in7;
+        out6 = tmp1 ^ out2;
+        out7 = out2 ^ out4 ^ in1;
+        out1 = tmp2 ^ out6;
+        out0 = tmp0 ^ out7 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(CF)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in6;
+        tmp1 = in0 ^ in1 ^ in5;
+        out4 = in2 ^ in3 ^ in5;
+        out5 = tmp0 ^ in4;
+        out7 = tmp1 ^ in6;
+        out1 = tmp1 ^ out4 ^ in7;
+        tmp2 = out5 ^ in0;
+        out2 = tmp2 ^ in7;
+        out3 = tmp2 ^ out4;
+        out6 = tmp0 ^ out2 ^ in5;
+        out0 = tmp0 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D0)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        tmp1 = in1 ^ in4;
+        tmp2 = in2 ^ in5;
+        out7 = tmp0 ^ tmp1;
+        out0 = tmp1 ^ tmp2;
+        tmp3 = tmp2 ^ in3;
+        out1 = tmp3 ^ in6;
+        tmp4 = out1 ^ in1;
+        out2 = tmp4 ^ in7;
+        out3 = out2 ^ in2;
+        out4 = tmp0 ^ out3;
+        out5 = tmp3 ^ out3;
+        out6 = tmp4 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D1)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in5 ^ in6;
+        tmp1 = tmp0 ^ in1;
+        out1 = tmp1 ^ in2;
+        out2 = tmp1 ^ in7;
+        out3 = out2 ^ in3;
+        out5 = out3 ^ in2;
+        tmp2 = out3 ^ in0;
+        out4 = tmp2 ^ in4;
+        out7 = tmp0 ^ out4;
+        out6 = tmp2 ^ out1 ^ in6;
+        out0 = out2 ^ out6 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D2)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in5 ^ in6;
+        out2 = tmp0 ^ in2 ^ in3;
+        out1 = out2 ^ in0;
+        out3 = out2 ^ in1;
+        out4 = out1 ^ in1 ^ in2;
+        out6 = out1 ^ in6 ^ in7;
+        out7 = out4 ^ in4 ^ in5;
+        out5 = out4 ^ out6 ^ in4;
+        out0 = tmp0 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D3)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in3 ^ in5 ^ in6;
+        tmp0 = out2 ^ in2;
+        tmp1 = tmp0 ^ in1;
+        out1 = tmp1 ^ in0;
+        out3 = tmp1 ^ in3;
+        out4 = out1 ^ in2 ^ in4;
+        tmp2 = out4 ^ in5;
+        out7 = tmp2 ^ in7;
+        out0 = tmp0 ^ out7;
+        tmp3 = out0 ^ in0;
+        out5 = tmp3 ^ in6;
+        out6 = tmp2 ^ tmp3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D4)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in3 ^ in5;
+        tmp0 = in1 ^ in5;
+        tmp1 = tmp0 ^ in2;
+        out4 = tmp1 ^ in0;
+        tmp2 = tmp1 ^ in6;
+        out2 = out4 ^ in3 ^ in7;
+        out0 = tmp2 ^ in4;
+        out5 = tmp2 ^ out3;
+        out1 = tmp0 ^ out5 ^ in7;
+        out6 = tmp0 ^ out2 ^ in4;
+        out7 = tmp1 ^ out6 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D5)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in5;
+        tmp0 = in0 ^ in4;
+        tmp1 = tmp0 ^ in1 ^ in5;
+        out4 = tmp1 ^ in2;
+        out0 = out4 ^ in6;
+        tmp2 = tmp0 ^ out0;
+        out5 = tmp2 ^ in3;
+        out1 = out5 ^ in7;
+        out6 = tmp1 ^ out1;
+        out7 = tmp2 ^ out6;
+        out2 = out7 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D6)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2 ^ in4 ^ in6;
+        out5 = tmp0 ^ in3;
+        out0 = tmp0 ^ in5 ^ in7;
+        out3 = out0 ^ out5 ^ in2;
+        tmp1 = out3 ^ in0;
+        out1 = tmp1 ^ in6;
+        out2 = tmp1 ^ in7;
+        out4 = tmp1 ^ in1;
+        out6 = tmp1 ^ in4;
+        out7 = tmp0 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D7)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in3;
+        out3 = in2 ^ in5 ^ in7;
+        out2 = tmp0 ^ in5;
+        tmp1 = tmp0 ^ out3 ^ in1;
+        out1 = tmp1 ^ in6;
+        out4 = tmp1 ^ in4;
+        tmp2 = out1 ^ in4;
+        out6 = tmp2 ^ in1;
+        out7 = tmp2 ^ in2;
+        out0 = tmp2 ^ in3;
+        out5 = tmp2 ^ in0 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D8)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in0;
+        out5 = in1;
+        tmp0 = in1 ^ in2;
+        out6 = in0 ^ in2;
+        out0 = tmp0 ^ in4;
+        tmp1 = tmp0 ^ in3;
+        out7 = tmp1 ^ out6;
+        out2 = tmp1 ^ in6;
+        out3 = out7 ^ in7;
+        out1 = tmp1 ^ in1 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(D9)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in0 ^ in4;
+        out5 = in1 ^ in5;
+        out2 = in1 ^ in3 ^ in6;
+        out3 = in0 ^ in1 ^ in7;
+        out6 = in0 ^ in2 ^ in6;
+        out0 = out4 ^ in1 ^ in2;
+        out1 = out5 ^ in2 ^ in3;
+        out7 = out3 ^ in3;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(DA)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out5 = in1 ^ in4;
+        tmp0 = in2 ^ in7;
+        tmp1 = in0 ^ in2 ^ in3;
+        out0 = tmp0 ^ out5;
+        out4 = tmp0 ^ tmp1;
+        out2 = tmp0 ^ in3 ^ in6;
+        out1 = tmp1 ^ in5;
+        out3 = tmp1 ^ in1;
+        out6 = out1 ^ in3;
+        out7 = out3 ^ in2 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(DB)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in1 ^ in5;
+        tmp2 = in3 ^ in7;
+        out3 = tmp0 ^ in2;
+        out5 = tmp1 ^ in4;
+        out6 = tmp1 ^ out3 ^ in6;
+        out2 = tmp2 ^ in6;
+        tmp3 = tmp2 ^ in4;
+        tmp4 = out3 ^ in3;
+        out4 = tmp3 ^ in0;
+        out1 = tmp4 ^ in5;
+        out0 = tmp3 ^ tmp4;
+        out7 = tmp0 ^ out2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(DC)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in2;
+        tmp1 = in0 ^ in3;
+        out6 = tmp0 ^ in4;
+        tmp2 = tmp0 ^ in7;
+        out3 = tmp1 ^ in6;
+        tmp3 = tmp1 ^ in1;
+        out1 = tmp1 ^ tmp2 ^ in5;
+        out4 = tmp2 ^ in6;
+        out2 = tmp3 ^ in2;
+        out7 = tmp3 ^ in5;
+        out5 = tmp2 ^ out2;
+        out0 = out2 ^ out3 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(DD)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0 ^ in6;
+        out2 = in0 ^ in1 ^ in3;
+        out6 = out3 ^ in2 ^ in4;
+        out7 = out2 ^ in5 ^ in7;
+        out0 = out6 ^ in1;
+        out4 = out6 ^ in7;
+        out5 = out7 ^ in0;
+        out1 = out5 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(DE)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3 ^ in6;
+        tmp1 = in3 ^ in4 ^ in7;
+        out4 = tmp0 ^ in0;
+        out5 = tmp1 ^ in1;
+        out3 = out4 ^ in7;
+        out2 = out3 ^ in6;
+        out1 = out2 ^ in5;
+        out6 = tmp1 ^ out1;
+        out0 = tmp0 ^ out5;
+        out7 = out0 ^ out1 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(DF)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0 ^ in3 ^ in7;
+        tmp0 = out2 ^ in1 ^ in5;
+        out1 = tmp0 ^ in2;
+        out7 = tmp0 ^ in6;
+        out5 = tmp0 ^ in0 ^ in4;
+        tmp1 = out1 ^ out5 ^ in6;
+        out4 = tmp1 ^ in3;
+        out6 = tmp1 ^ in5;
+        tmp2 = tmp1 ^ in7;
+        out0 = tmp2 ^ in1;
+        out3 = tmp2 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E0)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in1 ^ in7;
+        tmp0 = in2 ^ in4;
+        out4 = out3 ^ in3 ^ in5;
+        out2 = tmp0 ^ in1;
+        tmp1 = tmp0 ^ in6;
+        out0 = out4 ^ in2;
+        out6 = out4 ^ in0;
+        out1 = tmp1 ^ in3;
+        out5 = tmp1 ^ in0;
+        out7 = out5 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E1)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in1 ^ in4;
+        tmp0 = in1 ^ in7;
+        out3 = tmp0 ^ in3;
+        tmp1 = out3 ^ in5;
+        out4 = tmp1 ^ in4;
+        tmp2 = tmp1 ^ in0;
+        out0 = tmp2 ^ in2;
+        out6 = tmp2 ^ in6;
+        tmp3 = out0 ^ out4 ^ in6;
+        out5 = tmp3 ^ in5;
+        out7 = tmp0 ^ tmp3;
+        out1 = tmp2 ^ out5 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E2)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in1 ^ in2;
+        out4 = in1 ^ in5;
+        out2 = in2 ^ in4 ^ in7;
+        out5 = in0 ^ in2 ^ in6;
+        out0 = out3 ^ in3 ^ in5;
+        out7 = out3 ^ in0 ^ in4;
+        out6 = out2 ^ out7 ^ in3;
+        out1 = out5 ^ in3 ^ in4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E3)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in4 ^ in7;
+        tmp0 = in1 ^ in3;
+        out3 = tmp0 ^ in2;
+        tmp1 = out3 ^ in0;
+        out0 = tmp1 ^ in5;
+        tmp2 = tmp1 ^ in4;
+        out1 = tmp2 ^ in6;
+        tmp3 = tmp2 ^ in3;
+        out7 = tmp3 ^ in7;
+        out6 = out1 ^ out2 ^ in2;
+        tmp4 = tmp0 ^ out0;
+        out5 = tmp4 ^ in6;
+        out4 = tmp3 ^ tmp4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E4)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in6;
+        tmp0 = in0 ^ in4;
+        tmp1 = tmp0 ^ in2 ^ in6;
+        out2 = tmp1 ^ in1;
+        out7 = out2 ^ in5;
+        tmp2 = tmp0 ^ out7;
+        out4 = tmp2 ^ in3;
+        out0 = out4 ^ in7;
+        out6 = tmp1 ^ out0;
+        out5 = tmp2 ^ out6;
+        out1 = out5 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E5)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in3 ^ in6;
+        tmp0 = in0 ^ in1;
+        tmp1 = in5 ^ in7;
+        out2 = tmp0 ^ in4 ^ in6;
+        tmp2 = tmp1 ^ out2;
+        out6 = tmp2 ^ in3;
+        out7 = tmp2 ^ in2;
+        out0 = out6 ^ in2 ^ in4;
+        out5 = out6 ^ in1 ^ in2;
+        out1 = tmp0 ^ out5 ^ in5;
+        out4 = tmp1 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E6)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in2 ^ in6 ^ in7;
+        out2 = out3 ^ in0 ^ in4;
+        out4 = out3 ^ in1 ^ in5;
+        out1 = out2 ^ in3;
+        out7 = out2 ^ out4 ^ in2;
+        out0 = out4 ^ in3 ^ in7;
+        out5 = out1 ^ in4;
+        out6 = out0 ^ out2 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E7)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in3;
+        out3 = tmp0 ^ in6 ^ in7;
+        tmp1 = out3 ^ in0;
+        out5 = tmp1 ^ in5;
+        tmp2 = tmp1 ^ in4;
+        tmp3 = out5 ^ in7;
+        out1 = tmp2 ^ in1;
+        out0 = tmp3 ^ in1;
+        out6 = out1 ^ in2;
+        out2 = tmp0 ^ tmp2;
+        tmp4 = tmp3 ^ out6;
+        out4 = tmp4 ^ in6;
+        out7 = tmp4 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E8)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in3 ^ in6;
+        tmp0 = in4 ^ in7;
+        out1 = in2 ^ in3 ^ in4;
+        out5 = tmp0 ^ in0;
+        tmp1 = tmp0 ^ in1;
+        tmp2 = tmp1 ^ in5;
+        out0 = tmp1 ^ out1;
+        out2 = tmp2 ^ in2;
+        out6 = tmp2 ^ out5;
+        tmp3 = out6 ^ in6;
+        out3 = tmp3 ^ in7;
+        out7 = tmp3 ^ in2 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(E9)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = in3 ^ in6;
+        tmp2 = tmp0 ^ in6;
+        out4 = tmp1 ^ in4;
+        out6 = tmp2 ^ in5;
+        out7 = tmp2 ^ in2 ^ in7;
+        out3 = out6 ^ in3 ^ in7;
+        out0 = tmp1 ^ out7;
+        out2 = out3 ^ out4 ^ in0;
+        out5 = tmp0 ^ out2;
+        out1 = out0 ^ out5 ^ in5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(EA)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in6 ^ in7;
+        out5 = in0 ^ in7;
+        out6 = in0 ^ in1;
+        out0 = in1 ^ in2 ^ in3;
+        out2 = in2 ^ in4 ^ in5;
+        out7 = out6 ^ in2;
+        out1 = out0 ^ out6 ^ in4;
+        out3 = out7 ^ in5 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(EB)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in4 ^ in5;
+        tmp0 = in0 ^ in1;
+        out4 = in4 ^ in6 ^ in7;
+        out5 = in0 ^ in5 ^ in7;
+        out6 = tmp0 ^ in6;
+        tmp1 = tmp0 ^ in2;
+        out0 = tmp1 ^ in3;
+        out7 = tmp1 ^ in7;
+        out1 = out0 ^ in4;
+        out3 = out0 ^ in5 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(EC)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out3 = in0 ^ in5;
+        out4 = in2 ^ in3 ^ in7;
+        out5 = in0 ^ in3 ^ in4;
+        out6 = out3 ^ in1 ^ in4;
+        out1 = out4 ^ in4;
+        out0 = out4 ^ in1 ^ in6;
+        out2 = out0 ^ out5 ^ in5;
+        out7 = out2 ^ in4 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(ED)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in2 ^ in4;
+        tmp1 = in3 ^ in5;
+        out4 = tmp0 ^ in3 ^ in7;
+        out3 = tmp1 ^ in0;
+        out1 = out4 ^ in1;
+        out5 = out3 ^ in4;
+        out7 = out1 ^ out5 ^ in6;
+        out2 = tmp0 ^ out7;
+        out0 = tmp1 ^ out7;
+        out6 = out2 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(EE)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in2;
+        tmp0 = in0 ^ in1;
+        out5 = in0 ^ in3;
+        tmp1 = tmp0 ^ in2;
+        out6 = tmp0 ^ in4;
+        tmp2 = tmp1 ^ out5;
+        out7 = tmp1 ^ in5;
+        out1 = tmp2 ^ out6 ^ in7;
+        out0 = tmp2 ^ in6;
+        tmp3 = out7 ^ in1;
+        out3 = tmp3 ^ in7;
+        out2 = tmp3 ^ in4 ^ in6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(EF)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out4 = in2 ^ in4;
+        tmp0 = in0 ^ in5;
+        tmp1 = in4 ^ in6;
+        out5 = tmp0 ^ in3;
+        out2 = tmp0 ^ tmp1;
+        out6 = tmp1 ^ in0 ^ in1;
+        out3 = out5 ^ in2 ^ in7;
+        out7 = out3 ^ in1 ^ in3;
+        out0 = out4 ^ out6 ^ in3;
+        out1 = tmp1 ^ out0 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F0)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = in4 ^ in5;
+        out2 = tmp0 ^ in6;
+        out3 = tmp1 ^ in1;
+        tmp2 = tmp1 ^ in7;
+        out1 = out2 ^ out3 ^ in3;
+        tmp3 = tmp0 ^ tmp2;
+        out0 = tmp3 ^ in3;
+        out5 = tmp3 ^ in0;
+        out4 = out1 ^ out5 ^ in4;
+        out7 = out4 ^ in2;
+        out6 = tmp2 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F1)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in1 ^ in6;
+        tmp0 = in3 ^ in5;
+        out3 = tmp0 ^ in1 ^ in4;
+        tmp1 = out3 ^ in2;
+        out1 = tmp1 ^ in6;
+        tmp2 = tmp1 ^ in0;
+        tmp3 = out1 ^ in5;
+        out0 = tmp2 ^ in7;
+        out6 = tmp2 ^ in4;
+        out7 = tmp3 ^ in0;
+        out5 = tmp0 ^ out0;
+        out4 = tmp3 ^ out5 ^ in1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F2)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in4 ^ in5;
+        out2 = in2 ^ in6 ^ in7;
+        tmp1 = tmp0 ^ in1;
+        tmp2 = tmp1 ^ in2;
+        out0 = tmp2 ^ in3;
+        out3 = tmp2 ^ in7;
+        out5 = out3 ^ in0 ^ in4;
+        tmp3 = tmp0 ^ out5;
+        out7 = tmp3 ^ in3;
+        out4 = tmp3 ^ out2;
+        out1 = out0 ^ out4 ^ in4;
+        out6 = tmp1 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F3)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in6 ^ in7;
+        tmp0 = in0 ^ in1;
+        out4 = tmp0 ^ in6;
+        tmp1 = tmp0 ^ in2;
+        out5 = tmp1 ^ in7;
+        out6 = tmp1 ^ in3;
+        out7 = out6 ^ in4;
+        out0 = out7 ^ in5;
+        out1 = out0 ^ in6;
+        out3 = out0 ^ in0 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F4)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0 ^ in1 ^ in2;
+        tmp0 = out2 ^ in3;
+        out4 = tmp0 ^ in4;
+        out5 = out4 ^ in5;
+        out6 = out5 ^ in6;
+        out7 = out6 ^ in7;
+        out0 = out7 ^ in0;
+        out1 = out0 ^ in1;
+        out3 = tmp0 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F5)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0 ^ in1;
+        tmp0 = out2 ^ in2;
+        out4 = tmp0 ^ in3;
+        out5 = out4 ^ in4;
+        out6 = out5 ^ in5;
+        out7 = out6 ^ in6;
+        out0 = out7 ^ in7;
+        out1 = out0 ^ in0;
+        out3 = tmp0 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F6)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in7;
+        out2 = tmp0 ^ in2;
+        out4 = out2 ^ in1 ^ in4;
+        out7 = out4 ^ in3 ^ in5;
+        out5 = out7 ^ in4 ^ in7;
+        out0 = tmp0 ^ out7 ^ in6;
+        tmp1 = out0 ^ in1;
+        out6 = out0 ^ in0 ^ in5;
+        out3 = tmp1 ^ in3;
+        out1 = tmp0 ^ tmp1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F7)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0 ^ in7;
+        tmp0 = out2 ^ in1;
+        out4 = tmp0 ^ in2;
+        out5 = out4 ^ in3 ^ in7;
+        out6 = out5 ^ in4;
+        out7 = out6 ^ in5;
+        out0 = out7 ^ in6;
+        out1 = out0 ^ in7;
+        out3 = tmp0 ^ out1;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F8)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in4;
+        tmp1 = in3 ^ in5;
+        tmp2 = tmp0 ^ in6;
+        out4 = tmp0 ^ tmp1;
+        out1 = tmp1 ^ in2 ^ in4;
+        out3 = tmp2 ^ in1;
+        out5 = out3 ^ in5;
+        out7 = out1 ^ out5 ^ in7;
+        out6 = tmp1 ^ out7;
+        out0 = tmp2 ^ out7;
+        out2 = out6 ^ in0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(F9)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in3 ^ in5;
+        tmp1 = in0 ^ in6;
+        out4 = tmp0 ^ in0;
+        tmp2 = tmp1 ^ in4;
+        tmp3 = tmp1 ^ in2;
+        out5 = tmp2 ^ in1;
+        out3 = out5 ^ in3;
+        tmp4 = tmp3 ^ out3;
+        out1 = tmp4 ^ in5;
+        out0 = tmp4 ^ in0 ^ in7;
+        out6 = tmp0 ^ out0 ^ in4;
+        out7 = tmp2 ^ tmp4;
+        out2 = tmp3 ^ out6;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(FA)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in1;
+        tmp1 = tmp0 ^ in2;
+        tmp2 = tmp0 ^ in5;
+        tmp3 = tmp1 ^ in7;
+        out5 = tmp2 ^ in6;
+        out6 = tmp3 ^ in6;
+        out7 = tmp3 ^ in3;
+        out3 = out6 ^ in4;
+        out2 = tmp1 ^ out5;
+        out4 = out2 ^ out3 ^ in1;
+        out0 = out4 ^ out7 ^ in5;
+        out1 = tmp2 ^ out0;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(FB)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in5 ^ in6;
+        tmp0 = in0 ^ in1;
+        out4 = in0 ^ in5 ^ in7;
+        out5 = tmp0 ^ in6;
+        tmp1 = tmp0 ^ in2;
+        out6 = tmp1 ^ in7;
+        out7 = tmp1 ^ in3;
+        out0 = out7 ^ in4;
+        out1 = out0 ^ in5;
+        out3 = out0 ^ in6 ^ in7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(FC)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in1 ^ in2;
+        tmp1 = in0 ^ in7;
+        out2 = tmp0 ^ tmp1 ^ in5;
+        out3 = tmp1 ^ in4;
+        tmp2 = out2 ^ in6;
+        out6 = tmp2 ^ in4;
+        out7 = tmp2 ^ in3;
+        out4 = out6 ^ in1 ^ in3;
+        tmp3 = out4 ^ in0;
+        out1 = tmp3 ^ in6;
+        out0 = tmp3 ^ in1 ^ in5;
+        out5 = tmp0 ^ out4;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(FD)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in5;
+        tmp1 = in1 ^ in7;
+        out2 = tmp0 ^ tmp1;
+        out6 = out2 ^ in2 ^ in4;
+        tmp2 = out6 ^ in0;
+        out1 = tmp2 ^ in3;
+        out0 = tmp0 ^ out1 ^ in6;
+        out5 = out0 ^ in2;
+        tmp3 = out5 ^ in1;
+        out3 = tmp3 ^ in6;
+        out7 = tmp2 ^ tmp3;
+        out4 = tmp1 ^ out7;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(FE)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3, tmp4;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        tmp0 = in0 ^ in2;
+        out2 = tmp0 ^ in5;
+        out3 = tmp0 ^ in4;
+        tmp1 = out3 ^ in6;
+        out4 = tmp1 ^ in5;
+        tmp2 = tmp1 ^ in1;
+        out6 = tmp2 ^ in7;
+        tmp3 = tmp2 ^ in0;
+        out0 = tmp3 ^ in3;
+        tmp4 = out0 ^ out4 ^ in7;
+        out5 = tmp4 ^ in6;
+        out7 = tmp4 ^ in2;
+        out1 = tmp3 ^ out5;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static void EC_GF_NAME(FF)(uint8_t * out, uint8_t * in, unsigned int width)
+{
+    unsigned int i;
+    EC_GF_WORD * in_ptr = (EC_GF_WORD *)in;
+    EC_GF_WORD * out_ptr = (EC_GF_WORD *)out;
+
+    width /= EC_GF_LANES;
+
+    for (i = 0; i < width; i++)
+    {
+        EC_GF_WORD out0, out1, out2, out3, out4, out5, out6, out7;
+        EC_GF_WORD tmp0, tmp1, tmp2, tmp3;
+
+        EC_GF_WORD in0 = out_ptr[0];
+        EC_GF_WORD in1 = out_ptr[width];
+        EC_GF_WORD in2 = out_ptr[width * 2];
+        EC_GF_WORD in3 = out_ptr[width * 3];
+        EC_GF_WORD in4 = out_ptr[width * 4];
+        EC_GF_WORD in5 = out_ptr[width * 5];
+        EC_GF_WORD in6 = out_ptr[width * 6];
+        EC_GF_WORD in7 = out_ptr[width * 7];
+
+        out2 = in0 ^ in5;
+        tmp0 = in4 ^ in7;
+        tmp1 = out2 ^ in2;
+        out4 = tmp1 ^ in6;
+        out7 = tmp1 ^ in1 ^ in3;
+        out1 = tmp0 ^ out7;
+        tmp2 = out1 ^ in5;
+        out6 = tmp2 ^ in3;
+        tmp3 = tmp2 ^ in7;
+        out0 = tmp3 ^ in6;
+        out3 = tmp3 ^ in1;
+        out5 = tmp0 ^ out0 ^ in2;
+
+        out_ptr[0] = out0 ^ in_ptr[0];
+        out_ptr[width] = out1 ^ in_ptr[width];
+        out_ptr[width * 2] = out2 ^ in_ptr[width * 2];
+        out_ptr[width * 3] = out3 ^ in_ptr[width * 3];
+        out_ptr[width * 4] = out4 ^ in_ptr[width * 4];
+        out_ptr[width * 5] = out5 ^ in_ptr[width * 5];
+        out_ptr[width * 6] = out6 ^ in_ptr[width * 6];
+        out_ptr[width * 7] = out7 ^ in_ptr[width * 7];
+
+        in_ptr++;
+        out_ptr++;
+    }
+}
+
+static ec_gf_muladd_t EC_GF_TABLE[] =
+{
+    EC_GF_NAME(00), EC_GF_NAME(01), EC_GF_NAME(02), EC_GF_NAME(03),
+    EC_GF_NAME(04), EC_GF_NAME(05), EC_GF_NAME(06), EC_GF_NAME(07),
+    EC_GF_NAME(08), EC_GF_NAME(09), EC_GF_NAME(0A), EC_GF_NAME(0B),
+    EC_GF_NAME(0C), EC_GF_NAME(0D), EC_GF_NAME(0E), EC_GF_NAME(0F),
+    EC_GF_NAME(10), EC_GF_NAME(11), EC_GF_NAME(12), EC_GF_NAME(13),
+    EC_GF_NAME(14), EC_GF_NAME(15), EC_GF_NAME(16), EC_GF_NAME(17),
+    EC_GF_NAME(18), EC_GF_NAME(19), EC_GF_NAME(1A), EC_GF_NAME(1B),
+    EC_GF_NAME(1C), EC_GF_NAME(1D), EC_GF_NAME(1E), EC_GF_NAME(1F),
+    EC_GF_NAME(20), EC_GF_NAME(21), EC_GF_NAME(22), EC_GF_NAME(23),
+    EC_GF_NAME(24), EC_GF_NAME(25), EC_GF_NAME(26), EC_GF_NAME(27),
+    EC_GF_NAME(28), EC_GF_NAME(29), EC_GF_NAME(2A), EC_GF_NAME(2B),
+    EC_GF_NAME(2C), EC_GF_NAME(2D), EC_GF_NAME(2E), EC_GF_NAME(2F),
+    EC_GF_NAME(30), EC_GF_NAME(31), EC_GF_NAME(32), EC_GF_NAME(33),
+    EC_GF_NAME(34), EC_GF_NAME(35), EC_GF_NAME(36), EC_GF_NAME(37),
+    EC_GF_NAME(38), EC_GF_NAME(39), EC_GF_NAME(3A), EC_GF_NAME(3B),
+    EC_GF_NAME(3C), EC_GF_NAME(3D), EC_GF_NAME(3E), EC_GF_NAME(3F),
+    EC_GF_NAME(40), EC_GF_NAME(41), EC_GF_NAME(42), EC_GF_NAME(43),
+    EC_GF_NAME(44), EC_GF_NAME(45), EC_GF_NAME(46), EC_GF_NAME(47),
+    EC_GF_NAME(48), EC_GF_NAME(49), EC_GF_NAME(4A), EC_GF_NAME(4B),
+    EC_GF_NAME(4C), EC_GF_NAME(4D), EC_GF_NAME(4E), EC_GF_NAME(4F),
+    EC_GF_NAME(50), EC_GF_NAME(51), EC_GF_NAME(52), EC_GF_NAME(53),
+    EC_GF_NAME(54), EC_GF_NAME(55), EC_GF_NAME(56), EC_GF_NAME(57),
+    EC_GF_NAME(58), EC_GF_NAME(59), EC_GF_NAME(5A), EC_GF_NAME(5B),
+    EC_GF_NAME(5C), EC_GF_NAME(5D), EC_GF_NAME(5E), EC_GF_NAME(5F),
+    EC_GF_NAME(60), EC_GF_NAME(61), EC_GF_NAME(62), EC_GF_NAME(63),
+    EC_GF_NAME(64), EC_GF_NAME(65), EC_GF_NAME(66), EC_GF_NAME(67),
+    EC_GF_NAME(68), EC_GF_NAME(69), EC_GF_NAME(6A), EC_GF_NAME(6B),
+    EC_GF_NAME(6C), EC_GF_NAME(6D), EC_GF_NAME(6E), EC_GF_NAME(6F),
+    EC_GF_NAME(70), EC_GF_NAME(71), EC_GF_NAME(72), EC_GF_NAME(73),
+    EC_GF_NAME(74), EC_GF_NAME(75), EC_GF_NAME(76), EC_GF_NAME(77),
+    EC_GF_NAME(78), EC_GF_NAME(79), EC_GF_NAME(7A), EC_GF_NAME(7B),
+    EC_GF_NAME(7C), EC_GF_NAME(7D), EC_GF_NAME(7E), EC_GF_NAME(7F),
+    EC_GF_NAME(80), EC_GF_NAME(81), EC_GF_NAME(82), EC_GF_NAME(83),
+    EC_GF_NAME(84), EC_GF_NAME(85), EC_GF_NAME(86), EC_GF_NAME(87),
+    EC_GF_NAME(88), EC_GF_NAME(89), EC_GF_NAME(8A), EC_GF_NAME(8B),
+    EC_GF_NAME(8C), EC_GF_NAME(8D), EC_GF_NAME(8E), EC_GF_NAME(8F),
+    EC_GF_NAME(90), EC_GF_NAME(91), EC_GF_NAME(92), EC_GF_NAME(93),
+    EC_GF_NAME(94), EC_GF_NAME(95), EC_GF_NAME(96), EC_GF_NAME(97),
+    EC_GF_NAME(98), EC_GF_NAME(99), EC_GF_NAME(9A), EC_GF_NAME(9B),
+    EC_GF_NAME(9C), EC_GF_NAME(9D), EC_GF_NAME(9E), EC_GF_NAME(9F),
+    EC_GF_NAME(A0), EC_GF_NAME(A1), EC_GF_NAME(A2), EC_GF_NAME(A3),
+    EC_GF_NAME(A4), EC_GF_NAME(A5), EC_GF_NAME(A6), EC_GF_NAME(A7),
+    EC_GF_NAME(A8), EC_GF_NAME(A9), EC_GF_NAME(AA), EC_GF_NAME(AB),
+    EC_GF_NAME(AC), EC_GF_NAME(AD), EC_GF_NAME(AE), EC_GF_NAME(AF),
+    EC_GF_NAME(B0), EC_GF_NAME(B1), EC_GF_NAME(B2), EC_GF_NAME(B3),
+    EC_GF_NAME(B4), EC_GF_NAME(B5), EC_GF_NAME(B6), EC_GF_NAME(B7),
+    EC_GF_NAME(B8), EC_GF_NAME(B9), EC_GF_NAME(BA), EC_GF_NAME(BB),
+    EC_GF_NAME(BC), EC_GF_NAME(BD), EC_GF_NAME(BE), EC_GF_NAME(BF),
+    EC_GF_NAME(C0), EC_GF_NAME(C1), EC_GF_NAME(C2), EC_GF_NAME(C3),
+    EC_GF_NAME(C4), EC_GF_NAME(C5), EC_GF_NAME(C6), EC_GF_NAME(C7),
+    EC_GF_NAME(C8), EC_GF_NAME(C9), EC_GF_NAME(CA), EC_GF_NAME(CB),
+    EC_GF_NAME(CC), EC_GF_NAME(CD), EC_GF_NAME(CE), EC_GF_NAME(CF),
+    EC_GF_NAME(D0), EC_GF_NAME(D1), EC_GF_NAME(D2), EC_GF_NAME(D3),
+    EC_GF_NAME(D4), EC_GF_NAME(D5), EC_GF_NAME(D6), EC_GF_NAME(D7),
+    EC_GF_NAME(D8), EC_GF_NAME(D9), EC_GF_NAME(DA), EC_GF_NAME(DB),
+    EC_GF_NAME(DC), EC_GF_NAME(DD), EC_GF_NAME(DE), EC_GF_NAME(DF),
+    EC_GF_NAME(E0), EC_GF_NAME(E1), EC_GF_NAME(E2), EC_GF_NAME(E3),
+    EC_GF_NAME(E4), EC_GF_NAME(E5), EC_GF_NAME(E6), EC_GF_NAME(E7),
+    EC_GF_NAME(E8), EC_GF_NAME(E9), EC_GF_NAME(EA), EC_GF_NAME(EB),
+    EC_GF_NAME(EC), EC_GF_NAME(ED), EC_GF_NAME(EE), EC_GF_NAME(EF),
+    EC_GF_NAME(F0), EC_GF_NAME(F1), EC_GF_NAME(F2), EC_GF_NAME(F3),
+    EC_GF_NAME(F4), EC_GF_NAME(F5), EC_GF_NAME(F6), EC_GF_NAME(F7),
+    EC_GF_NAME(F8), EC_GF_NAME(F9), EC_GF_NAME(FA), EC_GF_NAME(FB),
+    EC_GF_NAME(FC), EC_GF_NAME(FD), EC_GF_NAME(FE), EC_GF_NAME(FF)
+};
@@ -20,13 +20,35 @@
 
 #include <string.h>
 #include <inttypes.h>
+#include <pthread.h>
 
 #include "ec-gf.h"
 #include "ec-method.h"
 
+#define EC_METHOD_CACHE_SIZE 16
+
+/* How to rebuild the data from one set of fragments. mul[i][j] is the
+ * kernel applied to output row i before fragment j is added to it, or
+ * EC_GF_SIZE if fragment j is not part of that row; last[i] is the final
+ * multiplier of the row. */
+typedef struct _ec_method_matrix
+{
+    uint64_t stamp;
+    uint32_t columns;
+    uint32_t rows[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t mul[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS];
+    uint32_t last[EC_METHOD_MAX_FRAGMENTS];
+} ec_method_matrix_t;
+
 static uint32_t GfPow[EC_GF_SIZE << 1];
 static uint32_t GfLog[EC_GF_SIZE << 1];
 
+static uint8_t ec_method_zero[EC_METHOD_CHUNK_SIZE];
+
+static pthread_mutex_t ec_method_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static ec_method_matrix_t ec_method_cache[EC_METHOD_CACHE_SIZE];
+static uint64_t ec_method_clock;
+
 void ec_method_initialize(void)
 {
     uint32_t i;
@@ -89,20 +111,19 @@ size_t ec_method_encode(size_t size, uint32_t columns, uint32_t row,
     return size * EC_METHOD_CHUNK_SIZE;
 }
 
-size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
-                        uint8_t ** in, uint8_t * out)
+/* Builds the decoding matrix of a set of fragments, inverts it and turns
+ * every row of the inverse into the sequence of multiply-adds (a Horner
+ * evaluation over the fragments in order) that produces that row. */
+static void ec_method_matrix_build(ec_method_matrix_t * matrix,
+                                   uint32_t columns, uint32_t * rows)
 {
-    uint32_t i, j, k, off, last, value;
+    uint32_t i, j, k, last;
     uint32_t f;
     uint8_t inv[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS + 1];
     uint8_t mtx[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS];
-    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
-
-    size /= EC_METHOD_CHUNK_SIZE;
 
     memset(inv, 0, sizeof(inv));
     memset(mtx, 0, sizeof(mtx));
-    memset(dummy, 0, sizeof(dummy));
     for (i = 0; i < columns; i++)
     {
         inv[i][i] = 1;
@@ -138,28 +159,107 @@ size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
             }
         }
     }
+
+    matrix->columns = columns;
+    for (i = 0; i < columns; i++)
+    {
+        matrix->rows[i] = rows[i];
+
+        last = 0;
+        for (j = 0; j < columns; j++)
+        {
+            /* A zero coefficient gives EC_GF_SIZE: the fragment is not
+             * used for this row. */
+            matrix->mul[i][j] = ec_method_div(last, inv[i][j]);
+            if (inv[i][j] != 0)
+            {
+                last = inv[i][j];
+            }
+        }
+        matrix->last[i] = last;
+    }
+}
+
+/* Gets the decoding steps for a set of fragments from the cache, building
+ * them on a miss. Degraded reads keep asking for the same few sets. */
+static void ec_method_matrix_get(ec_method_matrix_t * matrix,
+                                 uint32_t columns, uint32_t * rows)
+{
+    ec_method_matrix_t * entry, * victim;
+    uint32_t i;
+
+    pthread_mutex_lock(&ec_method_cache_lock);
+
+    victim = &ec_method_cache[0];
+    for (i = 0; i < EC_METHOD_CACHE_SIZE; i++)
+    {
+        entry = &ec_method_cache[i];
+        if ((entry->columns == columns) &&
+            (memcmp(entry->rows, rows, sizeof(uint32_t) * columns) == 0))
+        {
+            entry->stamp = ++ec_method_clock;
+            *matrix = *entry;
+
+            pthread_mutex_unlock(&ec_method_cache_lock);
+
+            return;
+        }
+        if (entry->stamp < victim->stamp)
+        {
+            victim = entry;
+        }
+    }
+
+    pthread_mutex_unlock(&ec_method_cache_lock);
+
+    ec_method_matrix_build(matrix, columns, rows);
+
+    pthread_mutex_lock(&ec_method_cache_lock);
+
+    /* Another thread may have replaced the victim meanwhile, which only
+     * costs it its entry. */
+    *victim = *matrix;
+    victim->stamp = ++ec_method_clock;
+
+    pthread_mutex_unlock(&ec_method_cache_lock);
+}
+
+size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
+                        uint8_t ** in, uint8_t * out)
+{
+    ec_method_matrix_t matrix;
+    uint32_t i, j, f, off, mul;
+    uint8_t * chunk;
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    ec_method_matrix_get(&matrix, columns, rows);
+
     off = 0;
     for (f = 0; f < size; f++)
     {
-        for (i = 0; i < columns; i++)
+        /* Every fragment chunk is read once and added to all the output
+         * chunks of the stripe while it is hot. */
+        for (j = 0; j < columns; j++)
         {
-            last = 0;
-            j = 0;
-            do
+            chunk = out;
+            for (i = 0; i < columns; i++)
             {
-                while (inv[i][j] == 0)
-                {
-                    j++;
-                }
-                if (j < columns)
+                mul = matrix.mul[i][j];
+                if (mul < EC_GF_SIZE)
                 {
-                    value = ec_method_div(last, inv[i][j]);
-                    last = inv[i][j];
-                    ec_gf_muladd[value](out, in[j] + off, EC_METHOD_WIDTH);
-                    j++;
+                    ec_gf_muladd[mul](chunk, in[j] + off, EC_METHOD_WIDTH);
                 }
-            } while (j < columns);
-            ec_gf_muladd[last](out, dummy, EC_METHOD_WIDTH);
+                chunk += EC_METHOD_CHUNK_SIZE;
+            }
+        }
+        for (i = 0; i < columns; i++)
+        {
+            if (matrix.last[i] != 1)
+            {
+                ec_gf_muladd[matrix.last[i]](out, ec_method_zero,
+                                             EC_METHOD_WIDTH);
+            }
             out += EC_METHOD_CHUNK_SIZE;
         }
         off += EC_METHOD_CHUNK_SIZE;
@@ -380,6 +380,9 @@ int32_t init(xlator_t * this)
 
     ec_method_initialize();
 
+    gf_log(this->name, GF_LOG_DEBUG, "Using %s Galois field kernels.",
+           ec_gf_select(NULL));
+
     gf_log(this->name, GF_LOG_DEBUG, "Disperse translator initialized.");
 
     return 0;
@@ -0,0 +1,212 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Encode and decode throughput of every Galois field implementation built
+ * into cluster/ec, for the usual disperse configurations. Decoding always
+ * uses the last k fragments, so redundancy is involved, and is measured
+ * on large buffers and one stripe at a time. The fragments of
+ * every implementation are compared with those of the plain C one, which
+ * is what is on disk today.
+ *
+ * usage: ec_method_bench [megabytes-per-run]
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ec-method.h"
+
+#define BENCH_STRIPES 2048
+
+static uint32_t bench_configs[][2] =
+{
+    { 2, 1 }, { 4, 2 }, { 8, 3 }, { 8, 4 }, { 16, 4 }
+};
+
+static double bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench_encode(uint8_t * data, size_t size, uint32_t k, uint32_t n,
+                         uint8_t ** frags)
+{
+    uint32_t row;
+
+    for (row = 0; row < n; row++)
+    {
+        ec_method_encode(size, k, row, data, frags[row]);
+    }
+}
+
+/* Returns 0 if decoding and, for other than the reference, encoding give
+ * the same bytes as the reference. */
+static int32_t bench_config(uint32_t k, uint32_t m, uint8_t * data,
+                            uint8_t ** ref, uint32_t runs, int32_t is_ref)
+{
+    uint8_t * frags[EC_METHOD_MAX_FRAGMENTS * 2];
+    uint8_t * in[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t rows[EC_METHOD_MAX_FRAGMENTS];
+    uint8_t * out;
+    size_t size, fsize;
+    double start, enc, dec, small;
+    uint32_t i, run, stripe;
+    int32_t ret = 0;
+
+    size = (size_t)BENCH_STRIPES * EC_METHOD_CHUNK_SIZE * k;
+    fsize = size / k;
+
+    out = malloc(size);
+    for (i = 0; i < k + m; i++)
+    {
+        frags[i] = is_ref ? ref[i] : malloc(fsize);
+    }
+
+    start = bench_now();
+    for (run = 0; run < runs; run++)
+    {
+        bench_encode(data, size, k, k + m, frags);
+    }
+    enc = bench_now() - start;
+
+    for (i = 0; i < k; i++)
+    {
+        rows[i] = m + i;
+        in[i] = frags[m + i];
+    }
+
+    start = bench_now();
+    for (run = 0; run < runs; run++)
+    {
+        ec_method_decode(fsize, k, rows, in, out);
+    }
+    dec = bench_now() - start;
+
+    /* one stripe per call, like small or unaligned reads */
+    start = bench_now();
+    for (run = 0; run < runs; run++)
+    {
+        for (stripe = 0; stripe < BENCH_STRIPES; stripe++)
+        {
+            for (i = 0; i < k; i++)
+            {
+                in[i] = frags[m + i] + stripe * EC_METHOD_CHUNK_SIZE;
+            }
+            ec_method_decode(EC_METHOD_CHUNK_SIZE, k, rows, in,
+                             out + stripe * EC_METHOD_CHUNK_SIZE * k);
+        }
+    }
+    small = bench_now() - start;
+
+    if (memcmp(out, data, size) != 0)
+    {
+        ret = -1;
+    }
+    for (i = 0; i < k + m; i++)
+    {
+        if (!is_ref)
+        {
+            if (memcmp(frags[i], ref[i], fsize) != 0)
+            {
+                ret = -1;
+            }
+            free(frags[i]);
+        }
+    }
+    free(out);
+
+    printf("%2u+%-2u %12.1f %12.1f %12.1f  %s\n", k, m,
+           (double)size * runs / enc / (1 << 20),
+           (double)size * runs / dec / (1 << 20),
+           (double)size * runs / small / (1 << 20),
+           ret ? "MISMATCH" : "ok");
+
+    return ret;
+}
+
+int main(int argc, char * argv[])
+{
+    uint8_t ** refs[sizeof(bench_configs) / sizeof(bench_configs[0])];
+    uint8_t * data;
+    const char * name;
+    size_t max;
+    uint32_t megs = 64, runs, i, c, k, m;
+    int32_t ret = 0;
+
+    if (argc > 1)
+    {
+        megs = atoi(argv[1]);
+    }
+
+    ec_method_initialize();
+
+    max = (size_t)BENCH_STRIPES * EC_METHOD_CHUNK_SIZE *
+          EC_METHOD_MAX_FRAGMENTS;
+    data = malloc(max);
+    if (data == NULL)
+    {
+        return 1;
+    }
+    srandom(1);
+    for (i = 0; i < max; i++)
+    {
+        data[i] = random();
+    }
+
+    for (c = 0; c < sizeof(bench_configs) / sizeof(bench_configs[0]); c++)
+    {
+        refs[c] = calloc(EC_METHOD_MAX_FRAGMENTS * 2, sizeof(uint8_t *));
+        for (i = 0; i < bench_configs[c][0] + bench_configs[c][1]; i++)
+        {
+            refs[c][i] = malloc(BENCH_STRIPES * EC_METHOD_CHUNK_SIZE);
+        }
+    }
+
+    /* the reference is built in last and always supported */
+    for (i = 0; ec_gf_name(i) != NULL; i++)
+        ;
+    while (i-- > 0)
+    {
+        name = ec_gf_name(i);
+        if (ec_gf_select(name) == NULL)
+        {
+            printf("%s: not supported\n", name);
+            continue;
+        }
+
+        printf("%s:\n%-5s %12s %12s %12s\n", name, "k+m", "encode MB/s",
+               "decode MB/s", "1-stripe MB/s");
+        for (c = 0; c < sizeof(bench_configs) / sizeof(bench_configs[0]);
+             c++)
+        {
+            k = bench_configs[c][0];
+            m = bench_configs[c][1];
+            runs = ((size_t)megs << 20) /
+                   ((size_t)BENCH_STRIPES * EC_METHOD_CHUNK_SIZE * k);
+            if (runs == 0)
+            {
+                runs = 1;
+            }
+
+            ret |= bench_config(k, m, data, refs[c], runs,
+                                strcmp(name, "c") == 0);
+        }
+    }
+
+    return ret ? 1 : 0;
+}
@@ -18,6 +18,9 @@ enum gf_io_stats_mem_types_ {
         gf_io_stats_mt_ios_fd,
         gf_io_stats_mt_ios_stat,
         gf_io_stats_mt_ios_stat_list,
+        gf_io_stats_mt_ios_client_stats,
+        gf_io_stats_mt_ios_global_stats,
+        gf_io_stats_mt_ios_client_snap,
         gf_io_stats_mt_end
 };
 #endif
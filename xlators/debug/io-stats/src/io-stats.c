@@ -23,6 +23,7 @@
  *  c) counts of read IO block size - since process start, last interval and per fd
  *  d) counts of write IO block size - since process start, last interval and per fd
  *  e) counts of all FOP types passing through it
+ *  f) latency of each FOP type, with percentiles, and per client on bricks
  *
  *  Usage: setfattr -n io-stats-dump /tmp/filename /mnt/gluster
  *
@@ -38,6 +39,7 @@
 #include "logging.h"
 #include "cli1-xdr.h"
 #include "statedump.h"
+#include "client_t.h"
 
 #define MAX_LIST_MEMBERS 100
 
@@ -86,11 +88,55 @@ struct ios_stat_head {
        struct ios_stat_list    *iosstats;
 };
 
+/*
+ * Latency histograms are log-linear, like HdrHistogram: latencies below
+ * IOS_HIST_SUB_COUNT usecs get a bucket each, and every power of two above
+ * is split into IOS_HIST_SUB_COUNT buckets, so a percentile read from them
+ * is within 1/IOS_HIST_SUB_COUNT of the real value. Latencies of 2^32 usecs
+ * (71 minutes) and more all land in the last bucket.
+ */
+#define IOS_HIST_SUB_BITS       4
+#define IOS_HIST_SUB_COUNT      (1 << IOS_HIST_SUB_BITS)
+#define IOS_HIST_MAX_BITS       32
+#define IOS_HIST_BUCKETS        ((IOS_HIST_MAX_BITS - IOS_HIST_SUB_BITS + 1) \
+                                 * IOS_HIST_SUB_COUNT)
+
+#define IOS_PERCENTILE_COUNT    4
+
+static const double ios_percentiles[IOS_PERCENTILE_COUNT] = {
+        50.0, 90.0, 99.0, 99.9
+};
+
+/* in the keys of volume profile and of the statedump */
+static const char *ios_percentile_names[IOS_PERCENTILE_COUNT] = {
+        "p50", "p90", "p99", "p999"
+};
+
 struct ios_lat {
         double      min;
         double      max;
         double      avg;
         uint64_t    total;
+        uint64_t    hist[IOS_HIST_BUCKETS];     /* atomic increments */
+};
+
+/* Per client of a brick, kept in the client_t. The counters are updated
+ * with atomic increments and read without locking. */
+struct ios_client_stats {
+        struct list_head  clients;
+        client_t         *client;
+        uint64_t          fop_hits[GF_FOP_MAXVALUE];
+        uint64_t          latency_total[GF_FOP_MAXVALUE];
+        uint64_t          hist[IOS_HIST_BUCKETS];       /* of all fops */
+};
+
+/* A copy of the stats of a client, taken under clients_lock so that the
+ * dumps are written without holding it */
+struct ios_client_snap {
+        char              uid[256];
+        uint64_t          fop_hits[GF_FOP_MAXVALUE];
+        uint64_t          latency_total[GF_FOP_MAXVALUE];
+        uint64_t          hist[IOS_HIST_BUCKETS];
 };
 
 struct ios_global_stats {
@@ -117,6 +163,8 @@ struct ios_conf {
         gf_boolean_t              measure_latency;
         struct ios_stat_head      list[IOS_STATS_TYPE_MAX];
         struct ios_stat_head      thru_list[IOS_STATS_THRU_MAX];
+        gf_lock_t                 clients_lock;
+        struct list_head          clients;      /* ios_client_stats */
 };
 
 
@@ -162,6 +210,79 @@ is_fop_latency_started (call_frame_t *frame)
         return memcmp (&frame->begin, &epoch, sizeof (epoch));
 }
 
+static inline int
+ios_hist_bucket (uint64_t usecs)
+{
+        int msb   = 0;
+        int shift = 0;
+
+        if (usecs < IOS_HIST_SUB_COUNT)
+                return usecs;
+
+        msb = 63 - __builtin_clzll (usecs);
+        if (msb >= IOS_HIST_MAX_BITS)
+                return IOS_HIST_BUCKETS - 1;
+
+        shift = msb - IOS_HIST_SUB_BITS;
+
+        return (shift + 1) * IOS_HIST_SUB_COUNT +
+               (usecs >> shift) - IOS_HIST_SUB_COUNT;
+}
+
+/* Highest latency counted in the bucket. */
+static uint64_t
+ios_hist_bucket_value (int bucket)
+{
+        int      shift = 0;
+        uint64_t sub   = 0;
+
+        if (bucket < IOS_HIST_SUB_COUNT)
+                return bucket;
+
+        shift = bucket / IOS_HIST_SUB_COUNT - 1;
+        sub = bucket % IOS_HIST_SUB_COUNT + IOS_HIST_SUB_COUNT;
+
+        return ((sub + 1) << shift) - 1;
+}
+
+/* Fills values with the latencies at ios_percentiles, 0 when there is
+ * nothing counted. max, if known, caps them, as the last bucket used is
+ * usually wider than what was actually seen. */
+static void
+ios_hist_percentiles (uint64_t *hist, double max, double *values)
+{
+        uint64_t count  = 0;
+        uint64_t seen   = 0;
+        uint64_t target = 0;
+        int      i      = 0;
+        int      p      = 0;
+
+        for (i = 0; i < IOS_HIST_BUCKETS; i++)
+                count += hist[i];
+
+        for (p = 0; p < IOS_PERCENTILE_COUNT; p++)
+                values[p] = 0;
+
+        if (!count)
+                return;
+
+        for (i = 0, p = 0; (i < IOS_HIST_BUCKETS) &&
+                           (p < IOS_PERCENTILE_COUNT); i++) {
+                seen += hist[i];
+                while (p < IOS_PERCENTILE_COUNT) {
+                        target = (uint64_t)(count * ios_percentiles[p] / 100);
+                        if (target == 0)
+                                target = 1;
+                        if (seen < target)
+                                break;
+                        values[p] = ios_hist_bucket_value (i);
+                        if (max && (values[p] > max))
+                                values[p] = max;
+                        p++;
+                }
+        }
+}
+
 #define END_FOP_LATENCY(frame, op)                                      \
         do {                                                            \
                 struct ios_conf  *conf = NULL;                          \
@@ -169,7 +290,7 @@ is_fop_latency_started (call_frame_t *frame)
                 conf = this->private;                                   \
                 if (conf && conf->measure_latency) {                    \
                         gettimeofday (&frame->end, NULL);               \
-                        update_ios_latency (conf, frame, GF_FOP_##op);  \
+                        update_ios_latency (this, frame, GF_FOP_##op);  \
                 }                                                       \
         } while (0)
 
@@ -204,16 +325,11 @@ is_fop_latency_started (call_frame_t *frame)
                 if (!is_fop_latency_started (frame))                          \
                         break;                                                \
                 conf = this->private;                                         \
-                LOCK (&conf->lock);                                           \
-                {                                                             \
-                        if (conf && conf->measure_latency &&                  \
-                            conf->count_fop_hits) {                           \
-                                BUMP_FOP(op);                                 \
-                                gettimeofday (&frame->end, NULL);             \
-                                update_ios_latency (conf, frame, GF_FOP_##op);\
-                        }                                                     \
-                }                                                             \
-                UNLOCK (&conf->lock);                                         \
+                if (!conf || !conf->measure_latency ||                        \
+                    !conf->count_fop_hits)                                    \
+                        break;                                                \
+                gettimeofday (&frame->end, NULL);                             \
+                update_ios_latency (this, frame, GF_FOP_##op);                \
         } while (0)
 
 #define BUMP_READ(fd, len)                                              \
@@ -582,6 +698,96 @@ ios_dump_throughput_stats (struct ios_stat_head *list_head, xlator_t *this,
         return 0;
 }
 
+/* Copies the stats of every client into an array allocated for the
+ * caller. clients_lock is a spinlock, so the array is sized before it is
+ * filled, and clients which came in between are left out. Returns the
+ * number of clients copied. */
+static int
+ios_client_snaps_get (struct ios_conf *conf, struct ios_client_snap **snapsp)
+{
+        struct ios_client_stats *client = NULL;
+        struct ios_client_snap  *snaps  = NULL;
+        int                      count  = 0;
+        int                      n      = 0;
+
+        *snapsp = NULL;
+
+        LOCK (&conf->clients_lock);
+        {
+                list_for_each_entry (client, &conf->clients, clients)
+                        count++;
+        }
+        UNLOCK (&conf->clients_lock);
+
+        if (!count)
+                return 0;
+
+        snaps = GF_CALLOC (count, sizeof (*snaps),
+                           gf_io_stats_mt_ios_client_snap);
+        if (!snaps)
+                return 0;
+
+        LOCK (&conf->clients_lock);
+        {
+                list_for_each_entry (client, &conf->clients, clients) {
+                        if (n == count)
+                                break;
+                        snprintf (snaps[n].uid, sizeof (snaps[n].uid), "%s",
+                                  client->client->client_uid);
+                        memcpy (snaps[n].fop_hits, client->fop_hits,
+                                sizeof (snaps[n].fop_hits));
+                        memcpy (snaps[n].latency_total, client->latency_total,
+                                sizeof (snaps[n].latency_total));
+                        memcpy (snaps[n].hist, client->hist,
+                                sizeof (snaps[n].hist));
+                        n++;
+                }
+        }
+        UNLOCK (&conf->clients_lock);
+
+        if (!n) {
+                GF_FREE (snaps);
+                snaps = NULL;
+        }
+
+        *snapsp = snaps;
+        return n;
+}
+
+static void
+ios_dump_client_stats (xlator_t *this, FILE *logfp)
+{
+        struct ios_conf         *conf   = this->private;
+        struct ios_client_snap  *snaps  = NULL;
+        double                   pct[IOS_PERCENTILE_COUNT] = {0, };
+        uint64_t                 hits   = 0;
+        int                      count  = 0;
+        int                      n      = 0;
+        int                      i      = 0;
+
+        count = ios_client_snaps_get (conf, &snaps);
+        if (!count)
+                return;
+
+        ios_log (this, logfp, "\n==========Client Latency Stats========");
+        ios_log (this, logfp, "\n%14s %14s %14s %14s %14s  %s",
+                 "Call Count", "P50-Latency", "P90-Latency",
+                 "P99-Latency", "P99.9-Latency", "CLIENT");
+
+        for (n = 0; n < count; n++) {
+                hits = 0;
+                for (i = 0; i < GF_FOP_MAXVALUE; i++)
+                        hits += snaps[n].fop_hits[i];
+
+                ios_hist_percentiles (snaps[n].hist, 0, pct);
+                ios_log (this, logfp, "%14"PRIu64" %11.0lf us "
+                         "%11.0lf us %11.0lf us %11.0lf us  %s", hits,
+                         pct[0], pct[1], pct[2], pct[3], snaps[n].uid);
+        }
+
+        GF_FREE (snaps);
+}
+
 int
 io_stats_dump_global_to_logfp (xlator_t *this, struct ios_global_stats *stats,
                                struct timeval *now, int interval, FILE* logfp)
@@ -595,6 +801,7 @@ io_stats_dump_global_to_logfp (xlator_t *this, struct ios_global_stats *stats,
         char                  str_header[128] = {0};
         char                  str_read[128] = {0};
         char                  str_write[128] = {0};
+        double                pct[IOS_PERCENTILE_COUNT] = {0, };
 
         conf = this->private;
 
@@ -661,22 +868,30 @@ io_stats_dump_global_to_logfp (xlator_t *this, struct ios_global_stats *stats,
                 ios_log (this, logfp, "%s\n", str_write);
         }
 
-        ios_log (this, logfp, "%-13s %10s %14s %14s %14s", "Fop",
-                 "Call Count", "Avg-Latency", "Min-Latency",
-                 "Max-Latency");
-        ios_log (this, logfp, "%-13s %10s %14s %14s %14s", "---", "----------",
-                 "-----------", "-----------", "-----------");
+        ios_log (this, logfp, "%-13s %10s %14s %14s %14s %14s %14s %14s "
+                 "%14s", "Fop", "Call Count", "Avg-Latency", "Min-Latency",
+                 "Max-Latency", "P50-Latency", "P90-Latency", "P99-Latency",
+                 "P99.9-Latency");
+        ios_log (this, logfp, "%-13s %10s %14s %14s %14s %14s %14s %14s "
+                 "%14s", "---", "----------", "-----------", "-----------",
+                 "-----------", "-----------", "-----------", "-----------",
+                 "-------------");
 
         for (i = 0; i < GF_FOP_MAXVALUE; i++) {
                 if (stats->fop_hits[i] && !stats->latency[i].avg)
                         ios_log (this, logfp, "%-13s %10"PRId64" %11s "
                                  "us %11s us %11s us", gf_fop_list[i],
                                  stats->fop_hits[i], "0", "0", "0");
-                else if (stats->fop_hits[i] && stats->latency[i].avg)
+                else if (stats->fop_hits[i] && stats->latency[i].avg) {
+                        ios_hist_percentiles (stats->latency[i].hist,
+                                              stats->latency[i].max, pct);
                         ios_log (this, logfp, "%-13s %10"PRId64" %11.2lf us "
-                                 "%11.2lf us %11.2lf us", gf_fop_list[i],
+                                 "%11.2lf us %11.2lf us %11.0lf us %11.0lf us "
+                                 "%11.0lf us %11.0lf us", gf_fop_list[i],
                                  stats->fop_hits[i], stats->latency[i].avg,
-                                 stats->latency[i].min, stats->latency[i].max);
+                                 stats->latency[i].min, stats->latency[i].max,
+                                 pct[0], pct[1], pct[2], pct[3]);
+                }
         }
         ios_log (this, logfp, "------ ----- ----- ----- ----- ----- ----- ----- "
                  " ----- ----- ----- -----\n");
@@ -733,6 +948,8 @@ io_stats_dump_global_to_logfp (xlator_t *this, struct ios_global_stats *stats,
                          "\tFILE NAME");
                 list_head = &conf->thru_list[IOS_STATS_THRU_WRITE];
                 ios_dump_throughput_stats (list_head, this, logfp, IOS_STATS_TYPE_WRITE);
+
+                ios_dump_client_stats (this, logfp);
         }
         return 0;
 }
@@ -745,7 +962,9 @@ io_stats_dump_global_to_dict (xlator_t *this, struct ios_global_stats *stats,
         char            key[256] = {0};
         uint64_t        sec = 0;
         int             i = 0;
+        int             p = 0;
         uint64_t        count = 0;
+        double          pct[IOS_PERCENTILE_COUNT] = {0, };
 
         GF_ASSERT (stats);
         GF_ASSERT (now);
@@ -857,6 +1076,21 @@ io_stats_dump_global_to_dict (xlator_t *this, struct ios_global_stats *stats,
                                 interval, stats->latency[i].max);
                         goto out;
                 }
+
+                ios_hist_percentiles (stats->latency[i].hist,
+                                      stats->latency[i].max, pct);
+                for (p = 0; p < IOS_PERCENTILE_COUNT; p++) {
+                        snprintf (key, sizeof (key), "%d-%d-%slatency",
+                                  interval, i, ios_percentile_names[p]);
+                        ret = dict_set_double (dict, key, pct[p]);
+                        if (ret) {
+                                gf_log (this->name, GF_LOG_ERROR, "failed to "
+                                        "set %s %slatency(%d) with %f",
+                                        gf_fop_list[i], ios_percentile_names[p],
+                                        interval, pct[p]);
+                                goto out;
+                        }
+                }
         }
 out:
         gf_log (this->name, GF_LOG_DEBUG, "returning %d", ret);
@@ -935,8 +1169,8 @@ io_stats_dump (xlator_t *this, struct ios_dump_args *args,
                gf1_cli_info_op op, gf_boolean_t is_peek)
 {
         struct ios_conf         *conf = NULL;
-        struct ios_global_stats  cumulative = {0, };
-        struct ios_global_stats  incremental = {0, };
+        struct ios_global_stats *cumulative = NULL;
+        struct ios_global_stats *incremental = NULL;
         int                      increment = 0;
         struct timeval           now;
 
@@ -947,16 +1181,24 @@ io_stats_dump (xlator_t *this, struct ios_dump_args *args,
 
         conf = this->private;
 
+        /* too large for the stack with the latency histograms */
+        cumulative = GF_CALLOC (1, sizeof (*cumulative),
+                                gf_io_stats_mt_ios_global_stats);
+        incremental = GF_CALLOC (1, sizeof (*incremental),
+                                 gf_io_stats_mt_ios_global_stats);
+        if (!cumulative || !incremental)
+                goto out;
+
         gettimeofday (&now, NULL);
         LOCK (&conf->lock);
         {
                 if (op == GF_CLI_INFO_ALL ||
                     op == GF_CLI_INFO_CUMULATIVE)
-                        cumulative  = conf->cumulative;
+                        *cumulative  = conf->cumulative;
 
                 if (op == GF_CLI_INFO_ALL ||
                     op == GF_CLI_INFO_INCREMENTAL) {
-                        incremental = conf->incremental;
+                        *incremental = conf->incremental;
                         increment = conf->increment;
 
                         if (!is_peek) {
@@ -971,11 +1213,15 @@ io_stats_dump (xlator_t *this, struct ios_dump_args *args,
 
         if (op == GF_CLI_INFO_ALL ||
             op == GF_CLI_INFO_CUMULATIVE)
-                io_stats_dump_global (this, &cumulative, &now, -1, args);
+                io_stats_dump_global (this, cumulative, &now, -1, args);
 
         if (op == GF_CLI_INFO_ALL ||
             op == GF_CLI_INFO_INCREMENTAL)
-                io_stats_dump_global (this, &incremental, &now, increment, args);
+                io_stats_dump_global (this, incremental, &now, increment, args);
+
+out:
+        GF_FREE (cumulative);
+        GF_FREE (incremental);
 
         return 0;
 }
@@ -1068,21 +1314,83 @@ update_ios_latency_stats (struct ios_global_stats   *stats, double elapsed,
         stats->latency[op].avg = avg + (elapsed - avg) / stats->fop_hits[op];
 }
 
+static struct ios_client_stats *
+ios_client_stats_get (xlator_t *this, struct ios_conf *conf, client_t *client)
+{
+        struct ios_client_stats *stats = NULL;
+        void                    *tmp   = NULL;
+
+        if (client_ctx_get (client, this, &tmp) == 0 && tmp)
+                return tmp;
+
+        LOCK (&conf->clients_lock);
+        {
+                if (client_ctx_get (client, this, &tmp) == 0 && tmp) {
+                        stats = tmp;
+                        goto unlock;
+                }
+
+                stats = GF_CALLOC (1, sizeof (*stats),
+                                   gf_io_stats_mt_ios_client_stats);
+                if (!stats)
+                        goto unlock;
+
+                stats->client = client;
+                if (client_ctx_set (client, this, stats) != 0) {
+                        GF_FREE (stats);
+                        stats = NULL;
+                        goto unlock;
+                }
+
+                list_add_tail (&stats->clients, &conf->clients);
+        }
+unlock:
+        UNLOCK (&conf->clients_lock);
+
+        return stats;
+}
+
 int
-update_ios_latency (struct ios_conf *conf, call_frame_t *frame,
-                    glusterfs_fop_t op)
+update_ios_latency (xlator_t *this, call_frame_t *frame, glusterfs_fop_t op)
 {
-        double elapsed;
-        struct timeval *begin, *end;
+        struct ios_conf         *conf   = NULL;
+        struct ios_client_stats *client = NULL;
+        double                   elapsed;
+        uint64_t                 usecs  = 0;
+        int                      bucket = 0;
+        struct timeval          *begin, *end;
 
+        conf  = this->private;
         begin = &frame->begin;
         end   = &frame->end;
 
         elapsed = (end->tv_sec - begin->tv_sec) * 1e6
                 + (end->tv_usec - begin->tv_usec);
+        usecs = (elapsed > 0) ? elapsed : 0;
+        bucket = ios_hist_bucket (usecs);
+
+        LOCK (&conf->lock);
+        {
+                conf->cumulative.fop_hits[op]++;
+                conf->incremental.fop_hits[op]++;
+                update_ios_latency_stats (&conf->cumulative, elapsed, op);
+                update_ios_latency_stats (&conf->incremental, elapsed, op);
+        }
+        UNLOCK (&conf->lock);
+
+        __sync_fetch_and_add (&conf->cumulative.latency[op].hist[bucket], 1);
+        __sync_fetch_and_add (&conf->incremental.latency[op].hist[bucket], 1);
+
+        if (!frame->root->client)
+                return 0;
+
+        client = ios_client_stats_get (this, conf, frame->root->client);
+        if (!client)
+                return 0;
 
-        update_ios_latency_stats (&conf->cumulative, elapsed, op);
-        update_ios_latency_stats (&conf->incremental, elapsed, op);
+        __sync_fetch_and_add (&client->fop_hits[op], 1);
+        __sync_fetch_and_add (&client->latency_total[op], usecs);
+        __sync_fetch_and_add (&client->hist[bucket], 1);
 
         return 0;
 }
@@ -2665,6 +2973,53 @@ io_stats_clear (struct ios_conf *conf)
         return ret;
 }
 
+/* One section per client: its overall latency percentiles, and the calls
+ * and average latency of each fop it sent. */
+static void
+io_priv_clients (xlator_t *this, struct ios_conf *conf)
+{
+        struct ios_client_snap  *snaps = NULL;
+        char                     key[GF_DUMP_MAX_BUF_LEN];
+        char                     prefix[GF_DUMP_MAX_BUF_LEN];
+        double                   pct[IOS_PERCENTILE_COUNT] = {0, };
+        int                      count = 0;
+        int                      n = 0;
+        int                      i = 0;
+        int                      p = 0;
+
+        count = ios_client_snaps_get (conf, &snaps);
+
+        for (n = 0; n < count; n++) {
+                snprintf (prefix, sizeof (prefix), "%s.client.%d",
+                          this->name, n);
+                gf_proc_dump_add_section (prefix);
+
+                gf_proc_dump_build_key (key, prefix, "client_uid");
+                gf_proc_dump_write (key, "%s", snaps[n].uid);
+
+                ios_hist_percentiles (snaps[n].hist, 0, pct);
+                for (p = 0; p < IOS_PERCENTILE_COUNT; p++) {
+                        gf_proc_dump_build_key (key, prefix, "%s",
+                                                ios_percentile_names[p]);
+                        gf_proc_dump_write (key, "%.0f", pct[p]);
+                }
+
+                for (i = 0; i < GF_FOP_MAXVALUE; i++) {
+                        if (!snaps[n].fop_hits[i])
+                                continue;
+                        gf_proc_dump_build_key (key, prefix, "%s",
+                                                gf_fop_list[i]);
+                        gf_proc_dump_write (key, "%"PRIu64",%.03f",
+                                            snaps[n].fop_hits[i],
+                                            (double)
+                                            snaps[n].latency_total[i] /
+                                            snaps[n].fop_hits[i]);
+                }
+        }
+
+        GF_FREE (snaps);
+}
+
 int32_t
 io_priv (xlator_t *this)
 {
@@ -2675,6 +3030,8 @@ io_priv (xlator_t *this)
         double              min, max, avg;
         uint64_t            count, total;
         struct ios_conf    *conf = NULL;
+        double              pct[IOS_PERCENTILE_COUNT] = {0, };
+        int                 p = 0;
 
         conf = this->private;
         if (!conf)
@@ -2723,8 +3080,21 @@ io_priv (xlator_t *this)
                 gf_proc_dump_write (key,"%"PRId64",%"PRId64",%.03f,%.03f,%.03f",
                                     count, total, min, max, avg);
 
+                if (!conf->cumulative.fop_hits[i])
+                        continue;
+
+                ios_hist_percentiles (conf->cumulative.latency[i].hist,
+                                      conf->cumulative.latency[i].max, pct);
+                for (p = 0; p < IOS_PERCENTILE_COUNT; p++) {
+                        gf_proc_dump_build_key (key, key_prefix_cumulative,
+                                                "%s_%s", gf_fop_list[i],
+                                                ios_percentile_names[p]);
+                        gf_proc_dump_write (key, "%.0f", pct[p]);
+                }
         }
 
+        io_priv_clients (this, conf);
+
         return 0;
 }
 
@@ -2818,10 +3188,22 @@ mem_acct_init (xlator_t *this)
 void
 ios_conf_destroy (struct ios_conf *conf)
 {
+        struct ios_client_stats *client = NULL;
+        struct ios_client_stats *tmp    = NULL;
+        void                    *ctx    = NULL;
+
         if (!conf)
                 return;
 
         ios_destroy_top_stats (conf);
+
+        list_for_each_entry_safe (client, tmp, &conf->clients, clients) {
+                client_ctx_del (client->client, THIS, &ctx);
+                list_del_init (&client->clients);
+                GF_FREE (client);
+        }
+
+        LOCK_DESTROY (&conf->clients_lock);
         LOCK_DESTROY (&conf->lock);
         GF_FREE(conf);
 }
@@ -2869,6 +3251,8 @@ init (xlator_t *this)
          * in case of error paths.
          */
         LOCK_INIT (&conf->lock);
+        LOCK_INIT (&conf->clients_lock);
+        INIT_LIST_HEAD (&conf->clients);
 
         gettimeofday (&conf->cumulative.started_at, NULL);
         gettimeofday (&conf->incremental.started_at, NULL);
@@ -3060,6 +3444,30 @@ out:
         return ret;
 }
 
+int
+io_stats_client_destroy_cbk (xlator_t *this, client_t *client)
+{
+        struct ios_conf         *conf  = this->private;
+        struct ios_client_stats *stats = NULL;
+        void                    *tmp   = NULL;
+
+        if (client_ctx_del (client, this, &tmp) != 0 || !tmp)
+                return 0;
+
+        stats = tmp;
+        if (conf) {
+                LOCK (&conf->clients_lock);
+                {
+                        list_del_init (&stats->clients);
+                }
+                UNLOCK (&conf->clients_lock);
+        }
+
+        GF_FREE (stats);
+
+        return 0;
+}
+
 struct xlator_dumpops dumpops = {
         .priv    = io_priv
 };
@@ -3113,6 +3521,7 @@ struct xlator_cbks cbks = {
         .release     = io_stats_release,
         .releasedir  = io_stats_releasedir,
         .forget      = io_stats_forget,
+        .client_destroy = io_stats_client_destroy_cbk,
 };
 
 struct volume_options options[] = {
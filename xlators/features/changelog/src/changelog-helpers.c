@@ -210,6 +210,11 @@ changelog_rollover_changelog (xlator_t *this,
         char nfile[PATH_MAX] = {0,};
 
         if (priv->changelog_fd != -1) {
+                if (changelog_journal_drain (priv))
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "failed to write pending records before"
+                                " rollover");
+
                 ret = fsync (priv->changelog_fd);
                 if (ret < 0) {
                         gf_log (this->name, GF_LOG_ERROR,
@@ -466,7 +471,8 @@ changelog_open (xlator_t *this,
                          CHANGELOG_VERSION_MAJOR,
                          CHANGELOG_VERSION_MINOR,
                          priv->ce->encoder);
-        ret = changelog_write_change (priv, buffer, strlen (buffer));
+        /* the journal is empty, it was drained before the last rollover */
+        ret = changelog_write (priv->changelog_fd, buffer, strlen (buffer));
         if (ret) {
                 close (priv->changelog_fd);
                 priv->changelog_fd = -1;
@@ -524,10 +530,254 @@ changelog_snap_write_change (changelog_priv_t *priv, char *buffer, size_t len)
         return changelog_write (priv->c_snap_fd, buffer, len);
 }
 
+int
+changelog_journal_init (changelog_priv_t *priv)
+{
+        changelog_journal_t *cj  = &priv->cj;
+        int                  ret = 0;
+
+        INIT_LIST_HEAD (&cj->pending);
+        INIT_LIST_HEAD (&cj->free);
+
+        ret = pthread_mutex_init (&cj->lock, NULL);
+        if (ret)
+                return -1;
+
+        ret = pthread_cond_init (&cj->cond, NULL);
+        if (ret) {
+                pthread_mutex_destroy (&cj->lock);
+                return -1;
+        }
+
+        return 0;
+}
+
+void
+changelog_journal_fini (changelog_priv_t *priv)
+{
+        changelog_journal_t     *cj  = &priv->cj;
+        changelog_journal_seg_t *seg = NULL;
+        changelog_journal_seg_t *tmp = NULL;
+
+        list_splice_init (&cj->pending, &cj->free);
+        list_for_each_entry_safe (seg, tmp, &cj->free, list) {
+                list_del (&seg->list);
+                GF_FREE (seg);
+        }
+
+        pthread_cond_destroy (&cj->cond);
+        pthread_mutex_destroy (&cj->lock);
+}
+
+static changelog_journal_seg_t *
+__changelog_journal_seg_get (changelog_journal_t *cj, size_t len)
+{
+        changelog_journal_seg_t *seg  = NULL;
+        size_t                   size = CHANGELOG_JOURNAL_SEGMENT_SIZE;
+
+        if (len <= size && !list_empty (&cj->free)) {
+                seg = list_entry (cj->free.next,
+                                  changelog_journal_seg_t, list);
+                list_del_init (&seg->list);
+                cj->nfree--;
+                seg->used = 0;
+                return seg;
+        }
+
+        if (len > size)
+                size = len;
+
+        seg = GF_CALLOC (1, sizeof (*seg) + size,
+                         gf_changelog_mt_journal_seg_t);
+        if (!seg)
+                return NULL;
+
+        INIT_LIST_HEAD (&seg->list);
+        seg->size = size;
+
+        return seg;
+}
+
+static void
+__changelog_journal_seg_put (changelog_journal_t *cj,
+                             changelog_journal_seg_t *seg)
+{
+        if (seg->size == CHANGELOG_JOURNAL_SEGMENT_SIZE &&
+            cj->nfree < CHANGELOG_JOURNAL_FREE_SEGMENTS) {
+                list_add (&seg->list, &cj->free);
+                cj->nfree++;
+                return;
+        }
+
+        GF_FREE (seg);
+}
+
+/* the records of a batch are written with as few writev()s as possible */
+static int
+changelog_journal_writev (int fd, struct list_head *batch)
+{
+        changelog_journal_seg_t *seg   = NULL;
+        struct iovec             iov[IOV_MAX];
+        int                      count = 0;
+        int                      i     = 0;
+        ssize_t                  size  = 0;
+
+        seg = list_entry (batch->next, changelog_journal_seg_t, list);
+
+        while (&seg->list != batch) {
+                for (count = 0; (&seg->list != batch) && (count < IOV_MAX);
+                     seg = list_entry (seg->list.next,
+                                       changelog_journal_seg_t, list)) {
+                        if (!seg->used)
+                                continue;
+                        iov[count].iov_base = seg->data;
+                        iov[count].iov_len = seg->used;
+                        count++;
+                }
+
+                i = 0;
+                while (i < count) {
+                        size = writev (fd, &iov[i], count - i);
+                        if (size <= 0)
+                                return -1;
+
+                        /* short write, carry on from where it stopped */
+                        while (i < count && size >= iov[i].iov_len) {
+                                size -= iov[i].iov_len;
+                                i++;
+                        }
+                        if (i < count) {
+                                iov[i].iov_base = (char *)iov[i].iov_base
+                                                  + size;
+                                iov[i].iov_len -= size;
+                        }
+                }
+        }
+
+        return 0;
+}
+
+/**
+ * Appends a record to the journal, it reaches the changelog at the next
+ * changelog_journal_commit(). Callers hold the dispatcher lock, so records
+ * keep their order with respect to rollover.
+ */
 int
 changelog_write_change (changelog_priv_t *priv, char *buffer, size_t len)
 {
-        return changelog_write (priv->changelog_fd, buffer, len);
+        changelog_journal_t     *cj  = &priv->cj;
+        changelog_journal_seg_t *seg = NULL;
+        int                      ret = -1;
+
+        pthread_mutex_lock (&cj->lock);
+        {
+                if (!list_empty (&cj->pending))
+                        seg = list_entry (cj->pending.prev,
+                                          changelog_journal_seg_t, list);
+
+                if (!seg || (seg->size - seg->used) < len) {
+                        seg = __changelog_journal_seg_get (cj, len);
+                        if (!seg)
+                                goto unlock;
+                        list_add_tail (&seg->list, &cj->pending);
+                }
+
+                memcpy (seg->data + seg->used, buffer, len);
+                seg->used += len;
+                cj->appended += len;
+                ret = 0;
+        }
+ unlock:
+        pthread_mutex_unlock (&cj->lock);
+
+        return ret;
+}
+
+uint64_t
+changelog_journal_seq (changelog_priv_t *priv)
+{
+        uint64_t seq = 0;
+
+        pthread_mutex_lock (&priv->cj.lock);
+        {
+                seq = priv->cj.appended;
+        }
+        pthread_mutex_unlock (&priv->cj.lock);
+
+        return seq;
+}
+
+/**
+ * Waits until everything appended up to @seq has been written to the
+ * changelog, writing it (and whatever else is pending) if no one else is.
+ * Returns -1 if the batch that carried @seq could not be written.
+ */
+int
+changelog_journal_commit (changelog_priv_t *priv, uint64_t seq)
+{
+        changelog_journal_t     *cj    = &priv->cj;
+        changelog_journal_seg_t *seg   = NULL;
+        changelog_journal_seg_t *tmp   = NULL;
+        struct list_head         batch;
+        uint64_t                 start = 0;
+        uint64_t                 end   = 0;
+        int                      fd    = -1;
+        int                      ret   = 0;
+
+        INIT_LIST_HEAD (&batch);
+
+        pthread_mutex_lock (&cj->lock);
+        {
+                while (cj->written < seq) {
+                        if (cj->flushing) {
+                                pthread_cond_wait (&cj->cond, &cj->lock);
+                                continue;
+                        }
+
+                        list_splice_init (&cj->pending, &batch);
+                        start = cj->written;
+                        end = cj->appended;
+                        fd = priv->changelog_fd;
+                        cj->flushing = _gf_true;
+
+                        pthread_mutex_unlock (&cj->lock);
+                        {
+                                ret = -1;
+                                if (fd != -1)
+                                        ret = changelog_journal_writev
+                                                (fd, &batch);
+                        }
+                        pthread_mutex_lock (&cj->lock);
+
+                        if (ret) {
+                                cj->fail_start = start;
+                                cj->fail_end = end;
+                        }
+
+                        list_for_each_entry_safe (seg, tmp, &batch, list) {
+                                list_del_init (&seg->list);
+                                __changelog_journal_seg_put (cj, seg);
+                        }
+
+                        cj->written = end;
+                        cj->flushing = _gf_false;
+                        pthread_cond_broadcast (&cj->cond);
+                }
+
+                ret = 0;
+                if (seq > cj->fail_start && seq <= cj->fail_end)
+                        ret = -1;
+        }
+        pthread_mutex_unlock (&cj->lock);
+
+        return ret;
+}
+
+/* writes out every record appended so far */
+int
+changelog_journal_drain (changelog_priv_t *priv)
+{
+        return changelog_journal_commit (priv, changelog_journal_seq (priv));
 }
 
 /*
@@ -610,6 +860,11 @@ changelog_handle_change (xlator_t *this,
                 return 0;
 
         if (CHANGELOG_TYPE_IS_FSYNC (cld->cld_type)) {
+                if (changelog_journal_drain (priv))
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "failed to write pending records before"
+                                " fsync");
+
                 ret = fsync (priv->changelog_fd);
                 if (ret < 0) {
                         gf_log (this->name, GF_LOG_ERROR,
@@ -143,6 +143,45 @@ typedef struct changelog_notify {
         xlator_t *this;
 } changelog_notify_t;
 
+/**
+ * Group commit of changelog records: the encoders append records to the
+ * journal (under the dispatcher lock, which only covers a memcpy now) and
+ * the fop then waits for them to reach the changelog. Whoever finds no
+ * flush in progress becomes the leader and writes every pending record
+ * with one writev(), the others wait for it. One write() (and one sync
+ * with O_SYNC) is shared by all the fops that came in during the previous
+ * flush. Rollover and fsync drain the journal first.
+ */
+#define CHANGELOG_JOURNAL_SEGMENT_SIZE  (128 * 1024)
+#define CHANGELOG_JOURNAL_FREE_SEGMENTS 8
+
+typedef struct changelog_journal_seg {
+        struct list_head list;
+        size_t           size;
+        size_t           used;
+        char             data[];
+} changelog_journal_seg_t;
+
+typedef struct changelog_journal {
+        pthread_mutex_t  lock;
+        pthread_cond_t   cond;
+
+        /* segments appended to and not yet written, oldest first */
+        struct list_head pending;
+        struct list_head free;
+        int              nfree;
+
+        /* bytes appended to and written from the journal so far */
+        uint64_t         appended;
+        uint64_t         written;
+
+        /* byte range of the last batch that could not be written */
+        uint64_t         fail_start;
+        uint64_t         fail_end;
+
+        gf_boolean_t     flushing;
+} changelog_journal_t;
+
 /* Draining during changelog rollover (for geo-rep snapshot dependency):
  * --------------------------------------------------------------------
  * The introduction of draining of in-transit fops during changelog rollover
@@ -250,6 +289,9 @@ struct changelog_priv {
         /* context of the notifier thread */
         changelog_notify_t cn;
 
+        /* records waiting to be written to the changelog */
+        changelog_journal_t cj;
+
         /* operation mode */
         changelog_mode_t op_mode;
 
@@ -400,6 +442,16 @@ changelog_write (int fd, char *buffer, size_t len);
 int
 changelog_write_change (changelog_priv_t *priv, char *buffer, size_t len);
 int
+changelog_journal_init (changelog_priv_t *priv);
+void
+changelog_journal_fini (changelog_priv_t *priv);
+uint64_t
+changelog_journal_seq (changelog_priv_t *priv);
+int
+changelog_journal_commit (changelog_priv_t *priv, uint64_t seq);
+int
+changelog_journal_drain (changelog_priv_t *priv);
+int
 changelog_handle_change (xlator_t *this,
                          changelog_priv_t *priv, changelog_log_data_t *cld);
 void
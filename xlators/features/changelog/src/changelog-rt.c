@@ -56,6 +56,7 @@ changelog_rt_enqueue (xlator_t *this, changelog_priv_t *priv, void *cbatch,
                       changelog_log_data_t *cld_0, changelog_log_data_t *cld_1)
 {
         int             ret = 0;
+        uint64_t        seq = 0;
         changelog_rt_t *crt = NULL;
 
         crt = (changelog_rt_t *) cbatch;
@@ -65,8 +66,18 @@ changelog_rt_enqueue (xlator_t *this, changelog_priv_t *priv, void *cbatch,
                 ret = changelog_handle_change (this, priv, cld_0);
                 if (!ret && cld_1)
                         ret = changelog_handle_change (this, priv, cld_1);
+
+                seq = changelog_journal_seq (priv);
         }
         UNLOCK (&crt->lock);
 
+        /* records are written in batches, outside of the lock */
+        if (!ret) {
+                ret = changelog_journal_commit (priv, seq);
+                if (ret)
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "error writing changelog to disk");
+        }
+
         return ret;
 }
@@ -17,7 +17,7 @@
 
 #include "changelog-helpers.h"
 
-/* unused as of now - may be you would need it later */
+/* serializes records (and rollover) into the journal */
 typedef struct changelog_rt {
         gf_lock_t lock;
 } changelog_rt_t;
@@ -2236,6 +2236,7 @@ init (xlator_t *this)
         char                    *tmp                    = NULL;
         changelog_priv_t        *priv                   = NULL;
         gf_boolean_t            cond_lock_init          = _gf_false;
+        gf_boolean_t            journal_init            = _gf_false;
         char                    htime_dir[PATH_MAX]     = {0,};
         char                    csnap_dir[PATH_MAX]     = {0,};
         uint32_t                timeout                 = 0;
@@ -2339,6 +2340,11 @@ init (xlator_t *this)
 
         priv->changelog_fd = -1;
 
+        ret = changelog_journal_init (priv);
+        if (ret)
+                goto out;
+        journal_init = _gf_true;
+
         /* snap dependency changes */
         priv->dm.black_fop_cnt = 0;
         priv->dm.white_fop_cnt = 0;
@@ -2381,6 +2387,8 @@ init (xlator_t *this)
                         GF_FREE (priv->changelog_dir);
                         if (cond_lock_init)
                                 changelog_pthread_destroy (priv);
+                        if (journal_init)
+                                changelog_journal_fini (priv);
                         GF_FREE (priv);
                 }
                 this->private = NULL;
@@ -2407,6 +2415,7 @@ fini (xlator_t *this)
                 GF_FREE (priv->changelog_brick);
                 GF_FREE (priv->changelog_dir);
                 changelog_pthread_destroy (priv);
+                changelog_journal_fini (priv);
                 GF_FREE (priv);
         }
 
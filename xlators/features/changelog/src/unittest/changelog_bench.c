@@ -0,0 +1,276 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Creates/s of a number of threads creating files in a scratch directory,
+ * with change-logging off and on. When on, each create is followed by the
+ * entry record changelog_create() would log (fop, mode, uid, gid and the
+ * parent gfid/basename), dispatched the way the xlator does it, into a real
+ * CHANGELOG in the scratch directory. "on, sync" opens it with O_SYNC like
+ * fsync-interval 0 does. Every round checks that the changelog holds all
+ * of the records appended to the journal.
+ *
+ * usage: changelog_bench [dir] [max-threads] [creates-per-thread]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "changelog-helpers.h"
+#include "changelog-encoders.h"
+#include "changelog-rt.h"
+
+enum {
+        BENCH_OFF,
+        BENCH_ON,
+        BENCH_ON_SYNC,
+        BENCH_MODES
+};
+
+static const char *bench_modes[BENCH_MODES] = {"off", "on", "on, sync"};
+
+struct bench_thread {
+        pthread_t         thread;
+        xlator_t         *this;
+        changelog_priv_t *priv;
+        char             *dir;
+        int               id;
+        int               mode;
+        long              creates;
+        long              errors;
+};
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int
+bench_record (xlator_t *this, changelog_priv_t *priv, const char *bname)
+{
+        changelog_opt_t       co[5];
+        struct iobuf          iobuf = {0, };
+        changelog_log_data_t  cld = {0, };
+        size_t                xtra_len = 0;
+        uuid_t                pargfid = {0, };
+
+        uuid_generate (cld.cld_gfid);
+        pargfid[15] = 1;
+
+        CHANGLOG_FILL_FOP_NUMBER ((&co[0]), GF_FOP_CREATE, fop_fn, xtra_len);
+        CHANGELOG_FILL_UINT32 ((&co[1]), 0100644, number_fn, xtra_len);
+        CHANGELOG_FILL_UINT32 ((&co[2]), 0, number_fn, xtra_len);
+        CHANGELOG_FILL_UINT32 ((&co[3]), 0, number_fn, xtra_len);
+
+        co[4].co_convert = entry_fn;
+        co[4].co_free = NULL;
+        co[4].co_type = CHANGELOG_OPT_REC_ENTRY;
+        uuid_copy (co[4].co_entry.cef_uuid, pargfid);
+        co[4].co_entry.cef_bname = (char *)bname;
+        xtra_len += UUID_CANONICAL_FORM_LEN + strlen (bname);
+
+        iobuf.ptr = (char *)co;
+        cld.cld_type = CHANGELOG_TYPE_ENTRY;
+        cld.cld_iobuf = &iobuf;
+        cld.cld_ptr_len = xtra_len;
+        cld.cld_xtra_records = 5;
+
+        return priv->cd.dispatchfn (this, priv, priv->cd.cd_data, &cld, NULL);
+}
+
+static void *
+bench_worker (void *data)
+{
+        struct bench_thread *bt = data;
+        char                 path[PATH_MAX] = {0, };
+        char                *bname = NULL;
+        long                 i = 0;
+        int                  fd = -1;
+
+        for (i = 0; i < bt->creates; i++) {
+                snprintf (path, sizeof (path), "%s/f.%d.%ld", bt->dir,
+                          bt->id, i);
+                fd = open (path, O_CREAT | O_EXCL | O_WRONLY, 0644);
+                if (fd < 0) {
+                        bt->errors++;
+                        continue;
+                }
+                close (fd);
+
+                if (bt->mode == BENCH_OFF)
+                        continue;
+
+                bname = strrchr (path, '/') + 1;
+                if (bench_record (bt->this, bt->priv, bname))
+                        bt->errors++;
+        }
+
+        return NULL;
+}
+
+static void
+bench_cleanup (char *dir, int threads, long creates)
+{
+        char path[PATH_MAX] = {0, };
+        long i = 0;
+        int  t = 0;
+
+        for (t = 0; t < threads; t++) {
+                for (i = 0; i < creates; i++) {
+                        snprintf (path, sizeof (path), "%s/f.%d.%ld", dir,
+                                  t, i);
+                        unlink (path);
+                }
+        }
+}
+
+static double
+bench_round (xlator_t *this, changelog_priv_t *priv, char *dir, int mode,
+             int threads, long creates, long *errors)
+{
+        struct bench_thread *bt = NULL;
+        struct stat          stbuf = {0, };
+        char                 path[PATH_MAX] = {0, };
+        off_t                header = 0;
+        uint64_t             start_seq = 0;
+        double               start = 0;
+        double               elapsed = 0;
+        int                  t = 0;
+
+        if (mode != BENCH_OFF) {
+                snprintf (path, sizeof (path), "%s/"CHANGELOG_FILE_NAME, dir);
+                unlink (path);
+
+                priv->fsync_interval = (mode == BENCH_ON_SYNC) ? 0 : 5;
+                if (changelog_open (this, priv) ||
+                    fstat (priv->changelog_fd, &stbuf))
+                        return -1;
+                header = stbuf.st_size;
+                start_seq = changelog_journal_seq (priv);
+        }
+
+        bt = calloc (threads, sizeof (*bt));
+        if (!bt)
+                return -1;
+
+        start = bench_now ();
+        for (t = 0; t < threads; t++) {
+                bt[t].this = this;
+                bt[t].priv = priv;
+                bt[t].dir = dir;
+                bt[t].id = t;
+                bt[t].mode = mode;
+                bt[t].creates = creates;
+                pthread_create (&bt[t].thread, NULL, bench_worker, &bt[t]);
+        }
+        for (t = 0; t < threads; t++) {
+                pthread_join (bt[t].thread, NULL);
+                *errors += bt[t].errors;
+        }
+        elapsed = bench_now () - start;
+
+        if (mode != BENCH_OFF) {
+                if (fstat (priv->changelog_fd, &stbuf) ||
+                    (stbuf.st_size - header !=
+                     changelog_journal_seq (priv) - start_seq))
+                        (*errors)++;
+                close (priv->changelog_fd);
+                priv->changelog_fd = -1;
+                unlink (path);
+        }
+
+        bench_cleanup (dir, threads, creates);
+        free (bt);
+
+        return (threads * creates) / elapsed;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t         *ctx = NULL;
+        xlator_t                 xl = {0, };
+        changelog_priv_t         priv = {0, };
+        char                     tmpl[] = "/tmp/changelog_bench.XXXXXX";
+        char                    *dir = NULL;
+        int                      max = 16;
+        long                     creates = 2000;
+        int                      threads = 0;
+        int                      mode = 0;
+        long                     errors = 0;
+
+        if (argc > 1)
+                dir = argv[1];
+        if (argc > 2)
+                max = atoi (argv[2]);
+        if (argc > 3)
+                creates = atol (argv[3]);
+
+        if (!dir) {
+                dir = mkdtemp (tmpl);
+                if (!dir)
+                        return 1;
+        }
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        xl.name = "bench-changelog";
+        xl.ctx = ctx;
+        xl.private = &priv;
+
+        priv.changelog_dir = dir;
+        priv.changelog_fd = -1;
+        priv.maps[CHANGELOG_TYPE_DATA]     = "D ";
+        priv.maps[CHANGELOG_TYPE_METADATA] = "M ";
+        priv.maps[CHANGELOG_TYPE_ENTRY]    = "E ";
+        priv.encode_mode = CHANGELOG_ENCODE_BINARY;
+        changelog_encode_change (&priv);
+
+        if (changelog_rt_init (&xl, &priv.cd) ||
+            changelog_journal_init (&priv))
+                return 1;
+
+        printf ("%8s", "threads");
+        for (mode = 0; mode < BENCH_MODES; mode++)
+                printf (" %12s", bench_modes[mode]);
+        printf ("   (creates/s)\n");
+
+        for (threads = 1; threads <= max; threads *= 2) {
+                printf ("%8d", threads);
+                for (mode = 0; mode < BENCH_MODES; mode++)
+                        printf (" %12.0f",
+                                bench_round (&xl, &priv, dir, mode, threads,
+                                             creates, &errors));
+                printf (" %s\n", errors ? "ERRORS" : "");
+        }
+
+        changelog_journal_fini (&priv);
+        changelog_rt_fini (&xl, &priv.cd);
+
+        if (dir == tmpl)
+                rmdir (dir);
+
+        return errors ? 1 : 0;
+}
@@ -176,7 +176,7 @@ clrlk_clear_posixlk (xlator_t *this, pl_inode_t *pl_inode, clrlk_args *args,
                             || plock->user_flock.l_len != ulock.l_len))
                                 continue;
 
-                        list_del_init (&plock->list);
+                        __delete_lock (pl_inode, plock);
                         if (plock->blocked) {
                                 bcount++;
                                 pl_trace_out (this, plock->frame, NULL, NULL,
@@ -239,7 +239,7 @@ blkd:
                                 continue;
 
                         bcount++;
-                        list_del_init (&ilock->blocked_locks);
+                        __delete_blocked_inode_lock (ilock);
                         list_add (&ilock->blocked_locks, &released);
                 }
         }
@@ -273,7 +273,7 @@ granted:
                                 continue;
 
                         gcount++;
-                        list_del_init (&ilock->list);
+                        __delete_inode_lock (ilock);
                         list_add (&ilock->list, &released);
                 }
         }
@@ -58,6 +58,8 @@ __allocate_domain (const char *volume)
         INIT_LIST_HEAD (&dom->blocked_entrylks);
         INIT_LIST_HEAD (&dom->inodelk_list);
         INIT_LIST_HEAD (&dom->blocked_inodelks);
+        pl_itree_init (&dom->inodelk_tree);
+        pl_itree_init (&dom->blocked_tree);
 
 out:
         if (dom && (NULL == dom->domain)) {
@@ -433,6 +435,8 @@ pl_inode_get (xlator_t *this, inode_t *inode)
 
                 INIT_LIST_HEAD (&pl_inode->dom_list);
                 INIT_LIST_HEAD (&pl_inode->ext_list);
+                pl_itree_init (&pl_inode->granted_tree);
+                pl_itree_init (&pl_inode->blocked_tree);
                 INIT_LIST_HEAD (&pl_inode->rw_list);
                 INIT_LIST_HEAD (&pl_inode->reservelk_list);
                 INIT_LIST_HEAD (&pl_inode->blocked_reservelks);
@@ -491,6 +495,18 @@ void
 __delete_lock (pl_inode_t *pl_inode, posix_lock_t *lock)
 {
         list_del_init (&lock->list);
+
+        if (!lock->range.linked)
+                return;
+
+        if (lock->blocked) {
+                pl_itree_remove (&pl_inode->blocked_tree, &lock->range);
+        } else {
+                pl_itree_remove (&pl_inode->granted_tree, &lock->range);
+                /* waiters on this range may be grantable now */
+                pl_itree_wake (&pl_inode->blocked_tree, lock->range.start,
+                               lock->range.end);
+        }
 }
 
 
@@ -521,10 +537,15 @@ posix_lock_to_flock (posix_lock_t *lock, struct gf_flock *flock)
 static void
 __insert_lock (pl_inode_t *pl_inode, posix_lock_t *lock)
 {
-        if (lock->blocked)
+        if (lock->blocked) {
                 gettimeofday (&lock->blkd_time, NULL);
-        else
+                pl_itree_insert (&pl_inode->blocked_tree, &lock->range,
+                                 lock->fl_start, lock->fl_end);
+        } else {
                 gettimeofday (&lock->granted_time, NULL);
+                pl_itree_insert (&pl_inode->granted_tree, &lock->range,
+                                 lock->fl_start, lock->fl_end);
+        }
 
         list_add_tail (&lock->list, &pl_inode->ext_list);
 
@@ -558,22 +579,6 @@ same_owner (posix_lock_t *l1, posix_lock_t *l2)
 }
 
 
-/* Delete all F_UNLCK locks */
-void
-__delete_unlck_locks (pl_inode_t *pl_inode)
-{
-        posix_lock_t *l = NULL;
-        posix_lock_t *tmp = NULL;
-
-        list_for_each_entry_safe (l, tmp, &pl_inode->ext_list, list) {
-                if (l->fl_type == F_UNLCK) {
-                        __delete_lock (pl_inode, l);
-                        __destroy_lock (l);
-                }
-        }
-}
-
-
 /* Add two locks */
 static posix_lock_t *
 add_locks (posix_lock_t *l1, posix_lock_t *l2)
@@ -702,55 +707,64 @@ done:
         return v;
 }
 
+/* Granted lock of another owner that conflicts on type */
+static int
+__conflicting_overlap (pl_itree_node_t *node, void *data)
+{
+        posix_lock_t *l    = pl_itree_entry (node, posix_lock_t, range);
+        posix_lock_t *lock = data;
+
+        if (same_owner (l, lock))
+                return 0;
+
+        return ((l->fl_type == F_WRLCK) || (lock->fl_type == F_WRLCK));
+}
+
+static int
+__any_overlap (pl_itree_node_t *node, void *data)
+{
+        return 1;
+}
+
+static int
+__same_owner_overlap (pl_itree_node_t *node, void *data)
+{
+        return same_owner (pl_itree_entry (node, posix_lock_t, range), data);
+}
+
 static posix_lock_t *
 first_conflicting_overlap (pl_inode_t *pl_inode, posix_lock_t *lock)
 {
-        posix_lock_t *l = NULL;
-        posix_lock_t *conf = NULL;
+        pl_itree_node_t *node = NULL;
 
         pthread_mutex_lock (&pl_inode->mutex);
         {
-                list_for_each_entry (l, &pl_inode->ext_list, list) {
-                        if (l->blocked)
-                                continue;
-
-                        if (locks_overlap (l, lock)) {
-                                if (same_owner (l, lock))
-                                        continue;
-
-                                if ((l->fl_type == F_WRLCK) ||
-                                    (lock->fl_type == F_WRLCK)) {
-                                        conf = l;
-                                        goto unlock;
-                                }
-                        }
-                }
+                node = pl_itree_overlap (&pl_inode->granted_tree,
+                                         lock->fl_start, lock->fl_end,
+                                         __conflicting_overlap, lock);
         }
-unlock:
         pthread_mutex_unlock (&pl_inode->mutex);
 
-        return conf;
+        if (!node)
+                return NULL;
+
+        return pl_itree_entry (node, posix_lock_t, range);
 }
 
 /*
-  Start searching from {begin}, and return the first lock that
-  conflicts, NULL if no conflict
-  If {begin} is NULL, then start from the beginning of the list
+  Return the first granted lock that overlaps {lock}, NULL if there is none
 */
 static posix_lock_t *
 first_overlap (pl_inode_t *pl_inode, posix_lock_t *lock)
 {
-        posix_lock_t *l = NULL;
+        pl_itree_node_t *node = NULL;
 
-        list_for_each_entry (l, &pl_inode->ext_list, list) {
-                if (l->blocked)
-                        continue;
-
-                if (locks_overlap (l, lock))
-                        return l;
-        }
+        node = pl_itree_overlap (&pl_inode->granted_tree, lock->fl_start,
+                                 lock->fl_end, __any_overlap, NULL);
+        if (!node)
+                return NULL;
 
-        return NULL;
+        return pl_itree_entry (node, posix_lock_t, range);
 }
 
 
@@ -759,21 +773,12 @@ first_overlap (pl_inode_t *pl_inode, posix_lock_t *lock)
 static int
 __is_lock_grantable (pl_inode_t *pl_inode, posix_lock_t *lock)
 {
-        posix_lock_t *l = NULL;
-        int           ret = 1;
-
-        list_for_each_entry (l, &pl_inode->ext_list, list) {
-                if (!l->blocked && locks_overlap (lock, l)) {
-                        if (((l->fl_type == F_WRLCK)
-                             || (lock->fl_type == F_WRLCK))
-                            && (lock->fl_type != F_UNLCK)
-                            && !same_owner (l, lock)) {
-                                ret = 0;
-                                break;
-                        }
-                }
-        }
-        return ret;
+        if (lock->fl_type == F_UNLCK)
+                return 1;
+
+        return (pl_itree_overlap (&pl_inode->granted_tree, lock->fl_start,
+                                  lock->fl_end, __conflicting_overlap,
+                                  lock) == NULL);
 }
 
 
@@ -783,78 +788,67 @@ extern void do_blocked_rw (pl_inode_t *);
 static void
 __insert_and_merge (pl_inode_t *pl_inode, posix_lock_t *lock)
 {
-        posix_lock_t  *conf = NULL;
-        posix_lock_t  *t = NULL;
-        posix_lock_t  *sum = NULL;
-        int            i = 0;
-        struct _values v = { .locks = {0, 0, 0} };
-
-        list_for_each_entry_safe (conf, t, &pl_inode->ext_list, list) {
-                if (conf->blocked)
-                        continue;
-                if (!locks_overlap (conf, lock))
-                        continue;
-
-                if (same_owner (conf, lock)) {
-                        if (conf->fl_type == lock->fl_type) {
-                                sum = add_locks (lock, conf);
+        pl_itree_node_t *node = NULL;
+        posix_lock_t    *conf = NULL;
+        posix_lock_t    *sum = NULL;
+        int              i = 0;
+        struct _values   v = { .locks = {0, 0, 0} };
+
+        /* locks of other owners that overlap are compatible, or {lock}
+           would not have been granted. Only ranges held by the same owner
+           get merged or split. */
+        node = pl_itree_overlap (&pl_inode->granted_tree, lock->fl_start,
+                                 lock->fl_end, __same_owner_overlap, lock);
+        if (node) {
+                conf = pl_itree_entry (node, posix_lock_t, range);
+                if (conf->fl_type == lock->fl_type) {
+                        sum = add_locks (lock, conf);
+
+                        sum->fl_type    = lock->fl_type;
+                        sum->client     = lock->client;
+                        sum->fd_num     = lock->fd_num;
+                        sum->client_pid = lock->client_pid;
+                        sum->owner      = lock->owner;
+
+                        __delete_lock (pl_inode, conf);
+                        __destroy_lock (conf);
+
+                        __destroy_lock (lock);
+                        INIT_LIST_HEAD (&sum->list);
+                        posix_lock_to_flock (sum, &sum->user_flock);
+                        __insert_and_merge (pl_inode, sum);
 
-                                sum->fl_type    = lock->fl_type;
-                                sum->client     = lock->client;
-                                sum->fd_num     = lock->fd_num;
-                                sum->client_pid = lock->client_pid;
-                                sum->owner      = lock->owner;
-
-                                __delete_lock (pl_inode, conf);
-                                __destroy_lock (conf);
-
-                                __destroy_lock (lock);
-                                INIT_LIST_HEAD (&sum->list);
-                                posix_lock_to_flock (sum, &sum->user_flock);
-                                __insert_and_merge (pl_inode, sum);
-
-                                return;
-                        } else {
-                                sum = add_locks (lock, conf);
-
-                                sum->fl_type    = conf->fl_type;
-                                sum->client     = conf->client;
-                                sum->fd_num     = conf->fd_num;
-                                sum->client_pid = conf->client_pid;
-                                sum->owner      = conf->owner;
+                        return;
+                } else {
+                        sum = add_locks (lock, conf);
 
-                                v = subtract_locks (sum, lock);
+                        sum->fl_type    = conf->fl_type;
+                        sum->client     = conf->client;
+                        sum->fd_num     = conf->fd_num;
+                        sum->client_pid = conf->client_pid;
+                        sum->owner      = conf->owner;
 
-                                __delete_lock (pl_inode, conf);
-                                __destroy_lock (conf);
+                        v = subtract_locks (sum, lock);
 
-                                __delete_lock (pl_inode, lock);
-                                __destroy_lock (lock);
+                        __delete_lock (pl_inode, conf);
+                        __destroy_lock (conf);
 
-                                __destroy_lock (sum);
+                        __delete_lock (pl_inode, lock);
+                        __destroy_lock (lock);
 
-                                for (i = 0; i < 3; i++) {
-                                        if (!v.locks[i])
-                                                continue;
+                        __destroy_lock (sum);
 
-                                        INIT_LIST_HEAD (&v.locks[i]->list);
-                                        posix_lock_to_flock (v.locks[i],
-                                                       &v.locks[i]->user_flock);
-                                        __insert_and_merge (pl_inode,
-                                                            v.locks[i]);
-                                }
+                        for (i = 0; i < 3; i++) {
+                                if (!v.locks[i])
+                                        continue;
 
-                                __delete_unlck_locks (pl_inode);
-                                return;
+                                INIT_LIST_HEAD (&v.locks[i]->list);
+                                posix_lock_to_flock (v.locks[i],
+                                               &v.locks[i]->user_flock);
+                                __insert_and_merge (pl_inode,
+                                                    v.locks[i]);
                         }
-                }
-
-                if (lock->fl_type == F_UNLCK) {
-                        continue;
-                }
 
-                if ((conf->fl_type == F_RDLCK) && (lock->fl_type == F_RDLCK)) {
-                        __insert_lock (pl_inode, lock);
                         return;
                 }
         }
@@ -872,23 +866,33 @@ void
 __grant_blocked_locks (xlator_t *this, pl_inode_t *pl_inode, struct list_head *granted)
 {
         struct list_head  tmp_list;
+        pl_itree_node_t **waiters = NULL;
         posix_lock_t     *l = NULL;
         posix_lock_t     *tmp = NULL;
         posix_lock_t     *conf = NULL;
+        int               count = 0;
+        int               i = 0;
 
         INIT_LIST_HEAD (&tmp_list);
 
-        list_for_each_entry_safe (l, tmp, &pl_inode->ext_list, list) {
-                if (l->blocked) {
-                        conf = first_overlap (pl_inode, l);
-                        if (conf)
-                                continue;
+        /* Only waiters on ranges released since the last pass can have
+           become grantable. They come oldest first. */
+        count = pl_itree_take_waiters (&pl_inode->blocked_tree, &waiters);
 
-                        l->blocked = 0;
-                        list_move_tail (&l->list, &tmp_list);
-                }
+        for (i = 0; i < count; i++) {
+                l = pl_itree_entry (waiters[i], posix_lock_t, range);
+
+                conf = first_overlap (pl_inode, l);
+                if (conf)
+                        continue;
+
+                __delete_lock (pl_inode, l);
+                l->blocked = 0;
+                list_add_tail (&l->list, &tmp_list);
         }
 
+        GF_FREE (waiters);
+
         list_for_each_entry_safe (l, tmp, &tmp_list, list) {
                 list_del_init (&l->list);
 
@@ -73,6 +73,9 @@ grant_blocked_inode_locks (xlator_t *this, pl_inode_t *pl_inode,
 void
 __delete_inode_lock (pl_inode_lock_t *lock);
 
+void
+__delete_blocked_inode_lock (pl_inode_lock_t *lock);
+
 void
 __pl_inodelk_unref (pl_inode_lock_t *lock);
 
@@ -27,6 +27,41 @@ inline void
 __delete_inode_lock (pl_inode_lock_t *lock)
 {
         list_del_init (&lock->list);
+
+        if (!lock->range.linked)
+                return;
+
+        pl_itree_remove (&lock->dom->inodelk_tree, &lock->range);
+        /* waiters on this range may be grantable now */
+        pl_itree_wake (&lock->dom->blocked_tree, lock->range.start,
+                       lock->range.end);
+}
+
+/* Takes a lock off the blocked list of its domain. Waiters that were queued
+ * behind it to prevent its starvation may be grantable now.
+ */
+void
+__delete_blocked_inode_lock (pl_inode_lock_t *lock)
+{
+        list_del_init (&lock->blocked_locks);
+
+        if (!lock->range.linked)
+                return;
+
+        pl_itree_remove (&lock->dom->blocked_tree, &lock->range);
+        pl_itree_wake (&lock->dom->blocked_tree, lock->range.start,
+                       lock->range.end);
+}
+
+static void
+__block_inode_lock (pl_dom_list_t *dom, pl_inode_lock_t *lock)
+{
+        gettimeofday (&lock->blkd_time, NULL);
+        list_add_tail (&lock->blocked_locks, &dom->blocked_inodelks);
+
+        lock->dom = dom;
+        pl_itree_insert (&dom->blocked_tree, &lock->range, lock->fl_start,
+                         lock->fl_end);
 }
 
 static inline void
@@ -111,14 +146,6 @@ pl_print_inodelk (char *str, int size, int cmd, struct gf_flock *flock, const ch
                   (unsigned long long) flock->l_pid);
 }
 
-/* Determine if the two inodelks overlap reach other's lock regions */
-static int
-inodelk_overlap (pl_inode_lock_t *l1, pl_inode_lock_t *l2)
-{
-        return ((l1->fl_end >= l2->fl_start) &&
-                (l2->fl_end >= l1->fl_start));
-}
-
 /* Returns true if the 2 inodelks have the same owner */
 static inline int
 same_inodelk_owner (pl_inode_lock_t *l1, pl_inode_lock_t *l2)
@@ -127,51 +154,56 @@ same_inodelk_owner (pl_inode_lock_t *l1, pl_inode_lock_t *l2)
                 (l1->client == l2->client));
 }
 
-/* Returns true if the 2 inodelks conflict with each other */
+/* Granted lock of another owner that conflicts on type */
 static int
-inodelk_conflict (pl_inode_lock_t *l1, pl_inode_lock_t *l2)
+__inodelk_conflict_fn (pl_itree_node_t *node, void *data)
 {
-        return (inodelk_overlap (l1, l2) &&
-                inodelk_type_conflict (l1, l2));
+        pl_inode_lock_t *l = pl_itree_entry (node, pl_inode_lock_t, range);
+
+        return (inodelk_type_conflict (data, l) &&
+                !same_inodelk_owner (data, l));
 }
 
 /* Determine if lock is grantable or not */
 static pl_inode_lock_t *
 __inodelk_grantable (pl_dom_list_t *dom, pl_inode_lock_t *lock)
 {
-        pl_inode_lock_t *l = NULL;
-        pl_inode_lock_t *ret = NULL;
-        if (list_empty (&dom->inodelk_list))
-                goto out;
-        list_for_each_entry (l, &dom->inodelk_list, list){
-                if (inodelk_conflict (lock, l) &&
-                    !same_inodelk_owner (lock, l)) {
-                        ret = l;
-                        goto out;
-                }
-        }
-out:
-        return ret;
+        pl_itree_node_t *node = NULL;
+
+        node = pl_itree_overlap (&dom->inodelk_tree, lock->fl_start,
+                                 lock->fl_end, __inodelk_conflict_fn, lock);
+        if (!node)
+                return NULL;
+
+        return pl_itree_entry (node, pl_inode_lock_t, range);
+}
+
+/* Blocked lock queued before {lock} that conflicts with it. A lock that was
+ * never blocked comes after all of them.
+ */
+static int
+__blocked_conflict_fn (pl_itree_node_t *node, void *data)
+{
+        pl_inode_lock_t *l    = pl_itree_entry (node, pl_inode_lock_t, range);
+        pl_inode_lock_t *lock = data;
+
+        if (lock->range.seq && l->range.seq > lock->range.seq)
+                return 0;
+
+        return inodelk_type_conflict (lock, l);
 }
 
 static pl_inode_lock_t *
 __blocked_lock_conflict (pl_dom_list_t *dom, pl_inode_lock_t *lock)
 {
-        pl_inode_lock_t *l   = NULL;
-        pl_inode_lock_t *ret = NULL;
+        pl_itree_node_t *node = NULL;
 
-        if (list_empty (&dom->blocked_inodelks))
+        node = pl_itree_overlap (&dom->blocked_tree, lock->fl_start,
+                                 lock->fl_end, __blocked_conflict_fn, lock);
+        if (!node)
                 return NULL;
 
-        list_for_each_entry (l, &dom->blocked_inodelks, blocked_locks) {
-                if (inodelk_conflict (lock, l)) {
-                        ret = l;
-                        goto out;
-                }
-        }
-
-out:
-        return ret;
+        return pl_itree_entry (node, pl_inode_lock_t, range);
 }
 
 static int
@@ -209,8 +241,7 @@ __lock_inodelk (xlator_t *this, pl_inode_t *pl_inode, pl_inode_lock_t *lock,
                 if (can_block == 0)
                         goto out;
 
-                gettimeofday (&lock->blkd_time, NULL);
-                list_add_tail (&lock->blocked_locks, &dom->blocked_inodelks);
+                __block_inode_lock (dom, lock);
 
                 gf_log (this->name, GF_LOG_TRACE,
                         "%s (pid=%d) lk-owner:%s %"PRId64" - %"PRId64" => Blocked",
@@ -229,8 +260,7 @@ __lock_inodelk (xlator_t *this, pl_inode_t *pl_inode, pl_inode_lock_t *lock,
                 if (can_block == 0)
                         goto out;
 
-                gettimeofday (&lock->blkd_time, NULL);
-                list_add_tail (&lock->blocked_locks, &dom->blocked_inodelks);
+                __block_inode_lock (dom, lock);
 
                 gf_log (this->name, GF_LOG_DEBUG,
                         "Lock is grantable, but blocking to prevent starvation");
@@ -249,6 +279,10 @@ __lock_inodelk (xlator_t *this, pl_inode_t *pl_inode, pl_inode_lock_t *lock,
         gettimeofday (&lock->granted_time, NULL);
         list_add (&lock->list, &dom->inodelk_list);
 
+        lock->dom = dom;
+        pl_itree_insert (&dom->inodelk_tree, &lock->range, lock->fl_start,
+                         lock->fl_end);
+
         ret = 0;
 
 out:
@@ -267,16 +301,25 @@ inodelks_equal (pl_inode_lock_t *l1, pl_inode_lock_t *l2)
 }
 
 
+static int
+__matching_inodelk_fn (pl_itree_node_t *node, void *data)
+{
+        pl_inode_lock_t *l = pl_itree_entry (node, pl_inode_lock_t, range);
+
+        return (inodelks_equal (l, data) && same_inodelk_owner (l, data));
+}
+
 static pl_inode_lock_t *
 find_matching_inodelk (pl_inode_lock_t *lock, pl_dom_list_t *dom)
 {
-        pl_inode_lock_t *l = NULL;
-        list_for_each_entry (l, &dom->inodelk_list, list) {
-                if (inodelks_equal (l, lock) &&
-                    same_inodelk_owner (l, lock))
-                        return l;
-        }
-        return NULL;
+        pl_itree_node_t *node = NULL;
+
+        node = pl_itree_overlap (&dom->inodelk_tree, lock->fl_start,
+                                 lock->fl_end, __matching_inodelk_fn, lock);
+        if (!node)
+                return NULL;
+
+        return pl_itree_entry (node, pl_inode_lock_t, range);
 }
 
 /* Set F_UNLCK removes a lock which has the exact same lock boundaries
@@ -313,24 +356,37 @@ static void
 __grant_blocked_inode_locks (xlator_t *this, pl_inode_t *pl_inode,
                              struct list_head *granted, pl_dom_list_t *dom)
 {
-        int              bl_ret = 0;
-        pl_inode_lock_t *bl = NULL;
-        pl_inode_lock_t *tmp = NULL;
-
-        struct list_head blocked_list;
-
-        INIT_LIST_HEAD (&blocked_list);
-        list_splice_init (&dom->blocked_inodelks, &blocked_list);
-
-        list_for_each_entry_safe (bl, tmp, &blocked_list, blocked_locks) {
+        int               bl_ret = 0;
+        pl_inode_lock_t  *bl = NULL;
+        pl_itree_node_t **waiters = NULL;
+        int               count = 0;
+        int               i = 0;
+
+        /* Only waiters on ranges released since the last pass can have
+         * become grantable. They come oldest first, and one that does not
+         * make it goes back with its place in line. A granted waiter lets
+         * blocked locks of its owner skip the starvation check, so its
+         * range is looked at again.
+         */
+        while ((count = pl_itree_take_waiters (&dom->blocked_tree,
+                                               &waiters)) > 0) {
+                for (i = 0; i < count; i++) {
+                        bl = pl_itree_entry (waiters[i], pl_inode_lock_t,
+                                             range);
 
-                list_del_init (&bl->blocked_locks);
+                        list_del_init (&bl->blocked_locks);
+                        pl_itree_remove (&dom->blocked_tree, &bl->range);
 
-                bl_ret = __lock_inodelk (this, pl_inode, bl, 1, dom);
+                        bl_ret = __lock_inodelk (this, pl_inode, bl, 1, dom);
 
-                if (bl_ret == 0) {
-                        list_add (&bl->blocked_locks, granted);
+                        if (bl_ret == 0) {
+                                list_add (&bl->blocked_locks, granted);
+                                pl_itree_wake (&dom->blocked_tree,
+                                               bl->fl_start, bl->fl_end);
+                        }
                 }
+
+                GF_FREE (waiters);
         }
         return;
 }
@@ -456,7 +512,7 @@ pl_inodelk_client_cleanup (xlator_t *this, pl_ctx_t *ctx)
                                         list_add_tail (&l->client_list,
                                                        &released);
                                 } else {
-                                        list_del_init(&l->blocked_locks);
+                                        __delete_blocked_inode_lock (l);
                                         list_add_tail (&l->client_list,
                                                        &unwind);
                                 }
@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+   This file is part of GlusterFS.
+
+   This file is licensed to you under your choice of the GNU Lesser
+   General Public License, version 3 or any later version (LGPLv3 or
+   later), or the GNU General Public License, version 2 (GPLv2), in all
+   cases as published by the Free Software Foundation.
+*/
+#include <stdlib.h>
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "glusterfs.h"
+#include "mem-pool.h"
+
+#include "locks-mem-types.h"
+#include "interval-tree.h"
+
+
+void
+pl_itree_init (pl_itree_t *tree)
+{
+        tree->root = NULL;
+        tree->count = 0;
+        tree->rand = 2463534242U;
+        tree->seq = 0;
+        tree->wake_start = 0;
+        tree->wake_end = -1;
+}
+
+
+static uint32_t
+__itree_rand (pl_itree_t *tree)
+{
+        uint32_t x = tree->rand;
+
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        tree->rand = x;
+
+        return x;
+}
+
+
+static void
+__itree_update (pl_itree_node_t *node)
+{
+        off_t max_end = node->end;
+
+        if (node->left && node->left->max_end > max_end)
+                max_end = node->left->max_end;
+        if (node->right && node->right->max_end > max_end)
+                max_end = node->right->max_end;
+
+        node->max_end = max_end;
+}
+
+
+/* Nodes are ordered by start, ties broken by address so that every node has
+   a unique position and can be found again for removal */
+static int
+__itree_before (pl_itree_node_t *a, pl_itree_node_t *b)
+{
+        if (a->start != b->start)
+                return (a->start < b->start);
+
+        return ((uintptr_t)a < (uintptr_t)b);
+}
+
+
+static pl_itree_node_t *
+__itree_rotate_right (pl_itree_node_t *node)
+{
+        pl_itree_node_t *left = node->left;
+
+        node->left = left->right;
+        left->right = node;
+
+        __itree_update (node);
+        __itree_update (left);
+
+        return left;
+}
+
+
+static pl_itree_node_t *
+__itree_rotate_left (pl_itree_node_t *node)
+{
+        pl_itree_node_t *right = node->right;
+
+        node->right = right->left;
+        right->left = node;
+
+        __itree_update (node);
+        __itree_update (right);
+
+        return right;
+}
+
+
+static pl_itree_node_t *
+__itree_insert (pl_itree_node_t *root, pl_itree_node_t *node)
+{
+        if (!root)
+                return node;
+
+        if (__itree_before (node, root)) {
+                root->left = __itree_insert (root->left, node);
+                if (root->left->prio > root->prio)
+                        return __itree_rotate_right (root);
+        } else {
+                root->right = __itree_insert (root->right, node);
+                if (root->right->prio > root->prio)
+                        return __itree_rotate_left (root);
+        }
+
+        __itree_update (root);
+
+        return root;
+}
+
+
+static pl_itree_node_t *
+__itree_join (pl_itree_node_t *left, pl_itree_node_t *right)
+{
+        if (!left)
+                return right;
+        if (!right)
+                return left;
+
+        if (left->prio > right->prio) {
+                left->right = __itree_join (left->right, right);
+                __itree_update (left);
+                return left;
+        }
+
+        right->left = __itree_join (left, right->left);
+        __itree_update (right);
+
+        return right;
+}
+
+
+static pl_itree_node_t *
+__itree_remove (pl_itree_node_t *root, pl_itree_node_t *node)
+{
+        if (!root)
+                return NULL;
+
+        if (root == node)
+                return __itree_join (root->left, root->right);
+
+        if (__itree_before (node, root))
+                root->left = __itree_remove (root->left, node);
+        else
+                root->right = __itree_remove (root->right, node);
+
+        __itree_update (root);
+
+        return root;
+}
+
+
+/* Adds @node for [@start, @end]. A node keeps the sequence number of its
+   first insertion, so a waiter that is put back keeps its place in line. */
+void
+pl_itree_insert (pl_itree_t *tree, pl_itree_node_t *node, off_t start,
+                 off_t end)
+{
+        node->left = NULL;
+        node->right = NULL;
+        node->start = start;
+        node->end = end;
+        node->max_end = end;
+        node->prio = __itree_rand (tree);
+        if (!node->seq)
+                node->seq = ++tree->seq;
+
+        tree->root = __itree_insert (tree->root, node);
+        tree->count++;
+        node->linked = 1;
+}
+
+
+/* Removing a node that is not in the tree is a no-op */
+void
+pl_itree_remove (pl_itree_t *tree, pl_itree_node_t *node)
+{
+        if (!node->linked)
+                return;
+
+        tree->root = __itree_remove (tree->root, node);
+        tree->count--;
+
+        node->left = NULL;
+        node->right = NULL;
+        node->linked = 0;
+}
+
+
+static pl_itree_node_t *
+__itree_overlap (pl_itree_node_t *node, off_t start, off_t end,
+                 pl_itree_fn_t fn, void *data)
+{
+        pl_itree_node_t *found = NULL;
+
+        while (node && node->max_end >= start) {
+                found = __itree_overlap (node->left, start, end, fn, data);
+                if (found)
+                        return found;
+
+                /* everything from here on starts after the range */
+                if (node->start > end)
+                        return NULL;
+
+                if (node->end >= start && fn (node, data))
+                        return node;
+
+                node = node->right;
+        }
+
+        return NULL;
+}
+
+
+/* Calls @fn for the nodes overlapping [@start, @end] in order of their start
+   offset, until it returns non-zero. Returns the node it stopped at. */
+pl_itree_node_t *
+pl_itree_overlap (pl_itree_t *tree, off_t start, off_t end,
+                  pl_itree_fn_t fn, void *data)
+{
+        return __itree_overlap (tree->root, start, end, fn, data);
+}
+
+
+void
+pl_itree_wake (pl_itree_t *tree, off_t start, off_t end)
+{
+        if (!tree->count)
+                return;
+
+        if (tree->wake_end < tree->wake_start) {
+                tree->wake_start = start;
+                tree->wake_end = end;
+                return;
+        }
+
+        if (start < tree->wake_start)
+                tree->wake_start = start;
+        if (end > tree->wake_end)
+                tree->wake_end = end;
+}
+
+
+struct __itree_gather {
+        pl_itree_node_t **nodes;
+        int               count;
+};
+
+
+static int
+__itree_gather (pl_itree_node_t *node, void *data)
+{
+        struct __itree_gather *gather = data;
+
+        if (gather->nodes)
+                gather->nodes[gather->count] = node;
+        gather->count++;
+
+        return 0;
+}
+
+
+static int
+__itree_seq_cmp (const void *a, const void *b)
+{
+        const pl_itree_node_t *na = *(pl_itree_node_t * const *)a;
+        const pl_itree_node_t *nb = *(pl_itree_node_t * const *)b;
+
+        if (na->seq == nb->seq)
+                return 0;
+
+        return (na->seq < nb->seq) ? -1 : 1;
+}
+
+
+/* Hands out the nodes overlapping the wake range, oldest first, and clears
+   the range. The nodes stay in the tree. Returns the number of nodes, with
+   *@nodes to be freed by the caller, or -1 if out of memory, in which case
+   the wake range is kept for the next attempt. */
+int
+pl_itree_take_waiters (pl_itree_t *tree, pl_itree_node_t ***nodes)
+{
+        struct __itree_gather gather = {NULL, 0};
+
+        *nodes = NULL;
+
+        if (tree->wake_end < tree->wake_start)
+                return 0;
+
+        pl_itree_overlap (tree, tree->wake_start, tree->wake_end,
+                          __itree_gather, &gather);
+
+        if (gather.count) {
+                gather.nodes = GF_CALLOC (gather.count, sizeof (*gather.nodes),
+                                          gf_locks_mt_pl_itree_nodes);
+                if (!gather.nodes)
+                        return -1;
+
+                gather.count = 0;
+                pl_itree_overlap (tree, tree->wake_start, tree->wake_end,
+                                  __itree_gather, &gather);
+
+                qsort (gather.nodes, gather.count, sizeof (*gather.nodes),
+                       __itree_seq_cmp);
+        }
+
+        tree->wake_start = 0;
+        tree->wake_end = -1;
+
+        *nodes = gather.nodes;
+
+        return gather.count;
+}
@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+   This file is part of GlusterFS.
+
+   This file is licensed to you under your choice of the GNU Lesser
+   General Public License, version 3 or any later version (LGPLv3 or
+   later), or the GNU General Public License, version 2 (GPLv2), in all
+   cases as published by the Free Software Foundation.
+*/
+#ifndef __PL_INTERVAL_TREE_H__
+#define __PL_INTERVAL_TREE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/*
+ * Byte ranges of locks, indexed by start offset in a treap where every node
+ * also keeps the largest end offset below it. Finding the locks that overlap
+ * a range costs O(log n + k) for k overlaps instead of a walk of the whole
+ * lock list. Nodes are embedded in the locks, so the tree never allocates.
+ *
+ * Trees of blocked locks also remember the ranges released since the last
+ * time the waiters were looked at (the wake range): only waiters overlapping
+ * it can have become grantable, and they are handed out oldest first.
+ */
+
+struct pl_itree_node {
+        struct pl_itree_node *left;
+        struct pl_itree_node *right;
+        off_t                 start;
+        off_t                 end;
+        off_t                 max_end;  /* largest end in this subtree */
+        uint64_t              seq;      /* order of first insertion */
+        uint32_t              prio;
+        int                   linked;
+};
+typedef struct pl_itree_node pl_itree_node_t;
+
+struct pl_itree {
+        pl_itree_node_t *root;
+        uint32_t         count;
+        uint32_t         rand;
+        uint64_t         seq;
+        off_t            wake_start;
+        off_t            wake_end;     /* wake range empty if < wake_start */
+};
+typedef struct pl_itree pl_itree_t;
+
+/* Returns non-zero to stop the walk at this node */
+typedef int (*pl_itree_fn_t) (pl_itree_node_t *node, void *data);
+
+#define pl_itree_entry(node, type, member)                              \
+        ((type *)((char *)(node) - offsetof (type, member)))
+
+void
+pl_itree_init (pl_itree_t *tree);
+
+void
+pl_itree_insert (pl_itree_t *tree, pl_itree_node_t *node, off_t start,
+                 off_t end);
+
+void
+pl_itree_remove (pl_itree_t *tree, pl_itree_node_t *node);
+
+pl_itree_node_t *
+pl_itree_overlap (pl_itree_t *tree, off_t start, off_t end,
+                  pl_itree_fn_t fn, void *data);
+
+void
+pl_itree_wake (pl_itree_t *tree, off_t start, off_t end);
+
+int
+pl_itree_take_waiters (pl_itree_t *tree, pl_itree_node_t ***nodes);
+
+#endif /* __PL_INTERVAL_TREE_H__ */
@@ -22,11 +22,13 @@
 #include "client_t.h"
 
 #include "lkowner.h"
+#include "interval-tree.h"
 
 struct __pl_fd;
 
 struct __posix_lock {
         struct list_head   list;
+        pl_itree_node_t    range;      /* in granted_tree or blocked_tree */
 
         short              fl_type;
         off_t              fl_start;
@@ -55,6 +57,8 @@ typedef struct __posix_lock posix_lock_t;
 struct __pl_inode_lock {
         struct list_head   list;
         struct list_head   blocked_locks; /* list_head pointing to blocked_inodelks */
+        pl_itree_node_t    range;         /* in inodelk_tree or blocked_tree */
+        struct __pl_dom_list_t *dom;      /* domain holding or queueing it */
         int                ref;
 
         short              fl_type;
@@ -99,6 +103,8 @@ struct __pl_dom_list_t {
         struct list_head   blocked_entrylks; /* List of all blocked entrylks */
         struct list_head   inodelk_list;     /* List of inode locks */
         struct list_head   blocked_inodelks; /* List of all blocked inodelks */
+        pl_itree_t         inodelk_tree;     /* inodelk_list by range */
+        pl_itree_t         blocked_tree;     /* blocked_inodelks by range */
 };
 typedef struct __pl_dom_list_t pl_dom_list_t;
 
@@ -138,6 +144,8 @@ struct __pl_inode {
 
         struct list_head dom_list;       /* list of domains */
         struct list_head ext_list;       /* list of fcntl locks */
+        pl_itree_t       granted_tree;   /* granted fcntl locks by range */
+        pl_itree_t       blocked_tree;   /* blocked fcntl locks by range */
         struct list_head rw_list;        /* list of waiting r/w requests */
         struct list_head reservelk_list;        /* list of reservelks */
         struct list_head blocked_reservelks;        /* list of blocked reservelks */
@@ -117,12 +117,17 @@ pl_truncate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 }
 
 
+static int
+__other_owner_overlap (pl_itree_node_t *node, void *data)
+{
+        return !same_owner (pl_itree_entry (node, posix_lock_t, range), data);
+}
+
 static int
 truncate_allowed (pl_inode_t *pl_inode,
                   client_t *client, pid_t client_pid,
                   gf_lkowner_t *owner, off_t offset)
 {
-        posix_lock_t *l = NULL;
         posix_lock_t  region = {.list = {0, }, };
         int           ret = 1;
 
@@ -134,15 +139,12 @@ truncate_allowed (pl_inode_t *pl_inode,
 
         pthread_mutex_lock (&pl_inode->mutex);
         {
-                list_for_each_entry (l, &pl_inode->ext_list, list) {
-                        if (!l->blocked
-                            && locks_overlap (&region, l)
-                            && !same_owner (&region, l)) {
-                                ret = 0;
-                                gf_log ("posix-locks", GF_LOG_TRACE, "Truncate "
-                                        "allowed");
-                                break;
-                        }
+                if (pl_itree_overlap (&pl_inode->granted_tree,
+                                      region.fl_start, region.fl_end,
+                                      __other_owner_overlap, &region)) {
+                        ret = 0;
+                        gf_log ("posix-locks", GF_LOG_TRACE, "Truncate "
+                                "allowed");
                 }
         }
         pthread_mutex_unlock (&pl_inode->mutex);
@@ -321,7 +323,8 @@ delete_locks_of_fd (xlator_t *this, pl_inode_t *pl_inode, fd_t *fd)
                list_for_each_entry_safe (l, tmp, &pl_inode->ext_list, list) {
                        if (l->fd_num == fd_to_fdnum(fd)) {
                                if (l->blocked) {
-                                       list_move_tail (&l->list, &blocked_list);
+                                       __delete_lock (pl_inode, l);
+                                       list_add_tail (&l->list, &blocked_list);
                                        continue;
                                }
                                __delete_lock (pl_inode, l);
@@ -1129,23 +1132,40 @@ do_blocked_rw (pl_inode_t *pl_inode)
 }
 
 
+struct __rw_query {
+        posix_lock_t    *region;
+        glusterfs_fop_t  op;
+};
+
+static int
+__rw_conflict (pl_itree_node_t *node, void *data)
+{
+        posix_lock_t      *l     = pl_itree_entry (node, posix_lock_t, range);
+        struct __rw_query *query = data;
+
+        if (same_owner (l, query->region))
+                return 0;
+
+        if ((query->op == GF_FOP_READ) && (l->fl_type != F_WRLCK))
+                return 0;
+
+        return 1;
+}
+
+/* Blocked locks count as well */
 static int
 __rw_allowable (pl_inode_t *pl_inode, posix_lock_t *region,
                 glusterfs_fop_t op)
 {
-        posix_lock_t *l = NULL;
-        int           ret = 1;
+        struct __rw_query query = {region, op};
 
-        list_for_each_entry (l, &pl_inode->ext_list, list) {
-                if (locks_overlap (l, region) && !same_owner (l, region)) {
-                        if ((op == GF_FOP_READ) && (l->fl_type != F_WRLCK))
-                                continue;
-                        ret = 0;
-                        break;
-                }
-        }
+        if (pl_itree_overlap (&pl_inode->granted_tree, region->fl_start,
+                              region->fl_end, __rw_conflict, &query) ||
+            pl_itree_overlap (&pl_inode->blocked_tree, region->fl_start,
+                              region->fl_end, __rw_conflict, &query))
+                return 0;
 
-        return ret;
+        return 1;
 }
 
 
@@ -0,0 +1,219 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * fcntl lock storm on one file, as the number of lock owners grows. Every
+ * owner holds a write lock on its own 4KB record, and a queue of waiters is
+ * blocked behind a hot record that is never released. Each round an owner
+ * drops and takes back its record, tries to take the record of another
+ * owner (which fails with EAGAIN) and asks F_GETLK about it. All of these
+ * used to walk every granted and blocked lock of the file, and every setlk
+ * looked at every waiter again.
+ *
+ * usage: locks_bench [max-owners] [rounds] [waiters]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "inode.h"
+#include "locks.h"
+#include "common.h"
+
+#define BENCH_RECORD 4096
+
+static char bench_clients[1];
+static char bench_fd[1];
+
+/* posix.c and inodelk.c are not linked in */
+void
+do_blocked_rw (pl_inode_t *pl_inode)
+{
+}
+
+void
+pl_print_inodelk (char *str, int size, int cmd, struct gf_flock *flock,
+                  const char *domain)
+{
+}
+
+static double
+bench_now (void)
+{
+        struct timespec ts;
+
+        clock_gettime (CLOCK_MONOTONIC, &ts);
+
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static posix_lock_t *
+bench_lock (int owner, int record, short type)
+{
+        struct gf_flock  flock = {0, };
+        gf_lkowner_t     lkowner = {0, };
+        posix_lock_t    *lock = NULL;
+
+        flock.l_type = type;
+        flock.l_whence = SEEK_SET;
+        flock.l_start = (off_t)record * BENCH_RECORD;
+        flock.l_len = BENCH_RECORD;
+
+        set_lk_owner_from_uint64 (&lkowner, owner);
+
+        lock = new_posix_lock (&flock, (client_t *)bench_clients, owner,
+                               &lkowner, (fd_t *)bench_fd);
+        if (lock)
+                lock->user_flock = flock;
+
+        return lock;
+}
+
+/* Record 0 is the hot one, owner k holds record k + 1 */
+static int
+bench_setup (xlator_t *this, pl_inode_t *pl_inode, int owners, int waiters)
+{
+        posix_lock_t *lock = NULL;
+        int           i = 0;
+
+        lock = bench_lock (0, 0, F_WRLCK);
+        if (!lock || pl_setlk (this, pl_inode, lock, 0))
+                return -1;
+
+        for (i = 0; i < owners; i++) {
+                lock = bench_lock (i + 1, i + 1, F_WRLCK);
+                if (!lock || pl_setlk (this, pl_inode, lock, 0))
+                        return -1;
+        }
+
+        for (i = 0; i < waiters; i++) {
+                lock = bench_lock (owners + i + 1, 0, F_WRLCK);
+                if (!lock || pl_setlk (this, pl_inode, lock, 1) != -1)
+                        return -1;
+        }
+
+        return 0;
+}
+
+static double
+bench_storm (xlator_t *this, pl_inode_t *pl_inode, int owners, long rounds,
+             long *errors)
+{
+        posix_lock_t *lock = NULL;
+        posix_lock_t *conf = NULL;
+        unsigned int  seed = 1;
+        double        start = 0;
+        double        ops = 0;
+        long          i = 0;
+        int           owner = 0;
+        int           other = 0;
+
+        start = bench_now ();
+        for (i = 0; i < rounds; i++) {
+                owner = 1 + rand_r (&seed) % owners;
+                other = 1 + rand_r (&seed) % owners;
+                if (other == owner)
+                        other = (other % owners) + 1;
+
+                lock = bench_lock (owner, owner, F_UNLCK);
+                if (pl_setlk (this, pl_inode, lock, 0))
+                        (*errors)++;
+
+                lock = bench_lock (owner, owner, F_WRLCK);
+                if (pl_setlk (this, pl_inode, lock, 0))
+                        (*errors)++;
+                ops += 2;
+
+                if (owners == 1)
+                        continue;
+
+                lock = bench_lock (owner, other, F_WRLCK);
+                if (pl_setlk (this, pl_inode, lock, 0) != -1)
+                        (*errors)++;
+                else
+                        __destroy_lock (lock);
+
+                lock = bench_lock (owner, other, F_RDLCK);
+                conf = pl_getlk (pl_inode, lock);
+                if (conf == lock)
+                        (*errors)++;
+                __destroy_lock (lock);
+                ops += 2;
+        }
+
+        return ops / (bench_now () - start);
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t         *ctx = NULL;
+        glusterfs_graph_t        graph = {{0, }, };
+        xlator_t                 xl = {0, };
+        posix_locks_private_t    priv = {0, };
+        inode_table_t           *table = NULL;
+        inode_t                 *inode = NULL;
+        pl_inode_t              *pl_inode = NULL;
+        int                      max = 4096;
+        long                     rounds = 100000;
+        int                      waiters = 256;
+        int                      owners = 0;
+        long                     errors = 0;
+        double                   ops = 0;
+
+        if (argc > 1)
+                max = atoi (argv[1]);
+        if (argc > 2)
+                rounds = atol (argv[2]);
+        if (argc > 3)
+                waiters = atoi (argv[3]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx))
+                return 1;
+        ctx->mem_acct_enable = 0;
+        THIS->ctx = ctx;
+
+        graph.xl_count = 1;
+        xl.name = "bench-locks";
+        xl.graph = &graph;
+        xl.ctx = ctx;
+        xl.private = &priv;
+
+        table = inode_table_new (0, &xl);
+        if (!table)
+                return 1;
+
+        printf ("%8s %8s %14s\n", "owners", "waiters", "lock ops/s");
+
+        for (owners = 1; owners <= max; owners *= 4) {
+                inode = inode_new (table);
+                if (!inode)
+                        return 1;
+                pl_inode = pl_inode_get (&xl, inode);
+                if (!pl_inode)
+                        return 1;
+
+                if (bench_setup (&xl, pl_inode, owners, waiters))
+                        return 1;
+
+                ops = bench_storm (&xl, pl_inode, owners, rounds, &errors);
+
+                printf ("%8d %8d %14.0f %s\n", owners, waiters, ops,
+                        errors ? "ERRORS" : "");
+        }
+
+        return errors ? 1 : 0;
+}
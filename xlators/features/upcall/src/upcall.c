@@ -0,0 +1,1790 @@
+/*
+   Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+   This file is part of GlusterFS.
+
+   This file is licensed to you under your choice of the GNU Lesser
+   General Public License, version 3 or any later version (LGPLv3 or
+   later), or the GNU General Public License, version 2 (GPLv2), in all
+   cases as published by the Free Software Foundation.
+*/
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include <time.h>
+
+#include "glusterfs.h"
+#include "xlator.h"
+#include "logging.h"
+#include "common-utils.h"
+#include "defaults.h"
+#include "statedump.h"
+
+#include "upcall.h"
+
+/*
+ * Remembers, per inode, which clients have looked at it during the last
+ * cache-invalidation-timeout seconds, and when a fop of one client changes
+ * the inode, sends the others a GF_EVENT_UPCALL up the graph, which
+ * protocol/server turns into a callback to that client. Clients can then
+ * cache attributes for much longer than they could without being told.
+ */
+
+void
+upcall_local_wipe (upcall_local_t *local)
+{
+        if (!local)
+                return;
+
+        if (local->inode)
+                inode_unref (local->inode);
+        if (local->parent)
+                inode_unref (local->parent);
+        if (local->inode2)
+                inode_unref (local->inode2);
+        if (local->parent2)
+                inode_unref (local->parent2);
+
+        GF_FREE (local);
+}
+
+/* Returns -1 only if the fop has to be failed; when invalidation is off or
+ * the frame does not come from a client there is nothing to track. */
+static int
+upcall_local_init (call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
+                   loc_t *loc2)
+{
+        upcall_private_t *priv  = this->private;
+        upcall_local_t   *local = NULL;
+
+        if (!priv->cache_invalidation_enabled || !frame->root->client)
+                return 0;
+
+        local = GF_CALLOC (1, sizeof (*local), gf_upcall_mt_local_t);
+        if (!local)
+                return -1;
+
+        if (loc) {
+                if (loc->inode)
+                        local->inode = inode_ref (loc->inode);
+                if (loc->parent)
+                        local->parent = inode_ref (loc->parent);
+        } else if (fd && fd->inode) {
+                local->inode = inode_ref (fd->inode);
+        }
+
+        if (loc2) {
+                if (loc2->inode)
+                        local->inode2 = inode_ref (loc2->inode);
+                if (loc2->parent)
+                        local->parent2 = inode_ref (loc2->parent);
+        }
+
+        frame->local = local;
+
+        return 0;
+}
+
+static uint32_t
+upcall_setattr_flags (int32_t valid)
+{
+        uint32_t flags = UP_TIMES;      /* ctime always changes */
+
+        if (valid & GF_SET_ATTR_MODE)
+                flags |= UP_MODE;
+        if (valid & (GF_SET_ATTR_UID | GF_SET_ATTR_GID))
+                flags |= UP_OWN;
+        if (valid & GF_SET_ATTR_ATIME)
+                flags |= UP_ATIME;
+
+        return flags;
+}
+
+static upcall_inode_ctx_t *
+upcall_inode_ctx_get (inode_t *inode, xlator_t *this)
+{
+        upcall_inode_ctx_t *ctx   = NULL;
+        uint64_t            value = 0;
+        int                 ret   = -1;
+
+        LOCK (&inode->lock);
+        {
+                ret = __inode_ctx_get (inode, this, &value);
+                if (ret == 0) {
+                        ctx = (upcall_inode_ctx_t *)(long) value;
+                        goto unlock;
+                }
+
+                ctx = GF_CALLOC (1, sizeof (*ctx), gf_upcall_mt_inode_ctx_t);
+                if (!ctx)
+                        goto unlock;
+
+                pthread_mutex_init (&ctx->client_list_lock, NULL);
+                INIT_LIST_HEAD (&ctx->client_list);
+
+                ret = __inode_ctx_set (inode, this, (uint64_t *)&ctx);
+                if (ret) {
+                        pthread_mutex_destroy (&ctx->client_list_lock);
+                        GF_FREE (ctx);
+                        ctx = NULL;
+                }
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        return ctx;
+}
+
+static void
+upcall_client_free (upcall_client_t *up_client)
+{
+        list_del_init (&up_client->list);
+        GF_FREE (up_client->client_uid);
+        GF_FREE (up_client);
+}
+
+static void
+upcall_client_notify (xlator_t *this, inode_t *inode,
+                      upcall_client_t *up_client, uint32_t flags)
+{
+        upcall_private_t                     *priv    = this->private;
+        struct gf_upcall                      upcall  = {0, };
+        struct gf_upcall_cache_invalidation   ca_data = {0, };
+
+        upcall.client_uid = up_client->client_uid;
+        upcall.event_type = GF_UPCALL_CACHE_INVALIDATION;
+        uuid_copy (upcall.gfid, inode->gfid);
+
+        ca_data.flags = flags;
+        ca_data.expire_time_attr = priv->cache_invalidation_timeout;
+        upcall.data = &ca_data;
+
+        gf_log (this->name, GF_LOG_TRACE, "invalidating %s on %s, flags 0x%x",
+                uuid_utoa (inode->gfid), up_client->client_uid, flags);
+
+        default_notify (this, GF_EVENT_UPCALL, &upcall);
+
+        LOCK (&priv->lock);
+        {
+                priv->notified++;
+        }
+        UNLOCK (&priv->lock);
+}
+
+/* Records that the client of the frame has seen the inode and, if flags
+ * are given, tells every other client which has seen it within the
+ * timeout what changed. Clients which have not been seen for longer are
+ * forgotten on the way.
+ */
+void
+upcall_cache_invalidate (call_frame_t *frame, xlator_t *this, inode_t *inode,
+                         uint32_t flags)
+{
+        upcall_private_t   *priv      = this->private;
+        upcall_inode_ctx_t *ctx       = NULL;
+        upcall_client_t    *up_client = NULL;
+        upcall_client_t    *tmp       = NULL;
+        upcall_client_t    *notify    = NULL;
+        client_t           *client    = NULL;
+        struct list_head    to_notify;
+        gf_boolean_t        found     = _gf_false;
+        uint64_t            expired   = 0;
+        time_t              now       = 0;
+
+        client = frame->root->client;
+        if (!inode || !client || !client->client_uid)
+                return;
+
+        ctx = upcall_inode_ctx_get (inode, this);
+        if (!ctx)
+                return;
+
+        now = time (NULL);
+        INIT_LIST_HEAD (&to_notify);
+
+        /* The notification travels up to the server and out through its
+         * rpc, which takes locks of its own; only the uids to notify are
+         * collected under the client list lock. */
+        pthread_mutex_lock (&ctx->client_list_lock);
+        {
+                list_for_each_entry_safe (up_client, tmp, &ctx->client_list,
+                                          list) {
+                        if (strcmp (up_client->client_uid,
+                                    client->client_uid) == 0) {
+                                up_client->access_time = now;
+                                found = _gf_true;
+                                continue;
+                        }
+
+                        if ((now - up_client->access_time) >
+                            priv->cache_invalidation_timeout) {
+                                upcall_client_free (up_client);
+                                expired++;
+                                continue;
+                        }
+
+                        if (!flags)
+                                continue;
+
+                        notify = GF_CALLOC (1, sizeof (*notify),
+                                            gf_upcall_mt_client_t);
+                        if (!notify)
+                                continue;
+
+                        notify->client_uid = gf_strdup (up_client->client_uid);
+                        if (!notify->client_uid) {
+                                GF_FREE (notify);
+                                continue;
+                        }
+                        list_add_tail (&notify->list, &to_notify);
+                }
+
+                if (found)
+                        goto unlock;
+
+                up_client = GF_CALLOC (1, sizeof (*up_client),
+                                       gf_upcall_mt_client_t);
+                if (!up_client)
+                        goto unlock;
+
+                up_client->client_uid = gf_strdup (client->client_uid);
+                if (!up_client->client_uid) {
+                        GF_FREE (up_client);
+                        goto unlock;
+                }
+                up_client->access_time = now;
+                list_add_tail (&up_client->list, &ctx->client_list);
+        }
+unlock:
+        pthread_mutex_unlock (&ctx->client_list_lock);
+
+        list_for_each_entry_safe (notify, tmp, &to_notify, list) {
+                upcall_client_notify (this, inode, notify, flags);
+                upcall_client_free (notify);
+        }
+
+        if (expired) {
+                LOCK (&priv->lock);
+                {
+                        priv->expired += expired;
+                }
+                UNLOCK (&priv->lock);
+        }
+}
+
+int32_t
+up_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, inode_t *inode,
+               struct iatt *buf, dict_t *xdata, struct iatt *postparent)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (lookup, frame, op_ret, op_errno, inode, buf, xdata,
+                             postparent);
+
+        return 0;
+}
+
+int32_t
+up_lookup (call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_lookup_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->lookup, loc, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (lookup, frame, -1, op_errno, NULL, NULL, NULL,
+                             NULL);
+
+        return 0;
+}
+
+int32_t
+up_stat_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+             int32_t op_ret, int32_t op_errno, struct iatt *buf,
+             dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (stat, frame, op_ret, op_errno, buf, xdata);
+
+        return 0;
+}
+
+int32_t
+up_stat (call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_stat_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->stat, loc, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (stat, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_fstat_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, struct iatt *buf,
+              dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (fstat, frame, op_ret, op_errno, buf, xdata);
+
+        return 0;
+}
+
+int32_t
+up_fstat (call_frame_t *frame, xlator_t *this, fd_t *fd, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_fstat_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->fstat, fd, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (fstat, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_access_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (access, frame, op_ret, op_errno, xdata);
+
+        return 0;
+}
+
+int32_t
+up_access (call_frame_t *frame, xlator_t *this, loc_t *loc, int32_t mask,
+           dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_access_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->access, loc, mask, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (access, frame, -1, op_errno, NULL);
+
+        return 0;
+}
+
+int32_t
+up_readlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, const char *path,
+                 struct iatt *buf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (readlink, frame, op_ret, op_errno, path, buf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_readlink (call_frame_t *frame, xlator_t *this, loc_t *loc, size_t size,
+             dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_readlink_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->readlink, loc, size, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (readlink, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+             int32_t op_ret, int32_t op_errno, fd_t *fd, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (open, frame, op_ret, op_errno, fd, xdata);
+
+        return 0;
+}
+
+int32_t
+up_open (call_frame_t *frame, xlator_t *this, loc_t *loc, int32_t flags,
+         fd_t *fd, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_open_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->open, loc, flags, fd, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (open, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_opendir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, fd_t *fd, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (opendir, frame, op_ret, op_errno, fd, xdata);
+
+        return 0;
+}
+
+int32_t
+up_opendir (call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
+            dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_opendir_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->opendir, loc, fd, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (opendir, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_readv_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, struct iovec *vector,
+              int32_t count, struct iatt *stbuf, struct iobref *iobref,
+              dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (readv, frame, op_ret, op_errno, vector, count,
+                             stbuf, iobref, xdata);
+
+        return 0;
+}
+
+int32_t
+up_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+          off_t offset, uint32_t flags, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_readv_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->readv, fd, size, offset, flags,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (readv, frame, -1, op_errno, NULL, 0, NULL, NULL,
+                             NULL);
+
+        return 0;
+}
+
+int32_t
+up_getxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, dict_t *dict,
+                 dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (getxattr, frame, op_ret, op_errno, dict, xdata);
+
+        return 0;
+}
+
+int32_t
+up_getxattr (call_frame_t *frame, xlator_t *this, loc_t *loc,
+             const char *name, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_getxattr_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->getxattr, loc, name, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (getxattr, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_fgetxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                  int32_t op_ret, int32_t op_errno, dict_t *dict,
+                  dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+out:
+        UPCALL_STACK_UNWIND (fgetxattr, frame, op_ret, op_errno, dict, xdata);
+
+        return 0;
+}
+
+int32_t
+up_fgetxattr (call_frame_t *frame, xlator_t *this, fd_t *fd, const char *name,
+              dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_fgetxattr_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->fgetxattr, fd, name, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (fgetxattr, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_readdirp_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, gf_dirent_t *entries,
+                 dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+        gf_dirent_t    *entry = NULL;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, 0);
+
+        /* the client caches the attributes of the entries too */
+        list_for_each_entry (entry, &entries->list, list) {
+                upcall_cache_invalidate (frame, this, entry->inode, 0);
+        }
+
+out:
+        UPCALL_STACK_UNWIND (readdirp, frame, op_ret, op_errno, entries, xdata);
+
+        return 0;
+}
+
+int32_t
+up_readdirp (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+             off_t offset, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_readdirp_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->readdirp, fd, size, offset,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (readdirp, frame, -1, op_errno, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_writev_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+               struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_WRITE_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (writev, frame, op_ret, op_errno, prebuf, postbuf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
+           struct iovec *vector, int32_t count, off_t offset, uint32_t flags,
+           struct iobref *iobref, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_writev_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->writev, fd, vector, count,
+                    offset, flags, iobref, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (writev, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_truncate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                 struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_WRITE_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (truncate, frame, op_ret, op_errno, prebuf, postbuf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_truncate (call_frame_t *frame, xlator_t *this, loc_t *loc, off_t offset,
+             dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_truncate_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->truncate, loc, offset, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (truncate, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_ftruncate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                  int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                  struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_WRITE_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (ftruncate, frame, op_ret, op_errno, prebuf,
+                             postbuf, xdata);
+
+        return 0;
+}
+
+int32_t
+up_ftruncate (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+              dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_ftruncate_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->ftruncate, fd, offset, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (ftruncate, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_fallocate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                  int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                  struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_WRITE_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (fallocate, frame, op_ret, op_errno, prebuf,
+                             postbuf, xdata);
+
+        return 0;
+}
+
+int32_t
+up_fallocate (call_frame_t *frame, xlator_t *this, fd_t *fd,
+              int32_t keep_size, off_t offset, size_t len, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_fallocate_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->fallocate, fd, keep_size,
+                    offset, len, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (fallocate, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_discard_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_WRITE_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (discard, frame, op_ret, op_errno, prebuf, postbuf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_discard (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+            size_t len, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_discard_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->discard, fd, offset, len, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (discard, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_zerofill_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                 struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_WRITE_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (zerofill, frame, op_ret, op_errno, prebuf, postbuf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_zerofill (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+             off_t len, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_zerofill_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->zerofill, fd, offset, len,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (zerofill, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_setattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode,
+                                 (uint32_t)(long) cookie);
+
+out:
+        UPCALL_STACK_UNWIND (setattr, frame, op_ret, op_errno, prebuf, postbuf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_setattr (call_frame_t *frame, xlator_t *this, loc_t *loc,
+            struct iatt *stbuf, int32_t valid, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND_COOKIE (frame, up_setattr_cbk,
+                           (void *)(long) upcall_setattr_flags (valid),
+                           FIRST_CHILD (this),
+                           FIRST_CHILD (this)->fops->setattr,
+                           loc, stbuf, valid, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (setattr, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_fsetattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                 struct iatt *postbuf, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode,
+                                 (uint32_t)(long) cookie);
+
+out:
+        UPCALL_STACK_UNWIND (fsetattr, frame, op_ret, op_errno, prebuf, postbuf,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_fsetattr (call_frame_t *frame, xlator_t *this, fd_t *fd,
+             struct iatt *stbuf, int32_t valid, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND_COOKIE (frame, up_fsetattr_cbk,
+                           (void *)(long) upcall_setattr_flags (valid),
+                           FIRST_CHILD (this),
+                           FIRST_CHILD (this)->fops->fsetattr,
+                           fd, stbuf, valid, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (fsetattr, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_setxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_XATTR);
+
+out:
+        UPCALL_STACK_UNWIND (setxattr, frame, op_ret, op_errno, xdata);
+
+        return 0;
+}
+
+int32_t
+up_setxattr (call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *dict,
+             int32_t flags, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_setxattr_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->setxattr, loc, dict, flags,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (setxattr, frame, -1, op_errno, NULL);
+
+        return 0;
+}
+
+int32_t
+up_fsetxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                  int32_t op_ret, int32_t op_errno, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_XATTR);
+
+out:
+        UPCALL_STACK_UNWIND (fsetxattr, frame, op_ret, op_errno, xdata);
+
+        return 0;
+}
+
+int32_t
+up_fsetxattr (call_frame_t *frame, xlator_t *this, fd_t *fd, dict_t *dict,
+              int32_t flags, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_fsetxattr_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->fsetxattr, fd, dict, flags,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (fsetxattr, frame, -1, op_errno, NULL);
+
+        return 0;
+}
+
+int32_t
+up_removexattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                    int32_t op_ret, int32_t op_errno, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_XATTR);
+
+out:
+        UPCALL_STACK_UNWIND (removexattr, frame, op_ret, op_errno, xdata);
+
+        return 0;
+}
+
+int32_t
+up_removexattr (call_frame_t *frame, xlator_t *this, loc_t *loc,
+                const char *name, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_removexattr_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->removexattr, loc, name, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (removexattr, frame, -1, op_errno, NULL);
+
+        return 0;
+}
+
+int32_t
+up_fremovexattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                     int32_t op_ret, int32_t op_errno, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode, UP_XATTR);
+
+out:
+        UPCALL_STACK_UNWIND (fremovexattr, frame, op_ret, op_errno, xdata);
+
+        return 0;
+}
+
+int32_t
+up_fremovexattr (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                 const char *name, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, NULL, fd, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_fremovexattr_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->fremovexattr, fd, name, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (fremovexattr, frame, -1, op_errno, NULL);
+
+        return 0;
+}
+
+int32_t
+up_unlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, struct iatt *preparent,
+               struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode,
+                                 UP_NLINK | UP_TIMES);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (unlink, frame, op_ret, op_errno, preparent,
+                             postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_unlink (call_frame_t *frame, xlator_t *this, loc_t *loc, int xflags,
+           dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_unlink_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->unlink, loc, xflags, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (unlink, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_rmdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, struct iatt *preparent,
+              struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode,
+                                 UP_NLINK | UP_TIMES);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (rmdir, frame, op_ret, op_errno, preparent,
+                             postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_rmdir (call_frame_t *frame, xlator_t *this, loc_t *loc, int xflags,
+          dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_rmdir_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->rmdir, loc, xflags, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (rmdir, frame, -1, op_errno, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_link_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+             int32_t op_ret, int32_t op_errno, inode_t *inode,
+             struct iatt *buf, struct iatt *preparent,
+             struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode,
+                                 UP_NLINK | UP_TIMES);
+        upcall_cache_invalidate (frame, this, local->parent2,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (link, frame, op_ret, op_errno, inode, buf,
+                             preparent, postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_link (call_frame_t *frame, xlator_t *this, loc_t *oldloc, loc_t *newloc,
+         dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, oldloc, NULL, newloc) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_link_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->link, oldloc, newloc, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (link, frame, -1, op_errno, NULL, NULL, NULL, NULL,
+                             NULL);
+
+        return 0;
+}
+
+int32_t
+up_rename_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, struct iatt *buf,
+               struct iatt *preoldparent, struct iatt *postoldparent,
+               struct iatt *prenewparent, struct iatt *postnewparent,
+               dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, local->inode,
+                                 UP_RENAME | UP_TIMES);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+        if (local->parent2 != local->parent)
+                upcall_cache_invalidate (frame, this, local->parent2,
+                                         UP_PARENT_DENTRY_FLAGS);
+        /* an entry which was replaced lost a link */
+        if (local->inode2 != local->inode)
+                upcall_cache_invalidate (frame, this, local->inode2,
+                                         UP_NLINK | UP_TIMES);
+
+out:
+        UPCALL_STACK_UNWIND (rename, frame, op_ret, op_errno, buf, preoldparent,
+                             postoldparent, prenewparent, postnewparent,
+                             xdata);
+
+        return 0;
+}
+
+int32_t
+up_rename (call_frame_t *frame, xlator_t *this, loc_t *oldloc, loc_t *newloc,
+           dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, oldloc, NULL, newloc) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_rename_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->rename, oldloc, newloc, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (rename, frame, -1, op_errno, NULL, NULL, NULL,
+                             NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, fd_t *fd, inode_t *inode,
+               struct iatt *buf, struct iatt *preparent,
+               struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, inode, 0);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (create, frame, op_ret, op_errno, fd, inode, buf,
+                             preparent, postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_create (call_frame_t *frame, xlator_t *this, loc_t *loc, int32_t flags,
+           mode_t mode, mode_t umask, fd_t *fd, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_create_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->create, loc, flags, mode, umask,
+                    fd, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (create, frame, -1, op_errno, NULL, NULL, NULL,
+                             NULL, NULL, NULL);
+
+        return 0;
+}
+
+int32_t
+up_mknod_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, inode_t *inode,
+              struct iatt *buf, struct iatt *preparent,
+              struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, inode, 0);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (mknod, frame, op_ret, op_errno, inode, buf,
+                             preparent, postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_mknod (call_frame_t *frame, xlator_t *this, loc_t *loc, mode_t mode,
+          dev_t rdev, mode_t umask, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_mknod_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->mknod, loc, mode, rdev, umask,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (mknod, frame, -1, op_errno, NULL, NULL, NULL, NULL,
+                             NULL);
+
+        return 0;
+}
+
+int32_t
+up_mkdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, inode_t *inode,
+              struct iatt *buf, struct iatt *preparent,
+              struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, inode, 0);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (mkdir, frame, op_ret, op_errno, inode, buf,
+                             preparent, postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_mkdir (call_frame_t *frame, xlator_t *this, loc_t *loc, mode_t mode,
+          mode_t umask, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_mkdir_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->mkdir, loc, mode, umask, xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (mkdir, frame, -1, op_errno, NULL, NULL, NULL, NULL,
+                             NULL);
+
+        return 0;
+}
+
+int32_t
+up_symlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, inode_t *inode,
+                struct iatt *buf, struct iatt *preparent,
+                struct iatt *postparent, dict_t *xdata)
+{
+        upcall_local_t *local = frame->local;
+
+        if ((op_ret < 0) || !local)
+                goto out;
+
+        upcall_cache_invalidate (frame, this, inode, 0);
+        upcall_cache_invalidate (frame, this, local->parent,
+                                 UP_PARENT_DENTRY_FLAGS);
+
+out:
+        UPCALL_STACK_UNWIND (symlink, frame, op_ret, op_errno, inode, buf,
+                             preparent, postparent, xdata);
+
+        return 0;
+}
+
+int32_t
+up_symlink (call_frame_t *frame, xlator_t *this, const char *linkpath,
+            loc_t *loc, mode_t umask, dict_t *xdata)
+{
+        int32_t op_errno = -1;
+
+        if (upcall_local_init (frame, this, loc, NULL, NULL) < 0) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        STACK_WIND (frame, up_symlink_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->symlink, linkpath, loc, umask,
+                    xdata);
+        return 0;
+
+err:
+        UPCALL_STACK_UNWIND (symlink, frame, -1, op_errno, NULL, NULL, NULL,
+                             NULL, NULL);
+
+        return 0;
+}
+
+int
+upcall_forget (xlator_t *this, inode_t *inode)
+{
+        upcall_inode_ctx_t *ctx       = NULL;
+        upcall_client_t    *up_client = NULL;
+        upcall_client_t    *tmp       = NULL;
+        uint64_t            value     = 0;
+
+        inode_ctx_del (inode, this, &value);
+        ctx = (upcall_inode_ctx_t *)(long) value;
+        if (!ctx)
+                return 0;
+
+        list_for_each_entry_safe (up_client, tmp, &ctx->client_list, list) {
+                upcall_client_free (up_client);
+        }
+
+        pthread_mutex_destroy (&ctx->client_list_lock);
+        GF_FREE (ctx);
+
+        return 0;
+}
+
+int
+upcall_dump_priv (xlator_t *this)
+{
+        upcall_private_t *priv = NULL;
+
+        priv = this->private;
+        if (!priv)
+                return 0;
+
+        gf_proc_dump_add_section ("xlator.features.upcall.priv");
+
+        gf_proc_dump_write ("cache_invalidation", "%d",
+                            priv->cache_invalidation_enabled);
+        gf_proc_dump_write ("cache_invalidation_timeout", "%d",
+                            priv->cache_invalidation_timeout);
+
+        LOCK (&priv->lock);
+        {
+                gf_proc_dump_write ("notified", "%"PRIu64, priv->notified);
+                gf_proc_dump_write ("expired", "%"PRIu64, priv->expired);
+        }
+        UNLOCK (&priv->lock);
+
+        return 0;
+}
+
+int
+upcall_dump_inode_ctx (xlator_t *this, inode_t *inode)
+{
+        upcall_inode_ctx_t *ctx                      = NULL;
+        upcall_client_t    *up_client                = NULL;
+        uint64_t            value                    = 0;
+        int                 i                        = 0;
+        char                key[GF_DUMP_MAX_BUF_LEN] = {0,};
+
+        if (inode_ctx_get (inode, this, &value) != 0)
+                return 0;
+        ctx = (upcall_inode_ctx_t *)(long) value;
+
+        gf_proc_dump_add_section ("xlator.features.upcall.inode");
+
+        pthread_mutex_lock (&ctx->client_list_lock);
+        {
+                list_for_each_entry (up_client, &ctx->client_list, list) {
+                        snprintf (key, sizeof (key), "client.%d", i++);
+                        gf_proc_dump_write (key, "%s, accessed %ld",
+                                            up_client->client_uid,
+                                            (long) up_client->access_time);
+                }
+        }
+        pthread_mutex_unlock (&ctx->client_list_lock);
+
+        return 0;
+}
+
+int32_t
+mem_acct_init (xlator_t *this)
+{
+        int     ret = -1;
+
+        ret = xlator_mem_acct_init (this, gf_upcall_mt_end + 1);
+        if (ret)
+                gf_log (this->name, GF_LOG_ERROR, "Memory accounting "
+                        "initialization failed.");
+
+        return ret;
+}
+
+int
+reconfigure (xlator_t *this, dict_t *options)
+{
+        upcall_private_t *priv = NULL;
+        int               ret  = -1;
+
+        priv = this->private;
+        GF_ASSERT (priv);
+
+        GF_OPTION_RECONF ("cache-invalidation",
+                          priv->cache_invalidation_enabled, options, bool,
+                          out);
+        GF_OPTION_RECONF ("cache-invalidation-timeout",
+                          priv->cache_invalidation_timeout, options, int32,
+                          out);
+
+        ret = 0;
+out:
+        return ret;
+}
+
+int
+init (xlator_t *this)
+{
+        int               ret  = -1;
+        upcall_private_t *priv = NULL;
+
+        if (!this->children || this->children->next) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "'upcall' not configured with exactly one child");
+                goto out;
+        }
+
+        if (!this->parents)
+                gf_log (this->name, GF_LOG_WARNING,
+                        "dangling volume. check volfile ");
+
+        priv = GF_CALLOC (1, sizeof (*priv), gf_upcall_mt_priv_t);
+        if (!priv)
+                goto out;
+
+        LOCK_INIT (&priv->lock);
+
+        GF_OPTION_INIT ("cache-invalidation",
+                        priv->cache_invalidation_enabled, bool, out);
+        GF_OPTION_INIT ("cache-invalidation-timeout",
+                        priv->cache_invalidation_timeout, int32, out);
+
+        this->private = priv;
+        ret = 0;
+out:
+        if (ret && priv) {
+                LOCK_DESTROY (&priv->lock);
+                GF_FREE (priv);
+        }
+
+        return ret;
+}
+
+void
+fini (xlator_t *this)
+{
+        upcall_private_t *priv = NULL;
+
+        priv = this->private;
+        if (!priv)
+                return;
+
+        this->private = NULL;
+
+        LOCK_DESTROY (&priv->lock);
+        GF_FREE (priv);
+}
+
+struct xlator_fops fops = {
+        .lookup        = up_lookup,
+        .stat          = up_stat,
+        .fstat         = up_fstat,
+        .access        = up_access,
+        .readlink      = up_readlink,
+        .open          = up_open,
+        .opendir       = up_opendir,
+        .readv         = up_readv,
+        .getxattr      = up_getxattr,
+        .fgetxattr     = up_fgetxattr,
+        .readdirp      = up_readdirp,
+        .writev        = up_writev,
+        .truncate      = up_truncate,
+        .ftruncate     = up_ftruncate,
+        .fallocate     = up_fallocate,
+        .discard       = up_discard,
+        .zerofill      = up_zerofill,
+        .setattr       = up_setattr,
+        .fsetattr      = up_fsetattr,
+        .setxattr      = up_setxattr,
+        .fsetxattr     = up_fsetxattr,
+        .removexattr   = up_removexattr,
+        .fremovexattr  = up_fremovexattr,
+        .unlink        = up_unlink,
+        .rmdir         = up_rmdir,
+        .link          = up_link,
+        .rename        = up_rename,
+        .create        = up_create,
+        .mknod         = up_mknod,
+        .mkdir         = up_mkdir,
+        .symlink       = up_symlink,
+};
+
+struct xlator_cbks cbks = {
+        .forget = upcall_forget,
+};
+
+struct xlator_dumpops dumpops = {
+        .priv     = upcall_dump_priv,
+        .inodectx = upcall_dump_inode_ctx,
+};
+
+struct volume_options options[] = {
+        { .key  = {"cache-invalidation"},
+          .type = GF_OPTION_TYPE_BOOL,
+          .default_value = "off",
+          .description = "When \"on\", sends cache-invalidation "
+                         "notifications to the clients which have recently "
+                         "accessed a file when another client changes it."
+        },
+        { .key  = {"cache-invalidation-timeout"},
+          .type = GF_OPTION_TYPE_INT,
+          .min  = 0,
+          .max  = 3600,
+          .default_value = UPCALL_CACHE_INVALIDATION_TIMEOUT,
+          .description = "Seconds after its last access a client is still "
+                         "notified of changes to a file. It should be at "
+                         "least the md-cache-timeout of the clients."
+        },
+        { .key  = {NULL} },
+};
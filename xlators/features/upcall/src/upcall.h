@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+   This file is part of GlusterFS.
+
+   This file is licensed to you under your choice of the GNU Lesser
+   General Public License, version 3 or any later version (LGPLv3 or
+   later), or the GNU General Public License, version 2 (GPLv2), in all
+   cases as published by the Free Software Foundation.
+*/
+
+#ifndef __UPCALL_H__
+#define __UPCALL_H__
+
+#include "upcall-mem-types.h"
+#include "upcall-utils.h"
+#include "xlator.h"
+#include "client_t.h"
+
+#define UPCALL_CACHE_INVALIDATION_TIMEOUT "60"
+
+#define UPCALL_STACK_UNWIND(fop, frame, params ...)                     \
+        do {                                                            \
+                upcall_local_t *__local = NULL;                         \
+                                                                        \
+                __local = frame->local;                                 \
+                frame->local = NULL;                                    \
+                STACK_UNWIND_STRICT (fop, frame, params);               \
+                upcall_local_wipe (__local);                            \
+        } while (0)
+
+typedef struct {
+        gf_boolean_t     cache_invalidation_enabled;
+        int32_t          cache_invalidation_timeout;
+        gf_lock_t        lock;   /* for the counters */
+        uint64_t         notified;
+        uint64_t         expired;
+} upcall_private_t;
+
+/* A client which has looked at the inode recently, and may cache it. */
+typedef struct {
+        struct list_head  list;
+        char             *client_uid;
+        time_t            access_time;
+} upcall_client_t;
+
+typedef struct {
+        pthread_mutex_t   client_list_lock;
+        struct list_head  client_list;
+} upcall_inode_ctx_t;
+
+/* The inodes a fop reads or changes, as they are known when it is wound.
+   Only set up when cache invalidation is enabled. */
+typedef struct {
+        inode_t          *inode;
+        inode_t          *parent;
+        inode_t          *inode2;
+        inode_t          *parent2;
+} upcall_local_t;
+
+void
+upcall_local_wipe (upcall_local_t *local);
+
+void
+upcall_cache_invalidate (call_frame_t *frame, xlator_t *this, inode_t *inode,
+                         uint32_t flags);
+
+#endif /* __UPCALL_H__ */
@@ -1794,6 +1794,14 @@ server_graph_builder (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
                         goto out;
         }
 
+        /* Needs to be above every xlator which changes the file, so that
+         * it sees them all. Always in the graph, so that turning
+         * features.cache-invalidation on or off is a reconfigure of upcall
+         * rather than a graph change. */
+        xl = volgen_graph_add (graph, "features/upcall", volname);
+        if (!xl)
+                return -1;
+
         xl = volgen_graph_add_as (graph, "debug/io-stats", path);
         if (!xl)
                 return -1;
@@ -2948,6 +2956,9 @@ build_client_graph (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
 char *gd_shd_options[] = {
         "!self-heal-daemon",
         "!heal-timeout",
+        "!shd-max-threads",
+        "!shd-wait-qlength",
+        "!shd-max-heal-rate",
         NULL
 };
 
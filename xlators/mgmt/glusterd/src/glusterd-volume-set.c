@@ -493,6 +493,24 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version = 2,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key        = "cluster.shd-max-threads",
+          .voltype    = "cluster/replicate",
+          .option     = "!shd-max-threads",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
+        { .key        = "cluster.shd-wait-qlength",
+          .voltype    = "cluster/replicate",
+          .option     = "!shd-wait-qlength",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
+        { .key        = "cluster.shd-max-heal-rate",
+          .voltype    = "cluster/replicate",
+          .option     = "!shd-max-heal-rate",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
         { .key        = "cluster.strict-readdir",
           .voltype    = "cluster/replicate",
           .type       = NO_DOC,
@@ -728,6 +746,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "performance/io-threads",
           .op_version  = 2
         },
+        { .key         = "performance.fair-queueing",
+          .voltype     = "performance/io-threads",
+          .op_version  = GD_OP_VERSION_3_7_0
+        },
 
         /* Other perf xlators' options */
         { .key        = "performance.cache-size",
@@ -783,6 +805,18 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version = 2,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key        = "performance.write-behind-aggregate-size",
+          .voltype    = "performance/write-behind",
+          .option     = "aggregate-size",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
+        { .key        = "performance.write-behind-batch-window",
+          .voltype    = "performance/write-behind",
+          .option     = "batch-window",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
         { .key        = "performance.lazy-open",
           .voltype    = "performance/open-behind",
           .option     = "lazy-open",
@@ -807,6 +841,12 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version = 2,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key        = "performance.cache-invalidation",
+          .voltype    = "performance/md-cache",
+          .option     = "cache-invalidation",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
 
  	/* Crypt xlator options */
 
@@ -973,6 +1013,14 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "protocol/server",
           .op_version  = GD_OP_VERSION_3_6_0,
         },
+        { .key         = "client.event-threads",
+          .voltype     = "protocol/client",
+          .op_version  = GD_OP_VERSION_3_7_0,
+        },
+        { .key         = "server.event-threads",
+          .voltype     = "protocol/server",
+          .op_version  = GD_OP_VERSION_3_7_0,
+        },
 
         /* Generic transport options */
         { .key         = SSL_CERT_DEPTH_OPT,
@@ -1654,6 +1702,15 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .value       = BARRIER_TIMEOUT,
           .op_version  = GD_OP_VERSION_3_6_0,
         },
+        { .key         = "features.cache-invalidation",
+          .voltype     = "features/upcall",
+          .value       = "off",
+          .op_version  = GD_OP_VERSION_3_7_0,
+        },
+        { .key         = "features.cache-invalidation-timeout",
+          .voltype     = "features/upcall",
+          .op_version  = GD_OP_VERSION_3_7_0,
+        },
         { .key         = "cluster.op-version",
           .voltype     = "mgmt/glusterd",
           .op_version  = GD_OP_VERSION_3_6_0,
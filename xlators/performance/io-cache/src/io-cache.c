@@ -139,7 +139,8 @@ ioc_inode_flush (ioc_inode_t *ioc_inode)
         if (destroy_size) {
                 ioc_table_lock (ioc_inode->table);
                 {
-                        ioc_inode->table->cache_used -= destroy_size;
+                        __ioc_arc_account (ioc_inode->table, ioc_inode,
+                                           -destroy_size);
                 }
                 ioc_table_unlock (ioc_inode->table);
         }
@@ -246,8 +247,7 @@ ioc_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
         ioc_table_lock (ioc_inode->table);
         {
-                list_move_tail (&ioc_inode->inode_lru,
-                                &table->inode_lru[ioc_inode->weight]);
+                __ioc_arc_touch (table, ioc_inode, IOC_ARC_LOOKUP);
         }
         ioc_table_unlock (ioc_inode->table);
 
@@ -383,7 +383,8 @@ ioc_cache_validate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         if (destroy_size) {
                 ioc_table_lock (ioc_inode->table);
                 {
-                        ioc_inode->table->cache_used -= destroy_size;
+                        __ioc_arc_account (ioc_inode->table, ioc_inode,
+                                           -destroy_size);
                 }
                 ioc_table_unlock (ioc_inode->table);
         }
@@ -567,8 +568,7 @@ ioc_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
 
                 ioc_table_lock (ioc_inode->table);
                 {
-                        list_move_tail (&ioc_inode->inode_lru,
-                                        &table->inode_lru[ioc_inode->weight]);
+                        __ioc_arc_touch (table, ioc_inode, IOC_ARC_OPEN);
                 }
                 ioc_table_unlock (ioc_inode->table);
 
@@ -990,6 +990,7 @@ ioc_dispatch_requests (call_frame_t *frame, ioc_inode_t *ioc_inode, fd_t *fd,
                                 trav = __ioc_page_create (ioc_inode,
                                                           trav_offset);
                                 fault = 1;
+                                __sync_fetch_and_add (&table->arc_misses, 1);
                                 if (!trav) {
                                         gf_log (frame->this->name,
                                                 GF_LOG_CRITICAL,
@@ -999,6 +1000,10 @@ ioc_dispatch_requests (call_frame_t *frame, ioc_inode_t *ioc_inode, fd_t *fd,
                                         ioc_inode_unlock (ioc_inode);
                                         goto out;
                                 }
+                        } else {
+                                __sync_fetch_and_add
+                                        (&table->arc_hits[ioc_inode->arc_list],
+                                         1);
                         }
 
                         __ioc_wait_on_page (trav, frame, local_offset,
@@ -1105,7 +1110,6 @@ ioc_readv (call_frame_t *frame, xlator_t *this, fd_t *fd,
         uint64_t     tmp_ioc_inode = 0;
         ioc_inode_t *ioc_inode     = NULL;
         ioc_local_t *local         = NULL;
-        uint32_t     weight        = 0;
         ioc_table_t *table         = NULL;
         int32_t      op_errno      = -1;
 
@@ -1180,12 +1184,10 @@ ioc_readv (call_frame_t *frame, xlator_t *this, fd_t *fd,
                 "NEW REQ (%p) offset = %"PRId64" && size = %"GF_PRI_SIZET"",
                 frame, offset, size);
 
-        weight = ioc_inode->weight;
-
         ioc_table_lock (ioc_inode->table);
         {
-                list_move_tail (&ioc_inode->inode_lru,
-                                &ioc_inode->table->inode_lru[weight]);
+                __ioc_arc_touch (ioc_inode->table, ioc_inode,
+                                 IOC_ARC_READ);
         }
         ioc_table_unlock (ioc_inode->table);
 
@@ -1692,6 +1694,8 @@ reconfigure (xlator_t *this, dict_t *options)
                         goto unlock;
                 }
                 table->cache_size = cache_size_new;
+                if (table->arc_target > table->cache_size)
+                        table->arc_target = table->cache_size;
 
                 ret = 0;
         }
@@ -1789,8 +1793,20 @@ init (xlator_t *this)
                 goto out;
         }
 
-        for (index = 0; index < (table->max_pri); index++)
+        table->inode_lfu = GF_CALLOC (table->max_pri,
+                                      sizeof (struct list_head),
+                                      gf_ioc_mt_list_head);
+        if (table->inode_lfu == NULL) {
+                goto out;
+        }
+
+        for (index = 0; index < (table->max_pri); index++) {
                 INIT_LIST_HEAD (&table->inode_lru[index]);
+                INIT_LIST_HEAD (&table->inode_lfu[index]);
+        }
+
+        INIT_LIST_HEAD (&table->ghost_lru[0]);
+        INIT_LIST_HEAD (&table->ghost_lru[1]);
 
         this->local_pool = mem_pool_new (ioc_local_t, 64);
         if (!this->local_pool) {
@@ -1823,6 +1839,7 @@ out:
         if (ret == -1) {
                 if (table != NULL) {
                         GF_FREE (table->inode_lru);
+                        GF_FREE (table->inode_lfu);
                         GF_FREE (table);
                 }
         }
@@ -1981,6 +1998,8 @@ ioc_inode_dump (xlator_t *this, inode_t *inode)
                 __inode_path (ioc_inode->inode, NULL, &path);
 
                 gf_proc_dump_write ("inode.weight", "%d", ioc_inode->weight);
+                gf_proc_dump_write ("arc_list", "%s",
+                                    ioc_arc_list_name (ioc_inode->arc_list));
 
                 if (path) {
                         gf_proc_dump_write ("path", "%s", path);
@@ -2034,6 +2053,24 @@ ioc_priv_dump (xlator_t *this)
                 gf_proc_dump_write ("cache_timeout", "%u", priv->cache_timeout);
                 gf_proc_dump_write ("min-file-size", "%u", priv->min_file_size);
                 gf_proc_dump_write ("max-file-size", "%u", priv->max_file_size);
+                gf_proc_dump_write ("arc_target", "%"PRIu64, priv->arc_target);
+                gf_proc_dump_write ("t1_used", "%"PRIu64,
+                                    priv->arc_used[IOC_ARC_T1]);
+                gf_proc_dump_write ("t2_used", "%"PRIu64,
+                                    priv->arc_used[IOC_ARC_T2]);
+                gf_proc_dump_write ("b1_ghost_size", "%"PRIu64,
+                                    priv->arc_used[IOC_ARC_B1]);
+                gf_proc_dump_write ("b2_ghost_size", "%"PRIu64,
+                                    priv->arc_used[IOC_ARC_B2]);
+                gf_proc_dump_write ("t1_hits", "%"PRIu64,
+                                    priv->arc_hits[IOC_ARC_T1]);
+                gf_proc_dump_write ("t2_hits", "%"PRIu64,
+                                    priv->arc_hits[IOC_ARC_T2]);
+                gf_proc_dump_write ("b1_ghost_hits", "%"PRIu64,
+                                    priv->arc_hits[IOC_ARC_B1]);
+                gf_proc_dump_write ("b2_ghost_hits", "%"PRIu64,
+                                    priv->arc_hits[IOC_ARC_B2]);
+                gf_proc_dump_write ("misses", "%"PRIu64, priv->arc_misses);
         }
         pthread_mutex_unlock (&priv->table_lock);
 out:
@@ -2084,10 +2121,13 @@ fini (xlator_t *this)
 
         for (i = 0; i < table->max_pri; i++) {
                 GF_ASSERT (list_empty (&table->inode_lru[i]));
+                GF_ASSERT (list_empty (&table->inode_lfu[i]));
         }
 
         GF_ASSERT (list_empty (&table->inodes));
         pthread_mutex_destroy (&table->table_lock);
+        GF_FREE (table->inode_lru);
+        GF_FREE (table->inode_lfu);
         GF_FREE (table);
 
         this->private = NULL;
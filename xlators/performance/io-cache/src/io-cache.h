@@ -39,6 +39,34 @@ struct ioc_local;
 struct ioc_page;
 struct ioc_inode;
 
+/*
+ * Cached inodes are replaced with ARC (adaptive replacement cache). An
+ * inode opened once sits on the recency list (T1, table->inode_lru), one
+ * opened again while it has pages cached moves to the frequency list (T2,
+ * table->inode_lfu). Inodes whose pages were all pruned are remembered on
+ * ghost lists (B1, B2) by their size only. Reading an inode from a ghost
+ * list again moves the target size of T1 (arc_target): towards recency for
+ * a B1 ghost, towards frequency for a B2 one. Pruning takes from T1 while
+ * it holds more than the target, so a one-time scan of many files only
+ * cycles through T1 and leaves the files in T2 alone. Both lists are kept
+ * per priority, and lower priorities are still pruned first.
+ */
+enum ioc_arc_list {
+        IOC_ARC_NONE = 0,
+        IOC_ARC_T1,
+        IOC_ARC_T2,
+        IOC_ARC_B1,
+        IOC_ARC_B2,
+        IOC_ARC_MAX
+};
+
+/* how an inode was used, see __ioc_arc_touch() */
+enum ioc_arc_ref {
+        IOC_ARC_LOOKUP,
+        IOC_ARC_READ,
+        IOC_ARC_OPEN
+};
+
 struct ioc_priority {
         struct list_head list;
         char             *pattern;
@@ -150,6 +178,12 @@ struct ioc_inode {
                                              * on each read
                                              */
         inode_t               *inode;
+        int                    arc_list;    /* enum ioc_arc_list */
+        uint64_t               cache_used;  /* bytes cached for this inode */
+        uint64_t               arc_size;    /*
+                                             * most bytes cached since it was
+                                             * put on T1/T2, size of a ghost
+                                             */
 };
 
 struct ioc_table {
@@ -160,7 +194,14 @@ struct ioc_table {
         uint64_t         max_file_size;
         struct list_head inodes; /* list of inodes cached */
         struct list_head active;
-        struct list_head *inode_lru;
+        struct list_head *inode_lru;    /* T1, per priority */
+        struct list_head *inode_lfu;    /* T2, per priority */
+        struct list_head ghost_lru[2];  /* B1, B2 */
+        uint64_t         arc_target;    /* bytes of T1 to aim for */
+        uint64_t         arc_used[IOC_ARC_MAX];
+        uint64_t         arc_hits[IOC_ARC_MAX]; /* pages read from T1/T2,
+                                                   ghosts read again */
+        uint64_t         arc_misses;
         struct list_head priority_list;
         int32_t          readv_count;
         pthread_mutex_t  table_lock;
@@ -329,4 +370,16 @@ ioc_prune (ioc_table_t *table);
 int32_t
 ioc_need_prune (ioc_table_t *table);
 
+void
+__ioc_arc_account (ioc_table_t *table, ioc_inode_t *ioc_inode, int64_t size);
+
+void
+__ioc_arc_touch (ioc_table_t *table, ioc_inode_t *ioc_inode, int ref);
+
+void
+__ioc_arc_remove (ioc_table_t *table, ioc_inode_t *ioc_inode);
+
+const char *
+ioc_arc_list_name (int list);
+
 #endif /* __IO_CACHE_H */
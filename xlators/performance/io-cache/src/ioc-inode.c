@@ -193,8 +193,8 @@ ioc_inode_update (ioc_table_t *table, inode_t *inode, uint32_t weight)
         {
                 table->inode_count++;
                 list_add (&ioc_inode->inode_list, &table->inodes);
-                list_add_tail (&ioc_inode->inode_lru,
-                               &table->inode_lru[weight]);
+                INIT_LIST_HEAD (&ioc_inode->inode_lru);
+                __ioc_arc_touch (table, ioc_inode, IOC_ARC_READ);
         }
         ioc_table_unlock (table);
 
@@ -226,7 +226,7 @@ ioc_inode_destroy (ioc_inode_t *ioc_inode)
         {
                 table->inode_count--;
                 list_del (&ioc_inode->inode_list);
-                list_del (&ioc_inode->inode_lru);
+                __ioc_arc_remove (table, ioc_inode);
         }
         ioc_table_unlock (table);
 
@@ -153,6 +153,217 @@ out:
         return ret;
 }
 
+static const char *ioc_arc_names[IOC_ARC_MAX] = {
+        [IOC_ARC_NONE] = "none",
+        [IOC_ARC_T1]   = "t1",
+        [IOC_ARC_T2]   = "t2",
+        [IOC_ARC_B1]   = "b1",
+        [IOC_ARC_B2]   = "b2",
+};
+
+
+const char *
+ioc_arc_list_name (int list)
+{
+        if (list < 0 || list >= IOC_ARC_MAX)
+                return "invalid";
+
+        return ioc_arc_names[list];
+}
+
+
+static inline void
+__ioc_arc_sub (uint64_t *used, uint64_t size)
+{
+        *used = (*used > size) ? (*used - size) : 0;
+}
+
+
+static struct list_head *
+__ioc_arc_head (ioc_table_t *table, ioc_inode_t *ioc_inode, int list)
+{
+        switch (list) {
+        case IOC_ARC_T1:
+                return &table->inode_lru[ioc_inode->weight];
+        case IOC_ARC_T2:
+                return &table->inode_lfu[ioc_inode->weight];
+        case IOC_ARC_B1:
+                return &table->ghost_lru[0];
+        case IOC_ARC_B2:
+                return &table->ghost_lru[1];
+        }
+
+        return NULL;
+}
+
+
+/* takes the inode off whatever list it is on, table lock held */
+void
+__ioc_arc_remove (ioc_table_t *table, ioc_inode_t *ioc_inode)
+{
+        switch (ioc_inode->arc_list) {
+        case IOC_ARC_T1:
+        case IOC_ARC_T2:
+                __ioc_arc_sub (&table->arc_used[ioc_inode->arc_list],
+                               ioc_inode->cache_used);
+                break;
+        case IOC_ARC_B1:
+        case IOC_ARC_B2:
+                __ioc_arc_sub (&table->arc_used[ioc_inode->arc_list],
+                               ioc_inode->arc_size);
+                break;
+        }
+
+        list_del_init (&ioc_inode->inode_lru);
+        ioc_inode->arc_list = IOC_ARC_NONE;
+}
+
+
+static void
+__ioc_arc_insert (ioc_table_t *table, ioc_inode_t *ioc_inode, int list)
+{
+        list_add_tail (&ioc_inode->inode_lru,
+                       __ioc_arc_head (table, ioc_inode, list));
+        ioc_inode->arc_list = list;
+
+        if (list == IOC_ARC_T1 || list == IOC_ARC_T2)
+                ioc_inode->arc_size = ioc_inode->cache_used;
+
+        table->arc_used[list] += ioc_inode->arc_size;
+}
+
+
+/* keeps T1 + B1 within the cache size, and all four lists within twice
+   the cache size */
+static void
+__ioc_arc_trim_ghosts (ioc_table_t *table)
+{
+        ioc_inode_t *ghost = NULL;
+
+        while (!list_empty (&table->ghost_lru[0]) &&
+               (table->arc_used[IOC_ARC_T1] + table->arc_used[IOC_ARC_B1]
+                > table->cache_size)) {
+                ghost = list_entry (table->ghost_lru[0].next, ioc_inode_t,
+                                    inode_lru);
+                __ioc_arc_remove (table, ghost);
+        }
+
+        while (!list_empty (&table->ghost_lru[1]) &&
+               (table->arc_used[IOC_ARC_T1] + table->arc_used[IOC_ARC_T2]
+                + table->arc_used[IOC_ARC_B1] + table->arc_used[IOC_ARC_B2]
+                > 2 * table->cache_size)) {
+                ghost = list_entry (table->ghost_lru[1].next, ioc_inode_t,
+                                    inode_lru);
+                __ioc_arc_remove (table, ghost);
+        }
+}
+
+
+/* all the pages of the inode were pruned, remember it as a ghost */
+static void
+__ioc_arc_evict (ioc_table_t *table, ioc_inode_t *ioc_inode)
+{
+        int      list = ioc_inode->arc_list;
+        uint64_t size = ioc_inode->arc_size;
+
+        __ioc_arc_remove (table, ioc_inode);
+
+        if (!size || (list != IOC_ARC_T1 && list != IOC_ARC_T2))
+                return;
+
+        ioc_inode->arc_size = size;
+        __ioc_arc_insert (table, ioc_inode,
+                          (list == IOC_ARC_T1) ? IOC_ARC_B1 : IOC_ARC_B2);
+
+        __ioc_arc_trim_ghosts (table);
+}
+
+
+/* @size bytes were cached (or dropped if negative), table lock held */
+void
+__ioc_arc_account (ioc_table_t *table, ioc_inode_t *ioc_inode, int64_t size)
+{
+        uint64_t dropped = 0;
+        int      list    = ioc_inode->arc_list;
+
+        table->cache_used += size;
+
+        if (size >= 0) {
+                ioc_inode->cache_used += size;
+                if (list == IOC_ARC_T1 || list == IOC_ARC_T2)
+                        table->arc_used[list] += size;
+                if (ioc_inode->cache_used > ioc_inode->arc_size)
+                        ioc_inode->arc_size = ioc_inode->cache_used;
+                return;
+        }
+
+        dropped = min ((uint64_t)-size, ioc_inode->cache_used);
+        ioc_inode->cache_used -= dropped;
+        if (list == IOC_ARC_T1 || list == IOC_ARC_T2)
+                __ioc_arc_sub (&table->arc_used[list], dropped);
+}
+
+
+/*
+ * Moves the inode according to @ref, table lock held. Lookups only
+ * refresh an inode on T1 or T2. A read puts a new inode on T1, and a ghost
+ * on T2 after adapting the target. Opening an inode on T1 that has pages
+ * cached promotes it to T2.
+ */
+void
+__ioc_arc_touch (ioc_table_t *table, ioc_inode_t *ioc_inode, int ref)
+{
+        int      list  = ioc_inode->arc_list;
+        uint64_t b1    = 0;
+        uint64_t b2    = 0;
+        uint64_t delta = 0;
+
+        switch (list) {
+        case IOC_ARC_T1:
+                if (ref == IOC_ARC_OPEN && ioc_inode->cache_used) {
+                        __ioc_arc_remove (table, ioc_inode);
+                        __ioc_arc_insert (table, ioc_inode, IOC_ARC_T2);
+                        break;
+                }
+                /* fall through */
+        case IOC_ARC_T2:
+                list_move_tail (&ioc_inode->inode_lru,
+                                __ioc_arc_head (table, ioc_inode, list));
+                break;
+
+        case IOC_ARC_B1:
+        case IOC_ARC_B2:
+                if (ref == IOC_ARC_LOOKUP)
+                        break;
+
+                b1 = max (table->arc_used[IOC_ARC_B1], 1);
+                b2 = max (table->arc_used[IOC_ARC_B2], 1);
+
+                if (list == IOC_ARC_B1) {
+                        delta = ioc_inode->arc_size * max (b2 / b1, 1);
+                        table->arc_target = min (table->arc_target + delta,
+                                                 table->cache_size);
+                } else {
+                        delta = ioc_inode->arc_size * max (b1 / b2, 1);
+                        __ioc_arc_sub (&table->arc_target, delta);
+                }
+
+                __sync_fetch_and_add (&table->arc_hits[list], 1);
+
+                __ioc_arc_remove (table, ioc_inode);
+                __ioc_arc_insert (table, ioc_inode, IOC_ARC_T2);
+                break;
+
+        default:
+                if (ref == IOC_ARC_LOOKUP)
+                        break;
+
+                __ioc_arc_insert (table, ioc_inode, IOC_ARC_T1);
+                break;
+        }
+}
+
+
 int32_t
 __ioc_inode_prune (ioc_inode_t *curr, uint64_t *size_pruned,
                    uint64_t size_to_prune, uint32_t index)
@@ -172,7 +383,7 @@ __ioc_inode_prune (ioc_inode_t *curr, uint64_t *size_pruned,
                 ret = __ioc_page_destroy (page);
 
                 if (ret != -1)
-                        table->cache_used -= ret;
+                        __ioc_arc_account (table, curr, -ret);
 
                 gf_log (table->xl->name, GF_LOG_TRACE,
                         "index = %d && table->cache_used = %"PRIu64" && table->"
@@ -184,7 +395,7 @@ __ioc_inode_prune (ioc_inode_t *curr, uint64_t *size_pruned,
         }
 
         if (ioc_empty (&curr->cache)) {
-                list_del_init (&curr->inode_lru);
+                __ioc_arc_evict (table, curr);
         }
 
 out:
@@ -200,21 +411,45 @@ out:
 int32_t
 ioc_prune (ioc_table_t *table)
 {
-        ioc_inode_t *curr          = NULL, *next_ioc_inode = NULL;
-        int32_t      index         = 0;
-        uint64_t     size_to_prune = 0;
-        uint64_t     size_pruned   = 0;
+        ioc_inode_t      *curr          = NULL;
+        struct list_head *t1            = NULL;
+        struct list_head *t2            = NULL;
+        struct list_head *next1         = NULL;
+        struct list_head *next2         = NULL;
+        int32_t           index         = 0;
+        uint64_t          size_to_prune = 0;
+        uint64_t          size_pruned   = 0;
 
         GF_VALIDATE_OR_GOTO ("io-cache", table, out);
 
         ioc_table_lock (table);
         {
                 size_to_prune = table->cache_used - table->cache_size;
-                /* take out the least recently used inode */
+                /* lowest priority first, and within a priority the least
+                 * recently used inode of T1 while T1 is above its target,
+                 * of T2 otherwise */
                 for (index=0; index < table->max_pri; index++) {
-                        list_for_each_entry_safe (curr, next_ioc_inode,
-                                                  &table->inode_lru[index],
-                                                  inode_lru) {
+                        t1 = &table->inode_lru[index];
+                        t2 = &table->inode_lfu[index];
+                        next1 = t1->next;
+                        next2 = t2->next;
+
+                        while (size_pruned < size_to_prune) {
+                                if ((next1 != t1) &&
+                                    ((next2 == t2) ||
+                                     (table->arc_used[IOC_ARC_T1]
+                                      > table->arc_target))) {
+                                        curr = list_entry (next1, ioc_inode_t,
+                                                           inode_lru);
+                                        next1 = next1->next;
+                                } else if (next2 != t2) {
+                                        curr = list_entry (next2, ioc_inode_t,
+                                                           inode_lru);
+                                        next2 = next2->next;
+                                } else {
+                                        break;
+                                }
+
                                 /* prune page-by-page for this inode, till
                                  * we reach the equilibrium */
                                 ioc_inode_lock (curr);
@@ -224,10 +459,7 @@ ioc_prune (ioc_table_t *table)
                                                            index);
                                 }
                                 ioc_inode_unlock (curr);
-
-                                if (size_pruned >= size_to_prune)
-                                        break;
-                        } /* list_for_each_entry_safe (curr...) */
+                        }
 
                         if (size_pruned >= size_to_prune)
                                 break;
@@ -424,6 +656,7 @@ ioc_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         ioc_waitq_t *waitq            = NULL;
         size_t       iobref_page_size = 0;
         char         zero_filled      = 0;
+        gf_boolean_t ghost            = _gf_false;
 
         GF_ASSERT (frame);
 
@@ -476,6 +709,9 @@ ioc_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                                         table->page_size, ioc_inode);
                         } else {
                                 if (page->vector) {
+                                        /* refilled, after a revalidation */
+                                        destroy_size += iobref_size
+                                                (page->iobref);
                                         iobref_unref (page->iobref);
                                         GF_FREE (page->vector);
                                         page->vector = NULL;
@@ -518,6 +754,19 @@ ioc_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
                                 iobref_page_size = iobref_size (page->iobref);
 
+                                /* A page pruned while it was read is
+                                 * stale, and the wakeup destroys it. If
+                                 * the inode was evicted to a ghost list
+                                 * meanwhile, ghosts keep no pages. Either
+                                 * way the page is not counted as cached. */
+                                if (page->stale)
+                                        iobref_page_size = 0;
+                                else
+                                        ghost = (ioc_inode->arc_list
+                                                 != IOC_ARC_T1 &&
+                                                 ioc_inode->arc_list
+                                                 != IOC_ARC_T2);
+
                                 if (page->waitq) {
                                         /* wake up all the frames waiting on
                                          * this page, including
@@ -525,6 +774,11 @@ ioc_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                                         waitq = __ioc_page_wakeup (page,
                                                                    op_errno);
                                 } /* if(page->waitq) */
+
+                                if (ghost) {
+                                        __ioc_page_destroy (page);
+                                        iobref_page_size = 0;
+                                }
                         } /* if(!page)...else */
                 } /* if(op_ret < 0)...else */
         } /* ioc_inode locked region end */
@@ -536,7 +790,8 @@ unlock:
         if (iobref_page_size) {
                 ioc_table_lock (table);
                 {
-                        table->cache_used += iobref_page_size;
+                        __ioc_arc_account (table, ioc_inode,
+                                           iobref_page_size);
                 }
                 ioc_table_unlock (table);
         }
@@ -544,7 +799,7 @@ unlock:
         if (destroy_size) {
                 ioc_table_lock (table);
                 {
-                        table->cache_used -= destroy_size;
+                        __ioc_arc_account (table, ioc_inode, -destroy_size);
                 }
                 ioc_table_unlock (table);
         }
@@ -988,6 +1243,7 @@ __ioc_page_error (ioc_page_t *page, int32_t op_ret, int32_t op_errno)
         int64_t       ret   = 0;
         ioc_table_t  *table = NULL;
         ioc_local_t  *local = NULL;
+        ioc_inode_t  *ioc_inode = NULL;
 
         GF_VALIDATE_OR_GOTO ("io-cache", page, out);
 
@@ -1012,11 +1268,12 @@ __ioc_page_error (ioc_page_t *page, int32_t op_ret, int32_t op_errno)
                 ioc_local_unlock (local);
         }
 
-        table = page->inode->table;
+        ioc_inode = page->inode;
+        table = ioc_inode->table;
         ret = __ioc_page_destroy (page);
 
         if (ret != -1) {
-                table->cache_used -= ret;
+                __ioc_arc_account (table, ioc_inode, -ret);
         }
 
 out:
@@ -52,8 +52,94 @@ struct volume_options options[];
                 }                                                              \
         } while (0)
 
-call_stub_t *
-__iot_dequeue (iot_conf_t *conf, int *pri, struct timespec *sleep)
+/* Cost of a request in DRR units. */
+static int
+iot_stub_cost (call_stub_t *stub)
+{
+        size_t  size = 0;
+        int     cost = 0;
+
+        switch (stub->fop) {
+        case GF_FOP_READ:
+                size = stub->args.size;
+                break;
+        case GF_FOP_WRITE:
+                size = iov_length (stub->args.vector, stub->args.count);
+                break;
+        default:
+                break;
+        }
+
+        cost = 1 + size / IOT_DRR_UNIT;
+        if (cost > IOT_DRR_MAX_COST)
+                cost = IOT_DRR_MAX_COST;
+
+        return cost;
+}
+
+
+/* Takes the next request of the round of clients of one priority. Called
+   with conf->queue_locks[pri] held and the round not empty. */
+static call_stub_t *
+__iot_dequeue_client (iot_conf_t *conf, int pri)
+{
+        struct list_head *round = &conf->queues[pri];
+        iot_client_t     *ctx = NULL;
+        call_stub_t      *stub = NULL;
+        call_stub_t      *next = NULL;
+        struct timeval    now = {0, };
+        uint64_t          wait = 0;
+        int               cost = 0;
+
+        for (;;) {
+                ctx = list_entry (round->next, iot_client_t, active[pri]);
+                stub = list_entry (ctx->reqs[pri].next, call_stub_t, list);
+                cost = iot_stub_cost (stub);
+
+                if (ctx->deficit[pri] >= cost)
+                        break;
+
+                /* its turn starts */
+                ctx->deficit[pri] += IOT_DRR_QUANTUM;
+                if (ctx->deficit[pri] >= cost)
+                        break;
+
+                list_move_tail (&ctx->active[pri], round);
+        }
+
+        ctx->deficit[pri] -= cost;
+        list_del_init (&stub->list);
+
+        if (list_empty (&ctx->reqs[pri])) {
+                ctx->deficit[pri] = 0;
+                list_del_init (&ctx->active[pri]);
+        } else {
+                next = list_entry (ctx->reqs[pri].next, call_stub_t, list);
+                /* its turn is over */
+                if (ctx->deficit[pri] < iot_stub_cost (next))
+                        list_move_tail (&ctx->active[pri], round);
+        }
+
+        gettimeofday (&now, NULL);
+        wait = (now.tv_sec - stub->queued.tv_sec) * 1000000 +
+                now.tv_usec - stub->queued.tv_usec;
+
+        ctx->queue_sizes[pri]--;
+        ctx->served[pri]++;
+        ctx->wait_usec[pri] += wait;
+        if (wait > ctx->max_wait_usec[pri])
+                ctx->max_wait_usec[pri] = wait;
+
+        conf->queue_sizes[pri]--;
+
+        return stub;
+}
+
+
+/* Returns the request a worker should run next, from the highest priority
+   that has requests and threads to spare. Only takes the queue locks. */
+static call_stub_t *
+iot_dequeue (iot_conf_t *conf, int *pri, struct timespec *sleep)
 {
         call_stub_t  *stub = NULL;
         int           i = 0;
@@ -63,9 +149,16 @@ __iot_dequeue (iot_conf_t *conf, int *pri, struct timespec *sleep)
 	sleep->tv_sec = 0;
 	sleep->tv_nsec = 0;
         for (i = 0; i < IOT_PRI_MAX; i++) {
-                if (list_empty (&conf->reqs[i]) ||
-                   (conf->ac_iot_count[i] >= conf->ac_iot_limit[i]))
+                if (!conf->queue_sizes[i])
+                        continue;
+
+                pthread_mutex_lock (&conf->queue_locks[i]);
+
+                if (list_empty (&conf->queues[i]) ||
+                   (conf->ac_iot_count[i] >= conf->ac_iot_limit[i])) {
+                        pthread_mutex_unlock (&conf->queue_locks[i]);
                         continue;
+                }
 
 		if (i == IOT_PRI_LEAST) {
 			pthread_mutex_lock(&conf->throttle.lock);
@@ -109,6 +202,8 @@ __iot_dequeue (iot_conf_t *conf, int *pri, struct timespec *sleep)
 
 					pthread_mutex_unlock(
 						&conf->throttle.lock);
+					pthread_mutex_unlock (
+						&conf->queue_locks[i]);
 					break;
 				}
 			}
@@ -116,38 +211,103 @@ __iot_dequeue (iot_conf_t *conf, int *pri, struct timespec *sleep)
 			pthread_mutex_unlock(&conf->throttle.lock);
 		}
 
-                stub = list_entry (conf->reqs[i].next, call_stub_t, list);
+                stub = __iot_dequeue_client (conf, i);
                 conf->ac_iot_count[i]++;
+                pthread_mutex_unlock (&conf->queue_locks[i]);
                 *pri = i;
                 break;
         }
 
-        if (!stub)
-                return NULL;
-
-        conf->queue_size--;
-        conf->queue_sizes[*pri]--;
-        list_del_init (&stub->list);
+        if (stub)
+                __sync_sub_and_fetch (&conf->queue_size, 1);
 
         return stub;
 }
 
 
-void
-__iot_enqueue (iot_conf_t *conf, call_stub_t *stub, int pri)
+static void
+iot_dequeue_done (iot_conf_t *conf, int pri)
 {
-        if (pri < 0 || pri >= IOT_PRI_MAX)
-                pri = IOT_PRI_MAX-1;
+        pthread_mutex_lock (&conf->queue_locks[pri]);
+        {
+                conf->ac_iot_count[pri]--;
+        }
+        pthread_mutex_unlock (&conf->queue_locks[pri]);
+}
 
-        list_add_tail (&stub->list, &conf->reqs[pri]);
 
-        conf->queue_size++;
+/* Called with conf->queue_locks[pri] held. */
+void
+__iot_enqueue (iot_conf_t *conf, iot_client_t *ctx, call_stub_t *stub,
+               int pri)
+{
+        list_add_tail (&stub->list, &ctx->reqs[pri]);
+        if (list_empty (&ctx->active[pri]))
+                list_add_tail (&ctx->active[pri], &conf->queues[pri]);
+
+        ctx->queue_sizes[pri]++;
         conf->queue_sizes[pri]++;
 
         return;
 }
 
 
+static void
+iot_client_init (iot_client_t *ctx, client_t *client)
+{
+        int     i = 0;
+
+        INIT_LIST_HEAD (&ctx->clients);
+        for (i = 0; i < IOT_PRI_MAX; i++) {
+                INIT_LIST_HEAD (&ctx->active[i]);
+                INIT_LIST_HEAD (&ctx->reqs[i]);
+        }
+        ctx->client = client;
+}
+
+
+/* The queues of a client, created on its first request. Requests without a
+   client (internal ones, or io-threads loaded on the client side) and all
+   requests when fair-queueing is off share one set of queues. */
+static iot_client_t *
+iot_client_get (xlator_t *this, iot_conf_t *conf, client_t *client)
+{
+        iot_client_t *ctx = NULL;
+        void         *tmp = NULL;
+
+        if (!client || !conf->fair_queueing)
+                return &conf->shared;
+
+        if (client_ctx_get (client, this, &tmp) == 0 && tmp)
+                return tmp;
+
+        LOCK (&conf->clients_lock);
+        {
+                if (client_ctx_get (client, this, &tmp) == 0 && tmp) {
+                        ctx = tmp;
+                        goto unlock;
+                }
+
+                ctx = GF_CALLOC (1, sizeof (*ctx), gf_iot_mt_iot_client_t);
+                if (!ctx)
+                        goto unlock;
+
+                iot_client_init (ctx, client);
+                if (client_ctx_set (client, this, ctx) != 0) {
+                        GF_FREE (ctx);
+                        ctx = NULL;
+                        goto unlock;
+                }
+
+                list_add_tail (&ctx->clients, &conf->clients);
+        }
+unlock:
+        UNLOCK (&conf->clients_lock);
+
+        return ctx ? ctx : &conf->shared;
+}
+
+
 void *
 iot_worker (void *data)
 {
@@ -155,6 +315,7 @@ iot_worker (void *data)
         xlator_t         *this = NULL;
         call_stub_t      *stub = NULL;
         struct timespec   sleep_till = {0, };
+        uint64_t          queued = 0;
         int               ret = 0;
         int               pri = -1;
         char              timeout = 0;
@@ -166,28 +327,46 @@ iot_worker (void *data)
         THIS = this;
 
         for (;;) {
+                queued = conf->queued;
+                __sync_synchronize ();
+
+                stub = iot_dequeue (conf, &pri, &sleep);
+                if (stub) {
+                        call_resume (stub);
+                        iot_dequeue_done (conf, pri);
+                        continue;
+                }
+
                 sleep_till.tv_sec = time (NULL) + conf->idle_time;
 
                 pthread_mutex_lock (&conf->mutex);
                 {
-                        if (pri != -1) {
-                                conf->ac_iot_count[pri]--;
-                                pri = -1;
-                        }
-                        while (conf->queue_size == 0) {
-                                conf->sleep_count++;
+			if (sleep.tv_sec || sleep.tv_nsec) {
+				pthread_cond_timedwait(&conf->cond,
+						       &conf->mutex, &sleep);
+				pthread_mutex_unlock(&conf->mutex);
+				continue;
+			}
+
+                        /* Sleep until something is queued. Requests that
+                           are queued but can't run yet, because their
+                           priority has all the threads it may have, are
+                           picked up by those threads when they finish. */
+                        conf->sleep_count++;
+                        __sync_synchronize ();
 
+                        while (conf->queued == queued) {
                                 ret = pthread_cond_timedwait (&conf->cond,
                                                               &conf->mutex,
                                                               &sleep_till);
-                                conf->sleep_count--;
-
                                 if (ret == ETIMEDOUT) {
                                         timeout = 1;
                                         break;
                                 }
                         }
 
+                        conf->sleep_count--;
+
                         if (timeout) {
                                 if (conf->curr_count > IOT_MIN_THREADS) {
                                         conf->curr_count--;
@@ -199,31 +378,13 @@ iot_worker (void *data)
                                         timeout = 0;
                                 }
                         }
-
-                        stub = __iot_dequeue (conf, &pri, &sleep);
-			if (!stub && (sleep.tv_sec || sleep.tv_nsec)) {
-				pthread_cond_timedwait(&conf->cond,
-						       &conf->mutex, &sleep);
-				pthread_mutex_unlock(&conf->mutex);
-				continue;
-			}
                 }
                 pthread_mutex_unlock (&conf->mutex);
 
-                if (stub) /* guard against spurious wakeups */
-                        call_resume (stub);
-
                 if (bye)
                         break;
         }
 
-        if (pri != -1) {
-                pthread_mutex_lock (&conf->mutex);
-                {
-                        conf->ac_iot_count[pri]--;
-                }
-                pthread_mutex_unlock (&conf->mutex);
-        }
         return NULL;
 }
 
@@ -231,12 +392,34 @@ iot_worker (void *data)
 int
 do_iot_schedule (iot_conf_t *conf, call_stub_t *stub, int pri)
 {
-        int   ret = 0;
+        iot_client_t *ctx = NULL;
+        int           ret = 0;
 
-        pthread_mutex_lock (&conf->mutex);
+        if (pri < 0 || pri >= IOT_PRI_MAX)
+                pri = IOT_PRI_MAX-1;
+
+        ctx = iot_client_get (conf->this, conf, stub->frame->root->client);
+        gettimeofday (&stub->queued, NULL);
+
+        pthread_mutex_lock (&conf->queue_locks[pri]);
         {
-                __iot_enqueue (conf, stub, pri);
+                __iot_enqueue (conf, ctx, stub, pri);
+        }
+        pthread_mutex_unlock (&conf->queue_locks[pri]);
+
+        __sync_add_and_fetch (&conf->queue_size, 1);
+        __sync_add_and_fetch (&conf->queued, 1);
 
+        /* With every worker busy and no more needed, the request is left
+           for the first one to finish. Workers about to sleep check
+           conf->queued after announcing themselves in sleep_count, so one of
+           the two sides always sees the other. */
+        if (!conf->sleep_count &&
+            conf->curr_count >= min (conf->queue_size, conf->max_count))
+                return 0;
+
+        pthread_mutex_lock (&conf->mutex);
+        {
                 pthread_cond_signal (&conf->cond);
 
                 ret = __iot_workers_scale (conf);
@@ -847,11 +1030,74 @@ mem_acct_init (xlator_t *this)
         return ret;
 }
 
+static char *iot_pri_keys[IOT_PRI_MAX] = {
+        [IOT_PRI_HI]     = "high",
+        [IOT_PRI_NORMAL] = "normal",
+        [IOT_PRI_LO]     = "low",
+        [IOT_PRI_LEAST]  = "least",
+};
+
+/* What the dump shows of a client, copied out under the locks so that the
+   dump itself is written without holding any */
+struct iot_client_stats {
+        char           uid[256];
+        int32_t        queue_sizes[IOT_PRI_MAX];
+        uint64_t       served[IOT_PRI_MAX];
+        uint64_t       wait_usec[IOT_PRI_MAX];
+        uint64_t       max_wait_usec[IOT_PRI_MAX];
+};
+
+static void
+iot_client_stats_get (iot_client_t *ctx, int pri,
+                      struct iot_client_stats *stats)
+{
+        stats->queue_sizes[pri] = ctx->queue_sizes[pri];
+        stats->served[pri] = ctx->served[pri];
+        stats->wait_usec[pri] = ctx->wait_usec[pri];
+        stats->max_wait_usec[pri] = ctx->max_wait_usec[pri];
+}
+
+static void
+iot_client_dump (struct iot_client_stats *stats, char *prefix, int idx)
+{
+        char           key[GF_DUMP_MAX_BUF_LEN];
+        uint64_t       served = 0;
+        int            i = 0;
+
+        gf_proc_dump_add_section ("%s.client.%d", prefix, idx);
+        gf_proc_dump_write ("client", "%s", stats->uid);
+
+        for (i = 0; i < IOT_PRI_MAX; i++) {
+                served = stats->served[i];
+                if (!stats->queue_sizes[i] && !served)
+                        continue;
+
+                snprintf (key, sizeof (key), "%s_queue_size",
+                          iot_pri_keys[i]);
+                gf_proc_dump_write (key, "%d", stats->queue_sizes[i]);
+                snprintf (key, sizeof (key), "%s_served", iot_pri_keys[i]);
+                gf_proc_dump_write (key, "%"PRIu64, served);
+                snprintf (key, sizeof (key), "%s_avg_wait_usec",
+                          iot_pri_keys[i]);
+                gf_proc_dump_write (key, "%"PRIu64,
+                                    served ? stats->wait_usec[i] / served : 0);
+                snprintf (key, sizeof (key), "%s_max_wait_usec",
+                          iot_pri_keys[i]);
+                gf_proc_dump_write (key, "%"PRIu64, stats->max_wait_usec[i]);
+        }
+}
+
 int
 iot_priv_dump (xlator_t *this)
 {
         iot_conf_t     *conf   =   NULL;
+        iot_client_t   *ctx    =   NULL;
+        struct iot_client_stats  shared = {{0, }, };
+        struct iot_client_stats *stats  = NULL;
         char           key_prefix[GF_DUMP_MAX_BUF_LEN];
+        int            count   =   0;
+        int            i       =   0;
+        int            n       =   0;
 
         if (!this)
                 return 0;
@@ -883,6 +1129,56 @@ iot_priv_dump (xlator_t *this)
 			   conf->throttle.cached_rate);
 	gf_proc_dump_write("least rate limit", "%u", conf->throttle.rate_limit);
 
+        gf_proc_dump_write("fair_queueing", "%d", conf->fair_queueing);
+        gf_proc_dump_write("queue_size", "%d", conf->queue_size);
+        gf_proc_dump_write("queued", "%"PRIu64, conf->queued);
+
+        snprintf (shared.uid, sizeof (shared.uid), "-");
+        for (i = 0; i < IOT_PRI_MAX; i++) {
+                pthread_mutex_lock (&conf->queue_locks[i]);
+                {
+                        iot_client_stats_get (&conf->shared, i, &shared);
+                }
+                pthread_mutex_unlock (&conf->queue_locks[i]);
+        }
+        iot_client_dump (&shared, key_prefix, 0);
+
+        /* clients_lock is a spinlock, under which neither the queue locks
+           are taken nor the dump written: the counters are copied as they
+           are, which is good enough for a dump */
+        LOCK (&conf->clients_lock);
+        {
+                list_for_each_entry (ctx, &conf->clients, clients)
+                        count++;
+        }
+        UNLOCK (&conf->clients_lock);
+
+        if (!count)
+                return 0;
+
+        stats = GF_CALLOC (count, sizeof (*stats), gf_iot_mt_client_stats_t);
+        if (!stats)
+                return 0;
+
+        LOCK (&conf->clients_lock);
+        {
+                list_for_each_entry (ctx, &conf->clients, clients) {
+                        if (n == count)
+                                break;
+                        snprintf (stats[n].uid, sizeof (stats[n].uid), "%s",
+                                  ctx->client->client_uid);
+                        for (i = 0; i < IOT_PRI_MAX; i++)
+                                iot_client_stats_get (ctx, i, &stats[n]);
+                        n++;
+                }
+        }
+        UNLOCK (&conf->clients_lock);
+
+        for (i = 0; i < n; i++)
+                iot_client_dump (&stats[i], key_prefix, i + 1);
+
+        GF_FREE (stats);
+
         return 0;
 }
 
@@ -917,6 +1213,9 @@ reconfigure (xlator_t *this, dict_t *options)
 	GF_OPTION_RECONF("least-rate-limit", conf->throttle.rate_limit, options,
 			 int32, out);
 
+        GF_OPTION_RECONF ("fair-queueing", conf->fair_queueing, options, bool,
+                          out);
+
 	ret = 0;
 out:
 	return ret;
@@ -980,6 +1279,7 @@ init (xlator_t *this)
         GF_OPTION_INIT ("idle-time", conf->idle_time, int32, out);
         GF_OPTION_INIT ("enable-least-priority", conf->least_priority,
                         bool, out);
+        GF_OPTION_INIT ("fair-queueing", conf->fair_queueing, bool, out);
 
 	GF_OPTION_INIT("least-rate-limit", conf->throttle.rate_limit, int32,
 		       out);
@@ -992,9 +1292,19 @@ init (xlator_t *this)
         conf->this = this;
 
         for (i = 0; i < IOT_PRI_MAX; i++) {
-                INIT_LIST_HEAD (&conf->reqs[i]);
+                if ((ret = pthread_mutex_init (&conf->queue_locks[i],
+                                               NULL)) != 0) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "pthread_mutex_init failed (%d)", ret);
+                        goto out;
+                }
+                INIT_LIST_HEAD (&conf->queues[i]);
         }
 
+        LOCK_INIT (&conf->clients_lock);
+        INIT_LIST_HEAD (&conf->clients);
+        iot_client_init (&conf->shared, NULL);
+
 	ret = iot_workers_scale (conf);
 
         if (ret == -1) {
@@ -1024,6 +1334,32 @@ fini (xlator_t *this)
 	return;
 }
 
+static int
+iot_client_destroy_cbk (xlator_t *this, client_t *client)
+{
+        iot_conf_t   *conf = this->private;
+        iot_client_t *ctx  = NULL;
+        void         *tmp  = NULL;
+
+        if (client_ctx_del (client, this, &tmp) != 0 || !tmp)
+                return 0;
+
+        /* the frames of its requests hold references on the client, so
+           nothing is queued any more */
+        ctx = tmp;
+        if (conf) {
+                LOCK (&conf->clients_lock);
+                {
+                        list_del_init (&ctx->clients);
+                }
+                UNLOCK (&conf->clients_lock);
+        }
+
+        GF_FREE (ctx);
+
+        return 0;
+}
+
 struct xlator_dumpops dumpops = {
         .priv    = iot_priv_dump,
 };
@@ -1075,7 +1411,9 @@ struct xlator_fops fops = {
         .zerofill    = iot_zerofill,
 };
 
-struct xlator_cbks cbks;
+struct xlator_cbks cbks = {
+        .client_destroy = iot_client_destroy_cbk,
+};
 
 struct volume_options options[] = {
 	{ .key  = {"thread-count"},
@@ -1133,6 +1471,14 @@ struct volume_options options[] = {
          .max   = 0x7fffffff,
          .default_value = "120",
         },
+        { .key  = {"fair-queueing"},
+          .type = GF_OPTION_TYPE_BOOL,
+          .default_value = "on",
+          .description = "Queue requests per client and share the threads "
+                         "of each priority between the clients that have "
+                         "requests, in round-robin, instead of serving all "
+                         "requests of a priority in arrival order"
+        },
 	{.key	= {"least-rate-limit"},
 	 .type	= GF_OPTION_TYPE_INT,
 	 .min	= 0,
@@ -29,6 +29,7 @@
 #include "iot-mem-types.h"
 #include <semaphore.h>
 #include "statedump.h"
+#include "client_t.h"
 
 
 struct iot_conf;
@@ -62,8 +63,33 @@ struct iot_least_throttle {
 	pthread_mutex_t	lock;
 };
 
+/*
+ * Requests are queued per client and, within each priority, clients are
+ * served by deficit round-robin: a client at the head of the round gets
+ * IOT_DRR_QUANTUM cost units of credit, dispatches requests while their cost
+ * fits in its credit and then goes to the tail. Reads and writes cost one
+ * unit per IOT_DRR_UNIT bytes on top of the unit every request costs, so a
+ * client streaming large writes gets its share of bytes, not of requests.
+ */
+#define IOT_DRR_QUANTUM         4
+#define IOT_DRR_UNIT            (64 * 1024)
+#define IOT_DRR_MAX_COST        16
+
+typedef struct iot_client {
+        struct list_head     clients;             /* conf->clients */
+        struct list_head     active[IOT_PRI_MAX]; /* conf->queues[], while
+                                                     reqs[] is not empty */
+        struct list_head     reqs[IOT_PRI_MAX];
+        int32_t              deficit[IOT_PRI_MAX];
+        int32_t              queue_sizes[IOT_PRI_MAX];
+        uint64_t             served[IOT_PRI_MAX];
+        uint64_t             wait_usec[IOT_PRI_MAX];
+        uint64_t             max_wait_usec[IOT_PRI_MAX];
+        client_t            *client;    /* NULL for conf->shared */
+} iot_client_t;
+
 struct iot_conf {
-        pthread_mutex_t      mutex;
+        pthread_mutex_t      mutex;       /* thread counts, sleep and wake */
         pthread_cond_t       cond;
 
         int32_t              max_count;   /* configured maximum */
@@ -72,12 +98,22 @@ struct iot_conf {
 
         int32_t              idle_time;   /* in seconds */
 
-        struct list_head     reqs[IOT_PRI_MAX];
+        /* queues[i], ac_iot_count[i] and queue_sizes[i] are protected by
+           queue_locks[i], so enqueue and dequeue only take conf->mutex to
+           wake a sleeping worker or to start one */
+        pthread_mutex_t      queue_locks[IOT_PRI_MAX];
+        struct list_head     queues[IOT_PRI_MAX]; /* iot_client_t round */
 
         int32_t              ac_iot_limit[IOT_PRI_MAX];
         int32_t              ac_iot_count[IOT_PRI_MAX];
         int                  queue_sizes[IOT_PRI_MAX];
-        int                  queue_size;
+        int                  queue_size;  /* atomic */
+        uint64_t             queued;      /* atomic, requests ever queued */
+
+        gf_boolean_t         fair_queueing;
+        gf_lock_t            clients_lock;
+        struct list_head     clients;     /* iot_client_t */
+        iot_client_t         shared;      /* requests without a client */
         pthread_attr_t       w_attr;
         gf_boolean_t         least_priority; /*Enable/Disable least-priority */
 
@@ -20,6 +20,8 @@
 #include "md-cache-mem-types.h"
 #include "compat-errno.h"
 #include "glusterfs-acl.h"
+#include "defaults.h"
+#include "upcall-utils.h"
 #include <assert.h>
 #include <sys/time.h>
 
@@ -35,6 +37,7 @@ struct mdc_conf {
 	gf_boolean_t cache_posix_acl;
 	gf_boolean_t cache_selinux;
 	gf_boolean_t force_readdirp;
+	gf_boolean_t cache_invalidation;
 };
 
 
@@ -2212,6 +2215,9 @@ reconfigure (xlator_t *this, dict_t *options)
 
 	GF_OPTION_RECONF("force-readdirp", conf->force_readdirp, options, bool, out);
 
+	GF_OPTION_RECONF ("cache-invalidation", conf->cache_invalidation,
+			  options, bool, out);
+
 out:
 	return 0;
 }
@@ -2246,6 +2252,9 @@ init (xlator_t *this)
 	mdc_key_load_set (mdc_keys, "system.posix_acl_", conf->cache_posix_acl);
 
 	GF_OPTION_INIT("force-readdirp", conf->force_readdirp, bool, out);
+
+	GF_OPTION_INIT ("cache-invalidation", conf->cache_invalidation,
+			bool, out);
 out:
 	this->private = conf;
 
@@ -2253,6 +2262,53 @@ out:
 }
 
 
+/* The brick tells which cached inodes were changed by someone else; what
+   is dropped here is fetched again on the next access. */
+static int
+mdc_invalidate (xlator_t *this, void *data)
+{
+	struct gf_upcall                    *upcall  = data;
+	struct gf_upcall_cache_invalidation *ca_data = NULL;
+	inode_table_t                       *itable  = NULL;
+	inode_t                             *inode   = NULL;
+
+	if (!upcall || upcall->event_type != GF_UPCALL_CACHE_INVALIDATION)
+		return 0;
+
+	ca_data = upcall->data;
+	if (!ca_data || !this->graph || !this->graph->top)
+		return 0;
+
+	itable = ((xlator_t *)this->graph->top)->itable;
+	if (!itable)
+		return 0;
+
+	inode = inode_find (itable, upcall->gfid);
+	if (!inode)
+		return 0;
+
+	mdc_inode_iatt_invalidate (this, inode);
+	if (ca_data->flags & UP_XATTR)
+		mdc_inode_xatt_invalidate (this, inode);
+
+	inode_unref (inode);
+
+	return 0;
+}
+
+
+int
+notify (xlator_t *this, int32_t event, void *data, ...)
+{
+	struct mdc_conf *conf = this->private;
+
+	if ((event == GF_EVENT_UPCALL) && conf && conf->cache_invalidation)
+		mdc_invalidate (this, data);
+
+	return default_notify (this, event, data);
+}
+
+
 void
 fini (xlator_t *this)
 {
@@ -2309,9 +2365,11 @@ struct volume_options options[] = {
         { .key = {"md-cache-timeout"},
           .type = GF_OPTION_TYPE_INT,
           .min = 0,
-          .max = 60,
+          .max = 600,
           .default_value = "1",
-          .description = "Time period after which cache has to be refreshed",
+          .description = "Time period after which cache has to be refreshed. "
+                         "Values above a few seconds should only be used "
+                         "together with cache-invalidation.",
         },
 	{ .key = {"force-readdirp"},
 	  .type = GF_OPTION_TYPE_BOOL,
@@ -2319,5 +2377,12 @@ struct volume_options options[] = {
 	  .description = "Convert all readdir requests to readdirplus to "
 			 "collect stat info on each entry.",
 	},
+	{ .key = {"cache-invalidation"},
+	  .type = GF_OPTION_TYPE_BOOL,
+	  .default_value = "false",
+	  .description = "When \"on\", drops cached attributes of the files "
+			 "the bricks report as changed by other clients. "
+			 "Needs features.cache-invalidation on the volume.",
+	},
     { .key = {NULL} },
 };
@@ -10,6 +10,7 @@
 
 #include "quick-read.h"
 #include "statedump.h"
+#include "upcall-utils.h"
 
 qr_inode_t *qr_inode_ctx_get (xlator_t *this, inode_t *inode);
 void __qr_inode_prune (qr_inode_table_t *table, qr_inode_t *qr_inode);
@@ -1078,6 +1079,47 @@ qr_conf_destroy (qr_conf_t *conf)
 }
 
 
+/* Drops the cached content of a file another client has written to. */
+static void
+qr_invalidate (xlator_t *this, struct gf_upcall *upcall)
+{
+	struct gf_upcall_cache_invalidation *ca_data = NULL;
+	inode_table_t                       *itable  = NULL;
+	inode_t                             *inode   = NULL;
+
+	if (!upcall || upcall->event_type != GF_UPCALL_CACHE_INVALIDATION)
+		return;
+
+	ca_data = upcall->data;
+	if (!ca_data || !(ca_data->flags & UP_WRITE_FLAGS))
+		return;
+
+	if (!this->graph || !this->graph->top)
+		return;
+
+	itable = ((xlator_t *)this->graph->top)->itable;
+	if (!itable)
+		return;
+
+	inode = inode_find (itable, upcall->gfid);
+	if (!inode)
+		return;
+
+	qr_inode_prune (this, inode);
+	inode_unref (inode);
+}
+
+
+int
+notify (xlator_t *this, int32_t event, void *data, ...)
+{
+	if ((event == GF_EVENT_UPCALL) && this->private)
+		qr_invalidate (this, data);
+
+	return default_notify (this, event, data);
+}
+
+
 void
 fini (xlator_t *this)
 {
@@ -520,8 +520,19 @@ out:
 void
 ra_page_purge (ra_page_t *page)
 {
+        ra_stream_t *stream = NULL;
+
         GF_VALIDATE_OR_GOTO ("read-ahead", page, out);
 
+        /* fetched ahead and never read: the stream is reading too far */
+        if (page->dirty) {
+                RA_STATS_INC (page->file, waste);
+
+                stream = __ra_stream_get (page->file, page->stream);
+                if (stream && stream->window > 1)
+                        stream->window /= 2;
+        }
+
         page->prev->next = page->next;
         page->next->prev = page->prev;
 
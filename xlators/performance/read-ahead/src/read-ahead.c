@@ -30,7 +30,7 @@
 #include <sys/time.h>
 
 static void
-read_ahead (call_frame_t *frame, ra_file_t *file);
+read_ahead (call_frame_t *frame, ra_file_t *file, uint32_t id);
 
 
 int
@@ -62,7 +62,6 @@ ra_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         if ((fd->flags & O_DIRECT) || ((fd->flags & O_ACCMODE) == O_WRONLY))
                 file->disabled = 1;
 
-        file->offset = (unsigned long long) 0;
         file->conf = conf;
         file->pages.next = &file->pages;
         file->pages.prev = &file->pages;
@@ -79,14 +78,9 @@ ra_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         ra_conf_unlock (conf);
 
         file->fd = fd;
-        file->page_count = conf->page_count;
         file->page_size = conf->page_size;
         pthread_mutex_init (&file->file_lock, NULL);
 
-        if (!file->disabled) {
-                file->page_count = 1;
-        }
-
         ret = fd_ctx_set (fd, this, (uint64_t)(long)file);
         if (ret == -1) {
                 gf_log (frame->this->name, GF_LOG_WARNING,
@@ -137,7 +131,6 @@ ra_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         if ((fd->flags & O_DIRECT) || ((fd->flags & O_ACCMODE) == O_WRONLY))
                 file->disabled = 1;
 
-        file->offset = (unsigned long long) 0;
         //file->size = fd->inode->buf.ia_size;
         file->conf = conf;
         file->pages.next = &file->pages;
@@ -155,7 +148,6 @@ ra_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         ra_conf_unlock (conf);
 
         file->fd = fd;
-        file->page_count = conf->page_count;
         file->page_size = conf->page_size;
         pthread_mutex_init (&file->file_lock, NULL);
 
@@ -265,51 +257,187 @@ out:
 }
 
 
-void
-read_ahead (call_frame_t *frame, ra_file_t *file)
+/* drops the pages of stream @id before @offset, which it has gone past */
+static void
+__ra_stream_flush (ra_file_t *file, uint32_t id, off_t offset)
 {
-        off_t      ra_offset   = 0;
-        size_t     ra_size     = 0;
-        off_t      trav_offset = 0;
-        ra_page_t *trav        = NULL;
-        off_t      cap         = 0;
-        char       fault       = 0;
+        ra_page_t *trav = NULL;
+        ra_page_t *next = NULL;
 
-        GF_VALIDATE_OR_GOTO ("read-ahead", frame, out);
-        GF_VALIDATE_OR_GOTO (frame->this->name, file, out);
+        trav = file->pages.next;
+        while (trav != &file->pages && trav->offset < offset) {
+                next = trav->next;
+                if (trav->stream == id) {
+                        if (!trav->waitq)
+                                ra_page_purge (trav);
+                        else
+                                trav->stale = 1;
+                }
+                trav = next;
+        }
+}
 
-        if (!file->page_count) {
-                goto out;
+
+static void
+ra_stream_flush (ra_file_t *file, uint32_t id, off_t offset)
+{
+        ra_file_lock (file);
+        {
+                __ra_stream_flush (file, id, offset);
         }
+        ra_file_unlock (file);
+}
+
 
-        ra_size   = file->page_size * file->page_count;
-        ra_offset = floor (file->offset, file->page_size);
-        cap       = file->size ? file->size : file->offset + ra_size;
+ra_stream_t *
+__ra_stream_get (ra_file_t *file, uint32_t id)
+{
+        int i = 0;
 
-        while (ra_offset < min (file->offset + ra_size, cap)) {
+        if (!id)
+                return NULL;
 
-                ra_file_lock (file);
-                {
-                        trav = ra_page_get (file, ra_offset);
+        for (i = 0; i < RA_MAX_STREAMS; i++) {
+                if (file->streams[i].id == id)
+                        return &file->streams[i];
+        }
+
+        return NULL;
+}
+
+
+static void
+__ra_stream_hit (ra_file_t *file, ra_stream_t *stream)
+{
+        uint32_t max = file->conf->page_count;
+
+        stream->hits++;
+        stream->window = stream->window ? min (stream->window * 2, max) : 1;
+}
+
+
+/* strides farther apart than this are taken as unrelated reads */
+#define RA_MAX_STRIDE(file) ((file)->page_size * 256)
+
+/*
+ * Finds the stream a read at @offset continues, or starts a new one in
+ * place of the least recently used stream. A stream is sequential once a
+ * read starts where the previous one ended, and strided once two reads
+ * in a row are the same distance apart.
+ */
+static ra_stream_t *
+__ra_stream_match (ra_file_t *file, off_t offset, size_t size)
+{
+        ra_stream_t *stream = NULL;
+        ra_stream_t *trav   = NULL;
+        uint32_t     old    = 0;
+        int          i      = 0;
+
+        for (i = 0; i < RA_MAX_STREAMS; i++) {
+                trav = &file->streams[i];
+                if (!trav->id)
+                        continue;
+
+                if (offset == trav->offset + trav->size) {
+                        if (trav->stride || !trav->hits) {
+                                trav->stride = 0;
+                                trav->hits = 0;
+                                trav->window = 0;
+                                RA_STATS_INC (file, sequential);
+                        }
+                        __ra_stream_hit (file, trav);
+                        stream = trav;
+                        break;
                 }
-                ra_file_unlock (file);
 
-                if (!trav)
+                if (trav->stride && offset == trav->offset + trav->stride) {
+                        if (!trav->hits)
+                                RA_STATS_INC (file, strided);
+                        __ra_stream_hit (file, trav);
+                        stream = trav;
                         break;
+                }
+        }
 
-                ra_offset += file->page_size;
+        /* a second read of a new stream a little further on: the stride
+           is a guess until the next read confirms it */
+        for (i = 0; !stream && i < RA_MAX_STREAMS; i++) {
+                trav = &file->streams[i];
+                if (!trav->id || trav->hits)
+                        continue;
+
+                if (offset > trav->offset + trav->size &&
+                    offset - trav->offset <= RA_MAX_STRIDE (file)) {
+                        trav->stride = offset - trav->offset;
+                        stream = trav;
+                }
         }
 
-        if (trav) {
-                /* comfortable enough */
-                goto out;
+        if (!stream) {
+                stream = &file->streams[0];
+                for (i = 0; i < RA_MAX_STREAMS; i++) {
+                        trav = &file->streams[i];
+                        if (!trav->id) {
+                                stream = trav;
+                                break;
+                        }
+                        if (trav->used < stream->used)
+                                stream = trav;
+                }
+
+                old = stream->id;
+                memset (stream, 0, sizeof (*stream));
+                stream->id = ++file->stream_id;
+                if (!stream->id)
+                        stream->id = ++file->stream_id;
+
+                if (old)
+                        __ra_stream_flush (file, old,
+                                           file->pages.prev->offset + 1);
+
+                /* reading from the start is taken as sequential */
+                if (offset == 0) {
+                        RA_STATS_INC (file, sequential);
+                        __ra_stream_hit (file, stream);
+                }
         }
 
-        trav_offset = ra_offset;
+        stream->offset = offset;
+        stream->size = size;
+        stream->used = ++file->stream_tick;
+
+        return stream;
+}
+
+
+/* forget the access patterns, after a write for instance */
+static void
+ra_stream_reset (ra_file_t *file)
+{
+        ra_file_lock (file);
+        {
+                memset (file->streams, 0, sizeof (file->streams));
+        }
+        ra_file_unlock (file);
+}
+
 
-        cap  = file->size ? file->size : ra_offset + ra_size;
+/* faults in the pages of [@offset, @offset + @size) not cached yet */
+static void
+ra_fetch_ahead (call_frame_t *frame, ra_file_t *file, uint32_t id,
+                off_t offset, size_t size)
+{
+        off_t      trav_offset = 0;
+        off_t      end         = 0;
+        ra_page_t *trav        = NULL;
+        char       fault       = 0;
+
+        trav_offset = floor (offset, file->page_size);
+        end = offset + size;
+        if (file->size)
+                end = min (end, file->size);
 
-        while (trav_offset < min(ra_offset + ra_size, cap)) {
+        while (trav_offset < end) {
                 fault = 0;
                 ra_file_lock (file);
                 {
@@ -317,8 +445,10 @@ read_ahead (call_frame_t *frame, ra_file_t *file)
                         if (!trav) {
                                 fault = 1;
                                 trav = ra_page_create (file, trav_offset);
-                                if (trav)
+                                if (trav) {
                                         trav->dirty = 1;
+                                        trav->stream = id;
+                                }
                         }
                 }
                 ra_file_unlock (file);
@@ -335,6 +465,41 @@ read_ahead (call_frame_t *frame, ra_file_t *file)
                 }
                 trav_offset += file->page_size;
         }
+}
+
+
+void
+read_ahead (call_frame_t *frame, ra_file_t *file, uint32_t id)
+{
+        ra_stream_t  stream = {0, };
+        ra_stream_t *trav   = NULL;
+        uint32_t     i      = 0;
+
+        GF_VALIDATE_OR_GOTO ("read-ahead", frame, out);
+        GF_VALIDATE_OR_GOTO (frame->this->name, file, out);
+
+        ra_file_lock (file);
+        {
+                trav = __ra_stream_get (file, id);
+                if (trav)
+                        stream = *trav;
+        }
+        ra_file_unlock (file);
+
+        if (!stream.window) {
+                goto out;
+        }
+
+        if (!stream.stride) {
+                ra_fetch_ahead (frame, file, id, stream.offset + stream.size,
+                                file->page_size * stream.window);
+                goto out;
+        }
+
+        for (i = 1; i <= stream.window; i++)
+                ra_fetch_ahead (frame, file, id,
+                                stream.offset + stream.stride * i,
+                                stream.size);
 
 out:
         return;
@@ -392,8 +557,12 @@ dispatch_requests (call_frame_t *frame, ra_file_t *file)
                                 }
                                 fault = 1;
                                 need_atime_update = 0;
+                                RA_STATS_INC (file, misses);
+                        } else if (trav->dirty) {
+                                RA_STATS_INC (file, hits);
                         }
                         trav->dirty = 0;
+                        trav->stream = local->stream;
 
                         if (trav->ready) {
                                 gf_log (frame->this->name, GF_LOG_TRACE,
@@ -465,17 +634,15 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 {
         ra_file_t   *file            = NULL;
         ra_local_t  *local           = NULL;
-        ra_conf_t   *conf            = NULL;
+        ra_stream_t *stream          = NULL;
+        uint32_t     id              = 0;
         int          op_errno        = EINVAL;
-        char         expected_offset = 1;
         uint64_t     tmp_file        = 0;
 
         GF_ASSERT (frame);
         GF_VALIDATE_OR_GOTO (frame->this->name, this, unwind);
         GF_VALIDATE_OR_GOTO (frame->this->name, fd, unwind);
 
-        conf = this->private;
-
         gf_log (this->name, GF_LOG_TRACE,
                 "NEW REQ at offset=%"PRId64" for size=%"GF_PRI_SIZET"",
                 offset, size);
@@ -487,28 +654,16 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
                 goto disabled;
         }
 
-        if (file->offset != offset) {
-                gf_log (this->name, GF_LOG_TRACE,
-                        "unexpected offset (%"PRId64" != %"PRId64") resetting",
-                        file->offset, offset);
+        ra_file_lock (file);
+        {
+                stream = __ra_stream_match (file, offset, size);
+                id = stream->id;
 
-                expected_offset = file->expected = file->page_count = 0;
-        } else {
                 gf_log (this->name, GF_LOG_TRACE,
-                        "expected offset (%"PRId64") when page_count=%d",
-                        offset, file->page_count);
-
-                if (file->expected < (file->page_size * conf->page_count)) {
-                        file->expected += size;
-                        file->page_count = min ((file->expected
-                                                 / file->page_size),
-                                                conf->page_count);
-                }
-        }
-
-        if (!expected_offset) {
-                flush_region (frame, file, 0, file->pages.prev->offset + 1, 0);
+                        "stream %u (stride=%"PRId64") window=%u", id,
+                        stream->stride, stream->window);
         }
+        ra_file_unlock (file);
 
         local = mem_get0 (this->local_pool);
         if (!local) {
@@ -519,6 +674,7 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
         local->fd         = fd;
         local->offset     = offset;
         local->size       = size;
+        local->stream     = id;
         local->wait_count = 1;
 
         local->fill.next  = &local->fill;
@@ -530,14 +686,12 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 
         dispatch_requests (frame, file);
 
-        flush_region (frame, file, 0, floor (offset, file->page_size), 0);
+        ra_stream_flush (file, id, floor (offset, file->page_size));
 
-        read_ahead (frame, file);
+        read_ahead (frame, file, id);
 
         ra_frame_return (frame);
 
-        file->offset = offset + size;
-
         return 0;
 
 unwind:
@@ -675,8 +829,8 @@ ra_writev (call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
         if (file) {
                 flush_region (frame, file, 0, file->pages.prev->offset+1, 1);
                 frame->local = file;
-                /* reset the read-ahead counters too */
-                file->expected = file->page_count = 0;
+                /* reset the read-ahead streams too */
+                ra_stream_reset (file);
         }
 
         STACK_WIND (frame, ra_writev_cbk,
@@ -803,6 +957,7 @@ ra_fdctx_dump (xlator_t *this, fd_t *fd)
 {
 	ra_file_t    *file     = NULL;
         ra_page_t    *page     = NULL;
+        ra_stream_t  *stream   = NULL;
         int32_t       ret      = 0, i = 0;
         uint64_t      tmp_file = 0;
         char         *path     = NULL;
@@ -840,10 +995,27 @@ ra_fdctx_dump (xlator_t *this, fd_t *fd)
 
         gf_proc_dump_write ("page-size", "%"PRId64, file->page_size);
 
-        gf_proc_dump_write ("page-count", "%u", file->page_count);
+        gf_proc_dump_write ("ra-hits", "%"PRIu64, file->stats.hits);
+        gf_proc_dump_write ("ra-waste", "%"PRIu64, file->stats.waste);
+        gf_proc_dump_write ("ra-misses", "%"PRIu64, file->stats.misses);
+
+        for (i = 0; i < RA_MAX_STREAMS; i++) {
+                stream = &file->streams[i];
+                if (!stream->id)
+                        continue;
+
+                sprintf (key, "stream[%d]", i);
+                gf_proc_dump_write (key, "%s next-offset=%"PRId64
+                                    " stride=%"PRId64" window=%u hits=%u",
+                                    stream->stride ? "strided" : "sequential",
+                                    stream->offset + (stream->stride ?
+                                                      stream->stride :
+                                                      (off_t)stream->size),
+                                    stream->stride, stream->window,
+                                    stream->hits);
+        }
 
-        gf_proc_dump_write ("next-expected-offset-for-sequential-reads",
-                            "%"PRId64, file->offset);
+        i = 0;
 
         for (page = file->pages.next; page != &file->pages;
              page = page->next) {
@@ -1075,6 +1247,15 @@ ra_priv_dump (xlator_t *this)
                 gf_proc_dump_write ("page_count", "%d", conf->page_count);
                 gf_proc_dump_write ("force_atime_update", "%d",
                                     conf->force_atime_update);
+                gf_proc_dump_write ("ra_hits", "%"PRIu64, conf->stats.hits);
+                gf_proc_dump_write ("ra_waste", "%"PRIu64,
+                                    conf->stats.waste);
+                gf_proc_dump_write ("ra_misses", "%"PRIu64,
+                                    conf->stats.misses);
+                gf_proc_dump_write ("sequential_streams", "%"PRIu64,
+                                    conf->stats.sequential);
+                gf_proc_dump_write ("strided_streams", "%"PRIu64,
+                                    conf->stats.strided);
         }
         pthread_mutex_unlock (&conf->conf_lock);
 
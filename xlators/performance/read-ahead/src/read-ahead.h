@@ -48,8 +48,39 @@ struct ra_fill {
 };
 
 
+/*
+ * A sequential or strided pattern of reads on a fd. Each fd tracks up to
+ * RA_MAX_STREAMS of them, so interleaved readers and backward seeks do not
+ * throw away the pages fetched for the other streams. The window (pages
+ * for a sequential stream, strides for a strided one) doubles every time a
+ * read follows the pattern and is halved every time a page fetched ahead
+ * for the stream is dropped before being read.
+ */
+#define RA_MAX_STREAMS 8
+
+struct ra_stream {
+        uint32_t          id;       /* 0 if the slot is free */
+        off_t             offset;   /* of the last read */
+        size_t            size;     /* of the last read */
+        off_t             stride;   /* 0 for sequential reads */
+        uint32_t          window;
+        uint32_t          hits;     /* reads that followed the pattern */
+        uint64_t          used;     /* for replacing the least recent one */
+};
+
+
+struct ra_stats {
+        uint64_t          hits;     /* pages fetched ahead and then read */
+        uint64_t          waste;    /* pages fetched ahead and never read */
+        uint64_t          misses;   /* pages the reader had to wait for */
+        uint64_t          sequential;
+        uint64_t          strided;
+};
+
+
 struct ra_local {
         mode_t            mode;
+        uint32_t          stream;
         struct ra_fill    fill;
         off_t             offset;
         size_t            size;
@@ -77,6 +108,7 @@ struct ra_page {
         struct ra_waitq  *waitq;
         struct iobref    *iobref;
         char              stale;
+        uint32_t          stream;   /* stream it was last read or fetched for */
 };
 
 
@@ -86,15 +118,16 @@ struct ra_file {
         struct ra_conf    *conf;
         fd_t              *fd;
         int                disabled;
-        size_t             expected;
         struct ra_page     pages;
-        off_t              offset;
         size_t             size;
         int32_t            refcount;
         pthread_mutex_t    file_lock;
         struct iatt        stbuf;
         uint64_t           page_size;
-        uint32_t           page_count;
+        struct ra_stream   streams[RA_MAX_STREAMS];
+        uint32_t           stream_id;
+        uint64_t           stream_tick;
+        struct ra_stats    stats;
 };
 
 
@@ -105,6 +138,7 @@ struct ra_conf {
         struct ra_file    files;
         gf_boolean_t      force_atime_update;
         pthread_mutex_t   conf_lock;
+        struct ra_stats   stats;
 };
 
 
@@ -114,6 +148,7 @@ typedef struct ra_page ra_page_t;
 typedef struct ra_file ra_file_t;
 typedef struct ra_waitq ra_waitq_t;
 typedef struct ra_fill ra_fill_t;
+typedef struct ra_stream ra_stream_t;
 
 ra_page_t *
 ra_page_get (ra_file_t *file,
@@ -154,6 +189,14 @@ ra_frame_fill (ra_page_t *page,
 void
 ra_file_destroy (ra_file_t *file);
 
+ra_stream_t *
+__ra_stream_get (ra_file_t *file, uint32_t id);
+
+#define RA_STATS_INC(file, field) do {                                  \
+                (file)->stats.field++;                                  \
+                __sync_fetch_and_add (&(file)->conf->stats.field, 1);   \
+        } while (0)
+
 static inline void
 ra_file_lock (ra_file_t *file)
 {
@@ -25,11 +25,14 @@
 #include "call-stub.h"
 #include "statedump.h"
 #include "defaults.h"
+#include "timer.h"
 #include "write-behind-mem-types.h"
 
-#define MAX_VECTOR_COUNT          8
+#define MAX_VECTOR_COUNT          16
 #define WB_AGGREGATE_SIZE         131072 /* 128 KB */
 #define WB_WINDOW_SIZE            1048576 /* 1MB */
+#define WB_MAX_EXTENTS            64
+#define WB_SIZE_BUCKETS           32
 
 typedef struct list_head list_head_t;
 struct wb_conf;
@@ -109,6 +112,16 @@ typedef struct wb_inode {
 				liability generation higher than itself)
 			     */
 	size_t       size; /* Size of the file to catch write after EOF. */
+	list_head_t  extents; /* Extent map: non-sync writes still open
+				 for merging (ordering.go not set), in
+				 order of arrival. A later write that
+				 overlaps or is adjacent to one of them
+				 is copied into it instead of being
+				 sent on its own. See
+				 __wb_preprocess_winds().
+			      */
+	int          extent_count;
+	gf_timer_t  *timer;   /* sends extents older than batch-window */
         gf_lock_t    lock;
         xlator_t    *this;
 } wb_inode_t;
@@ -121,6 +134,7 @@ typedef struct wb_request {
         list_head_t           winds;
         list_head_t           unwinds;
         list_head_t           wip;
+	list_head_t           extent; /* in @extents while open for merging */
 
         call_stub_t          *stub;
 
@@ -148,6 +162,7 @@ typedef struct wb_request {
 				       request arrival */
 
 	fd_t                 *fd;
+	struct timeval        birth; /* when it started an extent */
 	struct {
 		size_t        size;          /* 0 size == till infinity */
 		off_t         off;
@@ -157,20 +172,41 @@ typedef struct wb_request {
 		int           lied:1;        /* sin committed */
 		int           fulfilled:1;   /* got server acknowledgement */
 		int           go:1;          /* enough aggregating, good to go */
+		int           seen:1;        /* looked at by the extent map */
 	} ordering;
 } wb_request_t;
 
 
+/* write sizes by power of two, as io-stats counts blocks */
+typedef struct wb_stats {
+        uint64_t         size_in[WB_SIZE_BUCKETS];  /* as written by the
+                                                       application */
+        uint64_t         size_out[WB_SIZE_BUCKETS]; /* as sent, after
+                                                       merging */
+        uint64_t         merged;        /* writes merged into an extent */
+        uint64_t         overwritten;   /* bytes rewritten before they were
+                                           sent */
+} wb_stats_t;
+
+
 typedef struct wb_conf {
         uint64_t         aggregate_size;
         uint64_t         window_size;
+        uint32_t         batch_window;   /* msec, 0 to send extents as soon
+                                            as nothing is in transit */
         gf_boolean_t     flush_behind;
         gf_boolean_t     trickling_writes;
 	gf_boolean_t     strict_write_ordering;
 	gf_boolean_t     strict_O_DIRECT;
+        wb_stats_t       stats;
 } wb_conf_t;
 
 
+#define WB_STATS_SIZE(conf, dir, size)                                  \
+        __sync_fetch_and_add (&(conf)->stats.dir[log_base2 (size)], 1)
+
+
+
 void
 wb_process_queue (wb_inode_t *wb_inode);
 
@@ -377,6 +413,11 @@ __wb_request_unref (wb_request_t *req)
 		list_del_init (&req->winds);
 		list_del_init (&req->unwinds);
 
+		if (!list_empty (&req->extent)) {
+			list_del_init (&req->extent);
+			wb_inode->extent_count--;
+		}
+
                 if (req->stub && req->ordering.tempted) {
                         call_stub_destroy (req->stub);
 			req->stub = NULL;
@@ -472,6 +513,7 @@ wb_enqueue_common (wb_inode_t *wb_inode, call_stub_t *stub, int tempted)
         INIT_LIST_HEAD (&req->winds);
         INIT_LIST_HEAD (&req->unwinds);
         INIT_LIST_HEAD (&req->wip);
+        INIT_LIST_HEAD (&req->extent);
 
         req->stub = stub;
         req->wb_inode = wb_inode;
@@ -498,6 +540,10 @@ wb_enqueue_common (wb_inode_t *wb_inode, call_stub_t *stub, int tempted)
 
 		if (stub->args.fd->flags & O_APPEND)
 			req->ordering.append = 1;
+
+		if (tempted)
+			WB_STATS_SIZE ((wb_conf_t *)wb_inode->this->private,
+				       size_in, req->write_size);
         }
 
         req->lk_owner = stub->frame->root->lk_owner;
@@ -614,6 +660,7 @@ __wb_inode_create (xlator_t *this, inode_t *inode)
         INIT_LIST_HEAD (&wb_inode->liability);
         INIT_LIST_HEAD (&wb_inode->temptation);
         INIT_LIST_HEAD (&wb_inode->wip);
+        INIT_LIST_HEAD (&wb_inode->extents);
 
         wb_inode->this = this;
 
@@ -809,6 +856,9 @@ wb_fulfill_head (wb_inode_t *wb_inode, wb_request_t *head)
 	frame->root->lk_owner = head->lk_owner;
 	frame->local = head;
 
+	WB_STATS_SIZE ((wb_conf_t *)wb_inode->this->private, size_out,
+		       head->total_size);
+
 	LOCK (&wb_inode->lock);
 	{
 		wb_inode->transit += head->total_size;
@@ -842,11 +892,58 @@ err:
 		head = req;						\
 		expected_offset = req->stub->args.offset +		\
 			req->write_size;				\
-		curr_aggregate = 0;					\
-		vector_count = 0;					\
+		curr_aggregate = req->write_size;			\
+		vector_count = req->stub->args.count;			\
 	} while (0)
 
 
+static gf_boolean_t
+wb_request_before (wb_request_t *req1, wb_request_t *req2)
+{
+	if (req1->fd != req2->fd)
+		return ((uintptr_t)req1->fd < (uintptr_t)req2->fd);
+
+	return (req1->stub->args.offset < req2->stub->args.offset);
+}
+
+
+/* Writes picked in one go never overlap (see wb_wip_has_conflict()), so
+   they can be sent in order of offset. Extents filled out of order then
+   end up next to each other and go out in one writev.
+*/
+void
+wb_sort_liabilities (wb_conf_t *conf, list_head_t *liabilities)
+{
+	list_head_t   sorted = {0, };
+	wb_request_t *req    = NULL;
+	wb_request_t *tmp    = NULL;
+	wb_request_t *each   = NULL;
+
+	if (conf->strict_write_ordering)
+		return;
+
+	list_for_each_entry (req, liabilities, winds) {
+		/* offsets of appends mean nothing */
+		if (req->ordering.append)
+			return;
+	}
+
+	INIT_LIST_HEAD (&sorted);
+
+	list_for_each_entry_safe (req, tmp, liabilities, winds) {
+		list_del_init (&req->winds);
+
+		list_for_each_entry_reverse (each, &sorted, winds) {
+			if (!wb_request_before (req, each))
+				break;
+		}
+		list_add (&req->winds, &each->winds);
+	}
+
+	list_splice_init (&sorted, liabilities);
+}
+
+
 int
 wb_fulfill (wb_inode_t *wb_inode, list_head_t *liabilities)
 {
@@ -861,6 +958,8 @@ wb_fulfill (wb_inode_t *wb_inode, list_head_t *liabilities)
 
 	conf = wb_inode->this->private;
 
+	wb_sort_liabilities (conf, liabilities);
+
 	list_for_each_entry_safe (req, tmp, liabilities, winds) {
 		list_del_init (&req->winds);
 
@@ -884,6 +983,12 @@ wb_fulfill (wb_inode_t *wb_inode, list_head_t *liabilities)
 			continue;
 		}
 
+		if (!(req->stub->args.offset % conf->aggregate_size)) {
+			/* keep batches aligned to the aggregate size */
+			NEXT_HEAD (head, req);
+			continue;
+		}
+
 		if ((curr_aggregate + req->write_size) > conf->aggregate_size) {
 			NEXT_HEAD (head, req);
 			continue;
@@ -960,6 +1065,9 @@ __wb_pick_unwinds (wb_inode_t *wb_inode, list_head_t *lies)
 }
 
 
+/* Copies the data of @req into @holder, whose range grows to cover both.
+   They overlap or are adjacent, and @req wins where they overlap.
+*/
 int
 __wb_collapse_small_writes (wb_request_t *holder, wb_request_t *req)
 {
@@ -968,17 +1076,21 @@ __wb_collapse_small_writes (wb_request_t *holder, wb_request_t *req)
         struct iobref *iobref = NULL;
         int            ret    = -1;
         ssize_t        required_size = 0;
-        size_t         holder_len = 0;
-        size_t         req_len = 0;
+        off_t          start  = 0;
+        off_t          end    = 0;
+        off_t          holder_off = 0;
+        off_t          req_off = 0;
+        uint64_t       ordering_end = 0;
 
-        if (!holder->iobref) {
-                holder_len = iov_length (holder->stub->args.vector,
-                                         holder->stub->args.count);
-                req_len = iov_length (req->stub->args.vector,
-                                      req->stub->args.count);
+        holder_off = holder->stub->args.offset;
+        req_off = req->stub->args.offset;
+
+        start = min (holder_off, req_off);
+        end = max (holder_off + holder->write_size,
+                   req_off + req->write_size);
 
-                required_size = max ((THIS->ctx->page_size),
-                                     (holder_len + req_len));
+        if (!holder->iobref) {
+                required_size = max ((THIS->ctx->page_size), (end - start));
                 iobuf = iobuf_get2 (req->wb_inode->this->ctx->iobuf_pool,
                                     required_size);
                 if (iobuf == NULL) {
@@ -1001,7 +1113,8 @@ __wb_collapse_small_writes (wb_request_t *holder, wb_request_t *req)
                         goto out;
                 }
 
-                iov_unload (iobuf->ptr, holder->stub->args.vector,
+                iov_unload (iobuf->ptr + (holder_off - start),
+                            holder->stub->args.vector,
                             holder->stub->args.count);
                 holder->stub->args.vector[0].iov_base = iobuf->ptr;
 		holder->stub->args.count = 1;
@@ -1012,16 +1125,25 @@ __wb_collapse_small_writes (wb_request_t *holder, wb_request_t *req)
                 iobuf_unref (iobuf);
 
                 holder->iobref = iobref_ref (iobref);
+        } else if (holder_off > start) {
+                ptr = holder->stub->args.vector[0].iov_base;
+                memmove (ptr + (holder_off - start), ptr,
+                         holder->write_size);
         }
 
-        ptr = holder->stub->args.vector[0].iov_base + holder->write_size;
+        ptr = holder->stub->args.vector[0].iov_base + (req_off - start);
 
         iov_unload (ptr, req->stub->args.vector,
                     req->stub->args.count);
 
-        holder->stub->args.vector[0].iov_len += req->write_size;
-        holder->write_size += req->write_size;
-        holder->ordering.size += req->write_size;
+        holder->stub->args.vector[0].iov_len = end - start;
+        holder->stub->args.offset = start;
+        holder->write_size = end - start;
+
+        ordering_end = max (holder->ordering.off + holder->ordering.size,
+                            req->ordering.off + req->ordering.size);
+        holder->ordering.off = min (holder->ordering.off, req->ordering.off);
+        holder->ordering.size = ordering_end - holder->ordering.off;
 
         ret = 0;
 out:
@@ -1029,78 +1151,316 @@ out:
 }
 
 
+static void
+__wb_extent_close (wb_inode_t *wb_inode, wb_request_t *extent)
+{
+	extent->ordering.go = 1;
+
+	list_del_init (&extent->extent);
+	wb_inode->extent_count--;
+}
+
+
+static void
+__wb_extents_close_all (wb_inode_t *wb_inode)
+{
+	wb_request_t *extent = NULL;
+	wb_request_t *tmp    = NULL;
+
+	list_for_each_entry_safe (extent, tmp, &wb_inode->extents, extent) {
+		__wb_extent_close (wb_inode, extent);
+	}
+}
+
+
+static void
+__wb_extent_open (wb_inode_t *wb_inode, wb_request_t *req)
+{
+	wb_conf_t *conf = NULL;
+
+	conf = wb_inode->this->private;
+
+	if (wb_inode->extent_count >= WB_MAX_EXTENTS)
+		__wb_extent_close (wb_inode,
+				   list_entry (wb_inode->extents.next,
+					       wb_request_t, extent));
+
+	if (conf->batch_window)
+		gettimeofday (&req->birth, NULL);
+
+	list_add_tail (&req->extent, &wb_inode->extents);
+	wb_inode->extent_count++;
+}
+
+
+/* data of the two writes overlaps or is adjacent */
+static gf_boolean_t
+wb_extent_touches (wb_request_t *extent, wb_request_t *req)
+{
+	off_t extent_start = extent->stub->args.offset;
+	off_t req_start = req->stub->args.offset;
+
+	return ((req_start <= extent_start + extent->write_size) &&
+		(extent_start <= req_start + req->write_size));
+}
+
+
+static gf_boolean_t
+wb_extent_can_take (wb_request_t *extent, wb_request_t *req,
+		    ssize_t page_size)
+{
+	off_t start = 0;
+	off_t end   = 0;
+
+	if (req->fd != extent->fd)
+		return _gf_false;
+
+	if (!is_same_lkowner (&req->lk_owner, &extent->lk_owner))
+		return _gf_false;
+
+	if ((req->ordering.append || extent->ordering.append) &&
+	    (req->stub->args.offset != (extent->stub->args.offset
+					+ extent->write_size)))
+		/* appends only go at the end */
+		return _gf_false;
+
+	/* an extent never grows over a page boundary, so that full
+	   extents make aligned writes */
+	start = min (extent->stub->args.offset, req->stub->args.offset);
+	end = max (extent->stub->args.offset + extent->write_size,
+		   req->stub->args.offset + req->write_size);
+
+	return (start / page_size == (end - 1) / page_size);
+}
+
+
+/* Merging @req into @extent sends it before everything queued in
+   between, so none of that may touch the range of @req.
+*/
+static gf_boolean_t
+__wb_extent_fenced (wb_request_t *extent, wb_request_t *req)
+{
+	struct list_head *pos  = NULL;
+	wb_request_t     *each = NULL;
+
+	for (pos = req->todo.prev; pos != &extent->todo; pos = pos->prev) {
+		each = list_entry (pos, wb_request_t, todo);
+
+		switch (each->fop) {
+		case GF_FOP_WRITE:
+		case GF_FOP_READ:
+		case GF_FOP_TRUNCATE:
+		case GF_FOP_FTRUNCATE:
+			if (wb_requests_overlap (each, req))
+				return _gf_true;
+			break;
+		default:
+			break;
+		}
+	}
+
+	return _gf_false;
+}
+
+
+/* Finds the extent @req can be merged into. Every other extent touching
+   @req is closed: it must go out before @req does, and a write next to it
+   that it could not take means it is done growing.
+*/
+static wb_request_t *
+__wb_extent_lookup (wb_inode_t *wb_inode, wb_request_t *req,
+		    ssize_t page_size)
+{
+	wb_request_t *extent = NULL;
+	wb_request_t *tmp    = NULL;
+	wb_request_t *holder = NULL;
+
+	list_for_each_entry_safe (extent, tmp, &wb_inode->extents, extent) {
+		if (!wb_extent_touches (extent, req) &&
+		    !wb_requests_overlap (extent, req))
+			continue;
+
+		if (!holder && wb_extent_touches (extent, req) &&
+		    wb_extent_can_take (extent, req, page_size) &&
+		    !__wb_extent_fenced (extent, req)) {
+			holder = extent;
+			continue;
+		}
+
+		__wb_extent_close (wb_inode, extent);
+	}
+
+	return holder;
+}
+
+
+/* The timer holds a ref on an fd of the inode rather than on a request:
+   a request stays a liability until its last unref, so a ref held by the
+   timer would keep fsync and friends waiting on an extent which was
+   already sent. */
+void
+wb_batch_timeout (void *data)
+{
+	fd_t         *fd       = NULL;
+	wb_inode_t   *wb_inode = NULL;
+	gf_timer_t   *timer    = NULL;
+
+	fd = data;
+
+	wb_inode = wb_inode_ctx_get (THIS, fd->inode);
+	if (!wb_inode)
+		goto out;
+
+	LOCK (&wb_inode->lock);
+	{
+		timer = wb_inode->timer;
+		wb_inode->timer = NULL;
+	}
+	UNLOCK (&wb_inode->lock);
+
+	if (timer)
+		gf_timer_call_cancel (wb_inode->this->ctx, timer);
+
+	wb_process_queue (wb_inode);
+out:
+	fd_unref (fd);
+}
+
+
+/* Decides which extents stop waiting for more writes */
+static void
+__wb_extents_flush (wb_inode_t *wb_inode)
+{
+	wb_conf_t      *conf    = NULL;
+	wb_request_t   *req     = NULL;
+	wb_request_t   *tmp     = NULL;
+	ssize_t         pending = 0;
+	struct timeval  now     = {0, };
+	struct timespec delta   = {0, };
+	int64_t         age     = 0;
+
+	conf = wb_inode->this->private;
+
+	if (list_empty (&wb_inode->extents))
+		return;
+
+	/* writes waiting for room in the window would wait forever on
+	   extents that nothing sends */
+	pending = wb_inode->window_current;
+	list_for_each_entry (req, &wb_inode->temptation, lie) {
+		if (!req->ordering.fulfilled)
+			pending += req->orig_size;
+	}
+
+	if (pending > wb_inode->window_conf) {
+		__wb_extents_close_all (wb_inode);
+		return;
+	}
+
+	if (!conf->batch_window) {
+		/* but if trickling writes are enabled, then do not hold
+		   back writes if there are no outstanding requests
+		*/
+		if (conf->trickling_writes && !wb_inode->transit)
+			__wb_extents_close_all (wb_inode);
+		return;
+	}
+
+	gettimeofday (&now, NULL);
+
+	list_for_each_entry_safe (req, tmp, &wb_inode->extents, extent) {
+		age = (now.tv_sec - req->birth.tv_sec) * 1000
+			+ (now.tv_usec - req->birth.tv_usec) / 1000;
+		if (age < conf->batch_window)
+			break;
+
+		__wb_extent_close (wb_inode, req);
+	}
+
+	if (list_empty (&wb_inode->extents) || wb_inode->timer)
+		return;
+
+	/* come back when the oldest one is due */
+	req = list_entry (wb_inode->extents.next, wb_request_t, extent);
+	age = conf->batch_window - age;
+	delta.tv_sec = age / 1000;
+	delta.tv_nsec = (age % 1000) * 1000000;
+
+	wb_inode->timer = gf_timer_call_after (wb_inode->this->ctx, delta,
+					       wb_batch_timeout,
+					       fd_ref (req->fd));
+	if (!wb_inode->timer) {
+		fd_unref (req->fd);
+		__wb_extents_close_all (wb_inode);
+	}
+}
+
+
 void
 __wb_preprocess_winds (wb_inode_t *wb_inode)
 {
-        off_t         offset_expected = 0;
-        ssize_t       space_left      = 0;
 	wb_request_t *req             = NULL;
 	wb_request_t *tmp             = NULL;
+	wb_request_t *extent          = NULL;
+	wb_request_t *next            = NULL;
 	wb_request_t *holder          = NULL;
 	wb_conf_t    *conf            = NULL;
         int           ret             = 0;
 	ssize_t       page_size       = 0;
-
-	/* With asynchronous IO from a VM guest (as a file), there
-	   can be two sequential writes happening in two regions
-	   of the file. But individual (broken down) IO requests
-	   can arrive interleaved.
-
-	   TODO: cycle for each such sequence sifting
-	   through the interleaved ops
+	size_t        size            = 0;
+
+	/* Non-sync writes are kept in the extent map of the inode, where
+	   writes that overlap or are adjacent to one of them are merged
+	   into it. Random writes from VMs and databases often rewrite the
+	   same blocks, or fill a region in pieces and out of order, so
+	   several extents are kept open at a time. Every request is looked
+	   at once, in order of arrival.
 	*/
 
 	page_size = wb_inode->this->ctx->page_size;
 	conf = wb_inode->this->private;
 
         list_for_each_entry_safe (req, tmp, &wb_inode->todo, todo) {
+		if (req->ordering.seen)
+			continue;
+		req->ordering.seen = 1;
+
 		if (!req->ordering.tempted) {
-			if (holder) {
-				if (wb_requests_conflict (holder, req))
-					/* do not hold on write if a
-					   dependent write is in queue */
-					holder->ordering.go = 1;
+			/* do not hold on write if a
+			   dependent operation is in queue */
+			list_for_each_entry_safe (extent, next,
+						  &wb_inode->extents, extent) {
+				if (wb_requests_conflict (extent, req))
+					__wb_extent_close (wb_inode, extent);
 			}
 			/* collapse only non-sync writes */
 			continue;
-		} else if (!holder) {
-			/* holder is always a non-sync write */
-			holder = req;
-			continue;
 		}
 
-		offset_expected = holder->stub->args.offset
-			+ holder->write_size;
-
-		if (req->stub->args.offset != offset_expected) {
-			holder->ordering.go = 1;
-			holder = req;
+		holder = __wb_extent_lookup (wb_inode, req, page_size);
+		if (!holder) {
+			__wb_extent_open (wb_inode, req);
 			continue;
 		}
 
-		if (!is_same_lkowner (&req->lk_owner, &holder->lk_owner)) {
-			holder->ordering.go = 1;
-			holder = req;
-			continue;
-		}
+		size = holder->write_size;
 
-                if (req->fd != holder->fd) {
-                        holder->ordering.go = 1;
-                        holder = req;
-                        continue;
-                }
-
-		space_left = page_size - holder->write_size;
-
-		if (space_left < req->write_size) {
-			holder->ordering.go = 1;
-			holder = req;
+		ret = __wb_collapse_small_writes (holder, req);
+		if (ret) {
+			/* @req overlaps or follows @holder, which must go
+			   first */
+			__wb_extent_close (wb_inode, holder);
+			__wb_extent_open (wb_inode, req);
 			continue;
 		}
 
-		ret = __wb_collapse_small_writes (holder, req);
-		if (ret)
-			continue;
+		/* bytes of the extent @req wrote again are never sent,
+		   and so never shrink the window */
+		size = req->write_size - (holder->write_size - size);
+		wb_inode->window_current -= size;
+
+		__sync_fetch_and_add (&conf->stats.merged, 1);
+		__sync_fetch_and_add (&conf->stats.overwritten, size);
 
 		/* collapsed request is as good as wound
 		   (from its p.o.v)
@@ -1108,22 +1468,12 @@ __wb_preprocess_winds (wb_inode_t *wb_inode)
 		list_del_init (&req->todo);
 		__wb_fulfill_request (req);
 
-               /* Only the last @holder in queue which
-
-                  - does not have any non-buffered-writes following it
-                  - has not yet filled its capacity
-
-                  does not get its 'go' set, in anticipation of the arrival
-                  of consecutive smaller writes.
-               */
+		if (holder->write_size == page_size)
+			/* a full page */
+			__wb_extent_close (wb_inode, holder);
         }
 
-	/* but if trickling writes are enabled, then do not hold back
-	   writes if there are no outstanding requests
-	*/
-
-	if (conf->trickling_writes && !wb_inode->transit && holder)
-		holder->ordering.go = 1;
+	__wb_extents_flush (wb_inode);
 
         return;
 }
@@ -1959,7 +2309,9 @@ wb_priv_dump (xlator_t *this)
 {
         wb_conf_t      *conf                            = NULL;
         char            key_prefix[GF_DUMP_MAX_BUF_LEN] = {0, };
+        char            key[GF_DUMP_MAX_BUF_LEN]        = {0, };
         int             ret                             = -1;
+        int             i                               = 0;
 
         GF_VALIDATE_OR_GOTO ("write-behind", this, out);
 
@@ -1975,6 +2327,21 @@ wb_priv_dump (xlator_t *this)
         gf_proc_dump_write ("window_size", "%d", conf->window_size);
         gf_proc_dump_write ("flush_behind", "%d", conf->flush_behind);
         gf_proc_dump_write ("trickling_writes", "%d", conf->trickling_writes);
+        gf_proc_dump_write ("batch_window", "%u", conf->batch_window);
+
+        gf_proc_dump_write ("merged_writes", "%"PRIu64, conf->stats.merged);
+        gf_proc_dump_write ("overwritten_bytes", "%"PRIu64,
+                            conf->stats.overwritten);
+
+        for (i = 0; i < WB_SIZE_BUCKETS; i++) {
+                if (!conf->stats.size_in[i] && !conf->stats.size_out[i])
+                        continue;
+
+                snprintf (key, sizeof (key), "write_size.%lub+", 1UL << i);
+                gf_proc_dump_write (key, "in: %"PRIu64", out: %"PRIu64,
+                                    conf->stats.size_in[i],
+                                    conf->stats.size_out[i]);
+        }
 
         ret = 0;
 out:
@@ -2022,6 +2389,9 @@ __wb_dump_requests (struct list_head *head, char *prefix)
 
                         flag = req->ordering.go;
                         gf_proc_dump_write ("go", "%d", flag);
+
+                        if (!list_empty (&req->extent))
+                                gf_proc_dump_write ("extent", "open");
                 }
         }
 }
@@ -2066,6 +2436,8 @@ wb_inode_dump (xlator_t *this, inode_t *inode)
         gf_proc_dump_write ("window_current", "%"GF_PRI_SIZET,
                             wb_inode->window_current);
 
+        gf_proc_dump_write ("open_extents", "%d", wb_inode->extent_count);
+
 
         ret = TRY_LOCK (&wb_inode->lock);
         if (!ret)
@@ -2118,6 +2490,20 @@ reconfigure (xlator_t *this, dict_t *options)
 
         GF_OPTION_RECONF ("cache-size", conf->window_size, options, size_uint64, out);
 
+        GF_OPTION_RECONF ("aggregate-size", conf->aggregate_size, options,
+                          size_uint64, out);
+
+        if (conf->window_size < conf->aggregate_size) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "aggregate-size(%"PRIu64") cannot be more than "
+                        "window-size(%"PRIu64")", conf->aggregate_size,
+                        conf->window_size);
+                goto out;
+        }
+
+        GF_OPTION_RECONF ("batch-window", conf->batch_window, options, uint32,
+                          out);
+
         GF_OPTION_RECONF ("flush-behind", conf->flush_behind, options, bool,
                           out);
 
@@ -2160,7 +2546,10 @@ init (xlator_t *this)
         }
 
         /* configure 'options aggregate-size <size>' */
-        conf->aggregate_size = WB_AGGREGATE_SIZE;
+        GF_OPTION_INIT ("aggregate-size", conf->aggregate_size, size_uint64,
+                        out);
+
+        GF_OPTION_INIT ("batch-window", conf->batch_window, uint32, out);
 
         /* configure 'option window-size <size>' */
         GF_OPTION_INIT ("cache-size", conf->window_size, size_uint64, out);
@@ -2282,5 +2671,25 @@ struct volume_options options[] = {
 	  .description = "Do not let later writes overtake earlier writes even "
 	                  "if they do not overlap",
         },
+        { .key  = {"aggregate-size"},
+          .type = GF_OPTION_TYPE_SIZET,
+          .min  = 4 * GF_UNIT_KB,
+          .max  = 4 * GF_UNIT_MB,
+          .default_value = "128KB",
+          .description = "Largest write sent to the backend for writes which "
+                         "were cached. Adjacent cached writes are sent "
+                         "together up to this size, and never across a "
+                         "multiple of it."
+        },
+        { .key  = {"batch-window"},
+          .type = GF_OPTION_TYPE_INT,
+          .min  = 0,
+          .max  = 1000,
+          .default_value = "0",
+          .description = "Time in milliseconds a cached write waits for "
+                         "more writes to merge with, even when nothing else "
+                         "is being written (trickling-writes). 0 sends it as "
+                         "soon as nothing is in transit."
+        },
         { .key = {NULL} },
 };
@@ -15,6 +15,8 @@
 
 #include "client.h"
 #include "rpc-clnt.h"
+#include "defaults.h"
+#include "upcall-utils.h"
 
 int
 client_cbk_null (struct rpc_clnt *rpc, void *mydata, void *data)
@@ -40,10 +42,48 @@ client_cbk_ino_flush (struct rpc_clnt *rpc, void *mydata, void *data)
         return 0;
 }
 
+int
+client_cbk_cache_invalidation (struct rpc_clnt *rpc, void *mydata, void *data)
+{
+        xlator_t                              *this     = mydata;
+        struct iovec                          *iov      = data;
+        gfs3_cbk_cache_invalidation_req        req      = {{0,},};
+        struct gf_upcall                       upcall   = {0,};
+        struct gf_upcall_cache_invalidation    ca_data  = {0,};
+        int                                    ret      = -1;
+
+        ret = xdr_to_generic (*iov, &req,
+                              (xdrproc_t)xdr_gfs3_cbk_cache_invalidation_req);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "XDR decode of cache_invalidation failed");
+                goto out;
+        }
+
+        upcall.client_uid = NULL;
+        upcall.event_type = req.event_type;
+        memcpy (upcall.gfid, req.gfid, 16);
+
+        gf_log (this->name, GF_LOG_TRACE, "upcall for %s, flags 0x%x",
+                uuid_utoa (upcall.gfid), req.flags);
+
+        ca_data.flags = req.flags;
+        ca_data.expire_time_attr = req.expire_time_attr;
+        upcall.data = &ca_data;
+
+        default_notify (this, GF_EVENT_UPCALL, &upcall);
+        ret = 0;
+out:
+        return ret;
+}
+
 rpcclnt_cb_actor_t gluster_cbk_actors[GF_CBK_MAXVALUE] = {
         [GF_CBK_NULL]      = {"NULL",      GF_CBK_NULL,      client_cbk_null },
         [GF_CBK_FETCHSPEC] = {"FETCHSPEC", GF_CBK_FETCHSPEC, client_cbk_fetchspec },
         [GF_CBK_INO_FLUSH] = {"INO_FLUSH", GF_CBK_INO_FLUSH, client_cbk_ino_flush },
+        [GF_CBK_CACHE_INVALIDATION] = {"CACHE_INVALIDATION",
+                                       GF_CBK_CACHE_INVALIDATION,
+                                       client_cbk_cache_invalidation },
 };
 
 
@@ -110,7 +110,7 @@ int32_t client3_getspec (call_frame_t *frame, xlator_t *this, void *data)
         ret = client_submit_request (this, &req, frame, conf->handshake,
                                      GF_HNDSK_GETSPEC, client3_getspec_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gf_getspec_req);
+                                     (xdrproc_t)xdr_gf_getspec_req, NULL);
 
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING,
@@ -234,7 +234,7 @@ client_set_lk_version (xlator_t *this)
                                      GF_HNDSK_SET_LK_VER,
                                      client_set_lk_version_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gf_set_lk_ver_req);
+                                     (xdrproc_t)xdr_gf_set_lk_ver_req, NULL);
 out:
         GF_FREE (req.uid);
         return ret;
@@ -374,7 +374,8 @@ clnt_release_reopen_fd (xlator_t *this, clnt_fd_ctx_t *fdctx)
                                         GFS3_OP_RELEASE,
                                         clnt_release_reopen_fd_cbk, NULL,
                                         NULL, 0, NULL, 0, NULL,
-                                        (xdrproc_t)xdr_gfs3_releasedir_req);
+                                        (xdrproc_t)xdr_gfs3_releasedir_req,
+                                        NULL);
         return 0;
  out:
         if (ret) {
@@ -579,7 +580,7 @@ _client_reacquire_lock (xlator_t *this, clnt_fd_ctx_t *fdctx)
                                              conf->fops, GFS3_OP_LK,
                                              client_reacquire_lock_cbk,
                                              NULL, NULL, 0, NULL, 0, NULL,
-                                             (xdrproc_t)xdr_gfs3_lk_req);
+                                             (xdrproc_t)xdr_gfs3_lk_req, NULL);
                 if (ret) {
                         gf_log (this->name, GF_LOG_WARNING,
                                 "reacquiring locks failed on file with gfid %s",
@@ -872,7 +873,7 @@ protocol_client_reopendir (clnt_fd_ctx_t *fdctx, xlator_t *this)
                                      GFS3_OP_OPENDIR,
                                      client3_3_reopendir_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_opendir_req);
+                                     (xdrproc_t)xdr_gfs3_opendir_req, NULL);
         if (ret) {
                 gf_log (this->name, GF_LOG_ERROR,
                         "failed to send the re-opendir request");
@@ -936,7 +937,7 @@ protocol_client_reopenfile (clnt_fd_ctx_t *fdctx, xlator_t *this)
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_OPEN, client3_3_reopen_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_open_req);
+                                     (xdrproc_t)xdr_gfs3_open_req, NULL);
         if (ret) {
                 gf_log (this->name, GF_LOG_ERROR,
                         "failed to send the re-open request");
@@ -1380,7 +1381,7 @@ client_setvolume (xlator_t *this, struct rpc_clnt *rpc)
         ret = client_submit_request (this, &req, fr, conf->handshake,
                                      GF_HNDSK_SETVOLUME, client_setvolume_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gf_setvolume_req);
+                                     (xdrproc_t)xdr_gf_setvolume_req, NULL);
 
 fail:
         GF_FREE (req.dict.dict_val);
@@ -1576,7 +1577,8 @@ client_query_portmap (xlator_t *this, struct rpc_clnt *rpc)
                                      GF_PMAP_PORTBYBRICK,
                                      client_query_portmap_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_pmap_port_by_brick_req);
+                                     (xdrproc_t)xdr_pmap_port_by_brick_req,
+                                     NULL);
 
 fail:
         return ret;
@@ -1672,7 +1674,7 @@ client_handshake (xlator_t *this, struct rpc_clnt *rpc)
         ret = client_submit_request (this, &req, frame, conf->dump,
                                      GF_DUMP_DUMP, client_dump_version_cbk,
                                      NULL, NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gf_dump_req);
+                                     NULL, (xdrproc_t)xdr_gf_dump_req, NULL);
 
 out:
         return ret;
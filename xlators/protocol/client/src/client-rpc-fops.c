@@ -28,7 +28,8 @@ client_submit_vec_request (xlator_t  *this, void *req, call_frame_t  *frame,
                            rpc_clnt_prog_t *prog, int procnum,
                            fop_cbk_fn_t cbkfn,
                            struct iovec  *payload, int payloadcnt,
-                           struct iobref *iobref, xdrproc_t xdrproc)
+                           struct iobref *iobref, xdrproc_t xdrproc,
+                           dict_t *xdata)
 {
         int             ret        = 0;
         clnt_conf_t    *conf       = NULL;
@@ -42,7 +43,7 @@ client_submit_vec_request (xlator_t  *this, void *req, call_frame_t  *frame,
         conf = this->private;
 
         if (req && xdrproc) {
-                xdr_size = xdr_sizeof (xdrproc, req);
+                xdr_size = xdr_sizeof_xdata (xdrproc, req, xdata);
                 iobuf = iobuf_get2 (this->ctx->iobuf_pool, xdr_size);
                 if (!iobuf) {
                         goto unwind;
@@ -73,7 +74,7 @@ client_submit_vec_request (xlator_t  *this, void *req, call_frame_t  *frame,
                 iov.iov_len  = iobuf_size (iobuf);
 
                 /* Create the xdr payload */
-                ret = xdr_serialize_generic (iov, req, xdrproc);
+                ret = xdr_serialize_generic_xdata (iov, req, xdrproc, xdata);
                 if (ret == -1) {
                         gf_log_callingfn ("", GF_LOG_WARNING,
                                           "XDR function failed");
@@ -157,9 +158,9 @@ client3_3_symlink_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -228,9 +229,9 @@ client3_3_mknod_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -294,9 +295,9 @@ client3_3_mkdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -436,9 +437,9 @@ client3_3_open_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 }
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -493,9 +494,9 @@ client3_3_stat_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.stat, &iatt);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -547,9 +548,9 @@ client3_3_readlink_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.buf, &iatt);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -609,9 +610,9 @@ client3_3_unlink_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -669,9 +670,9 @@ client3_3_rmdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -726,9 +727,9 @@ client3_3_truncate_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -781,9 +782,9 @@ client3_3_statfs_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_statfs_to_statfs (&rsp.statfs, &statfs);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -840,9 +841,9 @@ client3_3_writev_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -901,9 +902,9 @@ client3_3_flush_cbk (struct rpc_req *req, struct iovec *iov, int count,
                         lkowner_utoa (&local->owner), ret);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -958,9 +959,9 @@ client3_3_fsync_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1008,9 +1009,9 @@ client3_3_setxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         op_errno = gf_error_to_errno (rsp.op_errno);
@@ -1065,15 +1066,15 @@ client3_3_getxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
 
         op_errno = gf_error_to_errno (rsp.op_errno);
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, dict,
+                                                  (rsp.dict.dict_val),
+                                                  (rsp.dict.dict_len), rsp.op_ret,
+                                                  op_errno, out);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1138,14 +1139,14 @@ client3_3_fgetxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
 
         op_errno = gf_error_to_errno (rsp.op_errno);
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, dict,
+                                                  (rsp.dict.dict_val),
+                                                  (rsp.dict.dict_len), rsp.op_ret,
+                                                  op_errno, out);
         }
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1201,9 +1202,9 @@ client3_3_removexattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1251,9 +1252,9 @@ client3_3_fremovexattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1299,9 +1300,9 @@ client3_3_fsyncdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1347,9 +1348,9 @@ client3_3_access_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1403,9 +1404,9 @@ client3_3_ftruncate_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1457,9 +1458,9 @@ client3_3_fstat_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.stat, &stat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1506,9 +1507,9 @@ client3_3_inodelk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -1556,9 +1557,9 @@ client3_3_finodelk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -1608,9 +1609,9 @@ client3_3_entrylk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -1658,9 +1659,9 @@ client3_3_fentrylk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -1714,15 +1715,15 @@ client3_3_xattrop_cbk (struct rpc_req *req, struct iovec *iov, int count,
 
         op_errno = rsp.op_errno;
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, dict,
+                                                  (rsp.dict.dict_val),
+                                                  (rsp.dict.dict_len), rsp.op_ret,
+                                                  op_errno, out);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1781,16 +1782,16 @@ client3_3_fxattrop_cbk (struct rpc_req *req, struct iovec *iov, int count,
         }
         op_errno = rsp.op_errno;
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, dict,
+                                                  (rsp.dict.dict_val),
+                                                  (rsp.dict.dict_len), rsp.op_ret,
+                                                  op_errno, out);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, xdata,
-                                      (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), rsp.op_ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, xdata,
+                                          (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), rsp.op_ret,
+                                          op_errno, out);
 out:
 
         if (rsp.op_ret == -1) {
@@ -1845,9 +1846,9 @@ client3_3_fsetxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         op_errno = gf_error_to_errno (rsp.op_errno);
@@ -1903,9 +1904,9 @@ client3_3_fsetattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1959,9 +1960,9 @@ client3_3_fallocate_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2014,9 +2015,9 @@ client3_3_discard_cbk(struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2069,9 +2070,9 @@ client3_3_zerofill_cbk(struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2127,9 +2128,9 @@ client3_3_setattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2200,9 +2201,9 @@ client3_3_create_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 }
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2254,9 +2255,9 @@ client3_3_rchecksum_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2332,9 +2333,9 @@ client3_3_lk_cbk (struct rpc_req *req, struct iovec *iov, int count,
         }
         */
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -2393,10 +2394,10 @@ client3_3_readdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 unserialize_rsp_dirent (&rsp, &entries);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, xdata,
-                                      (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), rsp.op_ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, xdata,
+                                          (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), rsp.op_ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2459,9 +2460,9 @@ client3_3_readdirp_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 unserialize_rsp_direntp (this, local->fd, &rsp, &entries);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2529,9 +2530,9 @@ client3_3_rename_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postnewparent, &postnewparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2595,9 +2596,9 @@ client3_3_link_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2665,9 +2666,9 @@ client3_3_opendir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 }
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2732,9 +2733,10 @@ client3_3_lookup_cbk (struct rpc_req *req, struct iovec *iov, int count,
         rsp.op_ret = -1;
         gf_stat_to_iatt (&rsp.stat, &stbuf);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), rsp.op_ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->this, xdata,
+                                          (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), rsp.op_ret,
+                                          op_errno, out);
 
         if ((!uuid_is_null (inode->gfid))
             && (uuid_compare (stbuf.ia_gfid, inode->gfid) != 0)) {
@@ -2821,9 +2823,9 @@ client3_3_readv_cbk (struct rpc_req *req, struct iovec *iov, int count,
                         vector[0].iov_base = req->rsp[1].iov_base;
                 rspcount = 1;
         }
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (this, xdata, (rsp.xdata.xdata_val),
+                                          (rsp.xdata.xdata_len), ret,
+                                          rsp.op_errno, out);
 
 #ifdef GF_TESTING_IO_XDATA
         dict_dump (xdata);
@@ -2921,7 +2923,8 @@ client_fdctx_destroy (xlator_t *this, clnt_fd_ctx_t *fdctx)
                                        GFS3_OP_RELEASEDIR,
                                        client3_3_releasedir_cbk,
                                        NULL, NULL, 0, NULL, 0, NULL,
-                                       (xdrproc_t)xdr_gfs3_releasedir_req);
+                                       (xdrproc_t)xdr_gfs3_releasedir_req,
+                                       NULL);
         } else {
                 gfs3_release_req  req = {{0,},};
                 req.fd = fdctx->remote_fd;
@@ -2930,7 +2933,7 @@ client_fdctx_destroy (xlator_t *this, clnt_fd_ctx_t *fdctx)
                                        GFS3_OP_RELEASE,
                                        client3_3_release_cbk, NULL,
                                        NULL, 0, NULL, 0, NULL,
-                                       (xdrproc_t)xdr_gfs3_release_req);
+                                       (xdrproc_t)xdr_gfs3_release_req, NULL);
         }
 
         rpc_clnt_unref (conf->rpc);
@@ -3107,10 +3110,6 @@ client3_3_lookup (call_frame_t *frame, xlator_t *this,
                         rsp_iobref = NULL;
                 }
 
-                GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata,
-                                            (&req.xdata.xdata_val),
-                                            req.xdata.xdata_len,
-                                            op_errno, unwind);
         }
 
         if (args->loc->name)
@@ -3122,14 +3121,13 @@ client3_3_lookup (call_frame_t *frame, xlator_t *this,
                                      GFS3_OP_LOOKUP, client3_3_lookup_cbk,
                                      NULL, rsphdr, count,
                                      NULL, 0, local->iobref,
-                                     (xdrproc_t)xdr_gfs3_lookup_req);
+                                     (xdrproc_t)xdr_gfs3_lookup_req,
+                                     args->xdata);
 
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         if (rsp_iobref)
                 iobref_unref (rsp_iobref);
 
@@ -3142,8 +3140,6 @@ unwind:
         CLIENT_STACK_UNWIND (lookup, frame, -1, op_errno, NULL, NULL, NULL,
                              NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         if (rsp_iobref)
                 iobref_unref (rsp_iobref);
 
@@ -3180,25 +3176,19 @@ client3_3_stat (call_frame_t *frame, xlator_t *this,
                                        unwind, op_errno, EINVAL);
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_STAT, client3_3_stat_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_stat_req);
+                                     (xdrproc_t)xdr_gfs3_stat_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (stat, frame, -1, op_errno, NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -3233,24 +3223,19 @@ client3_3_truncate (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_TRUNCATE,
                                      client3_3_truncate_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_truncate_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_truncate_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (truncate, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3281,24 +3266,19 @@ client3_3_ftruncate (call_frame_t *frame, xlator_t *this,
         req.fd     = remote_fd;
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FTRUNCATE,
                                      client3_3_ftruncate_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_ftruncate_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_ftruncate_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (ftruncate, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3335,24 +3315,19 @@ client3_3_access (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_ACCESS,
                                      client3_3_access_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_access_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_access_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (access, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3400,9 +3375,6 @@ client3_3_readlink (call_frame_t *frame, xlator_t *this,
 
         frame->local = local;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         rsp_iobref = iobref_new ();
         if (rsp_iobref == NULL) {
                 goto unwind;
@@ -3428,13 +3400,12 @@ client3_3_readlink (call_frame_t *frame, xlator_t *this,
                                      client3_3_readlink_cbk, NULL,
                                      rsphdr, count, NULL, 0,
                                      local->iobref,
-                                     (xdrproc_t)xdr_gfs3_readlink_req);
+                                     (xdrproc_t)xdr_gfs3_readlink_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         if (rsp_iobref != NULL) {
@@ -3442,7 +3413,6 @@ unwind:
         }
 
         CLIENT_STACK_UNWIND (readlink, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3479,24 +3449,19 @@ client3_3_unlink (call_frame_t *frame, xlator_t *this,
         req.bname = (char *)args->loc->name;
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_UNLINK,
                                      client3_3_unlink_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_unlink_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_unlink_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (unlink, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3533,22 +3498,18 @@ client3_3_rmdir (call_frame_t *frame, xlator_t *this,
         req.xflags = args->flags;
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_RMDIR, client3_3_rmdir_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_rmdir_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_rmdir_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (rmdir, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3599,27 +3560,21 @@ client3_3_symlink (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_SYMLINK, client3_3_symlink_cbk,
                                      NULL,  NULL, 0, NULL,
-                                     0, NULL, (xdrproc_t)xdr_gfs3_symlink_req);
+                                     0, NULL, (xdrproc_t)xdr_gfs3_symlink_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
 
         CLIENT_STACK_UNWIND (symlink, frame, -1, op_errno, NULL, NULL, NULL,
                              NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -3664,26 +3619,20 @@ client3_3_rename (call_frame_t *frame, xlator_t *this,
         req.newbname = (char *)args->newloc->name;
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_RENAME, client3_3_rename_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_rename_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_rename_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (rename, frame, -1, op_errno, NULL, NULL, NULL,
                              NULL, NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -3740,23 +3689,18 @@ client3_3_link (call_frame_t *frame, xlator_t *this,
         req.newbname = (char *)args->newloc->name;
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_LINK, client3_3_link_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_link_req);
+                                     (xdrproc_t)xdr_gfs3_link_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (link, frame, -1, op_errno, NULL, NULL, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -3807,25 +3751,20 @@ client3_3_mknod (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_MKNOD, client3_3_mknod_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_mknod_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_mknod_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (mknod, frame, -1, op_errno, NULL, NULL, NULL,
                              NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -3875,25 +3814,20 @@ client3_3_mkdir (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_MKDIR, client3_3_mkdir_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_mkdir_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_mkdir_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (mkdir, frame, -1, op_errno, NULL, NULL, NULL,
                              NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -3945,26 +3879,20 @@ client3_3_create (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_CREATE, client3_3_create_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_create_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_create_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (create, frame, -1, op_errno, NULL, NULL, NULL,
                              NULL, NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4013,25 +3941,19 @@ client3_3_open (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_OPEN, client3_3_open_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_open_req);
+                                     (xdrproc_t)xdr_gfs3_open_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (open, frame, -1, op_errno, NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4106,21 +4028,17 @@ client3_3_readv (call_frame_t *frame, xlator_t *this,
         local->iobref = rsp_iobref;
         rsp_iobref = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_READ, client3_3_readv_cbk, NULL,
                                      NULL, 0, &rsp_vec, 1,
                                      local->iobref,
-                                     (xdrproc_t)xdr_gfs3_read_req);
+                                     (xdrproc_t)xdr_gfs3_read_req,
+                                     args->xdata);
         if (ret) {
                 //unwind is done in the cbk
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         if (rsp_iobuf)
@@ -4130,7 +4048,6 @@ unwind:
                 iobref_unref (rsp_iobref);
 
         CLIENT_STACK_UNWIND (readv, frame, -1, op_errno, NULL, 0, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4175,14 +4092,12 @@ client3_3_writev (call_frame_t *frame, xlator_t *this, void *data)
                             "testing-the-xdata-value");
 #endif
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_vec_request (this, &req, frame, conf->fops,
                                          GFS3_OP_WRITE, client3_3_writev_cbk,
                                          args->vector, args->count,
                                          args->iobref,
-                                         (xdrproc_t)xdr_gfs3_write_req);
+                                         (xdrproc_t)xdr_gfs3_write_req,
+                                         args->xdata);
         if (ret) {
                 /*
                  * If the lower layers fail to submit a request, they'll also
@@ -4192,13 +4107,10 @@ client3_3_writev (call_frame_t *frame, xlator_t *this, void *data)
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (writev, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4240,25 +4152,20 @@ client3_3_flush (call_frame_t *frame, xlator_t *this,
         req.fd = remote_fd;
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FLUSH, client3_3_flush_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_flush_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_flush_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
 
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (flush, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4289,25 +4196,20 @@ client3_3_fsync (call_frame_t *frame, xlator_t *this,
         req.data = args->flags;
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FSYNC, client3_3_fsync_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_fsync_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_fsync_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
 
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (fsync, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4337,24 +4239,19 @@ client3_3_fstat (call_frame_t *frame, xlator_t *this,
         req.fd = remote_fd;
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FSTAT, client3_3_fstat_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_fstat_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_fstat_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (fstat, frame, -1, op_errno, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4402,26 +4299,20 @@ client3_3_opendir (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_OPENDIR, client3_3_opendir_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_opendir_req);
+                                     (xdrproc_t)xdr_gfs3_opendir_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (opendir, frame, -1, op_errno, NULL, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4452,25 +4343,20 @@ client3_3_fsyncdir (call_frame_t *frame, xlator_t *this, void *data)
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FSYNCDIR, client3_3_fsyncdir_cbk,
                                      NULL, NULL, 0,
                                      NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_fsyncdir_req);
+                                     (xdrproc_t)xdr_gfs3_fsyncdir_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (fsyncdir, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4509,24 +4395,19 @@ client3_3_statfs (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_STATFS, client3_3_statfs_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_statfs_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_statfs_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 
 unwind:
         CLIENT_STACK_UNWIND (statfs, frame, -1, op_errno, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -4570,27 +4451,21 @@ client3_3_setxattr (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_SETXATTR, client3_3_setxattr_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_setxattr_req);
+                                     (xdrproc_t)xdr_gfs3_setxattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
         GF_FREE (req.dict.dict_val);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (setxattr, frame, -1, op_errno, NULL);
         GF_FREE (req.dict.dict_val);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4627,28 +4502,22 @@ client3_3_fsetxattr (call_frame_t *frame, xlator_t *this,
                                             op_errno, unwind);
         }
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FSETXATTR, client3_3_fsetxattr_cbk,
                                      NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_fsetxattr_req);
+                                     (xdrproc_t)xdr_gfs3_fsetxattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
         GF_FREE (req.dict.dict_val);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (fsetxattr, frame, -1, op_errno, NULL);
         GF_FREE (req.dict.dict_val);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4721,21 +4590,17 @@ client3_3_fgetxattr (call_frame_t *frame, xlator_t *this,
         }
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FGETXATTR,
                                      client3_3_fgetxattr_cbk, NULL,
                                      rsphdr, count,
                                      NULL, 0, local->iobref,
-                                     (xdrproc_t)xdr_gfs3_fgetxattr_req);
+                                     (xdrproc_t)xdr_gfs3_fgetxattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         if (rsp_iobuf)
                 iobuf_unref (rsp_iobuf);
 
@@ -4752,8 +4617,6 @@ unwind:
         if (rsp_iobref)
                 iobref_unref (rsp_iobref);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4862,21 +4725,17 @@ client3_3_getxattr (call_frame_t *frame, xlator_t *this,
                 }
         }
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_GETXATTR,
                                      client3_3_getxattr_cbk, NULL,
                                      rsphdr, count,
                                      NULL, 0, local->iobref,
-                                     (xdrproc_t)xdr_gfs3_getxattr_req);
+                                     (xdrproc_t)xdr_gfs3_getxattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         if (rsp_iobuf)
                 iobuf_unref (rsp_iobuf);
 
@@ -4893,8 +4752,6 @@ unwind:
 
         CLIENT_STACK_UNWIND (getxattr, frame, op_ret, op_errno, dict, NULL);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -4976,23 +4833,19 @@ client3_3_xattrop (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_XATTROP,
                                      client3_3_xattrop_cbk, NULL,
                                      rsphdr, count,
                                      NULL, 0, local->iobref,
-                                     (xdrproc_t)xdr_gfs3_xattrop_req);
+                                     (xdrproc_t)xdr_gfs3_xattrop_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
         GF_FREE (req.dict.dict_val);
 
-        GF_FREE (req.xdata.xdata_val);
-
         if (rsp_iobuf)
                 iobuf_unref (rsp_iobuf);
 
@@ -5011,8 +4864,6 @@ unwind:
         if (rsp_iobref)
                 iobref_unref (rsp_iobref);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -5085,23 +4936,19 @@ client3_3_fxattrop (call_frame_t *frame, xlator_t *this,
                                             op_errno, unwind);
         }
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FXATTROP,
                                      client3_3_fxattrop_cbk, NULL,
                                      rsphdr, count,
                                      NULL, 0, local->iobref,
-                                     (xdrproc_t)xdr_gfs3_fxattrop_req);
+                                     (xdrproc_t)xdr_gfs3_fxattrop_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
         GF_FREE (req.dict.dict_val);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (fxattrop, frame, -1, op_errno, NULL, NULL);
@@ -5114,8 +4961,6 @@ unwind:
         if (rsp_iobuf)
                 iobuf_unref (rsp_iobuf);
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 }
 
@@ -5150,24 +4995,19 @@ client3_3_removexattr (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_REMOVEXATTR,
                                      client3_3_removexattr_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_removexattr_req);
+                                     (xdrproc_t)xdr_gfs3_removexattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (removexattr, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5200,24 +5040,19 @@ client3_3_fremovexattr (call_frame_t *frame, xlator_t *this,
         req.name = (char *)args->name;
         req.fd = remote_fd;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FREMOVEXATTR,
                                      client3_3_fremovexattr_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_fremovexattr_req);
+                                     (xdrproc_t)xdr_gfs3_fremovexattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (fremovexattr, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5282,23 +5117,18 @@ client3_3_lk (call_frame_t *frame, xlator_t *this,
 
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops, GFS3_OP_LK,
                                      client3_3_lk_cbk, NULL,
                                      NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gfs3_lk_req);
+                                     (xdrproc_t)xdr_gfs3_lk_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (lk, frame, -1, op_errno, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5363,24 +5193,19 @@ client3_3_inodelk (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_INODELK,
                                      client3_3_inodelk_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_inodelk_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_inodelk_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (inodelk, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5444,23 +5269,19 @@ client3_3_finodelk (call_frame_t *frame, xlator_t *this,
         gf_proto_flock_from_flock (&req.flock, args->flock);
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FINODELK,
                                      client3_3_finodelk_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_finodelk_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_finodelk_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (finodelk, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5503,24 +5324,19 @@ client3_3_entrylk (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_ENTRYLK,
                                      client3_3_entrylk_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_entrylk_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_entrylk_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (entrylk, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5558,24 +5374,19 @@ client3_3_fentrylk (call_frame_t *frame, xlator_t *this,
         }
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FENTRYLK,
                                      client3_3_fentrylk_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_fentrylk_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_fentrylk_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (fentrylk, frame, -1, op_errno, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5605,25 +5416,20 @@ client3_3_rchecksum (call_frame_t *frame, xlator_t *this,
         req.offset = args->offset;
         req.fd     = remote_fd;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_RCHECKSUM,
                                      client3_3_rchecksum_cbk, NULL,
                                      NULL, 0, NULL,
                                      0, NULL,
-                                     (xdrproc_t)xdr_gfs3_rchecksum_req);
+                                     (xdrproc_t)xdr_gfs3_rchecksum_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (rchecksum, frame, -1, op_errno, 0, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5702,22 +5508,19 @@ client3_3_readdir (call_frame_t *frame, xlator_t *this,
         local->cmd = remote_fd;
 
         memcpy (req.gfid, args->fd->inode->gfid, 16);
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
 
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_READDIR,
                                      client3_3_readdir_cbk, NULL,
                                      rsphdr, count,
                                      NULL, 0, rsp_iobref,
-                                     (xdrproc_t)xdr_gfs3_readdir_req);
+                                     (xdrproc_t)xdr_gfs3_readdir_req,
+                                     args->xdata);
 
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         if (rsp_iobuf)
                 iobuf_unref (rsp_iobuf);
 
@@ -5734,7 +5537,6 @@ unwind:
                 iobuf_unref (rsp_iobuf);
 
         CLIENT_STACK_UNWIND (readdir, frame, -1, op_errno, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5822,7 +5624,7 @@ client3_3_readdirp (call_frame_t *frame, xlator_t *this,
                                      client3_3_readdirp_cbk, NULL,
                                      rsphdr, count, NULL,
                                      0, rsp_iobref,
-                                     (xdrproc_t)xdr_gfs3_readdirp_req);
+                                     (xdrproc_t)xdr_gfs3_readdirp_req, NULL);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
@@ -5881,24 +5683,19 @@ client3_3_setattr (call_frame_t *frame, xlator_t *this,
 
         conf = this->private;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_SETATTR,
                                      client3_3_setattr_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_setattr_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_setattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (setattr, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5926,24 +5723,19 @@ client3_3_fsetattr (call_frame_t *frame, xlator_t *this, void *data)
         req.valid = args->valid;
         gf_stat_from_iatt (&req.stbuf, args->stbuf);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FSETATTR,
                                      client3_3_fsetattr_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_fsetattr_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_fsetattr_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (fsetattr, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -5973,24 +5765,19 @@ client3_3_fallocate(call_frame_t *frame, xlator_t *this, void *data)
 	req.size = args->size;
 	memcpy(req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request (this, &req, frame, conf->fops,
                                      GFS3_OP_FALLOCATE,
                                      client3_3_fallocate_cbk, NULL,
                                      NULL, 0, NULL, 0,
-                                     NULL, (xdrproc_t)xdr_gfs3_fallocate_req);
+                                     NULL, (xdrproc_t)xdr_gfs3_fallocate_req,
+                                     args->xdata);
         if (ret) {
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
         }
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND (fallocate, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -6019,22 +5806,16 @@ client3_3_discard(call_frame_t *frame, xlator_t *this, void *data)
 	req.size = args->size;
 	memcpy(req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request(this, &req, frame, conf->fops,
                                     GFS3_OP_DISCARD, client3_3_discard_cbk,
 				    NULL, NULL, 0, NULL, 0, NULL,
-                                    (xdrproc_t) xdr_gfs3_discard_req);
+                                    (xdrproc_t) xdr_gfs3_discard_req, NULL);
         if (ret)
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND(discard, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
@@ -6065,22 +5846,16 @@ client3_3_zerofill(call_frame_t *frame, xlator_t *this, void *data)
         req.size = args->size;
         memcpy(req.gfid, args->fd->inode->gfid, 16);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
-                                    req.xdata.xdata_len, op_errno, unwind);
-
         ret = client_submit_request(this, &req, frame, conf->fops,
                                     GFS3_OP_ZEROFILL, client3_3_zerofill_cbk,
                                     NULL, NULL, 0, NULL, 0, NULL,
-                                    (xdrproc_t) xdr_gfs3_zerofill_req);
+                                    (xdrproc_t) xdr_gfs3_zerofill_req, NULL);
         if (ret)
                 gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
 
-        GF_FREE (req.xdata.xdata_val);
-
         return 0;
 unwind:
         CLIENT_STACK_UNWIND(zerofill, frame, -1, op_errno, NULL, NULL, NULL);
-        GF_FREE (req.xdata.xdata_val);
 
         return 0;
 }
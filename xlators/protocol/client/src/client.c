@@ -20,6 +20,7 @@
 #include "glusterfs.h"
 #include "statedump.h"
 #include "compat-errno.h"
+#include "event.h"
 
 #include "xdr-rpc.h"
 #include "glusterfs3.h"
@@ -148,7 +149,7 @@ client_submit_request (xlator_t *this, void *req, call_frame_t *frame,
                        struct iobref *iobref,  struct iovec *rsphdr,
                        int rsphdr_count, struct iovec *rsp_payload,
                        int rsp_payload_count, struct iobref *rsp_iobref,
-                       xdrproc_t xdrproc)
+                       xdrproc_t xdrproc, dict_t *xdata)
 {
         int             ret        = -1;
         clnt_conf_t    *conf       = NULL;
@@ -183,7 +184,7 @@ client_submit_request (xlator_t *this, void *req, call_frame_t *frame,
        }
 
         if (req && xdrproc) {
-                xdr_size = xdr_sizeof (xdrproc, req);
+                xdr_size = xdr_sizeof_xdata (xdrproc, req, xdata);
                 iobuf = iobuf_get2 (this->ctx->iobuf_pool, xdr_size);
                 if (!iobuf) {
                         goto out;
@@ -213,8 +214,9 @@ client_submit_request (xlator_t *this, void *req, call_frame_t *frame,
                 iov.iov_base = iobuf->ptr;
                 iov.iov_len  = iobuf_size (iobuf);
 
-                /* Create the xdr payload */
-                ret = xdr_serialize_generic (iov, req, xdrproc);
+                /* Create the xdr payload, xdata (if any) is written
+                   straight into its tail */
+                ret = xdr_serialize_generic_xdata (iov, req, xdrproc, xdata);
                 if (ret == -1) {
                         /* callingfn so that, we can get to know which xdr
                            function was called */
@@ -2368,6 +2370,10 @@ build_client_config (xlator_t *this, clnt_conf_t *conf)
 
         GF_OPTION_INIT ("send-gids", conf->send_gids, bool, out);
 
+        GF_OPTION_INIT ("event-threads", conf->event_threads, int32, out);
+        event_request_threads (this->ctx->event_pool, EVENT_THREADS_CLIENT,
+                               conf->event_threads);
+
         ret = client_check_remote_host (this, this->options);
         if (ret)
                 goto out;
@@ -2565,6 +2571,11 @@ reconfigure (xlator_t *this, dict_t *options)
 
         GF_OPTION_RECONF ("send-gids", conf->send_gids, options, bool, out);
 
+        GF_OPTION_RECONF ("event-threads", conf->event_threads, options,
+                          int32, out);
+        event_request_threads (this->ctx->event_pool, EVENT_THREADS_CLIENT,
+                               conf->event_threads);
+
         ret = client_init_grace_timer (this, options, conf);
         if (ret)
                 goto out;
@@ -2933,5 +2944,15 @@ struct volume_options options[] = {
           .type  = GF_OPTION_TYPE_BOOL,
           .default_value = "on",
         },
+        { .key   = {"event-threads"},
+          .type  = GF_OPTION_TYPE_INT,
+          .min   = 1,
+          .max   = 32,
+          .default_value = "1",
+          .description = "Specifies the number of event threads to execute "
+                         "in parallel. Larger values would help process "
+                         "responses faster, depending on available processing "
+                         "power. Range 1-32 threads."
+        },
         { .key   = {NULL} },
 };
@@ -127,6 +127,8 @@ typedef struct clnt_conf {
         uint64_t               setvol_count;
 
         gf_boolean_t           send_gids; /* let the server resolve gids */
+
+        int                    event_threads; /* # of epoll dispatchers */
 } clnt_conf_t;
 
 typedef struct _client_fd_ctx {
@@ -222,7 +224,8 @@ int client_submit_request (xlator_t *this, void *req,
                            struct iobref *iobref,
                            struct iovec *rsphdr, int rsphdr_count,
                            struct iovec *rsp_payload, int rsp_count,
-                           struct iobref *rsp_iobref, xdrproc_t xdrproc);
+                           struct iobref *rsp_iobref, xdrproc_t xdrproc,
+                           dict_t *xdata);
 
 int unserialize_rsp_dirent (struct gfs3_readdir_rsp *rsp, gf_dirent_t *entries);
 int unserialize_rsp_direntp (xlator_t *this, fd_t *fd,
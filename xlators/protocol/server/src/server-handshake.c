@@ -319,7 +319,7 @@ fail:
                 close (spec_fd);
 
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_getspec_rsp);
+                             (xdrproc_t)xdr_gf_getspec_rsp, NULL);
 
         return 0;
 }
@@ -693,7 +693,7 @@ fail:
                 req->trans->xl_private = NULL;
         }
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_setvolume_rsp);
+                             (xdrproc_t)xdr_gf_setvolume_rsp, NULL);
 
 
         free (args.dict.dict_val);
@@ -719,7 +719,7 @@ server_ping (rpcsvc_request_t *req)
         rsp.op_ret = 0;
 
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
+                             (xdrproc_t)xdr_gf_common_rsp, NULL);
 
         return 0;
 }
@@ -767,7 +767,7 @@ fail:
         rsp.op_ret   = op_ret;
         rsp.op_errno = op_errno;
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_set_lk_ver_rsp);
+                             (xdrproc_t)xdr_gf_set_lk_ver_rsp, NULL);
 
         free (args.uid);
 
@@ -75,9 +75,6 @@ server_statfs_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         gfs3_statfs_rsp      rsp    = {0,};
         rpcsvc_request_t    *req    = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 gf_log (this->name, GF_LOG_WARNING, "%"PRId64": STATFS (%s)",
                         frame->root->unique, strerror (op_errno));
@@ -92,9 +89,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_statfs_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_statfs_rsp,
+                             xdata);
 
         return 0;
 }
@@ -132,9 +128,6 @@ server_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
         gf_stat_from_iatt (&rsp.postparent, postparent);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 if (state->is_revalidate && op_errno == ENOENT) {
                         if (!__is_root_gfid (state->resolve.gfid)) {
@@ -193,9 +186,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_lookup_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_lookup_rsp,
+                             xdata);
 
         return 0;
 }
@@ -210,9 +202,6 @@ server_lk_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_LK, op_errno),
@@ -248,9 +237,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_lk_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_lk_rsp,
+                             xdata);
 
         return 0;
 }
@@ -264,9 +252,6 @@ server_inodelk_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t   *state     = NULL;
         rpcsvc_request_t *req       = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -284,9 +269,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -300,9 +284,6 @@ server_finodelk_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t   *state     = NULL;
         rpcsvc_request_t *req       = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -321,9 +302,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -336,9 +316,6 @@ server_entrylk_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t   *state     = NULL;
         rpcsvc_request_t *req       = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -356,9 +333,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -372,9 +348,6 @@ server_fentrylk_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t   *state     = NULL;
         rpcsvc_request_t *req       = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -392,9 +365,8 @@ out:
 
         req   = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -408,9 +380,6 @@ server_access_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -427,9 +396,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -444,9 +412,6 @@ server_rmdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         inode_t             *parent = NULL;
         rpcsvc_request_t    *req    = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret) {
@@ -479,9 +444,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_rmdir_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_rmdir_rsp,
+                             xdata);
 
         return 0;
 }
@@ -497,9 +461,6 @@ server_mkdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         inode_t             *link_inode = NULL;
         rpcsvc_request_t    *req        = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -526,9 +487,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_mkdir_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_mkdir_rsp,
+                             xdata);
 
         return 0;
 }
@@ -544,9 +504,6 @@ server_mknod_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         inode_t             *link_inode = NULL;
         rpcsvc_request_t    *req        = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -573,9 +530,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_mknod_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_mknod_rsp,
+                             xdata);
 
         return 0;
 }
@@ -588,9 +544,6 @@ server_fsyncdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -607,9 +560,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -624,9 +576,6 @@ server_readdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         int                  ret   = 0;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -653,9 +602,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_readdir_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_readdir_rsp,
+                             xdata);
 
         readdir_rsp_cleanup (&rsp);
 
@@ -672,9 +620,6 @@ server_opendir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         gfs3_opendir_rsp     rsp      = {0,};
         uint64_t             fd_no    = 0;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_OPENDIR, op_errno),
@@ -701,9 +646,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_opendir_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_opendir_rsp,
+                             xdata);
 
         return 0;
 }
@@ -716,9 +660,6 @@ server_removexattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret == -1) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -735,9 +676,8 @@ out:
 
         req   = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -750,9 +690,6 @@ server_fremovexattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret == -1) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -769,9 +706,8 @@ out:
 
         req   = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -785,9 +721,6 @@ server_getxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret == -1) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_GETXATTR, op_errno),
@@ -807,12 +740,11 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_getxattr_rsp);
+                             (xdrproc_t)xdr_gfs3_getxattr_rsp,
+                             xdata);
 
         GF_FREE (rsp.dict.dict_val);
 
-        GF_FREE (rsp.xdata.xdata_val);
-
         return 0;
 }
 
@@ -826,9 +758,6 @@ server_fgetxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret == -1) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_FGETXATTR, op_errno),
@@ -849,12 +778,11 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_fgetxattr_rsp);
+                             (xdrproc_t)xdr_gfs3_fgetxattr_rsp,
+                             xdata);
 
         GF_FREE (rsp.dict.dict_val);
 
-        GF_FREE (rsp.xdata.xdata_val);
-
         return 0;
 }
 
@@ -884,9 +812,6 @@ server_setxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t *req = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret == -1) {
                 state = CALL_STATE (frame);
                 if (op_errno != ENOTSUP)
@@ -906,9 +831,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -940,9 +864,6 @@ server_fsetxattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t *req = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret == -1) {
                 state = CALL_STATE (frame);
                 if (op_errno != ENOTSUP) {
@@ -962,9 +883,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -984,9 +904,6 @@ server_rename_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         char         oldpar_str[50]     = {0,};
         char         newpar_str[50]     = {0,};
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret == -1) {
@@ -1047,9 +964,8 @@ out:
 
         req   = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_rename_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_rename_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1064,9 +980,6 @@ server_unlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         inode_t             *parent = NULL;
         rpcsvc_request_t    *req    = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret) {
@@ -1101,9 +1014,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_unlink_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_unlink_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1119,9 +1031,6 @@ server_symlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         inode_t             *link_inode = NULL;
         rpcsvc_request_t    *req        = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -1148,9 +1057,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_symlink_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_symlink_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1169,9 +1077,6 @@ server_link_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         char              gfid_str[50]   = {0,};
         char              newpar_str[50] = {0,};
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret) {
@@ -1200,9 +1105,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_link_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_link_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1216,9 +1120,6 @@ server_truncate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1237,9 +1138,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_truncate_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_truncate_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1253,9 +1153,6 @@ server_fstat_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1273,9 +1170,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_fstat_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_fstat_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1289,9 +1185,6 @@ server_ftruncate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1310,9 +1203,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_ftruncate_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_ftruncate_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1325,9 +1217,6 @@ server_flush_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_FLUSH, op_errno),
@@ -1343,9 +1232,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gf_common_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1359,9 +1247,6 @@ server_fsync_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1380,9 +1265,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_fsync_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_fsync_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1396,9 +1280,6 @@ server_writev_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1417,9 +1298,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_write_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_write_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1445,8 +1325,6 @@ server_readv_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                                        "testing-xdata-value");
         }
 #endif
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
 
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
@@ -1466,9 +1344,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, vector, count, iobref,
-                             (xdrproc_t)xdr_gfs3_read_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_read_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1483,9 +1360,6 @@ server_rchecksum_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         rpcsvc_request_t    *req   = NULL;
         server_state_t      *state = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1506,9 +1380,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_rchecksum_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_rchecksum_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1524,9 +1397,6 @@ server_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         uint64_t             fd_no    = 0;
         gfs3_open_rsp        rsp      = {0,};
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_OPEN, op_errno),
@@ -1554,8 +1424,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_open_rsp);
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_open_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1574,9 +1444,6 @@ server_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         uint64_t             fd_no      = 0;
         gfs3_create_rsp      rsp        = {0,};
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         state = CALL_STATE (frame);
 
         if (op_ret < 0) {
@@ -1642,9 +1509,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_create_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_create_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1658,9 +1524,6 @@ server_readlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1683,9 +1546,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_readlink_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_readlink_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1699,9 +1561,6 @@ server_stat_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state  = CALL_STATE (frame);
                 gf_log (this->name, fop_log_level (GF_FOP_STAT, op_errno),
@@ -1720,9 +1579,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_stat_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_stat_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1737,9 +1595,6 @@ server_setattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1759,9 +1614,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_setattr_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_setattr_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1775,9 +1629,6 @@ server_fsetattr_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state  = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1797,9 +1648,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_fsetattr_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_fsetattr_rsp,
+                             xdata);
 
         return 0;
 }
@@ -1814,9 +1664,6 @@ server_xattrop_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1836,12 +1683,11 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_xattrop_rsp);
+                             (xdrproc_t)xdr_gfs3_xattrop_rsp,
+                             xdata);
 
         GF_FREE (rsp.dict.dict_val);
 
-        GF_FREE (rsp.xdata.xdata_val);
-
         return 0;
 }
 
@@ -1855,9 +1701,6 @@ server_fxattrop_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t      *state = NULL;
         rpcsvc_request_t    *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1877,12 +1720,11 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_fxattrop_rsp);
+                             (xdrproc_t)xdr_gfs3_fxattrop_rsp,
+                             xdata);
 
         GF_FREE (rsp.dict.dict_val);
 
-        GF_FREE (rsp.xdata.xdata_val);
-
         return 0;
 }
 
@@ -1899,9 +1741,6 @@ server_readdirp_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
         state = CALL_STATE (frame);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret < 0) {
                 state = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1930,9 +1769,8 @@ out:
 
         req = frame->local;
         server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gfs3_readdirp_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                             (xdrproc_t)xdr_gfs3_readdirp_rsp,
+                             xdata);
 
         readdirp_rsp_cleanup (&rsp);
 
@@ -1948,9 +1786,6 @@ server_fallocate_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t    *state = NULL;
         rpcsvc_request_t  *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state  = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -1970,9 +1805,8 @@ out:
 
         req = frame->local;
         server_submit_reply(frame, req, &rsp, NULL, 0, NULL,
-                            (xdrproc_t) xdr_gfs3_fallocate_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                            (xdrproc_t) xdr_gfs3_fallocate_rsp,
+                            xdata);
 
         return 0;
 }
@@ -1986,9 +1820,6 @@ server_discard_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
         server_state_t    *state = NULL;
         rpcsvc_request_t  *req   = NULL;
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 state  = CALL_STATE (frame);
                 gf_log (this->name, GF_LOG_INFO,
@@ -2008,9 +1839,8 @@ out:
 
         req = frame->local;
         server_submit_reply(frame, req, &rsp, NULL, 0, NULL,
-                            (xdrproc_t) xdr_gfs3_discard_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                            (xdrproc_t) xdr_gfs3_discard_rsp,
+                            xdata);
 
         return 0;
 }
@@ -2027,9 +1857,6 @@ server_zerofill_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
         req = frame->local;
         state  = CALL_STATE (frame);
 
-        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, (&rsp.xdata.xdata_val),
-                                    rsp.xdata.xdata_len, op_errno, out);
-
         if (op_ret) {
                 gf_log (this->name, GF_LOG_INFO,
                         "%"PRId64": ZEROFILL%"PRId64" (%s) ==> (%s)",
@@ -2047,9 +1874,8 @@ out:
         rsp.op_errno  = gf_errno_to_error (op_errno);
 
         server_submit_reply(frame, req, &rsp, NULL, 0, NULL,
-                            (xdrproc_t) xdr_gfs3_zerofill_rsp);
-
-        GF_FREE (rsp.xdata.xdata_val);
+                            (xdrproc_t) xdr_gfs3_zerofill_rsp,
+                            xdata);
 
         return 0;
 }
@@ -3144,11 +2970,11 @@ server3_3_stat (rpcsvc_request_t *req)
         state->resolve.type  = RESOLVE_MUST;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
 
         ret = 0;
@@ -3205,11 +3031,11 @@ server3_3_setattr (rpcsvc_request_t *req)
         gf_stat_to_iatt (&args.stbuf, &state->stbuf);
         state->valid = args.valid;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_setattr_resume);
@@ -3264,11 +3090,11 @@ server3_3_fsetattr (rpcsvc_request_t *req)
         gf_stat_to_iatt (&args.stbuf, &state->stbuf);
         state->valid = args.valid;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsetattr_resume);
@@ -3325,11 +3151,11 @@ server3_3_fallocate(rpcsvc_request_t *req)
         state->size = args.size;
         memcpy(state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fallocate_resume);
@@ -3386,11 +3212,11 @@ server3_3_discard(rpcsvc_request_t *req)
         state->size = args.size;
         memcpy(state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_discard_resume);
@@ -3447,10 +3273,10 @@ server3_3_zerofill(rpcsvc_request_t *req)
         state->size = args.size;
         memcpy(state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl, state->xdata,
-                                      (args.xdata.xdata_val),
-                                      (args.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata, (args.xdata.xdata_val),
+                                          (args.xdata.xdata_len), ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_zerofill_resume);
@@ -3504,11 +3330,11 @@ server3_3_readlink (rpcsvc_request_t *req)
 
         state->size  = args.size;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_readlink_resume);
@@ -3574,11 +3400,11 @@ server3_3_create (rpcsvc_request_t *req)
         }
 
         /* TODO: can do alloca for xdata field instead of stdalloc */
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_create_resume);
@@ -3633,11 +3459,11 @@ server3_3_open (rpcsvc_request_t *req)
 
         state->flags = gf_flags_to_flags (args.flags);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_open_resume);
@@ -3693,11 +3519,11 @@ server3_3_readv (rpcsvc_request_t *req)
 
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_readv_resume);
@@ -3774,11 +3600,11 @@ server3_3_writev (rpcsvc_request_t *req)
                 state->size += state->payload_vector[i].iov_len;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
 #ifdef GF_TESTING_IO_XDATA
         dict_dump (state->xdata);
@@ -3888,7 +3714,7 @@ server3_3_release (rpcsvc_request_t *req)
         gf_fd_put (serv_ctx->fdtable, args.fd);
 
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
+                             (xdrproc_t)xdr_gf_common_rsp, NULL);
 
         ret = 0;
 out:
@@ -3929,7 +3755,7 @@ server3_3_releasedir (rpcsvc_request_t *req)
         gf_fd_put (serv_ctx->fdtable, args.fd);
 
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
+                             (xdrproc_t)xdr_gf_common_rsp, NULL);
 
         ret = 0;
 out:
@@ -3977,11 +3803,11 @@ server3_3_fsync (rpcsvc_request_t *req)
         state->flags         = args.data;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsync_resume);
@@ -4035,11 +3861,11 @@ server3_3_flush (rpcsvc_request_t *req)
         state->resolve.fd_no = args.fd;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_flush_resume);
@@ -4094,11 +3920,11 @@ server3_3_ftruncate (rpcsvc_request_t *req)
         state->offset         = args.offset;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_ftruncate_resume);
@@ -4151,11 +3977,11 @@ server3_3_fstat (rpcsvc_request_t *req)
         state->resolve.fd_no   = args.fd;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fstat_resume);
@@ -4208,11 +4034,11 @@ server3_3_truncate (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->offset        = args.offset;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_truncate_resume);
@@ -4270,11 +4096,11 @@ server3_3_unlink (rpcsvc_request_t *req)
 
         state->flags = args.xflags;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_unlink_resume);
@@ -4341,11 +4167,11 @@ server3_3_setxattr (rpcsvc_request_t *req)
         /* There can be some commands hidden in key, check and proceed */
         gf_server_check_setxattr_cmd (frame, dict);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_setxattr_resume);
@@ -4415,11 +4241,11 @@ server3_3_fsetxattr (rpcsvc_request_t *req)
 
         state->dict = dict;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsetxattr_resume);
@@ -4489,11 +4315,11 @@ server3_3_fxattrop (rpcsvc_request_t *req)
 
         state->dict = dict;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fxattrop_resume);
@@ -4564,11 +4390,11 @@ server3_3_xattrop (rpcsvc_request_t *req)
 
         state->dict = dict;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_xattrop_resume);
@@ -4633,11 +4459,11 @@ server3_3_getxattr (rpcsvc_request_t *req)
                 gf_server_check_getxattr_cmd (frame, state->name);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_getxattr_resume);
@@ -4694,11 +4520,11 @@ server3_3_fgetxattr (rpcsvc_request_t *req)
         if (args.namelen)
                 state->name = gf_strdup (args.name);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fgetxattr_resume);
@@ -4754,11 +4580,11 @@ server3_3_removexattr (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->name           = gf_strdup (args.name);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_removexattr_resume);
@@ -4813,11 +4639,11 @@ server3_3_fremovexattr (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->name           = gf_strdup (args.name);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fremovexattr_resume);
@@ -4871,11 +4697,11 @@ server3_3_opendir (rpcsvc_request_t *req)
         state->resolve.type   = RESOLVE_MUST;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_opendir_resume);
@@ -4942,11 +4768,11 @@ server3_3_readdirp (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
 
         /* here, dict itself works as xdata */
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->dict,
-                                      (args.dict.dict_val),
-                                      (args.dict.dict_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->dict,
+                                          (args.dict.dict_val),
+                                          (args.dict.dict_len), ret,
+                                          op_errno, out);
 
 
         ret = 0;
@@ -5012,11 +4838,11 @@ server3_3_readdir (rpcsvc_request_t *req)
         state->offset = args.offset;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_readdir_resume);
@@ -5069,11 +4895,11 @@ server3_3_fsyncdir (rpcsvc_request_t *req)
         state->flags = args.data;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsyncdir_resume);
@@ -5133,11 +4959,11 @@ server3_3_mknod (rpcsvc_request_t *req)
         state->dev   = args.dev;
         state->umask = args.umask;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_mknod_resume);
@@ -5199,11 +5025,11 @@ server3_3_mkdir (rpcsvc_request_t *req)
         state->umask = args.umask;
 
         /* TODO: can do alloca for xdata field instead of stdalloc */
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_mkdir_resume);
@@ -5261,11 +5087,11 @@ server3_3_rmdir (rpcsvc_request_t *req)
 
         state->flags = args.xflags;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_rmdir_resume);
@@ -5351,11 +5177,11 @@ server3_3_inodelk (rpcsvc_request_t *req)
                 break;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_inodelk_resume);
@@ -5440,11 +5266,11 @@ server3_3_finodelk (rpcsvc_request_t *req)
                 break;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_finodelk_resume);
@@ -5508,11 +5334,11 @@ server3_3_entrylk (rpcsvc_request_t *req)
         state->cmd            = args.cmd;
         state->type           = args.type;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_entrylk_resume);
@@ -5573,11 +5399,11 @@ server3_3_fentrylk (rpcsvc_request_t *req)
                 state->name = gf_strdup (args.name);
         state->volume = gf_strdup (args.volume);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_fentrylk_resume);
@@ -5629,11 +5455,11 @@ server3_3_access (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->mask          = args.mask;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_access_resume);
@@ -5692,11 +5518,11 @@ server3_3_symlink (rpcsvc_request_t *req)
         state->name           = gf_strdup (args.linkname);
         state->umask          = args.umask;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_symlink_resume);
@@ -5756,11 +5582,11 @@ server3_3_link (rpcsvc_request_t *req)
         state->resolve2.bname  = gf_strdup (args.newbname);
         memcpy (state->resolve2.pargfid, args.newgfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_link_resume);
@@ -5820,11 +5646,11 @@ server3_3_rename (rpcsvc_request_t *req)
         state->resolve2.bname = gf_strdup (args.newbname);
         memcpy (state->resolve2.pargfid, args.newgfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_rename_resume);
@@ -5923,11 +5749,11 @@ server3_3_lk (rpcsvc_request_t *req)
         }
 
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_lk_resume);
@@ -5983,11 +5809,11 @@ server3_3_rchecksum (rpcsvc_request_t *req)
         state->offset        = args.offset;
         state->size          = args.len;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_rchecksum_resume);
@@ -6009,7 +5835,7 @@ server_null (rpcsvc_request_t *req)
         rsp.op_ret = 0;
 
         server_submit_reply (NULL, req, &rsp, NULL, 0, NULL,
-                             (xdrproc_t)xdr_gf_common_rsp);
+                             (xdrproc_t)xdr_gf_common_rsp, NULL);
 
         return 0;
 }
@@ -6121,11 +5947,11 @@ server3_3_statfs (rpcsvc_request_t *req)
         state->resolve.type   = RESOLVE_MUST;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_REF (frame->root->client->bound_xl,
+                                          state->xdata,
+                                          args.xdata.xdata_val,
+                                          args.xdata.xdata_len, ret,
+                                          op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_statfs_resume);
@@ -25,6 +25,13 @@
 #include "statedump.h"
 #include "defaults.h"
 #include "authenticate.h"
+#include "upcall-utils.h"
+
+rpcsvc_cbk_program_t server_cbk_prog = {
+        .progname  = "Gluster Callback",
+        .prognum   = GLUSTER_CBK_PROGRAM,
+        .progver   = GLUSTER_CBK_VERSION,
+};
 
 void
 grace_time_handler (void *data)
@@ -82,7 +89,7 @@ out:
 
 struct iobuf *
 gfs_serialize_reply (rpcsvc_request_t *req, void *arg, struct iovec *outmsg,
-                     xdrproc_t xdrproc)
+                     xdrproc_t xdrproc, dict_t *xdata)
 {
         struct iobuf *iob      = NULL;
         ssize_t       retlen   = 0;
@@ -94,7 +101,7 @@ gfs_serialize_reply (rpcsvc_request_t *req, void *arg, struct iovec *outmsg,
          * be serialized.
          */
         if (arg && xdrproc) {
-                xdr_size = xdr_sizeof (xdrproc, arg);
+                xdr_size = xdr_sizeof_xdata (xdrproc, arg, xdata);
                 iob = iobuf_get2 (req->svc->ctx->iobuf_pool, xdr_size);
                 if (!iob) {
                         gf_log_callingfn (THIS->name, GF_LOG_ERROR,
@@ -110,7 +117,17 @@ gfs_serialize_reply (rpcsvc_request_t *req, void *arg, struct iovec *outmsg,
                  * need -1 for error notification during encoding.
                  */
 
-                retlen = xdr_serialize_generic (*outmsg, arg, xdrproc);
+                retlen = xdr_serialize_generic_xdata (*outmsg, arg, xdrproc,
+                                                      xdata);
+                if (retlen == -1 && xdata) {
+                        /* the reply itself still goes out, only without
+                           the extra data which could not be encoded */
+                        gf_log_callingfn (THIS->name, GF_LOG_WARNING,
+                                          "Failed to encode xdata of the "
+                                          "reply, sending it without");
+                        retlen = xdr_serialize_generic (*outmsg, arg,
+                                                        xdrproc);
+                }
                 if (retlen == -1) {
                         /* Failed to Encode 'GlusterFS' msg in RPC is not exactly
                            failure of RPC return values.. client should get
@@ -133,7 +150,7 @@ ret:
 int
 server_submit_reply (call_frame_t *frame, rpcsvc_request_t *req, void *arg,
                      struct iovec *payload, int payloadcount,
-                     struct iobref *iobref, xdrproc_t xdrproc)
+                     struct iobref *iobref, xdrproc_t xdrproc, dict_t *xdata)
 {
         struct iobuf           *iob        = NULL;
         int                     ret        = -1;
@@ -164,7 +181,7 @@ server_submit_reply (call_frame_t *frame, rpcsvc_request_t *req, void *arg,
                 new_iobref = 1;
         }
 
-        iob = gfs_serialize_reply (req, arg, &rsp, xdrproc);
+        iob = gfs_serialize_reply (req, arg, &rsp, xdrproc, xdata);
         if (!iob) {
                 gf_log ("", GF_LOG_ERROR, "Failed to serialize reply");
                 goto ret;
@@ -756,6 +773,11 @@ reconfigure (xlator_t *this, dict_t *options)
                 goto out;
         }
 
+        GF_OPTION_RECONF ("event-threads", conf->event_threads, options,
+                          int32, out);
+        event_request_threads (this->ctx->event_pool, EVENT_THREADS_SERVER,
+                               conf->event_threads);
+
         rpc_conf = conf->rpc;
         if (!rpc_conf) {
                 gf_log (this->name, GF_LOG_ERROR, "No rpc_conf !!!!");
@@ -896,6 +918,10 @@ init (xlator_t *this)
                 goto out;
         }
 
+        GF_OPTION_INIT ("event-threads", conf->event_threads, int32, out);
+        event_request_threads (this->ctx->event_pool, EVENT_THREADS_SERVER,
+                               conf->event_threads);
+
         /* RPC related */
         conf->rpc = rpcsvc_init (this, this->ctx, this->options, 0);
         if (conf->rpc == NULL) {
@@ -1032,6 +1058,87 @@ fini (xlator_t *this)
         return;
 }
 
+/* Sends the upcall to the one client it is meant for, over whichever of
+ * its transports is found first. A client which has gone away meanwhile
+ * is not an error, it has nothing left to invalidate.
+ */
+int
+server_process_event_upcall (xlator_t *this, void *data)
+{
+        server_conf_t                         *conf    = NULL;
+        rpc_transport_t                       *xprt    = NULL;
+        client_t                              *client  = NULL;
+        struct gf_upcall                      *upcall  = NULL;
+        struct gf_upcall_cache_invalidation   *ca_data = NULL;
+        gfs3_cbk_cache_invalidation_req        req     = {{0,},};
+        char                                   buf[64] = {0,};
+        struct iovec                           iov     = {0,};
+        int                                    ret     = -1;
+
+        GF_VALIDATE_OR_GOTO ("server", this, out);
+        GF_VALIDATE_OR_GOTO (this->name, data, out);
+
+        conf = this->private;
+        GF_VALIDATE_OR_GOTO (this->name, conf, out);
+
+        upcall = data;
+        if (!upcall->client_uid)
+                goto out;
+
+        switch (upcall->event_type) {
+        case GF_UPCALL_CACHE_INVALIDATION:
+                ca_data = upcall->data;
+                GF_VALIDATE_OR_GOTO (this->name, ca_data, out);
+
+                memcpy (req.gfid, upcall->gfid, 16);
+                req.event_type = upcall->event_type;
+                req.flags = ca_data->flags;
+                req.expire_time_attr = ca_data->expire_time_attr;
+                break;
+        default:
+                gf_log (this->name, GF_LOG_WARNING,
+                        "unknown upcall event type %d", upcall->event_type);
+                goto out;
+        }
+
+        iov.iov_base = buf;
+        iov.iov_len = sizeof (buf);
+        ret = xdr_serialize_generic (iov, &req,
+                                     (xdrproc_t)xdr_gfs3_cbk_cache_invalidation_req);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "failed to serialize upcall for %s",
+                        upcall->client_uid);
+                goto out;
+        }
+        iov.iov_len = ret;
+
+        ret = -1;
+        pthread_mutex_lock (&conf->mutex);
+        {
+                list_for_each_entry (xprt, &conf->xprt_list, list) {
+                        client = xprt->xl_private;
+
+                        if (!client || !client->client_uid ||
+                            strcmp (client->client_uid, upcall->client_uid))
+                                continue;
+
+                        ret = rpcsvc_callback_submit (conf->rpc, xprt,
+                                                      &server_cbk_prog,
+                                                      GF_CBK_CACHE_INVALIDATION,
+                                                      &iov, 1);
+                        break;
+                }
+        }
+        pthread_mutex_unlock (&conf->mutex);
+
+        if (ret < 0)
+                gf_log (this->name, GF_LOG_DEBUG, "upcall for %s not sent",
+                        upcall->client_uid);
+out:
+        return ret;
+}
+
 int
 notify (xlator_t *this, int32_t event, void *data, ...)
 {
@@ -1047,6 +1154,9 @@ notify (xlator_t *this, int32_t event, void *data, ...)
         va_end (ap);
 
         switch (event) {
+        case GF_EVENT_UPCALL:
+                server_process_event_upcall (this, data);
+                break;
         default:
                 default_notify (this, event, data);
                 break;
@@ -1191,6 +1301,16 @@ struct volume_options options[] = {
           .default_value = "2",
           .description = "Timeout in seconds for the cached groups to expire."
         },
+        { .key   = {"event-threads"},
+          .type  = GF_OPTION_TYPE_INT,
+          .min   = 1,
+          .max   = 32,
+          .default_value = "1",
+          .description = "Specifies the number of event threads to execute "
+                         "in parallel. Larger values would help process "
+                         "responses faster, depending on available processing "
+                         "power. Range 1-32 threads."
+        },
 
         { .key   = {NULL} },
 };
@@ -63,6 +63,7 @@ struct server_conf {
         gf_boolean_t            server_manage_gids; /* resolve gids on brick */
         gid_cache_t             gid_cache;
         int32_t                 gid_cache_timeout;
+        int32_t                 event_threads; /* # of epoll dispatchers */
 };
 typedef struct server_conf server_conf_t;
 
@@ -162,7 +163,7 @@ typedef struct _server_ctx {
 int
 server_submit_reply (call_frame_t *frame, rpcsvc_request_t *req, void *arg,
                      struct iovec *payload, int payloadcount,
-                     struct iobref *iobref, xdrproc_t xdrproc);
+                     struct iobref *iobref, xdrproc_t xdrproc, dict_t *xdata);
 
 int gf_server_check_setxattr_cmd (call_frame_t *frame, dict_t *dict);
 int gf_server_check_getxattr_cmd (call_frame_t *frame, const char *name);
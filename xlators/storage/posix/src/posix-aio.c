@@ -71,6 +71,9 @@ struct posix_aio_cb {
         int             fd;
         int             op;
         off_t           offset;
+        size_t          size;
+        inode_t        *inode;
+        gf_boolean_t    append;   /* O_APPEND fd, written at end of file */
 };
 
 
@@ -271,6 +274,14 @@ posix_aio_writev_complete (struct posix_aio_cb *paiocb, int res, int res2)
         prebuf = paiocb->prebuf;
         _fd = paiocb->fd;
 
+        if (paiocb->append)
+                posix_merkle_invalidate (this, paiocb->inode,
+                                         min (paiocb->offset,
+                                              (off_t) prebuf.ia_size), -1);
+        else
+                posix_merkle_invalidate (this, paiocb->inode, paiocb->offset,
+                                         paiocb->size);
+
         if (res < 0) {
                 op_ret = -1;
                 op_errno = -res;
@@ -309,6 +320,8 @@ out:
         if (paiocb) {
                 if (paiocb->iobref)
                         iobref_unref (paiocb->iobref);
+                if (paiocb->inode)
+                        inode_unref (paiocb->inode);
                 GF_FREE (paiocb);
         }
 
@@ -360,6 +373,9 @@ posix_aio_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
         paiocb->iocb.data = paiocb;
         paiocb->iocb.aio_fildes = _fd;
         paiocb->iobref = iobref_ref (iobref);
+        paiocb->size = iov_length (iov, count);
+        paiocb->inode = inode_ref (fd->inode);
+        paiocb->append = !!(pfd->flags & O_APPEND);
         paiocb->iocb.aio_lio_opcode = IO_CMD_PWRITEV;
         paiocb->iocb.aio_reqprio = 0;
         paiocb->iocb.u.v.vec = iov;
@@ -401,6 +417,8 @@ err:
         if (paiocb) {
                 if (paiocb->iobref)
                         iobref_unref (paiocb->iobref);
+                if (paiocb->inode)
+                        inode_unref (paiocb->inode);
                 GF_FREE (paiocb);
         }
 
@@ -1696,3 +1696,354 @@ posix_fsyncer (void *d)
                 }
         }
 }
+
+
+/*
+ * Checksums of tree (Merkle) rchecksum requests. A request covers a range
+ * of leaves of leaf_size bytes each, and its checksum is the checksum of
+ * the concatenated leaf checksums, so AFR can compare a large range at once
+ * and only descend into the parts that differ.
+ *
+ * The leaf checksums of the last range asked for (up to
+ * POSIX_MERKLE_MAX_LEAVES leaves) are kept in the inode context until the
+ * fd is released. Every write to the file clears the leaves it touched, so
+ * descending into a range after comparing it does not read the data again.
+ */
+
+#define POSIX_MERKLE_MAX_LEAVES      4096
+#define POSIX_MERKLE_MAX_LEAF_SIZE   (16 * GF_UNIT_MB)
+
+struct posix_merkle {
+        gf_lock_t       lock;
+        uint64_t        gen;          /* bumped by every invalidation */
+        int32_t         leaf_size;
+        off_t           base;
+        int             nleaves;      /* of the window, 0 if none */
+        int             eof_leaf;     /* first leaf cached from a short read */
+        unsigned char  *valid;        /* nleaves flags */
+        unsigned char  *sums;         /* nleaves checksums */
+};
+
+
+static struct posix_merkle *
+posix_merkle_get (xlator_t *this, inode_t *inode, gf_boolean_t create)
+{
+        struct posix_merkle *merkle = NULL;
+        uint64_t             tmp = 0;
+
+        LOCK (&inode->lock);
+        {
+                if (!__inode_ctx_get (inode, this, &tmp)) {
+                        merkle = (struct posix_merkle *)(long) tmp;
+                        goto unlock;
+                }
+
+                if (!create)
+                        goto unlock;
+
+                merkle = GF_CALLOC (1, sizeof (*merkle), gf_posix_mt_merkle_t);
+                if (!merkle)
+                        goto unlock;
+
+                LOCK_INIT (&merkle->lock);
+
+                tmp = (uint64_t)(long) merkle;
+                if (__inode_ctx_set (inode, this, &tmp)) {
+                        LOCK_DESTROY (&merkle->lock);
+                        GF_FREE (merkle);
+                        merkle = NULL;
+                }
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        return merkle;
+}
+
+
+void
+posix_merkle_forget (xlator_t *this, inode_t *inode)
+{
+        struct posix_merkle *merkle = NULL;
+        uint64_t             tmp = 0;
+
+        if (inode_ctx_del (inode, this, &tmp))
+                return;
+
+        merkle = (struct posix_merkle *)(long) tmp;
+        if (!merkle)
+                return;
+
+        LOCK_DESTROY (&merkle->lock);
+        GF_FREE (merkle->valid);
+        GF_FREE (merkle->sums);
+        GF_FREE (merkle);
+}
+
+
+/* Replaces the window of leaves by one of @nleaves leaves from @base, or by
+   none if @nleaves is 0. */
+static void
+posix_merkle_window (struct posix_merkle *merkle, int32_t leaf_size,
+                     off_t base, int nleaves)
+{
+        unsigned char *valid = NULL;
+        unsigned char *sums = NULL;
+        unsigned char *tmp = NULL;
+
+        if (nleaves) {
+                valid = GF_CALLOC (nleaves, 1, gf_posix_mt_char);
+                sums = GF_CALLOC (nleaves, GF_FAST_CHECKSUM_LENGTH,
+                                  gf_posix_mt_char);
+                if (!valid || !sums) {
+                        GF_FREE (valid);
+                        GF_FREE (sums);
+                        valid = sums = NULL;
+                        nleaves = 0;
+                }
+        }
+
+        LOCK (&merkle->lock);
+        {
+                tmp = merkle->valid;
+                merkle->valid = valid;
+                valid = tmp;
+
+                tmp = merkle->sums;
+                merkle->sums = sums;
+                sums = tmp;
+
+                merkle->leaf_size = nleaves ? leaf_size : 0;
+                merkle->base = base;
+                merkle->nleaves = nleaves;
+                merkle->eof_leaf = nleaves;
+                merkle->gen++;
+        }
+        UNLOCK (&merkle->lock);
+
+        GF_FREE (valid);
+        GF_FREE (sums);
+}
+
+
+/* Drops the leaves kept for @inode, once the fd a heal used is released. */
+void
+posix_merkle_release (xlator_t *this, inode_t *inode)
+{
+        struct posix_merkle *merkle = NULL;
+
+        merkle = posix_merkle_get (this, inode, _gf_false);
+        if (!merkle || !merkle->nleaves)
+                return;
+
+        posix_merkle_window (merkle, 0, 0, 0);
+}
+
+
+/* To be called once a write, truncate or allocation of [offset, offset +
+   len) is done, len < 0 meaning up to the end of the file. A change which
+   reaches past the end of file as it was when leaves got cached clears all
+   the leaves from there on, since it may have filled a hole up to it. */
+void
+posix_merkle_invalidate (xlator_t *this, inode_t *inode, off_t offset,
+                         off_t len)
+{
+        struct posix_merkle *merkle = NULL;
+        off_t                first = 0;
+        off_t                last = 0;
+        off_t                end = 0;
+
+        merkle = posix_merkle_get (this, inode, _gf_false);
+        if (!merkle)
+                return;
+
+        LOCK (&merkle->lock);
+        {
+                merkle->gen++;
+
+                if (!merkle->nleaves)
+                        goto unlock;
+
+                end = merkle->base +
+                        (off_t)merkle->nleaves * merkle->leaf_size;
+                if (len >= 0 && offset + len <= merkle->base)
+                        goto unlock;
+
+                first = 0;
+                if (offset > merkle->base)
+                        first = (offset - merkle->base) / merkle->leaf_size;
+
+                last = merkle->nleaves - 1;
+                if (len >= 0 && offset + len < end)
+                        last = (offset + len - 1 - merkle->base) /
+                                merkle->leaf_size;
+
+                if (merkle->eof_leaf < merkle->nleaves &&
+                    last >= merkle->eof_leaf) {
+                        if (first > merkle->eof_leaf)
+                                first = merkle->eof_leaf;
+                        last = merkle->nleaves - 1;
+                        merkle->eof_leaf = merkle->nleaves;
+                }
+
+                if (first <= last)
+                        memset (&merkle->valid[first], 0, last - first + 1);
+        }
+unlock:
+        UNLOCK (&merkle->lock);
+}
+
+
+static int
+posix_merkle_leaf (xlator_t *this, fd_t *fd, struct posix_fd *pfd,
+                   char *buf, off_t offset, int32_t len, unsigned char *sum)
+{
+        struct posix_private *priv = NULL;
+        int                   ret = 0;
+
+        priv = this->private;
+
+        LOCK (&fd->lock);
+        {
+                if (priv->aio_capable && priv->aio_init_done)
+                        __posix_fd_set_odirect (fd, pfd, 0, offset, len);
+
+                ret = pread (pfd->fd, buf, len, offset);
+        }
+        UNLOCK (&fd->lock);
+
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "pread of %d bytes returned %d (%s)",
+                        len, ret, strerror (errno));
+                return -errno;
+        }
+
+        gf_fast_checksum ((unsigned char *)buf, ret, sum);
+
+        return ret;
+}
+
+
+int
+posix_merkle_checksum (xlator_t *this, fd_t *fd, struct posix_fd *pfd,
+                       off_t offset, int32_t len, int32_t leaf_size,
+                       unsigned char *sum)
+{
+        struct posix_merkle *merkle = NULL;
+        unsigned char       *sums = NULL;
+        char                *alloc_buf = NULL;
+        char                *buf = NULL;
+        int                  nleaves = 0;
+        int                  i = 0;
+        int                  idx = 0;
+        int                  ret = 0;
+        off_t                leaf_off = 0;
+        int32_t              leaf_len = 0;
+        uint64_t             gen = 0;
+        gf_boolean_t         cached = _gf_false;
+        gf_boolean_t         moved = _gf_false;
+
+        if (leaf_size <= 0 || leaf_size > POSIX_MERKLE_MAX_LEAF_SIZE ||
+            len <= 0 || offset < 0)
+                return -EINVAL;
+
+        nleaves = (len + leaf_size - 1) / leaf_size;
+
+        sums = GF_CALLOC (nleaves, GF_FAST_CHECKSUM_LENGTH, gf_posix_mt_char);
+        if (!sums)
+                return -ENOMEM;
+
+        /* without a cache every leaf is simply read. A range outside of
+           the window becomes the new one, sized to it. */
+        merkle = posix_merkle_get (this, fd->inode, _gf_true);
+        if (merkle) {
+                LOCK (&merkle->lock);
+                {
+                        moved = (merkle->leaf_size != leaf_size ||
+                                 offset < merkle->base ||
+                                 offset >= merkle->base + (off_t)leaf_size *
+                                 merkle->nleaves);
+                }
+                UNLOCK (&merkle->lock);
+
+                if (moved)
+                        posix_merkle_window (merkle, leaf_size, offset,
+                                             min (nleaves,
+                                                  POSIX_MERKLE_MAX_LEAVES));
+        }
+
+        for (i = 0; i < nleaves; i++) {
+                leaf_off = offset + (off_t)i * leaf_size;
+                leaf_len = min (leaf_size, len - i * leaf_size);
+                cached = _gf_false;
+                idx = -1;
+
+                if (merkle) {
+                        LOCK (&merkle->lock);
+                        {
+                                if (merkle->leaf_size == leaf_size &&
+                                    leaf_len == leaf_size &&
+                                    leaf_off >= merkle->base &&
+                                    (leaf_off - merkle->base) % leaf_size == 0 &&
+                                    (leaf_off - merkle->base) / leaf_size <
+                                    merkle->nleaves)
+                                        idx = (leaf_off - merkle->base) /
+                                                leaf_size;
+
+                                if (idx >= 0 && merkle->valid[idx]) {
+                                        memcpy (sums + i * GF_FAST_CHECKSUM_LENGTH,
+                                                merkle->sums +
+                                                idx * GF_FAST_CHECKSUM_LENGTH,
+                                                GF_FAST_CHECKSUM_LENGTH);
+                                        cached = _gf_true;
+                                }
+                                gen = merkle->gen;
+                        }
+                        UNLOCK (&merkle->lock);
+                }
+
+                if (cached)
+                        continue;
+
+                if (!alloc_buf) {
+                        alloc_buf = _page_aligned_alloc (leaf_size, &buf);
+                        if (!alloc_buf) {
+                                ret = -ENOMEM;
+                                goto out;
+                        }
+                }
+
+                ret = posix_merkle_leaf (this, fd, pfd, buf, leaf_off,
+                                         leaf_len,
+                                         sums + i * GF_FAST_CHECKSUM_LENGTH);
+                if (ret < 0)
+                        goto out;
+
+                if (idx < 0)
+                        continue;
+
+                /* a write since the lookup may have raced with the read */
+                LOCK (&merkle->lock);
+                {
+                        if (merkle->gen == gen) {
+                                memcpy (merkle->sums +
+                                        idx * GF_FAST_CHECKSUM_LENGTH,
+                                        sums + i * GF_FAST_CHECKSUM_LENGTH,
+                                        GF_FAST_CHECKSUM_LENGTH);
+                                merkle->valid[idx] = 1;
+                                if (ret < leaf_len && idx < merkle->eof_leaf)
+                                        merkle->eof_leaf = idx;
+                        }
+                }
+                UNLOCK (&merkle->lock);
+        }
+
+        gf_fast_checksum (sums, nleaves * GF_FAST_CHECKSUM_LENGTH, sum);
+        ret = 0;
+out:
+        GF_FREE (alloc_buf);
+        GF_FREE (sums);
+
+        return ret;
+}
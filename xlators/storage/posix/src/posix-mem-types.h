@@ -21,6 +21,7 @@ enum gf_posix_mem_types_ {
         gf_posix_mt_posix_dev_t,
         gf_posix_mt_trash_path,
 	gf_posix_mt_paiocb,
+        gf_posix_mt_merkle_t,
         gf_posix_mt_end
 };
 #endif
@@ -82,9 +82,7 @@ extern char *marker_xattrs[];
 int
 posix_forget (xlator_t *this, inode_t *inode)
 {
-        uint64_t tmp_cache = 0;
-        if (!inode_ctx_del (inode, this, &tmp_cache))
-                dict_destroy ((dict_t *)(long)tmp_cache);
+        posix_merkle_forget (this, inode);
 
         return 0;
 }
@@ -606,6 +604,7 @@ posix_do_fallocate(call_frame_t *frame, xlator_t *this, fd_t *fd, int32_t flags,
         }
 
 	ret = sys_fallocate(pfd->fd, flags, offset, len);
+        posix_merkle_invalidate (this, fd->inode, offset, len);
 	if (ret == -1) {
 		ret = -errno;
 		goto out;
@@ -758,6 +757,7 @@ posix_do_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd,
                 goto out;
         }
         ret = _posix_do_zerofill(pfd->fd, offset, len, pfd->flags & O_DIRECT);
+        posix_merkle_invalidate (this, fd->inode, offset, len);
         if (ret < 0) {
                 ret = -errno;
                 gf_log(this->name, GF_LOG_ERROR,
@@ -2157,6 +2157,8 @@ posix_truncate (call_frame_t *frame, xlator_t *this, loc_t *loc, off_t offset,
         }
 
         op_ret = truncate (real_path, offset);
+        if (loc->inode)
+                posix_merkle_invalidate (this, loc->inode, 0, -1);
         if (op_ret == -1) {
                 op_errno = errno;
                 gf_log (this->name, GF_LOG_ERROR,
@@ -2739,6 +2741,15 @@ posix_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
 
         op_ret = __posix_writev (_fd, vector, count, offset,
                                  (pfd->flags & O_DIRECT));
+        /* on an O_APPEND fd the write lands at the end of file, wherever
+           offset points */
+        if (pfd->flags & O_APPEND)
+                posix_merkle_invalidate (this, fd->inode,
+                                         min (offset,
+                                              (off_t) preop.ia_size), -1);
+        else
+                posix_merkle_invalidate (this, fd->inode, offset,
+                                         iov_length (vector, count));
 
 	if (locked) {
 		UNLOCK (&fd->inode->lock);
@@ -2907,6 +2918,8 @@ posix_release (xlator_t *this, fd_t *fd)
                         pfd->dir, fd);
         }
 
+        posix_merkle_release (this, fd->inode);
+
         pthread_mutex_lock (&priv->janitor_lock);
         {
                 INIT_LIST_HEAD (&pfd->list);
@@ -4664,6 +4677,7 @@ posix_ftruncate (call_frame_t *frame, xlator_t *this,
         }
 
         op_ret = ftruncate (_fd, offset);
+        posix_merkle_invalidate (this, fd->inode, 0, -1);
 
         if (op_ret == -1) {
                 op_errno = errno;
@@ -5186,6 +5200,8 @@ posix_rchecksum (call_frame_t *frame, xlator_t *this,
         int32_t                 weak_checksum   = 0;
         unsigned char           strong_checksum[MD5_DIGEST_LENGTH] = {0};
         struct posix_private    *priv           = NULL;
+        int32_t                 leaf_size       = 0;
+        dict_t                  *rsp_xdata      = NULL;
 
         VALIDATE_OR_GOTO (frame, out);
         VALIDATE_OR_GOTO (this, out);
@@ -5194,12 +5210,6 @@ posix_rchecksum (call_frame_t *frame, xlator_t *this,
         priv = this->private;
         memset (strong_checksum, 0, MD5_DIGEST_LENGTH);
 
-        alloc_buf = _page_aligned_alloc (len, &buf);
-        if (!alloc_buf) {
-                op_errno = ENOMEM;
-                goto out;
-        }
-
         ret = posix_fd_ctx_get (fd, this, &pfd);
         if (ret < 0) {
                 gf_log (this->name, GF_LOG_WARNING,
@@ -5210,6 +5220,37 @@ posix_rchecksum (call_frame_t *frame, xlator_t *this,
 
         _fd = pfd->fd;
 
+        /* A tree checksum of the range, built from cached leaf checksums.
+           The reply carries the key back so that the caller can tell it
+           from the MD5 of older bricks. */
+        if (xdata && !dict_get_int32 (xdata, GLUSTERFS_RCHECKSUM_TREE,
+                                      &leaf_size)) {
+                ret = posix_merkle_checksum (this, fd, pfd, offset, len,
+                                             leaf_size, strong_checksum);
+                if (ret == 0) {
+                        rsp_xdata = dict_new ();
+                        if (!rsp_xdata ||
+                            dict_set_int32 (rsp_xdata, GLUSTERFS_RCHECKSUM_TREE,
+                                            leaf_size)) {
+                                op_errno = ENOMEM;
+                                goto out;
+                        }
+                        op_ret = 0;
+                        goto out;
+                }
+                if (ret != -EINVAL) {
+                        op_errno = -ret;
+                        goto out;
+                }
+                memset (strong_checksum, 0, MD5_DIGEST_LENGTH);
+        }
+
+        alloc_buf = _page_aligned_alloc (len, &buf);
+        if (!alloc_buf) {
+                op_errno = ENOMEM;
+                goto out;
+        }
+
         LOCK (&fd->lock);
         {
                 if (priv->aio_capable && priv->aio_init_done)
@@ -5236,9 +5277,11 @@ posix_rchecksum (call_frame_t *frame, xlator_t *this,
         op_ret = 0;
 out:
         STACK_UNWIND_STRICT (rchecksum, frame, op_ret, op_errno,
-                             weak_checksum, strong_checksum, NULL);
+                             weak_checksum, strong_checksum, rsp_xdata);
 
         GF_FREE (alloc_buf);
+        if (rsp_xdata)
+                dict_unref (rsp_xdata);
 
         return 0;
 }
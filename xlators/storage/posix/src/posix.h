@@ -232,4 +232,22 @@ posix_get_ancestry (xlator_t *this, inode_t *leaf_inode,
 void
 posix_gfid_unset (xlator_t *this, dict_t *xdata);
 
+char *
+_page_aligned_alloc (size_t size, char **aligned_buf);
+
+int
+posix_merkle_checksum (xlator_t *this, fd_t *fd, struct posix_fd *pfd,
+                       off_t offset, int32_t len, int32_t leaf_size,
+                       unsigned char *sum);
+
+void
+posix_merkle_invalidate (xlator_t *this, inode_t *inode, off_t offset,
+                         off_t len);
+
+void
+posix_merkle_release (xlator_t *this, inode_t *inode);
+
+void
+posix_merkle_forget (xlator_t *this, inode_t *inode);
+
 #endif /* _POSIX_H */